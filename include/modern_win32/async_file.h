@@ -0,0 +1,403 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_ASYNC_FILE_H_
+#define MODERN_WIN32_ASYNC_FILE_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <type_traits>
+#include <vector>
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/awaitable.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/virtual_arena.h>
+#include <modern_win32/windows_result.h>
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+#include <span>
+#endif
+
+namespace modern_win32
+{
+    enum class async_file_access
+    {
+        /// <summary>
+        /// the file must exist and is shared with other readers and writers
+        /// </summary>
+        read,
+
+        /// <summary>
+        /// the file is created if it does not exist and shared with readers
+        /// </summary>
+        write,
+
+        /// <summary>
+        /// the file is created if it does not exist and shared with readers
+        /// </summary>
+        read_write,
+    };
+
+    /// <summary>
+    /// page aligned buffer whose size is a whole number of pages, meeting the alignment unbuffered I/O requires of
+    /// buffers, offsets and lengths as well as the one page per segment required by scatter/gather I/O
+    /// </summary>
+    class MODERN_WIN32_EXPORT io_buffer final
+    {
+    public:
+        /// <summary>
+        /// allocates at least <paramref name="size"/> bytes of zero filled memory, rounded up to whole pages
+        /// </summary>
+        /// <exception cref="windows_exception">if the memory could not be allocated</exception>
+        explicit io_buffer(std::size_t size);
+        io_buffer(io_buffer const&) = delete;
+        io_buffer(io_buffer&&) noexcept = default;
+        ~io_buffer() = default;
+        io_buffer& operator=(io_buffer const&) = delete;
+        io_buffer& operator=(io_buffer&&) noexcept = default;
+
+        [[nodiscard]]
+        std::byte* data() const noexcept;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        /// <summary>
+        /// returns the number of pages in the buffer
+        /// </summary>
+        [[nodiscard]]
+        std::size_t page_count() const noexcept;
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+        [[nodiscard]]
+        std::span<std::byte> as_span() const noexcept
+        {
+            return std::span<std::byte>(data(), size());
+        }
+#endif
+
+        /// <summary>
+        /// returns the system page size, buffers, segments and scatter/gather lengths are multiples of it
+        /// </summary>
+        [[nodiscard]]
+        static std::size_t page_size() noexcept;
+
+    private:
+        virtual_memory_handle memory_;
+        std::size_t size_{};
+    };
+
+    /// <summary>
+    /// list of pages read into or written from by <see cref="async_file::read_scatter"/> and
+    /// <see cref="async_file::write_gather"/>, the pages must stay valid until the operation completes
+    /// </summary>
+    class MODERN_WIN32_EXPORT io_segment_list final
+    {
+    public:
+        io_segment_list();
+
+        /// <summary>
+        /// adds every page of <paramref name="buffer"/>
+        /// </summary>
+        void add(io_buffer const& buffer);
+
+        /// <summary>
+        /// adds the page starting at <paramref name="page"/>
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if <paramref name="page"/> is not page aligned</exception>
+        void add_page(void* page);
+
+        void clear() noexcept;
+
+        [[nodiscard]]
+        std::size_t page_count() const noexcept;
+
+        /// <summary>
+        /// returns the number of bytes transferred by an operation on every page
+        /// </summary>
+        [[nodiscard]]
+        std::size_t byte_count() const noexcept;
+
+        /// <summary>
+        /// returns the null terminated segment array passed to ReadFileScatter and WriteFileGather
+        /// </summary>
+        [[nodiscard]]
+        FILE_SEGMENT_ELEMENT* data() noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<FILE_SEGMENT_ELEMENT> segments_;
+#       pragma warning(pop)
+    };
+
+    /// <summary>
+    /// state of a single overlapped operation on an <see cref="async_file"/>, owned by the caller which must keep it
+    /// alive, and not start another operation with it, until <see cref="callback"/> has been invoked
+    /// </summary>
+    struct async_file_request final
+    {
+        using completion_callback = void (*)(async_file_request& request) noexcept;
+
+        OVERLAPPED overlapped{};
+
+        /// <summary>
+        /// invoked on an executor thread once the operation has completed, <see cref="error"/> and
+        /// <see cref="bytes_transferred"/> hold its result
+        /// </summary>
+        completion_callback callback{};
+        void* context{};
+
+        /// <summary>
+        /// Win32 error the operation completed with, ERROR_SUCCESS if it succeeded and ERROR_HANDLE_EOF if a read
+        /// started at or past the end of the file
+        /// </summary>
+        DWORD error{};
+        DWORD bytes_transferred{};
+
+        [[nodiscard]]
+        bool succeeded() const noexcept
+        {
+            return error == ERROR_SUCCESS;
+        }
+    };
+    static_assert(std::is_standard_layout_v<async_file_request>, "request must be recoverable from its OVERLAPPED");
+
+    /// <summary>
+    /// file opened for overlapped I/O whose completions are delivered through an
+    /// <see cref="threading::io_completion_executor"/>, any number of reads and writes at explicit offsets may be in
+    /// flight at once
+    /// </summary>
+    /// <remarks>
+    /// unbuffered files bypass the system cache; every buffer address, offset and length must then be a multiple
+    /// of <see cref="sector_size"/>, which <see cref="io_buffer"/> always satisfies.  The destructor cancels
+    /// outstanding operations and waits for their completions, so the executor must still be running.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT async_file final : public threading::io_completion_handler
+    {
+    public:
+        using native_handle_type = invalid_handle::native_handle_type;
+
+        /// <summary>
+        /// opens <paramref name="path"/> for overlapped I/O and associates it with <paramref name="executor"/>
+        /// </summary>
+        /// <param name="path">the file to open</param>
+        /// <param name="access">requested access, write access creates the file if it does not exist</param>
+        /// <param name="executor">executor on whose threads completions are delivered, must outlive the file</param>
+        /// <param name="unbuffered">if true the file is opened with FILE_FLAG_NO_BUFFERING</param>
+        /// <exception cref="windows_exception">if the file could not be opened or associated with the executor</exception>
+        explicit async_file(std::filesystem::path const& path, async_file_access access, threading::io_completion_executor& executor, bool unbuffered = true);
+        async_file(async_file const&) = delete;
+        async_file(async_file&&) noexcept = delete;
+        ~async_file() override;
+        async_file& operator=(async_file const&) = delete;
+        async_file& operator=(async_file&&) noexcept = delete;
+
+        /// <summary>
+        /// starts reading <paramref name="length"/> bytes at <paramref name="offset"/> into <paramref name="buffer"/>
+        /// </summary>
+        /// <returns>
+        /// true if the operation was started and <paramref name="request"/> will complete; otherwise, false with the
+        /// error available from GetLastError
+        /// </returns>
+        [[nodiscard]]
+        bool read(std::uint64_t offset, void* buffer, DWORD length, async_file_request& request) noexcept;
+
+        /// <summary>
+        /// starts writing <paramref name="length"/> bytes from <paramref name="buffer"/> at <paramref name="offset"/>
+        /// </summary>
+        /// <returns><see cref="read"/></returns>
+        [[nodiscard]]
+        bool write(std::uint64_t offset, void const* buffer, DWORD length, async_file_request& request) noexcept;
+
+        /// <summary>
+        /// starts reading consecutive pages of the file at <paramref name="offset"/> into each page of
+        /// <paramref name="segments"/> with a single ReadFileScatter, the file must be unbuffered
+        /// </summary>
+        /// <returns><see cref="read"/></returns>
+        [[nodiscard]]
+        bool read_scatter(std::uint64_t offset, io_segment_list& segments, async_file_request& request) noexcept;
+
+        /// <summary>
+        /// starts writing each page of <paramref name="segments"/> to consecutive pages of the file at
+        /// <paramref name="offset"/> with a single WriteFileGather, the file must be unbuffered
+        /// </summary>
+        /// <returns><see cref="read"/></returns>
+        [[nodiscard]]
+        bool write_gather(std::uint64_t offset, io_segment_list& segments, async_file_request& request) noexcept;
+
+        /// <summary>
+        /// requests cancellation of the operation using <paramref name="request"/>, which still completes, with
+        /// ERROR_OPERATION_ABORTED if it was cancelled
+        /// </summary>
+        /// <returns>true if the operation was found; otherwise, false</returns>
+        [[maybe_unused]]
+        bool cancel(async_file_request& request) const noexcept;
+
+        /// <summary>
+        /// returns the size of the file in bytes
+        /// </summary>
+        /// <exception cref="windows_exception">if the size could not be read</exception>
+        [[nodiscard]]
+        std::uint64_t size() const;
+
+        /// <summary>
+        /// sets the end of the file to <paramref name="size"/>, trimming the padding left by unbuffered writes of
+        /// whole sectors or extending the file ahead of writes
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_size(std::uint64_t size) const noexcept;
+
+        /// <summary>
+        /// returns the sector size unbuffered I/O must be aligned to for best performance
+        /// </summary>
+        [[nodiscard]]
+        std::size_t sector_size() const noexcept;
+
+        [[nodiscard]]
+        bool is_unbuffered() const noexcept;
+
+        /// <summary>
+        /// returns the number of operations started which have yet to complete
+        /// </summary>
+        [[nodiscard]]
+        std::size_t outstanding() const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+        void on_completion(threading::io_completion const& completion) noexcept override;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        invalid_handle file_;
+        std::atomic<std::uint32_t> outstanding_{};
+#       pragma warning(pop)
+        std::size_t sector_size_{};
+        bool unbuffered_{};
+
+        [[nodiscard]]
+        OVERLAPPED* prepare(std::uint64_t offset, async_file_request& request) noexcept;
+
+        [[nodiscard]]
+        bool started(BOOL result) noexcept;
+    };
+
+#ifdef MODERN_WIN32_HAS_COROUTINES
+
+    /// <summary>
+    /// awaitable which starts an operation on an <see cref="async_file"/> when awaited and resumes the awaiting
+    /// coroutine on an executor thread once it completes
+    /// </summary>
+    class MODERN_WIN32_EXPORT async_file_awaitable final
+    {
+    public:
+        enum class operation
+        {
+            read,
+            write,
+            read_scatter,
+            write_gather,
+        };
+
+        explicit async_file_awaitable(async_file& file, operation op, std::uint64_t offset, void* buffer, DWORD length) noexcept;
+        explicit async_file_awaitable(async_file& file, operation op, std::uint64_t offset, io_segment_list& segments) noexcept;
+        async_file_awaitable(async_file_awaitable const&) = delete;
+        async_file_awaitable(async_file_awaitable&&) noexcept = delete;
+        ~async_file_awaitable() = default;
+        async_file_awaitable& operator=(async_file_awaitable const&) = delete;
+        async_file_awaitable& operator=(async_file_awaitable&&) noexcept = delete;
+
+        [[nodiscard]]
+        constexpr bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        /// <summary>
+        /// starts the operation, completing without suspending if it could not be started
+        /// </summary>
+        [[nodiscard]]
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+
+        /// <summary>
+        /// returns the number of bytes transferred, or the error the operation failed with
+        /// </summary>
+        [[nodiscard]]
+        windows_result<DWORD> await_resume() const noexcept;
+
+    private:
+        async_file& file_;
+        operation operation_;
+        std::uint64_t offset_;
+        void* buffer_{};
+        DWORD length_{};
+        io_segment_list* segments_{};
+        std::coroutine_handle<> continuation_{};
+        async_file_request request_{};
+
+        static void on_complete(async_file_request& request) noexcept;
+    };
+
+    /// <summary>
+    /// returns an awaitable reading <paramref name="length"/> bytes at <paramref name="offset"/> into <paramref name="buffer"/>
+    /// </summary>
+    [[nodiscard]]
+    inline async_file_awaitable async_read(async_file& file, std::uint64_t const offset, void* const buffer, DWORD const length) noexcept
+    {
+        return async_file_awaitable(file, async_file_awaitable::operation::read, offset, buffer, length);
+    }
+
+    /// <summary>
+    /// returns an awaitable writing <paramref name="length"/> bytes from <paramref name="buffer"/> at <paramref name="offset"/>
+    /// </summary>
+    [[nodiscard]]
+    inline async_file_awaitable async_write(async_file& file, std::uint64_t const offset, void const* const buffer, DWORD const length) noexcept
+    {
+        return async_file_awaitable(file, async_file_awaitable::operation::write, offset, const_cast<void*>(buffer), length);
+    }
+
+    /// <summary>
+    /// returns an awaitable reading consecutive pages at <paramref name="offset"/> into <paramref name="segments"/>
+    /// </summary>
+    [[nodiscard]]
+    inline async_file_awaitable async_read_scatter(async_file& file, std::uint64_t const offset, io_segment_list& segments) noexcept
+    {
+        return async_file_awaitable(file, async_file_awaitable::operation::read_scatter, offset, segments);
+    }
+
+    /// <summary>
+    /// returns an awaitable writing <paramref name="segments"/> to consecutive pages at <paramref name="offset"/>
+    /// </summary>
+    [[nodiscard]]
+    inline async_file_awaitable async_write_gather(async_file& file, std::uint64_t const offset, io_segment_list& segments) noexcept
+    {
+        return async_file_awaitable(file, async_file_awaitable::operation::write_gather, offset, segments);
+    }
+
+#endif
+
+}
+
+#endif
+#endif
@@ -16,7 +16,9 @@
 #ifdef _WIN32
 
 #include <Windows.h>
+#include <bcrypt.h>
 #include <modern_win32/modern_win32_export.h>
+#include <modern_win32/unique_handle.h>
 
 #pragma comment (lib, "bcrypt")
 
@@ -35,6 +37,39 @@ namespace modern_win32
     [[nodiscard]]
     MODERN_WIN32_EXPORT bool bcrypt_get_random_bytes(byte* data, unsigned long length) noexcept;
 
+    /// <summary>
+    /// generates a random number using an algorithm provider previously opened with BCryptOpenAlgorithmProvider
+    /// </summary>
+    /// <param name="algorithm">an RNG algorithm provider such as the one returned by <see cref="bcrypt_rng_algorithm"/></param>
+    /// <param name="data">The address of a buffer that receives the random number.</param>
+    /// <param name="length">The size, in bytes, of the data buffer.</param>
+    /// <returns>returns true on success; otherwise, false</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool bcrypt_get_random_bytes(BCRYPT_ALG_HANDLE algorithm, byte* data, unsigned long length) noexcept;
+
+    struct bcrypt_algorithm_traits final
+    {
+        using native_handle_type = BCRYPT_ALG_HANDLE;
+
+        static constexpr native_handle_type invalid()
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const handle)
+        {
+            static_cast<void>(BCryptCloseAlgorithmProvider(handle, 0));
+        }
+    };
+    using bcrypt_algorithm_handle = unique_handle<bcrypt_algorithm_traits>;
+
+    /// <summary>
+    /// returns the process wide RNG algorithm provider, opened on first use and cached so repeated calls avoid the
+    /// provider lookup
+    /// </summary>
+    /// <returns>the provider or nullptr if it could not be opened</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT BCRYPT_ALG_HANDLE bcrypt_rng_algorithm() noexcept;
+
 }
 
 #endif
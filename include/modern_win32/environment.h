@@ -15,8 +15,14 @@
 #define MODERN_WIN32_ENVIRONMENT_H_
 #ifdef _WIN32
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <modern_win32/modern_win32_export.h>
 
 namespace modern_win32
@@ -63,18 +69,128 @@ namespace modern_win32
         return false;
     }
 
-    /*
+    /// <summary>
+    /// an environment block, the "name=value" strings each terminated by a nul and the block by a further nul, as
+    /// returned by GetEnvironmentStrings and accepted by CreateProcess
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// names and values are views into the block so reading them copies nothing; entries are iterated in block order.
+    /// A flat index sorted by name, compared case-insensitively as Windows does, gives O(log n) lookup.
+    /// </para>
+    /// <para>
+    /// the hidden per drive variables such as "=C:=C:\\" are included with names beginning with '='.
+    /// </para>
+    /// </remarks>
     template <typename TCHAR>
     class environment_block final
     {
     public:
-        explicit environment_block() = default;
+        using char_type = TCHAR;
+        using string_view_type = std::basic_string_view<TCHAR>;
+        using value_type = std::pair<string_view_type, string_view_type>;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        /// <summary>
+        /// Instantiates a new instance of the environment_block class with no variables
+        /// </summary>
+        environment_block();
+
+        /// <summary>
+        /// Instantiates a new instance of the environment_block class containing <paramref name="environment"/>
+        /// </summary>
+        explicit environment_block(environment_map<TCHAR> const& environment);
+        environment_block(environment_block const&) = delete;
+        environment_block(environment_block&& other) noexcept;
+        ~environment_block();
+        environment_block& operator=(environment_block const&) = delete;
+        environment_block& operator=(environment_block&& other) noexcept;
+
+        /// <summary>
+        /// returns the environment of the current process, the block returned by GetEnvironmentStrings is kept rather
+        /// than copied
+        /// </summary>
+        /// <exception cref="windows_exception">if GetEnvironmentStrings fails</exception>
+        [[nodiscard]]
+        static environment_block current();
+
+        /// <summary>
+        /// returns the value of <paramref name="name"/>, matched case-insensitively
+        /// </summary>
+        [[nodiscard]]
+        std::optional<string_view_type> find(string_view_type name) const noexcept;
+
+        [[nodiscard]]
+        bool contains(string_view_type const name) const noexcept
+        {
+            return find(name).has_value();
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept
+        {
+            return entries_.begin();
+        }
+        [[nodiscard]]
+        const_iterator end() const noexcept
+        {
+            return entries_.end();
+        }
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return entries_.empty();
+        }
+
+        /// <summary>
+        /// returns the block in the form CreateProcess expects
+        /// </summary>
+        [[nodiscard]]
+        TCHAR const* data() const noexcept
+        {
+            return block_;
+        }
+
+        /// <summary>
+        /// returns the number of characters in the block including every terminator
+        /// </summary>
+        [[nodiscard]]
+        std::size_t block_size() const noexcept
+        {
+            return block_size_;
+        }
+
+        /// <summary>
+        /// copies the variables into a map
+        /// </summary>
+        [[nodiscard]]
+        environment_map<TCHAR> to_map() const;
 
     private:
-        environment_map m_environment{};
+        TCHAR* block_{};
+        std::size_t block_size_{};
+        bool owned_by_system_{};
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<value_type> entries_{};
+        std::vector<std::uint32_t> sorted_{};
+#       pragma warning(pop)
+
+        environment_block(TCHAR* block, bool owned_by_system);
+        void index();
+        void release() noexcept;
     };
-    */
 
+    extern template class MODERN_WIN32_EXPORT environment_block<char>;
+    extern template class MODERN_WIN32_EXPORT environment_block<wchar_t>;
+
+    using narrow_environment_block = environment_block<char>;
+    using wide_environment_block = environment_block<wchar_t>;
 
 }
 
@@ -0,0 +1,423 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_FAST_RANDOM_H_
+#define MODERN_WIN32_FAST_RANDOM_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <modern_win32/bcrypt_random.h>
+#include <modern_win32/shared/simd.h>
+
+/// <summary>
+/// NOT CRYPTOGRAPHICALLY SECURE. fast statistical generators for simulation, sampling and load generation; output
+/// is predictable from a handful of values so never use these for keys, tokens, nonces or anything an attacker may
+/// observe, use <see cref="modern_win32::bcrypt_get_random_bytes"/> or <see cref="modern_win32::random_pool"/> instead
+/// </summary>
+namespace modern_win32::non_cryptographic
+{
+    namespace details
+    {
+        [[nodiscard]]
+        constexpr std::uint64_t rotate_left(std::uint64_t const value, int const count) noexcept
+        {
+            return value << count | value >> (64 - count);
+        }
+
+        /// <summary>
+        /// splitmix64, used to expand a single seed into a full generator state
+        /// </summary>
+        [[nodiscard]]
+        constexpr std::uint64_t split_mix(std::uint64_t& state) noexcept
+        {
+            auto value = (state += 0x9E3779B97F4A7C15ULL);
+            value = (value ^ value >> 30) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ value >> 27) * 0x94D049BB133111EBULL;
+            return value ^ value >> 31;
+        }
+    }
+
+    /// <summary>
+    /// xoshiro256** by Blackman and Vigna, a 256-bit state generator with a period of 2^256 - 1 satisfying
+    /// UniformRandomBitGenerator
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// not cryptographically secure. independent per-thread streams are made by copying a generator and calling
+    /// <see cref="jump"/> once per thread, each call advancing 2^128 values
+    /// </para>
+    /// <para>
+    /// <see cref="fill(std::uint64_t*, std::size_t)"/> interleaves four lanes spaced 2^192 values apart by
+    /// <see cref="long_jump"/>, stepping all four at once with AVX2 when the translation unit targets it; the
+    /// output is the same with or without AVX2 and never overlaps streams made with <see cref="jump"/>
+    /// </para>
+    /// </remarks>
+    class xoshiro256_star_star final
+    {
+    public:
+        using result_type = std::uint64_t;
+        using state_type = std::array<std::uint64_t, 4>;
+
+        /// <summary>
+        /// seeds the generator by expanding <paramref name="seed"/> with splitmix64
+        /// </summary>
+        constexpr explicit xoshiro256_star_star(std::uint64_t seed) noexcept
+            : state_{ details::split_mix(seed), details::split_mix(seed), details::split_mix(seed), details::split_mix(seed) }
+        {
+        }
+
+        /// <summary>
+        /// restores a generator from <paramref name="state"/>, which must not be all zero
+        /// </summary>
+        constexpr explicit xoshiro256_star_star(state_type const& state) noexcept
+            : state_(state)
+        {
+        }
+
+        /// <summary>
+        /// returns a generator seeded with 256 bits from BCryptGenRandom
+        /// </summary>
+        /// <returns>the generator or std::nullopt if random bytes could not be generated</returns>
+        [[nodiscard]]
+        static std::optional<xoshiro256_star_star> from_random_seed() noexcept
+        {
+            state_type state{};
+            do {
+                if (!bcrypt_get_random_bytes(reinterpret_cast<byte*>(state.data()), static_cast<unsigned long>(sizeof(state))))
+                    return std::nullopt;
+            } while ((state[0] | state[1] | state[2] | state[3]) == 0U);
+            return xoshiro256_star_star(state);
+        }
+
+        [[nodiscard]]
+        static constexpr result_type min() noexcept
+        {
+            return (std::numeric_limits<result_type>::min)();
+        }
+        [[nodiscard]]
+        static constexpr result_type max() noexcept
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        [[nodiscard]]
+        constexpr result_type operator()() noexcept
+        {
+            return step(state_);
+        }
+
+        /// <summary>
+        /// advances the generator by <paramref name="count"/> values
+        /// </summary>
+        constexpr void discard(unsigned long long count) noexcept
+        {
+            for (; count > 0; --count)
+                static_cast<void>(step(state_));
+        }
+
+        /// <summary>
+        /// advances the generator by 2^128 values, giving up to 2^128 non-overlapping streams
+        /// </summary>
+        constexpr void jump() noexcept
+        {
+            constexpr state_type polynomial{ 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+            apply(polynomial);
+        }
+
+        /// <summary>
+        /// advances the generator by 2^192 values, giving up to 2^64 starting points each holding 2^64
+        /// <see cref="jump"/> streams
+        /// </summary>
+        constexpr void long_jump() noexcept
+        {
+            constexpr state_type polynomial{ 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+            apply(polynomial);
+        }
+
+        /// <summary>
+        /// fills <paramref name="first"/> with <paramref name="count"/> values from four interleaved lanes, advancing
+        /// this generator by count / 4 rounded up
+        /// </summary>
+        void fill(std::uint64_t* first, std::size_t count) noexcept
+        {
+            if (count < MINIMUM_LANE_FILL) {
+                for (; count > 0; --count)
+                    *first++ = step(state_);
+                return;
+            }
+
+            std::array<state_type, LANES> lanes{ state_ };
+            for (std::size_t lane = 1; lane < LANES; ++lane) {
+                xoshiro256_star_star jumped(lanes[lane - 1]);
+                jumped.long_jump();
+                lanes[lane] = jumped.state_;
+            }
+
+            auto const rounds = count / LANES;
+            step_lanes(lanes, first, rounds);
+            first += rounds * LANES;
+            for (std::size_t lane = 0; lane < count % LANES; ++lane)
+                *first++ = step(lanes[lane]);
+
+            state_ = lanes[0];
+        }
+
+        /// <summary>
+        /// fills <paramref name="first"/> with <paramref name="length"/> random bytes
+        /// </summary>
+        void fill(byte* first, std::size_t length) noexcept
+        {
+            std::array<std::uint64_t, 256> buffer{};
+            while (length > 0) {
+                auto const bytes = (std::min)(length, sizeof(buffer));
+                auto const words = (bytes + sizeof(std::uint64_t) - 1U) / sizeof(std::uint64_t);
+                fill(buffer.data(), words);
+                std::memcpy(first, buffer.data(), bytes);
+                first += bytes;
+                length -= bytes;
+            }
+        }
+
+        [[nodiscard]]
+        constexpr state_type const& state() const noexcept
+        {
+            return state_;
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(xoshiro256_star_star const& left, xoshiro256_star_star const& right) noexcept
+        {
+            return left.state_[0] == right.state_[0] && left.state_[1] == right.state_[1] &&
+                left.state_[2] == right.state_[2] && left.state_[3] == right.state_[3];
+        }
+        [[nodiscard]]
+        friend constexpr bool operator!=(xoshiro256_star_star const& left, xoshiro256_star_star const& right) noexcept
+        {
+            return !(left == right);
+        }
+
+    private:
+        static constexpr std::size_t LANES = 4;
+
+        // below this the three long jumps needed to set up the lanes cost more than they save
+        static constexpr std::size_t MINIMUM_LANE_FILL = 256;
+
+        state_type state_;
+
+        [[nodiscard]]
+        static constexpr result_type step(state_type& state) noexcept
+        {
+            auto const result = details::rotate_left(state[1] * 5U, 7) * 9U;
+            auto const shifted = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= shifted;
+            state[3] = details::rotate_left(state[3], 45);
+            return result;
+        }
+
+        constexpr void apply(state_type const& polynomial) noexcept
+        {
+            state_type jumped{};
+            for (auto const word : polynomial) {
+                for (int bit = 0; bit < 64; ++bit) {
+                    if ((word & std::uint64_t{1} << bit) != 0U) {
+                        for (std::size_t i = 0; i < jumped.size(); ++i)
+                            jumped[i] ^= state_[i];
+                    }
+                    static_cast<void>(step(state_));
+                }
+            }
+            state_ = jumped;
+        }
+
+        static void step_lanes(std::array<state_type, LANES>& lanes, std::uint64_t* output, std::size_t const rounds) noexcept
+        {
+#       ifdef MODERN_WIN32_AVX2
+            // element k of each vector holds word i of lane k
+            auto load = [&lanes](std::size_t const word) noexcept {
+                return _mm256_set_epi64x(
+                    static_cast<long long>(lanes[3][word]), static_cast<long long>(lanes[2][word]),
+                    static_cast<long long>(lanes[1][word]), static_cast<long long>(lanes[0][word]));
+            };
+            auto rotate = [](__m256i const value, int const count) noexcept {
+                return _mm256_or_si256(_mm256_slli_epi64(value, count), _mm256_srli_epi64(value, 64 - count));
+            };
+
+            auto s0 = load(0);
+            auto s1 = load(1);
+            auto s2 = load(2);
+            auto s3 = load(3);
+            for (std::size_t round = 0; round < rounds; ++round) {
+                auto const times_five = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+                auto const rotated = rotate(times_five, 7);
+                auto const result = _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + round * LANES), result);
+
+                auto const shifted = _mm256_slli_epi64(s1, 17);
+                s2 = _mm256_xor_si256(s2, s0);
+                s3 = _mm256_xor_si256(s3, s1);
+                s1 = _mm256_xor_si256(s1, s2);
+                s0 = _mm256_xor_si256(s0, s3);
+                s2 = _mm256_xor_si256(s2, shifted);
+                s3 = rotate(s3, 45);
+            }
+
+            alignas(32) std::uint64_t words[4][LANES]{};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words[0]), s0);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words[1]), s1);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words[2]), s2);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(words[3]), s3);
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                for (std::size_t word = 0; word < 4; ++word)
+                    lanes[lane][word] = words[word][lane];
+            }
+#       else
+            for (std::size_t round = 0; round < rounds; ++round) {
+                for (std::size_t lane = 0; lane < LANES; ++lane)
+                    output[round * LANES + lane] = step(lanes[lane]);
+            }
+#       endif
+        }
+    };
+
+    /// <summary>
+    /// PCG32 (XSH RR) by O'Neill, a 64-bit state linear congruential generator with a permuted 32-bit output
+    /// satisfying UniformRandomBitGenerator
+    /// </summary>
+    /// <remarks>
+    /// not cryptographically secure. generators with different stream selectors never share a sequence, and
+    /// <see cref="advance"/> skips ahead in O(log n) for partitioning a single stream between threads
+    /// </remarks>
+    class pcg32 final
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        /// <summary>
+        /// seeds the generator as pcg32_srandom_r does, so sequences match the reference implementation
+        /// </summary>
+        constexpr explicit pcg32(std::uint64_t const seed, std::uint64_t const stream = DEFAULT_STREAM) noexcept
+            : increment_(stream << 1 | 1U)
+        {
+            static_cast<void>(step());
+            state_ += seed;
+            static_cast<void>(step());
+        }
+
+        /// <summary>
+        /// returns a generator with both seed and stream taken from BCryptGenRandom
+        /// </summary>
+        /// <returns>the generator or std::nullopt if random bytes could not be generated</returns>
+        [[nodiscard]]
+        static std::optional<pcg32> from_random_seed() noexcept
+        {
+            std::uint64_t seed[2]{};
+            if (!bcrypt_get_random_bytes(reinterpret_cast<byte*>(seed), static_cast<unsigned long>(sizeof(seed))))
+                return std::nullopt;
+            return pcg32(seed[0], seed[1]);
+        }
+
+        [[nodiscard]]
+        static constexpr result_type min() noexcept
+        {
+            return (std::numeric_limits<result_type>::min)();
+        }
+        [[nodiscard]]
+        static constexpr result_type max() noexcept
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        [[nodiscard]]
+        constexpr result_type operator()() noexcept
+        {
+            auto const previous = step();
+            auto const xor_shifted = static_cast<std::uint32_t>((previous >> 18 ^ previous) >> 27);
+            auto const rotation = static_cast<std::uint32_t>(previous >> 59);
+            return xor_shifted >> rotation | xor_shifted << ((0U - rotation) & 31U);
+        }
+
+        /// <summary>
+        /// advances the generator by <paramref name="delta"/> values in O(log delta)
+        /// </summary>
+        constexpr void advance(std::uint64_t delta) noexcept
+        {
+            std::uint64_t multiplier = MULTIPLIER;
+            std::uint64_t increment = increment_;
+            std::uint64_t accumulated_multiplier = 1U;
+            std::uint64_t accumulated_increment = 0U;
+            for (; delta > 0; delta >>= 1) {
+                if ((delta & 1U) != 0U) {
+                    accumulated_multiplier *= multiplier;
+                    accumulated_increment = accumulated_increment * multiplier + increment;
+                }
+                increment = (multiplier + 1U) * increment;
+                multiplier *= multiplier;
+            }
+            state_ = accumulated_multiplier * state_ + accumulated_increment;
+        }
+
+        constexpr void discard(unsigned long long const count) noexcept
+        {
+            advance(count);
+        }
+
+        /// <summary>
+        /// fills <paramref name="first"/> with <paramref name="count"/> values
+        /// </summary>
+        constexpr void fill(std::uint32_t* first, std::size_t count) noexcept
+        {
+            for (; count > 0; --count)
+                *first++ = (*this)();
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(pcg32 const& left, pcg32 const& right) noexcept
+        {
+            return left.state_ == right.state_ && left.increment_ == right.increment_;
+        }
+        [[nodiscard]]
+        friend constexpr bool operator!=(pcg32 const& left, pcg32 const& right) noexcept
+        {
+            return !(left == right);
+        }
+
+    private:
+        static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ULL;
+        static constexpr std::uint64_t DEFAULT_STREAM = 0xDA3E39CB94B95BDBULL >> 1;
+
+        std::uint64_t state_{};
+        std::uint64_t increment_;
+
+        constexpr std::uint64_t step() noexcept
+        {
+            auto const previous = state_;
+            state_ = previous * MULTIPLIER + increment_;
+            return previous;
+        }
+    };
+
+}
+
+#endif
+#endif
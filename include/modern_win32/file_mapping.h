@@ -0,0 +1,264 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_FILE_MAPPING_H_
+#define MODERN_WIN32_FILE_MAPPING_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/null_handle.h>
+#include <modern_win32/unique_handle.h>
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+#include <span>
+#endif
+
+namespace modern_win32
+{
+    using file_handle = invalid_handle;
+    using file_mapping_handle = null_handle;
+
+    struct mapped_view_traits final
+    {
+        using native_handle_type = void*;
+
+        static constexpr native_handle_type invalid() noexcept
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const address) noexcept
+        {
+            static_cast<void>(UnmapViewOfFile(address));
+        }
+    };
+    using mapped_view_handle = unique_handle<mapped_view_traits>;
+
+    enum class mapping_access
+    {
+        /// <summary>
+        /// views can only be read, the file is opened for reading and shared with other readers
+        /// </summary>
+        read_only,
+
+        /// <summary>
+        /// views can be written but changes are private to the view and never reach the file
+        /// </summary>
+        copy_on_write,
+
+        /// <summary>
+        /// views write through to the file, which is created if it does not exist and can be grown with
+        /// <see cref="file_mapping::grow"/>
+        /// </summary>
+        read_write,
+    };
+
+    /// <summary>
+    /// a range of a file mapped into the address space of the process, unmapped when destroyed
+    /// </summary>
+    /// <remarks>
+    /// views remain valid after the <see cref="file_mapping"/> they came from is destroyed or grown
+    /// </remarks>
+    class MODERN_WIN32_EXPORT mapped_view final
+    {
+    public:
+        explicit mapped_view() noexcept = default;
+
+        /// <summary>
+        /// takes ownership of a view mapped at <paramref name="base"/> exposing <paramref name="size"/> bytes
+        /// starting at <paramref name="data"/>, which lies within the view
+        /// </summary>
+        explicit mapped_view(mapped_view_handle&& base, std::byte* data, std::size_t size) noexcept;
+        mapped_view(mapped_view const&) = delete;
+        mapped_view(mapped_view&& other) noexcept;
+        ~mapped_view() = default;
+        mapped_view& operator=(mapped_view const&) = delete;
+        mapped_view& operator=(mapped_view&& other) noexcept;
+
+        [[nodiscard]]
+        std::byte* data() const noexcept;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        [[nodiscard]]
+        bool empty() const noexcept;
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+        /// <summary>
+        /// returns the view as a span, writing through it is only valid for copy-on-write and read-write mappings
+        /// </summary>
+        [[nodiscard]]
+        std::span<std::byte> as_span() const noexcept
+        {
+            return { data_, size_ };
+        }
+
+        [[nodiscard]]
+        std::span<std::byte const> as_const_span() const noexcept
+        {
+            return { data_, size_ };
+        }
+#endif
+
+        /// <summary>
+        /// asks the memory manager to read the whole view into memory ahead of use with a single large I/O
+        /// rather than faulting in a page at a time
+        /// </summary>
+        /// <returns>true if the request was issued; otherwise, false</returns>
+        bool prefetch() const noexcept;
+
+        /// <summary>
+        /// prefetches <paramref name="length"/> bytes of the view starting at <paramref name="offset"/>
+        /// </summary>
+        /// <returns>true if the request was issued; otherwise, false</returns>
+        bool prefetch(std::size_t offset, std::size_t length) const noexcept;
+
+        /// <summary>
+        /// writes modified pages of the view to the file, FlushFileBuffers is still needed for the data to be
+        /// durable, see <see cref="file_mapping::flush_file"/>
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool flush() const noexcept;
+
+        /// <summary>
+        /// writes modified pages within <paramref name="length"/> bytes from <paramref name="offset"/> to the file
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool flush(std::size_t offset, std::size_t length) const noexcept;
+
+        [[nodiscard]]
+        explicit operator bool() const noexcept;
+
+    private:
+        mapped_view_handle base_;
+        std::byte* data_{};
+        std::size_t size_{};
+    };
+
+    /// <summary>
+    /// file mapping object from which views of a file can be mapped, avoiding copies through read buffers
+    /// </summary>
+    class MODERN_WIN32_EXPORT file_mapping final
+    {
+    public:
+        using native_handle_type = file_mapping_handle::native_handle_type;
+
+        /// <summary>
+        /// opens <paramref name="path"/> and maps the whole file
+        /// </summary>
+        /// <param name="path">the file to map</param>
+        /// <param name="access">access granted to views of the file</param>
+        /// <param name="minimum_size">
+        /// read-write mappings grow the file to at least this size, it is ignored otherwise
+        /// </param>
+        /// <exception cref="windows_exception">if the file could not be opened or mapped</exception>
+        [[nodiscard]]
+        static file_mapping open(std::filesystem::path const& path, mapping_access access = mapping_access::read_only, std::uint64_t minimum_size = 0);
+
+        /// <summary>
+        /// creates a read-write mapping of <paramref name="size"/> bytes backed by the paging file, processes
+        /// opening the same <paramref name="name"/> share its memory
+        /// </summary>
+        /// <param name="name">name of the mapping, such as Local\name for the current session</param>
+        /// <param name="size">size of the mapping, committed memory is zero filled</param>
+        /// <exception cref="windows_exception">if the mapping could not be created or already exists</exception>
+        [[nodiscard]]
+        static file_mapping create_shared(wchar_t const* name, std::uint64_t size);
+
+        /// <summary>
+        /// opens a read-write mapping previously created with <see cref="create_shared"/>
+        /// </summary>
+        /// <exception cref="windows_exception">if the mapping could not be opened</exception>
+        [[nodiscard]]
+        static file_mapping open_shared(wchar_t const* name);
+
+        /// <summary>
+        /// maps the file represented by <paramref name="file"/>, which must have been opened with access
+        /// compatible with <paramref name="access"/>
+        /// </summary>
+        /// <param name="file">the file to map, ownership is taken</param>
+        /// <param name="access">access granted to views of the file</param>
+        /// <param name="minimum_size">read-write mappings grow the file to at least this size</param>
+        /// <exception cref="windows_exception">if the file could not be mapped</exception>
+        explicit file_mapping(file_handle&& file, mapping_access access, std::uint64_t minimum_size = 0);
+        file_mapping(file_mapping const&) = delete;
+        file_mapping(file_mapping&&) noexcept = default;
+        ~file_mapping() = default;
+        file_mapping& operator=(file_mapping const&) = delete;
+        file_mapping& operator=(file_mapping&&) noexcept = default;
+
+        /// <summary>
+        /// maps <paramref name="length"/> bytes starting at <paramref name="offset"/>, 0 maps to the end of the file
+        /// </summary>
+        /// <remarks>
+        /// the offset does not need to be a multiple of the allocation granularity, the view is mapped from the
+        /// preceding boundary and <see cref="mapped_view::data"/> points at the requested offset
+        /// </remarks>
+        /// <exception cref="std::out_of_range">if the range extends past the end of the mapping</exception>
+        /// <exception cref="windows_exception">if the view could not be mapped</exception>
+        [[nodiscard]]
+        mapped_view map(std::uint64_t offset = 0, std::size_t length = 0) const;
+
+        /// <summary>
+        /// grows a read-write mapping, and the file, to <paramref name="size"/> bytes; existing views remain valid
+        /// but only views mapped afterwards can reach the new range
+        /// </summary>
+        /// <exception cref="std::logic_error">if the mapping is not read-write or is backed by the paging file</exception>
+        /// <exception cref="windows_exception">if the mapping could not be extended</exception>
+        void grow(std::uint64_t size);
+
+        /// <summary>
+        /// flushes file buffers so that data written through flushed views is durable
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool flush_file() const noexcept;
+
+        /// <summary>
+        /// returns the size of the mapping in bytes
+        /// </summary>
+        [[nodiscard]]
+        std::uint64_t size() const noexcept;
+
+        [[nodiscard]]
+        mapping_access access() const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object, nullptr for an empty file as
+        /// empty files cannot be mapped
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+    private:
+        file_handle file_;
+        file_mapping_handle mapping_;
+        std::uint64_t size_{};
+        mapping_access access_{};
+
+        explicit file_mapping(file_mapping_handle&& mapping, std::uint64_t size) noexcept;
+
+        void create_mapping(std::uint64_t size);
+    };
+
+}
+
+#endif
+#endif
@@ -17,16 +17,189 @@
 #ifdef _WIN32
 
 #include <Windows.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <modern_win32/modern_win32_export.h>
 
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+#include <compare>
+#endif
+
 namespace modern_win32
 {
+    /// <summary>
+    /// length of the canonical 00000000-0000-0000-0000-000000000000 form
+    /// </summary>
+    constexpr std::size_t guid_string_length = 36;
+
+    /// <summary>
+    /// length of the braced {00000000-0000-0000-0000-000000000000} form
+    /// </summary>
+    constexpr std::size_t braced_guid_string_length = guid_string_length + 2;
+
+    namespace details
+    {
+        constexpr unsigned char invalid_hex_digit = 0xFF;
+
+        [[nodiscard]]
+        constexpr std::array<unsigned char, 128> make_hex_digit_values() noexcept
+        {
+            std::array<unsigned char, 128> values{};
+            for (auto& value : values)
+                value = invalid_hex_digit;
+            for (unsigned char digit = 0; digit < 10; ++digit)
+                values[static_cast<std::size_t>('0') + digit] = digit;
+            for (unsigned char digit = 0; digit < 6; ++digit) {
+                values[static_cast<std::size_t>('A') + digit] = static_cast<unsigned char>(10 + digit);
+                values[static_cast<std::size_t>('a') + digit] = static_cast<unsigned char>(10 + digit);
+            }
+            return values;
+        }
+
+        inline constexpr std::array<unsigned char, 128> hex_digit_values = make_hex_digit_values();
+        inline constexpr std::array<char, 17> hex_digits{ "0123456789ABCDEF" };
+
+        /// <summary>
+        /// offset of the first hex digit of each byte, in textual order, within the canonical form
+        /// </summary>
+        inline constexpr std::array<std::size_t, 16> guid_byte_offsets{ 0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34 };
+
+        template <typename TCHAR>
+        [[nodiscard]]
+        constexpr unsigned char hex_digit_value(TCHAR const ch) noexcept
+        {
+            auto const value = static_cast<std::size_t>(static_cast<std::make_unsigned_t<TCHAR>>(ch));
+            return value < hex_digit_values.size()
+                ? hex_digit_values[value]
+                : invalid_hex_digit;
+        }
+
+        template <typename TCHAR>
+        [[nodiscard]]
+        constexpr std::optional<GUID> parse_guid(std::basic_string_view<TCHAR> value) noexcept
+        {
+            if (value.size() == braced_guid_string_length) {
+                if (value.front() != TCHAR('{') || value.back() != TCHAR('}'))
+                    return std::nullopt;
+                value = value.substr(1, guid_string_length);
+            }
+            if (value.size() != guid_string_length)
+                return std::nullopt;
+            if ((value[8] != TCHAR('-')) | (value[13] != TCHAR('-')) | (value[18] != TCHAR('-')) | (value[23] != TCHAR('-')))
+                return std::nullopt;
+
+            // invalid digits have their high bits set, accumulating them defers the only check to after the loop
+            std::array<unsigned char, 16> bytes{};
+            unsigned int invalid{};
+            for (std::size_t i = 0; i < bytes.size(); ++i) {
+                auto const high = hex_digit_value(value[guid_byte_offsets[i]]);
+                auto const low = hex_digit_value(value[guid_byte_offsets[i] + 1]);
+                invalid |= static_cast<unsigned int>(high | low);
+                bytes[i] = static_cast<unsigned char>((high << 4) | (low & 0x0F));
+            }
+            if ((invalid & 0xF0U) != 0U)
+                return std::nullopt;
+
+            GUID result{};
+            result.Data1 = static_cast<unsigned long>(bytes[0]) << 24 | static_cast<unsigned long>(bytes[1]) << 16 | static_cast<unsigned long>(bytes[2]) << 8 | bytes[3];
+            result.Data2 = static_cast<unsigned short>(bytes[4] << 8 | bytes[5]);
+            result.Data3 = static_cast<unsigned short>(bytes[6] << 8 | bytes[7]);
+            for (std::size_t i = 0; i < 8; ++i)
+                result.Data4[i] = bytes[8 + i];
+            return result;
+        }
+
+        template <typename TCHAR>
+        constexpr void format_guid(GUID const& value, TCHAR* const output) noexcept
+        {
+            std::array<unsigned char, 16> const bytes{
+                static_cast<unsigned char>(value.Data1 >> 24), static_cast<unsigned char>(value.Data1 >> 16),
+                static_cast<unsigned char>(value.Data1 >> 8), static_cast<unsigned char>(value.Data1),
+                static_cast<unsigned char>(value.Data2 >> 8), static_cast<unsigned char>(value.Data2),
+                static_cast<unsigned char>(value.Data3 >> 8), static_cast<unsigned char>(value.Data3),
+                value.Data4[0], value.Data4[1], value.Data4[2], value.Data4[3],
+                value.Data4[4], value.Data4[5], value.Data4[6], value.Data4[7],
+            };
+
+            output[8] = output[13] = output[18] = output[23] = TCHAR('-');
+            for (std::size_t i = 0; i < bytes.size(); ++i) {
+                output[guid_byte_offsets[i]] = static_cast<TCHAR>(hex_digits[bytes[i] >> 4]);
+                output[guid_byte_offsets[i] + 1] = static_cast<TCHAR>(hex_digits[bytes[i] & 0x0F]);
+            }
+        }
+    }
+
+    /// <summary>
+    /// parses the canonical or braced form of a GUID, hex digits may be either case
+    /// </summary>
+    /// <returns>the parsed value or std::nullopt if <paramref name="value"/> is not in either form</returns>
+    [[nodiscard]]
+    constexpr std::optional<GUID> try_parse_guid(std::string_view const value) noexcept
+    {
+        return details::parse_guid(value);
+    }
+
+    /// <inheritdoc cref="try_parse_guid(std::string_view)"/>
+    [[nodiscard]]
+    constexpr std::optional<GUID> try_parse_guid(std::wstring_view const value) noexcept
+    {
+        return details::parse_guid(value);
+    }
+
+    /// <summary>
+    /// writes the canonical upper case form of <paramref name="value"/> to <paramref name="buffer"/>, without a
+    /// null terminator
+    /// </summary>
+    constexpr void format_guid(GUID const& value, char (&buffer)[guid_string_length]) noexcept
+    {
+        details::format_guid(value, buffer);
+    }
+
+    /// <inheritdoc cref="format_guid(GUID const&amp;, char (&amp;)[guid_string_length])"/>
+    constexpr void format_guid(GUID const& value, wchar_t (&buffer)[guid_string_length]) noexcept
+    {
+        details::format_guid(value, buffer);
+    }
+
+    /// <summary>
+    /// writes the braced upper case form of <paramref name="value"/> to <paramref name="buffer"/>, without a
+    /// null terminator
+    /// </summary>
+    constexpr void format_braced_guid(GUID const& value, char (&buffer)[braced_guid_string_length]) noexcept
+    {
+        buffer[0] = '{';
+        details::format_guid(value, buffer + 1);
+        buffer[braced_guid_string_length - 1] = '}';
+    }
+
+    /// <inheritdoc cref="format_braced_guid(GUID const&amp;, char (&amp;)[braced_guid_string_length])"/>
+    constexpr void format_braced_guid(GUID const& value, wchar_t (&buffer)[braced_guid_string_length]) noexcept
+    {
+        buffer[0] = L'{';
+        details::format_guid(value, buffer + 1);
+        buffer[braced_guid_string_length - 1] = L'}';
+    }
+
+    static_assert(sizeof(GUID) == 16, "compare and hash read GUID as two 64-bit words");
+
     class MODERN_WIN32_EXPORT guid final
     {
     public:
         explicit guid();
-        explicit guid(GUID const& value) noexcept;
+        constexpr explicit guid(GUID const& value) noexcept
+            : value_(value)
+        {
+        }
         explicit guid(char const* value);
         explicit guid(wchar_t const* value);
 
@@ -51,17 +224,98 @@ namespace modern_win32
         {
             return value_;
         }
-        explicit operator bool() const
+        constexpr explicit operator bool() const noexcept
+        {
+            return !empty();
+        }
+
+        /// <summary>
+        /// true if every bit is zero, equivalent to comparing against <see cref="zero"/>
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool empty() const noexcept
         {
-            return *this != zero();
+            auto bits = value_.Data1 | value_.Data2 | value_.Data3;
+            for (auto const part : value_.Data4)
+                bits |= part;
+            return bits == 0;
         }
+
+        /// <summary>
+        /// compares the 16 bytes of each value in memory order, the same order as memcmp
+        /// </summary>
+        /// <returns>negative if this orders before <paramref name="other"/>, 0 if equal; otherwise, positive</returns>
+        [[nodiscard]]
+        int compare(guid const& other) const noexcept
+        {
+            auto const [left_high, left_low] = big_endian_words();
+            auto const [right_high, right_low] = other.big_endian_words();
+            if (left_high != right_high)
+                return left_high < right_high ? -1 : 1;
+            if (left_low != right_low)
+                return left_low < right_low ? -1 : 1;
+            return 0;
+        }
+
+        /// <summary>
+        /// folds both 64-bit halves then mixes them with the murmur3 finalizer so every bit affects the result
+        /// </summary>
         [[nodiscard]]
-        constexpr bool empty() const
+        std::size_t hash() const noexcept
         {
-            return static_cast<bool>(this);
+            std::uint64_t words[2]{};
+            std::memcpy(words, &value_, sizeof(words));
+            auto mixed = words[0] ^ (words[1] << 32 | words[1] >> 32);
+            mixed ^= mixed >> 33;
+            mixed *= 0xFF51AFD7ED558CCDULL;
+            mixed ^= mixed >> 33;
+            if constexpr (sizeof(std::size_t) < sizeof(std::uint64_t))
+                return static_cast<std::size_t>(mixed ^ mixed >> 32);
+            else
+                return static_cast<std::size_t>(mixed);
         }
+
+        friend bool operator<(guid const& left, guid const& right) noexcept
+        {
+            return left.compare(right) < 0;
+        }
+        friend bool operator<=(guid const& left, guid const& right) noexcept
+        {
+            return left.compare(right) <= 0;
+        }
+        friend bool operator>(guid const& left, guid const& right) noexcept
+        {
+            return left.compare(right) > 0;
+        }
+        friend bool operator>=(guid const& left, guid const& right) noexcept
+        {
+            return left.compare(right) >= 0;
+        }
+
+#       if __cplusplus > 201703L || _MSVC_LANG > 201703L
+        friend std::strong_ordering operator<=>(guid const& left, guid const& right) noexcept
+        {
+            return left.compare(right) <=> 0;
+        }
+#       endif
+
     private:
         GUID value_{};
+
+        /// <summary>
+        /// the two halves of the value loaded so that integer comparison matches byte wise comparison
+        /// </summary>
+        [[nodiscard]]
+        std::pair<std::uint64_t, std::uint64_t> big_endian_words() const noexcept
+        {
+            std::uint64_t words[2]{};
+            std::memcpy(words, &value_, sizeof(words));
+#           ifdef _MSC_VER
+            return { _byteswap_uint64(words[0]), _byteswap_uint64(words[1]) };
+#           else
+            return { __builtin_bswap64(words[0]), __builtin_bswap64(words[1]) };
+#           endif
+        }
     };
 
     [[nodiscard]]
@@ -72,6 +326,35 @@ namespace modern_win32
     [[nodiscard]]
     MODERN_WIN32_EXPORT guid new_guid() noexcept;
 
+    namespace literals
+    {
+        /// <summary>
+        /// guid literal, an invalid value fails to compile when used in a constant expression and throws
+        /// std::invalid_argument otherwise
+        /// </summary>
+        [[nodiscard]]
+        constexpr guid operator""_guid(char const* const value, std::size_t const size)
+        {
+            auto const parsed = try_parse_guid(std::string_view(value, size));
+            if (!parsed.has_value())
+                throw std::invalid_argument("invalid format");
+            return guid(parsed.value());
+        }
+    }
+
+}
+
+namespace std
+{
+    template <>
+    struct hash<modern_win32::guid>
+    {
+        [[nodiscard]]
+        std::size_t operator()(modern_win32::guid const& value) const noexcept
+        {
+            return value.hash();
+        }
+    };
 }
 
 #endif
@@ -0,0 +1,93 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_GUID_GENERATOR_H_
+#define MODERN_WIN32_GUID_GENERATOR_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <modern_win32/guid.h>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// generates RFC 9562 version 4 (random) and version 7 (unix time ordered) GUIDs without taking a lock
+    /// </summary>
+    /// <remarks>
+    /// version 7 values from a single generator are strictly increasing, in canonical string and RFC byte order,
+    /// across all threads using it; the 12 bit rand_a field holds a counter for values created within the same
+    /// millisecond which borrows from the following millisecond should it overflow
+    /// </remarks>
+    class MODERN_WIN32_EXPORT guid_generator final
+    {
+    public:
+        explicit guid_generator() noexcept = default;
+        guid_generator(guid_generator const&) = delete;
+        guid_generator(guid_generator&&) = delete;
+        ~guid_generator() = default;
+
+        /// <summary>
+        /// fills <paramref name="first"/> with <paramref name="count"/> version 4 GUIDs using a single
+        /// BCryptGenRandom call
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        static bool generate_random(guid* first, std::size_t count) noexcept;
+
+        /// <summary>
+        /// returns a version 4 GUID drawn from the calling thread's <see cref="random_pool"/>
+        /// </summary>
+        /// <returns>the new GUID or std::nullopt if random bytes could not be generated</returns>
+        [[nodiscard]]
+        static std::optional<guid> next_random() noexcept;
+
+        /// <summary>
+        /// fills <paramref name="first"/> with <paramref name="count"/> consecutive version 7 GUIDs, reserving
+        /// their ordering with a single atomic update
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool generate_time_ordered(guid* first, std::size_t count) noexcept;
+
+        /// <summary>
+        /// returns a version 7 GUID ordered after every value previously produced by this generator
+        /// </summary>
+        /// <returns>the new GUID or std::nullopt if random bytes could not be generated</returns>
+        [[nodiscard]]
+        std::optional<guid> next_time_ordered() noexcept;
+
+        guid_generator& operator=(guid_generator const&) = delete;
+        guid_generator& operator=(guid_generator&&) = delete;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        /// <summary>
+        /// last reserved unix millisecond timestamp shifted left 12 bits, or'd with the counter for that millisecond
+        /// </summary>
+        std::atomic<std::uint64_t> sequence_{};
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        std::uint64_t reserve(std::uint64_t count) noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,137 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_HANDLE_DIAGNOSTICS_H_
+#define MODERN_WIN32_HANDLE_DIAGNOSTICS_H_
+#ifdef _WIN32
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// true when <see cref="unique_handle"/> counts the handles it owns, enabled by defining
+    /// MODERN_WIN32_HANDLE_DIAGNOSTICS (the MODERN_WIN32_HANDLE_DIAGNOSTICS CMake option) for the library and every
+    /// consumer of it
+    /// </summary>
+#ifdef MODERN_WIN32_HANDLE_DIAGNOSTICS
+    constexpr bool handle_diagnostics_enabled = true;
+#else
+    constexpr bool handle_diagnostics_enabled = false;
+#endif
+
+    /// <summary>
+    /// point in time copy of the counters held by <see cref="handle_counter"/>
+    /// </summary>
+    struct handle_count_snapshot final
+    {
+        std::string traits_name{};
+        std::int64_t open{};
+        std::uint64_t opened{};
+        std::uint64_t closed{};
+    };
+
+    /// <summary>
+    /// counts the handles owned by every <see cref="unique_handle"/> of a single TRAITS type
+    /// </summary>
+    /// <remarks>
+    /// a handle is counted as open from the moment a unique_handle takes ownership of it until it is closed or
+    /// released, handles moved between unique_handles are not counted again; only counters obtained from
+    /// <see cref="get_handle_counter"/> are reported by <see cref="get_handle_counts"/>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT handle_counter final
+    {
+    public:
+        explicit handle_counter(std::string traits_name) noexcept;
+        handle_counter(handle_counter const&) = delete;
+        handle_counter(handle_counter&&) noexcept = delete;
+        ~handle_counter() = default;
+
+        void on_opened() noexcept
+        {
+            opened_.fetch_add(1, std::memory_order_relaxed);
+        }
+        void on_closed() noexcept
+        {
+            closed_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        std::string const& traits_name() const noexcept
+        {
+            return traits_name_;
+        }
+
+        [[nodiscard]]
+        handle_count_snapshot snapshot() const;
+
+        handle_counter& operator=(handle_counter const&) = delete;
+        handle_counter& operator=(handle_counter&&) noexcept = delete;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::string traits_name_;
+        std::atomic<std::uint64_t> opened_{};
+        std::atomic<std::uint64_t> closed_{};
+#       pragma warning(pop)
+    };
+
+    /// <summary>
+    /// returns the counter registered for <paramref name="traits_name"/>, creating it on first use
+    /// </summary>
+    /// <remarks>
+    /// counters are owned by this library and never freed, so a module which has counted handles may be unloaded
+    /// without leaving <see cref="get_handle_counts"/> pointing into it
+    /// </remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT handle_counter& get_handle_counter(char const* traits_name);
+
+    /// <summary>
+    /// returns the counter shared by every unique_handle using <typeparamref name="TRAITS"/>, modules using the
+    /// same type share the same counter
+    /// </summary>
+    template <typename TRAITS>
+    [[nodiscard]]
+    handle_counter& handle_counter_for() noexcept
+    {
+        static handle_counter& counter = get_handle_counter(typeid(TRAITS).name());
+        return counter;
+    }
+
+    /// <summary>
+    /// returns the counts of each TRAITS type which has owned a handle; empty unless
+    /// <see cref="handle_diagnostics_enabled"/>
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::vector<handle_count_snapshot> get_handle_counts();
+
+    /// <summary>
+    /// returns the counts of <typeparamref name="TRAITS"/>
+    /// </summary>
+    template <typename TRAITS>
+    [[nodiscard]]
+    handle_count_snapshot get_handle_count()
+    {
+        return handle_counter_for<TRAITS>().snapshot();
+    }
+
+}
+
+#endif
+#endif
@@ -0,0 +1,179 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_HANDLE_REAPER_H_
+#define MODERN_WIN32_HANDLE_REAPER_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/threading/thread.h>
+#include <modern_win32/unique_handle.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// closes handles on a background thread in batches, letting the owner of a large number of handles release
+    /// them without paying for each close on its own thread
+    /// </summary>
+    /// <remarks>
+    /// handles are queued by <see cref="defer"/> and closed once <c>batch_size</c> are pending or
+    /// <c>flush_interval</c> has passed since the first of them was queued, whichever comes first.  The destructor
+    /// closes anything still pending before joining the thread.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT handle_reaper final
+    {
+    public:
+        using close_function = void (*)(void*) noexcept;
+
+        /// <summary>
+        /// Instantiates a new instance of the handle_reaper class
+        /// </summary>
+        /// <param name="batch_size">number of pending handles which wakes the background thread, if zero 1 is used</param>
+        /// <param name="flush_interval">longest a deferred handle waits to be closed</param>
+        /// <exception cref="windows_exception">if unable to create the background thread</exception>
+        explicit handle_reaper(std::size_t batch_size = 256, std::chrono::milliseconds flush_interval = std::chrono::milliseconds(50));
+        handle_reaper(handle_reaper const&) = delete;
+        handle_reaper(handle_reaper&&) noexcept = delete;
+        ~handle_reaper();
+        handle_reaper& operator=(handle_reaper const&) = delete;
+        handle_reaper& operator=(handle_reaper&&) noexcept = delete;
+
+        /// <summary>
+        /// returns the process wide reaper used by <see cref="deferred_close_traits"/>, created on first use
+        /// </summary>
+        /// <remarks>
+        /// the shared reaper is never destroyed so handles deferred during static destruction remain valid to defer,
+        /// handles still pending at exit are closed by the system along with the process
+        /// </remarks>
+        /// <exception cref="windows_exception">if unable to create the background thread on first use</exception>
+        [[nodiscard]]
+        static handle_reaper& shared();
+
+        /// <summary>
+        /// queues <paramref name="handle"/> to be closed by <typeparamref name="TRAITS"/>::close on the background
+        /// thread, if it can't be queued it is closed immediately on the calling thread
+        /// </summary>
+        template <typename TRAITS>
+        void defer(typename TRAITS::native_handle_type const handle) noexcept
+        {
+            defer(&close_native<TRAITS>, to_pointer<TRAITS>(handle));
+        }
+
+        /// <summary>
+        /// <see cref="defer"/> using the <see cref="shared"/> reaper, if it can't be created the handle is closed
+        /// immediately on the calling thread
+        /// </summary>
+        template <typename TRAITS>
+        static void defer_to_shared(typename TRAITS::native_handle_type const handle) noexcept
+        {
+            defer_to_shared(&close_native<TRAITS>, to_pointer<TRAITS>(handle));
+        }
+
+        /// <summary>
+        /// queues <paramref name="handle"/> to be closed by <paramref name="close"/> on the background thread, if it
+        /// can't be queued it is closed immediately on the calling thread
+        /// </summary>
+        void defer(close_function close, void* handle) noexcept;
+
+        /// <inheritdoc cref="defer_to_shared"/>
+        static void defer_to_shared(close_function close, void* handle) noexcept;
+
+        /// <summary>
+        /// closes every handle deferred before the call, on the calling thread, returning once they and any batch
+        /// the background thread is closing have been closed
+        /// </summary>
+        void flush() noexcept;
+
+        /// <summary>
+        /// returns the number of handles waiting to be closed
+        /// </summary>
+        [[nodiscard]]
+        std::size_t pending() const noexcept;
+
+        /// <summary>
+        /// returns the number of deferred handles closed so far
+        /// </summary>
+        [[nodiscard]]
+        std::uint64_t closed() const noexcept;
+
+    private:
+        struct deferred_handle final
+        {
+            close_function close;
+            void* handle;
+        };
+
+        std::size_t batch_size_;
+        std::chrono::milliseconds flush_interval_;
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        mutable threading::slim_lock lock_{};
+        threading::condition_variable wake_{};
+        std::vector<deferred_handle> pending_{};
+        threading::slim_lock close_lock_{};
+        std::vector<deferred_handle> closing_{};
+        std::atomic<std::uint64_t> closed_{};
+        bool stopping_{};
+        threading::thread worker_;
+#       pragma warning(pop)
+
+        template <typename TRAITS>
+        static void* to_pointer(typename TRAITS::native_handle_type const handle) noexcept
+        {
+            static_assert(std::is_pointer_v<typename TRAITS::native_handle_type>, "only pointer handles can be deferred");
+            return const_cast<void*>(static_cast<void const*>(handle));
+        }
+
+        template <typename TRAITS>
+        static void close_native(void* const handle) noexcept
+        {
+            TRAITS::close(static_cast<typename TRAITS::native_handle_type>(handle));
+        }
+
+        void close_pending() noexcept;
+
+        static DWORD __stdcall worker_proc(threading::thread::thread_parameter parameter);
+    };
+
+    /// <summary>
+    /// close policy handing handles to <see cref="handle_reaper::shared"/> rather than closing them on the
+    /// destroying thread, <typeparamref name="TRAITS"/> provides the invalid value and the close performed later
+    /// </summary>
+    /// <example>
+    /// <code>using deferred_handle = unique_handle&lt;deferred_close_traits&lt;null_handle_traits&gt;&gt;;</code>
+    /// </example>
+    template <typename TRAITS>
+    struct deferred_close_traits : TRAITS
+    {
+        using native_handle_type = typename TRAITS::native_handle_type;
+
+        static void close(native_handle_type const handle) noexcept
+        {
+            handle_reaper::defer_to_shared<TRAITS>(handle);
+        }
+    };
+
+}
+
+#endif
+#endif
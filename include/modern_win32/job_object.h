@@ -0,0 +1,192 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_JOB_OBJECT_H_
+#define MODERN_WIN32_JOB_OBJECT_H_
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/null_handle.h>
+#include <modern_win32/process.h>
+#include <modern_win32/process_snapshot.h>
+#include <modern_win32/process_startup_info.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace modern_win32
+{
+    using job_handle = null_handle;
+
+    /// <summary>
+    /// limits applied to every process in a <see cref="job_object"/>, unset values are not limited
+    /// </summary>
+    struct job_limits final
+    {
+        /// <summary>
+        /// hard cap on the processor time of the whole job as a percentage of all processors, 1 to 100
+        /// </summary>
+        std::optional<double> cpu_rate_percent{};
+
+        /// <summary>
+        /// maximum committed memory of any single process in the job
+        /// </summary>
+        std::optional<std::size_t> process_memory_bytes{};
+
+        /// <summary>
+        /// maximum committed memory of all processes in the job combined
+        /// </summary>
+        std::optional<std::size_t> job_memory_bytes{};
+
+        /// <summary>
+        /// maximum number of processes simultaneously running in the job, further assignments fail
+        /// </summary>
+        std::optional<std::uint32_t> active_process_limit{};
+
+        /// <summary>
+        /// terminates every process in the job once the last handle to the job is closed
+        /// </summary>
+        bool kill_on_close{};
+    };
+
+    /// <summary>
+    /// totals for every process which has been part of the job, including those which have exited
+    /// </summary>
+    struct job_accounting final
+    {
+        process_time_duration total_user_time{};
+        process_time_duration total_kernel_time{};
+        std::uint32_t total_page_fault_count{};
+        std::uint32_t total_processes{};
+        std::uint32_t active_processes{};
+        std::uint32_t total_terminated_processes{};
+        std::uint64_t read_operation_count{};
+        std::uint64_t write_operation_count{};
+        std::uint64_t other_operation_count{};
+        std::uint64_t read_transfer_bytes{};
+        std::uint64_t write_transfer_bytes{};
+        std::uint64_t other_transfer_bytes{};
+    };
+
+    /// <summary>
+    /// groups processes so they can be limited, accounted for and terminated together
+    /// </summary>
+    /// <remarks>
+    /// processes started through the job are created suspended and resumed once assigned, processes assigned
+    /// using <see cref="assign"/> may already have started children outside of the job.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT job_object final
+    {
+    public:
+        using native_handle_type = job_handle::native_handle_type;
+
+        /// <summary>
+        /// Instantiates a new instance of the job_object class creating an unnamed job
+        /// </summary>
+        /// <exception cref="windows_exception">if the job could not be created</exception>
+        explicit job_object();
+
+        /// <summary>
+        /// Instantiates a new instance of the job_object class taking ownership of <paramref name="handle"/>
+        /// </summary>
+        explicit job_object(job_handle&& handle) noexcept;
+        job_object(job_object const&) = delete;
+        job_object(job_object&&) noexcept = default;
+        ~job_object() = default;
+        job_object& operator=(job_object const&) = delete;
+        job_object& operator=(job_object&&) noexcept = default;
+
+        /// <summary>
+        /// replaces the limits of the job with <paramref name="limits"/>
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if cpu_rate_percent is not within 0 and 100</exception>
+        /// <exception cref="windows_exception">if the limits could not be applied</exception>
+        void set_limits(job_limits const& limits);
+
+        /// <summary>
+        /// assigns <paramref name="child"/> to the job
+        /// </summary>
+        /// <exception cref="windows_exception">if the process could not be assigned</exception>
+        void assign(process const& child);
+
+        /// <summary>
+        /// returns true if <paramref name="child"/> belongs to the job
+        /// </summary>
+        /// <exception cref="windows_exception">if the process could not be queried</exception>
+        [[nodiscard]]
+        bool contains(process const& child) const;
+
+        /// <summary>
+        /// starts the process described by <paramref name="startup_info"/> within the job
+        /// </summary>
+        /// <exception cref="std::filesystem::filesystem_error">if the filename is not found</exception>
+        /// <exception cref="windows_exception">if the process could not be started or assigned</exception>
+        [[nodiscard]]
+        process start_process(narrow_process_startup_info const& startup_info) const;
+
+        /// <summary><see cref="start_process(narrow_process_startup_info const&)"/></summary>
+        [[nodiscard]]
+        process start_process(wide_process_startup_info const& startup_info) const;
+
+        /// <summary>
+        /// starts <paramref name="filename"/> with <paramref name="arguments"/> within the job
+        /// </summary>
+        [[nodiscard]]
+        process start_process(char const* filename, char const* arguments) const;
+
+        /// <summary><see cref="start_process(char const*, char const*)"/></summary>
+        [[nodiscard]]
+        process start_process(wchar_t const* filename, wchar_t const* arguments) const;
+
+        /// <summary>
+        /// returns the accounting totals of the job using a single QueryInformationJobObject call
+        /// </summary>
+        /// <exception cref="windows_exception">if the job could not be queried</exception>
+        [[nodiscard]]
+        job_accounting get_accounting() const;
+
+        /// <summary>
+        /// returns the ids of the processes currently running in the job
+        /// </summary>
+        /// <exception cref="windows_exception">if the job could not be queried</exception>
+        [[nodiscard]]
+        std::vector<process_id_type> get_process_ids() const;
+
+        /// <summary>
+        /// terminates every process in the job with <paramref name="exit_code"/>
+        /// </summary>
+        /// <exception cref="windows_exception">if the processes could not be terminated</exception>
+        void terminate(process::exit_code_type exit_code = 1U) const;
+
+        /// <summary>
+        /// returns true if the job handle is valid
+        /// </summary>
+        [[nodiscard]]
+        explicit operator bool() const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+    private:
+        job_handle handle_;
+    };
+
+}
+
+#endif
+#endif
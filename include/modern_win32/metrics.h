@@ -0,0 +1,290 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_METRICS_H_
+#define MODERN_WIN32_METRICS_H_
+#ifdef _WIN32
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/cache_line.h>
+#include <modern_win32/threading/slim_lock.h>
+
+namespace modern_win32::metrics
+{
+    /// <summary>
+    /// true when the library feeds <see cref="library"/> from semaphore acquire, timer dispatch and process
+    /// launch, enabled by defining MODERN_WIN32_METRICS (the MODERN_WIN32_METRICS CMake option) for the library
+    /// and every consumer of it; the types below are available either way
+    /// </summary>
+#ifdef MODERN_WIN32_METRICS
+    constexpr bool metrics_enabled = true;
+#else
+    constexpr bool metrics_enabled = false;
+#endif
+
+    /// <summary>
+    /// number of shards each histogram and counter is split into, a thread always records to the same shard and
+    /// reads merge every shard
+    /// </summary>
+    constexpr std::size_t metric_shard_count = 8;
+
+    /// <summary>
+    /// each power of two range is split into 2^histogram_sub_bucket_bits linear buckets, bounding the error of a
+    /// reported value to 1/32 of it
+    /// </summary>
+    constexpr std::size_t histogram_sub_bucket_bits = 5;
+    constexpr std::size_t histogram_sub_bucket_count = std::size_t{ 1 } << histogram_sub_bucket_bits;
+
+    /// <summary>
+    /// values of 2^histogram_max_exponent nanoseconds (about 68 seconds) or more are counted by the last bucket
+    /// </summary>
+    constexpr std::size_t histogram_max_exponent = 36;
+    constexpr std::size_t histogram_bucket_count = (histogram_max_exponent - histogram_sub_bucket_bits + 1) * histogram_sub_bucket_count;
+
+    /// <summary>
+    /// returns the smallest value, in nanoseconds, counted by bucket <paramref name="index"/>
+    /// </summary>
+    [[nodiscard]]
+    constexpr std::uint64_t bucket_lower_bound(std::size_t const index) noexcept
+    {
+        auto const shift = index < histogram_sub_bucket_count ? 0 : index / histogram_sub_bucket_count - 1;
+        return static_cast<std::uint64_t>(index - shift * histogram_sub_bucket_count) << shift;
+    }
+
+    /// <summary>
+    /// returns the largest value, in nanoseconds, counted by bucket <paramref name="index"/>
+    /// </summary>
+    [[nodiscard]]
+    constexpr std::uint64_t bucket_upper_bound(std::size_t const index) noexcept
+    {
+        auto const shift = index < histogram_sub_bucket_count ? 0 : index / histogram_sub_bucket_count - 1;
+        return bucket_lower_bound(index) + (std::uint64_t{ 1 } << shift) - 1;
+    }
+
+    /// <summary>
+    /// point in time copy of a <see cref="latency_histogram"/>, percentiles are the upper bound of the bucket
+    /// holding them limited to <see cref="max"/>
+    /// </summary>
+    struct latency_snapshot final
+    {
+        std::wstring name{};
+        std::uint64_t count{};
+        std::chrono::nanoseconds total{};
+        std::chrono::nanoseconds min{};
+        std::chrono::nanoseconds max{};
+        std::chrono::nanoseconds p50{};
+        std::chrono::nanoseconds p99{};
+        std::chrono::nanoseconds p999{};
+        std::vector<std::uint64_t> buckets{};
+    };
+
+    /// <summary>
+    /// returns the value below which <paramref name="percentile"/> percent of the values in
+    /// <paramref name="snapshot"/> fall, zero if it is empty
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::chrono::nanoseconds value_at_percentile(latency_snapshot const& snapshot, double percentile) noexcept;
+
+    /// <summary>
+    /// log-linear (HDR style) histogram of durations. Recording never allocates: it makes two relaxed atomic adds
+    /// to the calling thread's shard plus relaxed loads of the shard minimum and maximum, which are only
+    /// compare-exchanged when the value extends them
+    /// </summary>
+    /// <remarks>
+    /// the shards are allocated once on construction, about 64KB, so histograms are intended to be long lived and
+    /// shared, usually through <see cref="registry"/>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT latency_histogram final
+    {
+    public:
+        explicit latency_histogram(std::wstring_view name = {});
+        latency_histogram(latency_histogram const&) = delete;
+        latency_histogram(latency_histogram&&) noexcept = delete;
+        ~latency_histogram();
+
+        /// <summary>
+        /// records <paramref name="value"/>, negative values are recorded as zero
+        /// </summary>
+        void record(std::chrono::nanoseconds value) noexcept;
+
+        [[nodiscard]]
+        std::wstring const& name() const noexcept;
+
+        /// <summary>
+        /// merges every shard, shards are read independently so a snapshot taken during updates may be off by the
+        /// values in flight
+        /// </summary>
+        [[nodiscard]]
+        latency_snapshot snapshot() const;
+
+        /// <summary>
+        /// clears every shard, values recorded concurrently may or may not survive
+        /// </summary>
+        void reset() noexcept;
+
+        latency_histogram& operator=(latency_histogram const&) = delete;
+        latency_histogram& operator=(latency_histogram&&) noexcept = delete;
+
+    private:
+        struct shard;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::wstring name_;
+        std::unique_ptr<shard[]> shards_;
+#       pragma warning(pop)
+    };
+
+    /// <summary>
+    /// point in time copy of a <see cref="counter"/>
+    /// </summary>
+    struct counter_snapshot final
+    {
+        std::wstring name{};
+        std::uint64_t value{};
+    };
+
+    /// <summary>
+    /// monotonic counter sharded by thread so that concurrent increments do not share a cache line
+    /// </summary>
+    class MODERN_WIN32_EXPORT counter final
+    {
+    public:
+        explicit counter(std::wstring_view name = {});
+        counter(counter const&) = delete;
+        counter(counter&&) noexcept = delete;
+        ~counter() = default;
+
+        void add(std::uint64_t value = 1) noexcept;
+
+        /// <summary>
+        /// returns the sum of every shard
+        /// </summary>
+        [[nodiscard]]
+        std::uint64_t value() const noexcept;
+
+        [[nodiscard]]
+        std::wstring const& name() const noexcept;
+
+        void reset() noexcept;
+
+        counter& operator=(counter const&) = delete;
+        counter& operator=(counter&&) noexcept = delete;
+
+    private:
+        struct alignas(threading::cache_line_size) shard final
+        {
+            std::atomic<std::uint64_t> value{};
+        };
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::wstring name_;
+        std::array<shard, metric_shard_count> shards_{};
+#       pragma warning(pop)
+    };
+
+    /// <summary>
+    /// point in time copy of every metric in a <see cref="registry"/>, ordered by name
+    /// </summary>
+    struct metrics_snapshot final
+    {
+        std::vector<latency_snapshot> histograms{};
+        std::vector<counter_snapshot> counters{};
+    };
+
+    /// <summary>
+    /// owns named histograms and counters for the lifetime of the registry, lookups take a lock and may allocate
+    /// so callers look a metric up once and keep the reference
+    /// </summary>
+    class MODERN_WIN32_EXPORT registry final
+    {
+    public:
+        explicit registry() = default;
+        registry(registry const&) = delete;
+        registry(registry&&) noexcept = delete;
+        ~registry() = default;
+
+        /// <summary>
+        /// returns the histogram named <paramref name="name"/>, creating it on first use
+        /// </summary>
+        [[nodiscard]]
+        latency_histogram& get_histogram(std::wstring_view name);
+
+        /// <summary>
+        /// returns the counter named <paramref name="name"/>, creating it on first use
+        /// </summary>
+        [[nodiscard]]
+        counter& get_counter(std::wstring_view name);
+
+        [[nodiscard]]
+        metrics_snapshot snapshot() const;
+
+        /// <summary>
+        /// returns a process wide instance, the one <see cref="library"/> registers with
+        /// </summary>
+        [[nodiscard]]
+        static registry& instance() noexcept;
+
+        registry& operator=(registry const&) = delete;
+        registry& operator=(registry&&) noexcept = delete;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        mutable threading::slim_lock lock_{};
+        std::map<std::wstring, std::unique_ptr<latency_histogram>, std::less<>> histograms_{};
+        std::map<std::wstring, std::unique_ptr<counter>, std::less<>> counters_{};
+#       pragma warning(pop)
+    };
+
+    /// <summary>
+    /// metrics recorded by the library itself when <see cref="metrics_enabled"/>
+    /// </summary>
+    struct library_metrics final
+    {
+        /// <summary>modern_win32.semaphore.acquire, time taken by successful semaphore wait_one and acquire</summary>
+        latency_histogram& semaphore_acquire;
+        /// <summary>modern_win32.semaphore.timeouts, semaphore wait_one and acquire calls which gave up</summary>
+        counter& semaphore_timeouts;
+        /// <summary>modern_win32.timer.dispatch_delay, time between an expiry being posted to an executor and its callback starting</summary>
+        latency_histogram& timer_dispatch_delay;
+        /// <summary>modern_win32.timer.callback, time spent in timer callbacks</summary>
+        latency_histogram& timer_callback;
+        /// <summary>modern_win32.process.launch, time taken by CreateProcess</summary>
+        latency_histogram& process_launch;
+        /// <summary>modern_win32.process.launch_failures, CreateProcess calls which failed</summary>
+        counter& process_launch_failures;
+    };
+
+    /// <summary>
+    /// returns the library metrics, registered with <see cref="registry::instance"/> on first use
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT library_metrics const& library() noexcept;
+
+}
+
+#endif
+#endif
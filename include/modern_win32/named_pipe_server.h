@@ -0,0 +1,267 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_NAMED_PIPE_SERVER_H_
+#define MODERN_WIN32_NAMED_PIPE_SERVER_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/threading/slim_lock.h>
+
+namespace modern_win32
+{
+    class named_pipe_connection;
+    class named_pipe_server;
+
+    /// <summary>
+    /// receives the connections and messages of a <see cref="named_pipe_server"/>, methods are called on the
+    /// executor threads; calls for one connection are never concurrent with each other
+    /// </summary>
+    class MODERN_WIN32_EXPORT named_pipe_handler
+    {
+    public:
+        named_pipe_handler() = default;
+        named_pipe_handler(named_pipe_handler const&) = delete;
+        named_pipe_handler(named_pipe_handler&&) noexcept = delete;
+        virtual ~named_pipe_handler() = default;
+        named_pipe_handler& operator=(named_pipe_handler const&) = delete;
+        named_pipe_handler& operator=(named_pipe_handler&&) noexcept = delete;
+
+        /// <summary>
+        /// called once a client has connected to <paramref name="connection"/>
+        /// </summary>
+        virtual void on_connected(named_pipe_connection& connection) noexcept = 0;
+
+        /// <summary>
+        /// called with each complete message written by the client, <paramref name="data"/> is only valid for the
+        /// duration of the call
+        /// </summary>
+        virtual void on_message(named_pipe_connection& connection, std::byte const* data, std::size_t size) noexcept = 0;
+
+        /// <summary>
+        /// called once the client has gone, <paramref name="error"/> is ERROR_BROKEN_PIPE if the client closed its
+        /// end and ERROR_OPERATION_ABORTED if the server disconnected it; the connection then waits for a new client
+        /// </summary>
+        virtual void on_disconnected(named_pipe_connection& connection, DWORD error) noexcept = 0;
+    };
+
+    struct named_pipe_server_options final
+    {
+        /// <summary>
+        /// number of instances kept waiting for clients, a new instance is created each time a client connects
+        /// while fewer than this are waiting
+        /// </summary>
+        std::size_t listening_instances{ 8 };
+
+        /// <summary>
+        /// most instances, and so concurrent clients, the server creates; PIPE_UNLIMITED_INSTANCES for no limit
+        /// other than system resources
+        /// </summary>
+        DWORD max_instances{ PIPE_UNLIMITED_INSTANCES };
+
+        /// <summary>
+        /// size of the pipe buffers and of the pooled buffers messages are read into and written from, larger
+        /// messages are still delivered whole but need an allocation
+        /// </summary>
+        DWORD buffer_size{ 16UL * 1024UL };
+
+        /// <summary>
+        /// number of unused pooled buffers kept for reuse
+        /// </summary>
+        std::size_t max_pooled_buffers{ 1024 };
+
+        /// <summary>
+        /// if true clients on other machines are refused
+        /// </summary>
+        bool reject_remote_clients{ true };
+    };
+
+    /// <summary>
+    /// a single instance of a <see cref="named_pipe_server"/>'s pipe, connected to at most one client at a time
+    /// </summary>
+    class MODERN_WIN32_EXPORT named_pipe_connection final : public threading::io_completion_handler
+    {
+    public:
+        using native_handle_type = invalid_handle::native_handle_type;
+
+        named_pipe_connection(named_pipe_connection const&) = delete;
+        named_pipe_connection(named_pipe_connection&&) noexcept = delete;
+        ~named_pipe_connection() override = default;
+        named_pipe_connection& operator=(named_pipe_connection const&) = delete;
+        named_pipe_connection& operator=(named_pipe_connection&&) noexcept = delete;
+
+        /// <summary>
+        /// starts writing <paramref name="data"/> to the client as one message, the data is copied so the caller
+        /// may reuse it as soon as the call returns
+        /// </summary>
+        /// <returns>true if the write was started; otherwise, false with the error available from GetLastError</returns>
+        /// <remarks>
+        /// only valid between on_connected and on_disconnected; once disconnected the instance serves a new client
+        /// </remarks>
+        [[nodiscard]]
+        bool send(void const* data, std::size_t size) noexcept;
+
+        /// <summary>
+        /// disconnects the client, <see cref="named_pipe_handler::on_disconnected"/> follows with ERROR_OPERATION_ABORTED
+        /// </summary>
+        [[maybe_unused]]
+        bool disconnect() noexcept;
+
+        /// <summary>
+        /// returns a value identifying the current client, unique among every client of the server
+        /// </summary>
+        [[nodiscard]]
+        std::uint64_t id() const noexcept;
+
+        [[nodiscard]]
+        bool is_connected() const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+        void on_completion(threading::io_completion const& completion) noexcept override;
+
+    private:
+        friend class named_pipe_server;
+
+        enum class connection_state : std::uint8_t
+        {
+            listening,
+            connected,
+            closed,
+        };
+
+        named_pipe_server& server_;
+        invalid_handle pipe_;
+        OVERLAPPED connect_overlapped_{};
+        OVERLAPPED read_overlapped_{};
+        std::byte* read_block_{};
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<std::byte> partial_message_{};
+        mutable threading::slim_lock lock_{};
+        std::atomic<std::uint64_t> id_{};
+#       pragma warning(pop)
+        connection_state state_{ connection_state::closed };
+
+        explicit named_pipe_connection(named_pipe_server& server, invalid_handle&& pipe) noexcept;
+
+        void listen() noexcept;
+        void on_connect_completed(DWORD error) noexcept;
+        void on_read_completed(DWORD error, DWORD bytes_read) noexcept;
+        void read_next() noexcept;
+        void on_client_gone(DWORD error) noexcept;
+        [[nodiscard]]
+        std::byte* read_buffer() const noexcept;
+    };
+
+    /// <summary>
+    /// message mode named pipe server accepting any number of local clients, every accept, read and write is
+    /// overlapped and completed by an <see cref="threading::io_completion_executor"/> so no thread is dedicated to
+    /// a client
+    /// </summary>
+    /// <remarks>
+    /// a pool of pipe instances always has a connect pending so clients never wait for an accept.  Messages are
+    /// read into, and sent from, buffers taken from a pool shared by every connection; a message longer than one
+    /// buffer arrives in pieces which are joined before being delivered.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT named_pipe_server final
+    {
+    public:
+        /// <summary>
+        /// creates the first <see cref="named_pipe_server_options::listening_instances"/> instances of
+        /// <paramref name="name"/> and starts accepting clients
+        /// </summary>
+        /// <param name="name">pipe name of the form \\.\pipe\name, which must not already be in use</param>
+        /// <param name="executor">executor whose threads complete the I/O, must outlive the server</param>
+        /// <param name="handler">receives connections and messages, must outlive the server</param>
+        /// <param name="options">instance, buffer and pool limits</param>
+        /// <exception cref="windows_exception">if the pipe could not be created or associated with the executor</exception>
+        explicit named_pipe_server(std::wstring name, threading::io_completion_executor& executor, named_pipe_handler& handler,
+            named_pipe_server_options const& options = {});
+        named_pipe_server(named_pipe_server const&) = delete;
+        named_pipe_server(named_pipe_server&&) noexcept = delete;
+
+        /// <summary>
+        /// stops accepting clients, disconnects those connected and waits for outstanding I/O to complete, so the
+        /// executor must still be running
+        /// </summary>
+        ~named_pipe_server();
+        named_pipe_server& operator=(named_pipe_server const&) = delete;
+        named_pipe_server& operator=(named_pipe_server&&) noexcept = delete;
+
+        [[nodiscard]]
+        std::wstring const& name() const noexcept;
+
+        /// <summary>
+        /// returns the number of pipe instances created
+        /// </summary>
+        [[nodiscard]]
+        std::size_t instance_count() const noexcept;
+
+        /// <summary>
+        /// returns the number of clients currently connected
+        /// </summary>
+        [[nodiscard]]
+        std::size_t connected_count() const noexcept;
+
+    private:
+        friend class named_pipe_connection;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::wstring name_;
+        threading::io_completion_executor& executor_;
+        named_pipe_handler& handler_;
+        named_pipe_server_options options_;
+        std::size_t block_size_{};
+
+        mutable threading::slim_lock instances_lock_{};
+        std::vector<std::unique_ptr<named_pipe_connection>> instances_{};
+        threading::slim_lock pool_lock_{};
+        std::vector<std::byte*> free_blocks_{};
+
+        std::atomic<std::size_t> listening_{};
+        std::atomic<std::size_t> connected_{};
+        std::atomic<std::uint32_t> outstanding_{};
+        std::atomic<std::uint64_t> next_id_{};
+        std::atomic<bool> stopping_{};
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        invalid_handle create_instance(bool first) const;
+        void add_instance(invalid_handle&& pipe);
+        void grow() noexcept;
+        void stop() noexcept;
+
+        [[nodiscard]]
+        std::byte* acquire_block() noexcept;
+        void release_block(std::byte* block) noexcept;
+    };
+
+}
+
+#endif
+#endif
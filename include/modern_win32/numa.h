@@ -0,0 +1,92 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_NUMA_H_
+#define MODERN_WIN32_NUMA_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/processor_topology.h>
+#include <modern_win32/virtual_arena.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// returns the highest NUMA node number, 0 on systems which are not NUMA
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<DWORD> highest_numa_node() noexcept;
+
+    /// <summary>
+    /// returns the numbers of every NUMA node with at least one active processor
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::vector<DWORD> get_numa_nodes();
+
+    /// <summary>
+    /// returns the processors belonging to <paramref name="node"/>
+    /// </summary>
+    /// <returns>the affinity of the node or std::nullopt if the node does not exist</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<threading::group_affinity> get_numa_node_affinity(DWORD node) noexcept;
+
+    /// <summary>
+    /// returns the amount of physical memory currently available on <paramref name="node"/>
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<std::uint64_t> get_numa_node_available_memory(DWORD node) noexcept;
+
+    /// <summary>
+    /// returns the NUMA node of the processor the calling thread is currently running on
+    /// </summary>
+    /// <remarks>unless the thread is bound to the node, see <see cref="bind_current_thread_to_numa_node"/>, it may be moved at any time</remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<DWORD> current_numa_node() noexcept;
+
+    /// <summary>
+    /// restricts the calling thread to the processors of <paramref name="node"/> using
+    /// <see cref="threading::set_thread_group_affinity"/>
+    /// </summary>
+    /// <returns>true on success; otherwise, false</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool bind_current_thread_to_numa_node(DWORD node) noexcept;
+
+    /// <summary>
+    /// reserves and commits <paramref name="size"/> bytes of read/write memory backed by physical memory on
+    /// <paramref name="node"/> when it is available
+    /// </summary>
+    /// <returns>the memory, released with VirtualFree when the handle is destroyed, or an invalid handle on failure</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT virtual_memory_handle allocate_on_numa_node(std::size_t size, DWORD node) noexcept;
+
+    /// <summary>
+    /// creates an arena whose memory is placed on the NUMA node of the calling thread
+    /// </summary>
+    /// <remarks>
+    /// bind the thread first, see <see cref="bind_current_thread_to_numa_node"/>, otherwise the node is only the
+    /// one the thread happened to be running on
+    /// </remarks>
+    /// <exception cref="windows_exception">if the node could not be determined or the range could not be reserved</exception>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT virtual_arena make_numa_local_arena(std::size_t reserve_size, arena_page_size page_size = arena_page_size::standard,
+        std::size_t commit_size = virtual_arena::default_commit_size);
+
+}
+
+#endif
+#endif
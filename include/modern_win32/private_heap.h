@@ -0,0 +1,219 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PRIVATE_HEAP_H_
+#define MODERN_WIN32_PRIVATE_HEAP_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/unique_handle.h>
+#include <modern_win32/win_memory.h>
+
+namespace modern_win32
+{
+    struct heap_traits final
+    {
+        using native_handle_type = HANDLE;
+
+        static constexpr native_handle_type invalid() noexcept
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const handle) noexcept
+        {
+            static_cast<void>(HeapDestroy(handle));
+        }
+    };
+    using heap_handle = unique_handle<heap_traits>;
+
+    enum class heap_options : DWORD
+    {
+        none = 0,
+
+        /// <summary>
+        /// the heap performs no locking of its own, it must only ever be used by one thread at a time and cannot
+        /// use the low fragmentation heap
+        /// </summary>
+        no_serialize = HEAP_NO_SERIALIZE,
+    };
+
+    /// <summary>
+    /// a heap owned by the caller, isolated from the process heap shared by every module in the process
+    /// </summary>
+    /// <remarks>
+    /// destroying the heap releases every allocation made from it in a single call, memory allocated from the heap
+    /// must not be used, or freed, once the heap is destroyed
+    /// </remarks>
+    class MODERN_WIN32_EXPORT private_heap final
+    {
+    public:
+        using native_handle_type = heap_handle::native_handle_type;
+
+        /// <summary>
+        /// creates a growable heap, serialized heaps use the low fragmentation heap
+        /// </summary>
+        /// <param name="options">creation options</param>
+        /// <param name="initial_size">bytes initially committed, rounded up to a page; 0 commits a single page</param>
+        /// <param name="maximum_size">maximum size of the heap, 0 allows it to grow to the limit of available memory</param>
+        /// <exception cref="windows_exception">if the heap could not be created</exception>
+        explicit private_heap(heap_options options = heap_options::none, std::size_t initial_size = 0, std::size_t maximum_size = 0);
+        private_heap(private_heap const&) = delete;
+        private_heap(private_heap&&) noexcept = default;
+        ~private_heap() = default;
+        private_heap& operator=(private_heap const&) = delete;
+        private_heap& operator=(private_heap&&) noexcept = default;
+
+        /// <summary>
+        /// allocates <paramref name="size"/> bytes aligned to MEMORY_ALLOCATION_ALIGNMENT
+        /// </summary>
+        /// <returns>the allocated memory or nullptr if the allocation failed</returns>
+        [[nodiscard]]
+        void* allocate(std::size_t size) const noexcept;
+
+        /// <summary>
+        /// returns <paramref name="memory"/> to the heap, nullptr is ignored
+        /// </summary>
+        void free(void* memory) const noexcept;
+
+        /// <summary>
+        /// allocates an uninitialized array of <paramref name="count"/> T owned by the heap
+        /// </summary>
+        template <typename T>
+        [[nodiscard]]
+        unique_heap_array<T> allocate_array(std::size_t const count) const
+        {
+            return unique_heap_array<T>(native_handle(), count);
+        }
+
+        /// <summary>
+        /// returns a deleter which frees memory to this heap
+        /// </summary>
+        [[nodiscard]]
+        heap_deleter get_deleter() const noexcept;
+
+        /// <summary>
+        /// coalesces free blocks and decommits large free regions
+        /// </summary>
+        /// <returns>the size of the largest committed free block</returns>
+        std::size_t compact() const noexcept;
+
+        /// <summary>
+        /// returns true if the heap is valid
+        /// </summary>
+        [[nodiscard]]
+        explicit operator bool() const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+    private:
+        heap_handle handle_;
+    };
+
+    /// <summary>
+    /// std::pmr::memory_resource allocating from a Win32 heap, letting pmr containers use an isolated
+    /// <see cref="private_heap"/> which is released in one call once the containers are gone
+    /// </summary>
+    /// <remarks>
+    /// the heap is not owned and must outlive the resource and everything allocated through it. alignments above
+    /// MEMORY_ALLOCATION_ALIGNMENT over-allocate and store the original block immediately before the aligned one
+    /// </remarks>
+    class heap_memory_resource final : public std::pmr::memory_resource
+    {
+    public:
+        /// <summary>
+        /// creates a resource allocating from the process heap
+        /// </summary>
+        explicit heap_memory_resource() noexcept
+            : heap_(GetProcessHeap())
+        {
+        }
+
+        /// <summary>
+        /// creates a resource allocating from <paramref name="heap"/>
+        /// </summary>
+        explicit heap_memory_resource(private_heap const& heap) noexcept
+            : heap_(heap.native_handle())
+        {
+        }
+
+        /// <summary>
+        /// creates a resource allocating from <paramref name="heap"/>, a handle returned by HeapCreate or GetProcessHeap
+        /// </summary>
+        explicit heap_memory_resource(HANDLE const heap) noexcept
+            : heap_(heap)
+        {
+        }
+
+        [[nodiscard]]
+        HANDLE heap() const noexcept
+        {
+            return heap_;
+        }
+
+    private:
+        HANDLE heap_;
+
+        [[nodiscard]]
+        static constexpr bool is_over_aligned(std::size_t const alignment) noexcept
+        {
+            return alignment > MEMORY_ALLOCATION_ALIGNMENT;
+        }
+
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            if (!is_over_aligned(alignment)) {
+                auto* const memory = HeapAlloc(heap_, 0, bytes);
+                if (memory == nullptr)
+                    throw std::bad_alloc();
+                return memory;
+            }
+
+            // the heap aligns to MEMORY_ALLOCATION_ALIGNMENT so the gap before the aligned block always fits a pointer
+            if (bytes > static_cast<std::size_t>(-1) - alignment)
+                throw std::bad_alloc();
+            auto* const memory = HeapAlloc(heap_, 0, bytes + alignment);
+            if (memory == nullptr)
+                throw std::bad_alloc();
+            auto const aligned = (reinterpret_cast<std::uintptr_t>(memory) + alignment) & ~(static_cast<std::uintptr_t>(alignment) - 1U);
+            reinterpret_cast<void**>(aligned)[-1] = memory;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        void do_deallocate(void* const memory, std::size_t, std::size_t const alignment) override
+        {
+            HeapFree(heap_, 0, is_over_aligned(alignment)
+                ? static_cast<void**>(memory)[-1]
+                : memory);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            auto const* const other_heap = dynamic_cast<heap_memory_resource const*>(&other);
+            return other_heap != nullptr && other_heap->heap_ == heap_;
+        }
+    };
+
+}
+
+#endif
+#endif
@@ -20,9 +20,13 @@
 #include <modern_win32/process_enums.h>
 #include <modern_win32/process_module.h>
 #include <modern_win32/process_startup_info.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/windows_result.h>
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
+#include <ratio>
 #include <string>
 #include <Windows.h>
 
@@ -31,6 +35,72 @@ namespace modern_win32
     using process_handle = null_handle;
     using process_id_type = decltype(PROCESS_INFORMATION::dwProcessId);
 
+    /// <summary>
+    /// native resolution of process times, 100 nanosecond intervals; creation times are measured from 1 January 1601 UTC
+    /// </summary>
+    using process_time_duration = std::chrono::duration<std::int64_t, std::ratio<1, 10'000'000>>;
+
+    /// <summary>
+    /// resource usage of a process at a point in time, see <see cref="process::sample"/>
+    /// </summary>
+    struct process_sample final
+    {
+        std::chrono::steady_clock::time_point sampled_at{};
+        process_time_duration user_time{};
+        process_time_duration kernel_time{};
+        /// <summary>processor cycles consumed by every thread of the process, more precise than the times</summary>
+        std::uint64_t cycle_time{};
+        std::uint64_t working_set_bytes{};
+        std::uint64_t peak_working_set_bytes{};
+        /// <summary>private commit charge</summary>
+        std::uint64_t private_bytes{};
+        std::uint64_t pagefile_bytes{};
+        std::uint32_t page_fault_count{};
+        std::uint32_t handle_count{};
+        std::uint64_t read_operation_count{};
+        std::uint64_t write_operation_count{};
+        std::uint64_t other_operation_count{};
+        std::uint64_t read_transfer_bytes{};
+        std::uint64_t write_transfer_bytes{};
+        std::uint64_t other_transfer_bytes{};
+    };
+
+    /// <summary>
+    /// rates of change between two samples of the same process, see <see cref="sample_rates"/>
+    /// </summary>
+    struct process_sample_rates final
+    {
+        /// <summary>processor time used as a percentage of every processor in the system</summary>
+        double cpu_percent{};
+        /// <summary>processor time used in processors, 1.5 meaning one and a half processors were kept busy</summary>
+        double cpu_processors{};
+        double cycles_per_second{};
+        double page_faults_per_second{};
+        double read_operations_per_second{};
+        double write_operations_per_second{};
+        double other_operations_per_second{};
+        double read_bytes_per_second{};
+        double write_bytes_per_second{};
+        double other_bytes_per_second{};
+    };
+
+    /// <summary>
+    /// how a <see cref="process"/> constructed from an id obtains a handle for queries
+    /// </summary>
+    enum class process_handle_policy : std::uint8_t
+    {
+        /// <summary>each query opens and closes its own handle</summary>
+        open_per_query,
+        /// <summary>
+        /// the first query opens a handle with the rights needed by every query and keeps it, once the process is
+        /// seen to have exited the exit code is kept and the handle closed so later queries make no system calls;
+        /// queries may be made from several threads at once
+        /// </summary>
+        cached,
+    };
+
+    class process_memory;
+
     class MODERN_WIN32_EXPORT process final
     {
     public:
@@ -51,6 +121,7 @@ namespace modern_win32
 
         explicit process(native_handle_type const& handle = process_handle::invalid());
         explicit process(process_id_type const& id);
+        explicit process(process_id_type const& id, process_handle_policy const handle_policy);
         explicit process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles = false);
         explicit process(process_id_type const& id, native_handle_type const& handle);
         explicit process(deconstruct_type const& id_handle_pair);
@@ -104,6 +175,12 @@ namespace modern_win32
         [[nodiscard]]
         process_handle& get() noexcept;
 
+        /// <summary>
+        /// returns how handles are obtained for queries when no handle is owned
+        /// </summary>
+        [[nodiscard]]
+        process_handle_policy handle_policy() const noexcept;
+
         /// <summary>
         /// Retrieves the process identifier of the process.
         /// </summary>
@@ -170,24 +247,93 @@ namespace modern_win32
         /// <summary>
         /// returns a collection of all modules in the process
         /// </summary>
-        /// <param name="max_count">maximum number of modules to retrieve</param>
-        /// <returns>a collection of all modules in the process</returns>
+        /// <param name="max_count">maximum number of modules to retrieve, any beyond this are omitted</param>
+        /// <returns>a collection of up to <paramref name="max_count"/> modules in the process</returns>
         /// <exception cref="windows_exception">if error occurs with Win32 API</exception>
         /// <exception cref="std::invalid_argument">if max_count is 0</exception>
         [[nodiscard]]
         std::vector<process_module> get_modules(DWORD max_count = 1024) const;
 
+        /// <summary>
+        /// returns every module in the process, the handle buffer is grown until it holds all of them
+        /// </summary>
+        /// <param name="include_information">
+        /// if true the base address, size and entry point of each module are retrieved during enumeration rather than
+        /// on first use of <see cref="process_module::get_information"/>
+        /// </param>
+        /// <returns>a collection of all modules in the process, names are retrieved on first use and cached</returns>
+        /// <exception cref="windows_exception">if error occurs with Win32 API</exception>
+        [[nodiscard]]
+        std::vector<process_module> enumerate_modules(bool include_information = false) const;
+
+        /// <summary>
+        /// reads the processor times, cycle time, memory, I/O and handle counters of the process in one go
+        /// </summary>
+        /// <returns>the sample, or <see cref="std::nullopt"/> if the process can't be opened or queried</returns>
+        /// <remarks>
+        /// intended to be called often, a process constructed with <see cref="process_handle_policy::cached"/> reuses
+        /// its handle and no exceptions are thrown. Memory counters need Windows 8.1 or later for processes opened by id.
+        /// </remarks>
+        [[nodiscard]]
+        std::optional<process_sample> sample() const noexcept;
+
+        /// <summary>
+        /// returns a reader of the process memory, defined in modern_win32/process_memory.h
+        /// </summary>
+        /// <remarks>the process must have been opened with process_vm_read and process_query_information rights</remarks>
+        /// <exception cref="windows_exception">if the process handle could not be duplicated or opened</exception>
+        [[nodiscard]]
+        process_memory memory() const;
+
     private:
 
 #       pragma warning(push)
 #       pragma warning(disable : 4251)
         process_handle handle_;
+        mutable process_handle cached_handle_{};
+        mutable std::optional<exit_code_type> cached_exit_code_{};
 #       pragma warning(pop)
+        mutable threading::slim_lock cache_lock_{};
         process_id_type id_;
+        process_handle_policy handle_policy_{ process_handle_policy::open_per_query };
+
+        /// <summary>
+        /// handle used by a single query, keeps the cached handle open until the query is complete
+        /// </summary>
+        class query_lease;
 
         void close() noexcept;
+
+        /// <summary>
+        /// returns the owned handle if any, otherwise the cached handle or a newly opened handle depending on the
+        /// handle policy; the leased handle may be invalid if the process can't be opened or has since exited
+        /// </summary>
+        [[nodiscard]]
+        query_lease query_handle() const noexcept;
+
+        /// <summary>
+        /// keeps <paramref name="exit_code"/> and closes the cached handle, when <paramref name="lease"/> holds the
+        /// cached handle; the lease no longer keeps the handle open once this returns
+        /// </summary>
+        void record_exit(query_lease& lease, exit_code_type exit_code) const noexcept;
+
+        /// <summary>
+        /// returns the exit code kept by <see cref="record_exit"/>, if any
+        /// </summary>
+        [[nodiscard]]
+        std::optional<exit_code_type> recorded_exit_code() const noexcept;
     };
 
+    /// <summary>
+    /// converts the change between <paramref name="earlier"/> and <paramref name="later"/> into rates per second
+    /// </summary>
+    /// <param name="processor_count">
+    /// processors cpu_percent is relative to, if 0 the active processors of every processor group
+    /// </param>
+    /// <returns>the rates, all zero if <paramref name="later"/> is not after <paramref name="earlier"/></returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT process_sample_rates sample_rates(process_sample const& earlier, process_sample const& later, std::uint32_t processor_count = 0U) noexcept;
+
     /// <summary>
     /// Opens an existing local process object.
     /// </summary>
@@ -205,6 +351,14 @@ namespace modern_win32
     [[nodiscard]]
     MODERN_WIN32_EXPORT process open_process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles = false);
 
+    /// <summary>
+    /// opens an existing local process object as <see cref="open_process"/> does, returning the error rather than
+    /// throwing when the process can not be opened, such as when access is denied
+    /// </summary>
+    /// <returns>the opened process; otherwise, the error, <see cref="windows_error::error_invalid_parameter"/> if <paramref name="id"/> is 0</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<process> try_open_process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles = false) noexcept;
+
     /// <summary>
     /// Starts the process resource that is specified by the parameter containing process start information
     /// (for example, the file name of the process to start) and associates the resource with a new Process component.
@@ -242,6 +396,22 @@ namespace modern_win32
     [[nodiscard]]
     process start_process(wide_process_startup_info const& startup_info);
 
+    /// <summary>
+    /// starts a process as <see cref="start_process(narrow_process_startup_info const&)"/> does, returning the error
+    /// rather than throwing if the process could not be created
+    /// </summary>
+    /// <returns>
+    /// the started process; otherwise, the error, <see cref="windows_error::error_file_not_found"/> if the filename
+    /// in <paramref name="startup_info"/> does not exist
+    /// </returns>
+    /// <exception cref="windows_exception">if extended startup attributes, such as group affinity, could not be built</exception>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<process> try_start_process(narrow_process_startup_info const& startup_info);
+
+    /// <summary><see cref="try_start_process(narrow_process_startup_info const&)"/></summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<process> try_start_process(wide_process_startup_info const& startup_info);
+
     /// <summary>
     /// Starts a process resource by specifying the name of an application and
     /// a set of command-line arguments, and associates the resource
@@ -0,0 +1,107 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PROCESS_LAUNCHER_H_
+#define MODERN_WIN32_PROCESS_LAUNCHER_H_
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/process.h>
+#include <modern_win32/process_startup_info.h>
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <Windows.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// starts any number of processes of the same executable with the same environment, doing the work
+    /// <see cref="start_process"/> repeats on every call only once
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// the executable is resolved and checked for existence, and the environment block built, on construction.
+    /// The resolved path is passed to CreateProcess as the application name so it isn't searched for again on each
+    /// launch.
+    /// </para>
+    /// <para>
+    /// <see cref="launch"/> is const and may be called from several threads at once; the only per launch buffer,
+    /// the command line which CreateProcess may write to, is a per thread buffer reused between launches.
+    /// </para>
+    /// </remarks>
+    template <typename TCHAR>
+    class process_launcher final
+    {
+    public:
+        using string_type = std::basic_string<TCHAR>;
+        using string_view_type = std::basic_string_view<TCHAR>;
+        using native_startup_info_type = std::conditional_t<std::is_same_v<TCHAR, wchar_t>, STARTUPINFOW, STARTUPINFOA>;
+
+        /// <summary>
+        /// Instantiates a new instance of the process_launcher class using the filename, default arguments,
+        /// directory, environment, window and handle inheritance settings of <paramref name="startup_info"/>
+        /// </summary>
+        /// <exception cref="std::filesystem::filesystem_error">if the filename of <paramref name="startup_info"/> is not found</exception>
+        /// <remarks>standard output and error pipes are not supported, pipes of <paramref name="startup_info"/> are ignored</remarks>
+        explicit process_launcher(process_startup_info<TCHAR> const& startup_info);
+
+        /// <summary>
+        /// starts the executable with the default arguments
+        /// </summary>
+        /// <exception cref="windows_exception">if there is an error in the native CreateProcess call</exception>
+        [[nodiscard]]
+        process launch() const;
+
+        /// <summary>
+        /// starts the executable with <paramref name="arguments"/> in place of the default arguments
+        /// </summary>
+        /// <exception cref="windows_exception">if there is an error in the native CreateProcess call</exception>
+        [[nodiscard]]
+        process launch(string_view_type arguments) const;
+
+        /// <summary>
+        /// returns the absolute path of the executable being launched
+        /// </summary>
+        [[nodiscard]]
+        std::filesystem::path const& executable() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::filesystem::path executable_;
+        string_type application_name_;
+        string_type command_prefix_;
+        string_type default_arguments_;
+        string_type directory_;
+        std::vector<TCHAR> environment_block_;
+#       pragma warning(pop)
+        native_startup_info_type native_startup_info_{};
+        process_creation_options creation_options_{};
+        bool inherit_handles_{};
+    };
+
+    extern template class MODERN_WIN32_EXPORT process_launcher<char>;
+    extern template class MODERN_WIN32_EXPORT process_launcher<wchar_t>;
+
+    using narrow_process_launcher = process_launcher<char>;
+    using wide_process_launcher = process_launcher<wchar_t>;
+
+}
+
+#endif
+#endif
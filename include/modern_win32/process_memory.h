@@ -0,0 +1,237 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PROCESS_MEMORY_H_
+#define MODERN_WIN32_PROCESS_MEMORY_H_
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/process.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <Windows.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// a range of pages in another process sharing the same state, protection and type, see VirtualQueryEx
+    /// </summary>
+    struct memory_region final
+    {
+        std::uintptr_t base_address{};
+        std::size_t size{};
+        DWORD state{};
+        DWORD protection{};
+        DWORD type{};
+
+        [[nodiscard]]
+        constexpr std::uintptr_t end_address() const noexcept
+        {
+            return base_address + size;
+        }
+
+        [[nodiscard]]
+        constexpr bool contains(std::uintptr_t const address) const noexcept
+        {
+            return address >= base_address && address < end_address();
+        }
+
+        /// <summary>
+        /// returns true if the region is committed and neither guard nor no access pages
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool is_readable() const noexcept
+        {
+            return state == MEM_COMMIT && protection != 0UL && (protection & (PAGE_NOACCESS | PAGE_GUARD)) == 0UL;
+        }
+    };
+
+    /// <summary>
+    /// a single read of a <see cref="process_memory::read_scatter"/> batch
+    /// </summary>
+    struct memory_read_request final
+    {
+        std::uintptr_t address{};
+        void* destination{};
+        std::size_t size{};
+        /// <summary>set to the number of bytes copied to destination</summary>
+        std::size_t bytes_read{};
+    };
+
+    /// <summary>
+    /// reads the memory of another process, which must have been opened with process_vm_read and
+    /// process_query_information rights
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// the region map is built once with VirtualQueryEx and cached until <see cref="refresh_regions"/>, the target
+    /// keeps running so the map, like any read, is only a snapshot.
+    /// </para>
+    /// <para>
+    /// reads report failure through the number of bytes read rather than exceptions; an instance is not safe for
+    /// concurrent use while the region map is being built or refreshed.
+    /// </para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT process_memory final
+    {
+    public:
+        /// <summary>
+        /// largest span a scatter read coalesces neighbouring requests into
+        /// </summary>
+        static constexpr std::size_t max_coalesced_read = 64U * 1024U;
+
+        /// <summary>
+        /// Instantiates a new instance of the process_memory class for <paramref name="target"/>, its handle is
+        /// duplicated or, for a process constructed from an id, a new handle is opened
+        /// </summary>
+        /// <exception cref="windows_exception">if the process could not be opened</exception>
+        explicit process_memory(process const& target);
+
+        /// <summary>
+        /// Instantiates a new instance of the process_memory class opening the process identified by <paramref name="id"/>
+        /// </summary>
+        /// <exception cref="windows_exception">if the process could not be opened</exception>
+        explicit process_memory(process_id_type id);
+
+        /// <summary>
+        /// returns the committed and reserved regions of the process in address order, building the map on first use
+        /// </summary>
+        [[nodiscard]]
+        std::vector<memory_region> const& regions() const;
+
+        /// <summary>
+        /// discards and rebuilds the region map
+        /// </summary>
+        std::vector<memory_region> const& refresh_regions() const;
+
+        /// <summary>
+        /// returns the region containing <paramref name="address"/> from the cached map
+        /// </summary>
+        [[nodiscard]]
+        std::optional<memory_region> find_region(std::uintptr_t address) const;
+
+        /// <summary>
+        /// reads up to <paramref name="size"/> bytes at <paramref name="address"/> into <paramref name="buffer"/>
+        /// </summary>
+        /// <returns>the number of bytes read, less than size if part of the range is not readable</returns>
+        [[nodiscard]]
+        std::size_t read(std::uintptr_t address, void* buffer, std::size_t size) const noexcept;
+
+        /// <summary>
+        /// reads a <typeparamref name="T"/> at <paramref name="address"/>
+        /// </summary>
+        /// <returns>the value, or <see cref="std::nullopt"/> if it could not be read in full</returns>
+        template <typename T>
+        [[nodiscard]]
+        std::optional<T> read(std::uintptr_t const address) const noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "T must be trivially copyable");
+
+            T value{};
+            if (read(address, &value, sizeof(T)) != sizeof(T))
+                return std::nullopt;
+            return value;
+        }
+
+        /// <summary>
+        /// performs every read of <paramref name="requests"/>, requests for nearby addresses are coalesced into a
+        /// single ReadProcessMemory call of up to <see cref="max_coalesced_read"/> bytes
+        /// </summary>
+        /// <returns>the number of requests read in full</returns>
+        [[maybe_unused]]
+        std::size_t read_scatter(memory_read_request* requests, std::size_t count) const;
+
+        /// <summary><see cref="read_scatter(memory_read_request*, std::size_t)"/></summary>
+        [[maybe_unused]]
+        std::size_t read_scatter(std::vector<memory_read_request>& requests) const
+        {
+            return read_scatter(requests.data(), requests.size());
+        }
+
+        /// <summary>
+        /// reads <paramref name="region"/> in chunks of up to <paramref name="buffer_size"/> bytes into
+        /// <paramref name="buffer"/>, passing each chunk to <paramref name="callback"/>
+        /// </summary>
+        /// <param name="callback">
+        /// invoked as bool(std::uintptr_t address, char const* data, std::size_t size), returning false stops the stream
+        /// </param>
+        /// <returns>the number of bytes read</returns>
+        template <typename CALLABLE>
+        [[maybe_unused]]
+        std::size_t stream(memory_region const& region, char* const buffer, std::size_t const buffer_size, CALLABLE&& callback) const
+        {
+            std::size_t total{};
+            for (std::size_t offset = 0; offset < region.size && buffer_size > 0;) {
+                auto const chunk = (std::min)(buffer_size, region.size - offset);
+                auto const address = region.base_address + offset;
+                auto const bytes_read = read(address, buffer, chunk);
+                total += bytes_read;
+                if (bytes_read > 0 && !std::invoke(callback, address, static_cast<char const*>(buffer), bytes_read))
+                    break;
+                // the unread remainder of a partial read has become inaccessible since the map was built
+                offset += chunk;
+            }
+            return total;
+        }
+
+        /// <summary>
+        /// streams every readable region of the map, see <see cref="stream"/>
+        /// </summary>
+        /// <returns>the number of bytes read</returns>
+        template <typename CALLABLE>
+        [[maybe_unused]]
+        std::size_t stream_readable(char* const buffer, std::size_t const buffer_size, CALLABLE&& callback) const
+        {
+            std::size_t total{};
+            auto stopped = false;
+            for (auto const& region : regions()) {
+                if (!region.is_readable())
+                    continue;
+                total += stream(region, buffer, buffer_size, [&callback, &stopped](std::uintptr_t const address, char const* const data, std::size_t const size) {
+                    stopped = !std::invoke(callback, address, data, size);
+                    return !stopped;
+                });
+                if (stopped)
+                    break;
+            }
+            return total;
+        }
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        process_handle::native_handle_type native_handle() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        process_handle handle_;
+        mutable std::optional<std::vector<memory_region>> regions_{};
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        std::size_t read_individually(memory_read_request* const* first, memory_read_request* const* last) const noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -16,6 +16,8 @@
 #ifdef _WIN32
 
 #include <Windows.h>
+#include <cstddef>
+#include <optional>
 #include <string>
 
 #include <modern_win32/modern_win32_export.h>
@@ -24,11 +26,30 @@
 namespace modern_win32
 {
 
+    /// <summary>
+    /// load address and extent of a module, as returned by GetModuleInformation
+    /// </summary>
+    struct module_information final
+    {
+        void* base_address{};
+        std::size_t size{};
+        void* entry_point{};
+    };
 
+    /// <summary>
+    /// a module loaded by a process, names and information are fetched on first access and cached
+    /// </summary>
+    /// <remarks>
+    /// the first call to each accessor populates the cache so must not race with another call on the same instance,
+    /// copies are independent
+    /// </remarks>
     class process_module final
     {
         HANDLE process_{};
         HMODULE module_{};
+        mutable std::optional<std::wstring> name_{};
+        mutable std::optional<std::wstring> filename_{};
+        mutable std::optional<module_information> information_{};
     public:
         using native_process_handle_type = HANDLE;
         using native_module_handle_type = HMODULE;
@@ -39,7 +60,7 @@ namespace modern_win32
         /// <returns>the module name</returns>
         /// <exception cref="windows_exception">if WIN32 API fails</exception>
         [[nodiscard]]
-        MODERN_WIN32_EXPORT std::wstring get_name() const;
+        MODERN_WIN32_EXPORT std::wstring const& get_name() const;
 
         /// <summary>
         /// returns the modules full path as a string
@@ -47,7 +68,14 @@ namespace modern_win32
         /// <returns>the modules full path as a string</returns>
         /// <exception cref="windows_exception">if WIN32 API fails</exception>
         [[nodiscard]]
-        MODERN_WIN32_EXPORT std::wstring get_filename() const;
+        MODERN_WIN32_EXPORT std::wstring const& get_filename() const;
+
+        /// <summary>
+        /// returns the base address, size and entry point of the module
+        /// </summary>
+        /// <exception cref="windows_exception">if WIN32 API fails</exception>
+        [[nodiscard]]
+        MODERN_WIN32_EXPORT module_information const& get_information() const;
 
         /// <summary>
         /// instantiates a new process_module
@@ -60,6 +88,11 @@ namespace modern_win32
         /// </remarks>
         MODERN_WIN32_EXPORT explicit process_module(native_process_handle_type process, native_module_handle_type module);
 
+        /// <summary>
+        /// instantiates a new process_module with information already retrieved by the caller
+        /// </summary>
+        MODERN_WIN32_EXPORT explicit process_module(native_process_handle_type process, native_module_handle_type module, module_information const& information);
+
         [[nodiscard]]
         constexpr native_process_handle_type process_handle() const noexcept
         {
@@ -0,0 +1,191 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PROCESS_PIPE_H_
+#define MODERN_WIN32_PROCESS_PIPE_H_
+#ifdef _WIN32
+
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/threading/slim_lock.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <Windows.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// caller owned memory a <see cref="process_output_pipe"/> reads into
+    /// </summary>
+    struct process_output_buffer final
+    {
+        char* data{};
+        std::size_t size{};
+
+        [[nodiscard]]
+        constexpr bool empty() const noexcept
+        {
+            return data == nullptr || size == 0;
+        }
+    };
+
+    /// <summary>
+    /// consumer of the output read from a child process, methods are called on the executor threads but never
+    /// concurrently with each other for the same pipe
+    /// </summary>
+    class MODERN_WIN32_EXPORT process_output_handler
+    {
+    public:
+        process_output_handler() = default;
+        process_output_handler(process_output_handler const&) = delete;
+        process_output_handler(process_output_handler&&) noexcept = delete;
+        virtual ~process_output_handler() = default;
+        process_output_handler& operator=(process_output_handler const&) = delete;
+        process_output_handler& operator=(process_output_handler&&) noexcept = delete;
+
+        /// <summary>
+        /// returns the buffer the next read is made into, an empty buffer pauses reading until
+        /// <see cref="process_output_pipe::resume"/> is called
+        /// </summary>
+        [[nodiscard]]
+        virtual process_output_buffer next_buffer() noexcept = 0;
+
+        /// <summary>
+        /// called once <paramref name="bytes_read"/> bytes have been read into the start of <paramref name="buffer"/>,
+        /// the buffer belongs to the caller again
+        /// </summary>
+        virtual void on_data(process_output_buffer buffer, std::size_t bytes_read) noexcept = 0;
+
+        /// <summary>
+        /// called once reading has ended, <paramref name="error"/> is ERROR_BROKEN_PIPE once the child has closed its
+        /// end of the pipe and ERROR_OPERATION_ABORTED if the pipe was destroyed while reading
+        /// </summary>
+        virtual void on_closed(DWORD error) noexcept = 0;
+    };
+
+    /// <summary>
+    /// overlapped named pipe used to redirect standard output or error of a child process, see
+    /// <see cref="process_startup_info_builder::with_stdout_pipe"/>
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// anonymous pipes don't support overlapped I/O so the pipe is a uniquely named, local only, single instance
+    /// named pipe with the parent's end opened overlapped and associated with an io_completion_executor.
+    /// </para>
+    /// <para>
+    /// a single read is outstanding at a time, into the buffer returned by
+    /// <see cref="process_output_handler::next_buffer"/>. A handler which stops supplying buffers leaves the data in
+    /// the pipe, once the pipe buffer is full the child blocks on write so memory use stays bounded however much the
+    /// child writes.
+    /// </para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT process_output_pipe final : public threading::io_completion_handler
+    {
+    public:
+        static constexpr DWORD default_pipe_buffer_size = 64UL * 1024UL;
+
+        /// <summary>
+        /// Instantiates a new instance of the process_output_pipe class
+        /// </summary>
+        /// <param name="executor">executor whose threads complete the reads, must outlive the pipe</param>
+        /// <param name="handler">consumer of the output, must outlive the pipe</param>
+        /// <param name="pipe_buffer_size">
+        /// size requested for the pipe's buffer, the amount the child can write ahead of the reader
+        /// </param>
+        /// <exception cref="windows_exception">if the pipe could not be created or associated with the executor</exception>
+        explicit process_output_pipe(threading::io_completion_executor const& executor, process_output_handler& handler,
+            DWORD pipe_buffer_size = default_pipe_buffer_size);
+        process_output_pipe(process_output_pipe const&) = delete;
+        process_output_pipe(process_output_pipe&&) noexcept = delete;
+
+        /// <summary>
+        /// cancels a read in progress and blocks until it has completed
+        /// </summary>
+        /// <remarks>
+        /// <see cref="process_output_handler::on_closed"/> is not called if reading has not started or is paused
+        /// </remarks>
+        ~process_output_pipe() override;
+        process_output_pipe& operator=(process_output_pipe const&) = delete;
+        process_output_pipe& operator=(process_output_pipe&&) noexcept = delete;
+
+        /// <summary>
+        /// returns the inheritable end of the pipe given to the child
+        /// </summary>
+        [[nodiscard]]
+        HANDLE child_handle() const noexcept;
+
+        /// <summary>
+        /// closes this process's copy of the child end, so the pipe breaks once the child exits, and starts reading
+        /// </summary>
+        /// <remarks>called by start_process once the child has been created</remarks>
+        /// <exception cref="std::logic_error">if already started</exception>
+        void start();
+
+        /// <summary>
+        /// resumes reading after <see cref="process_output_handler::next_buffer"/> returned an empty buffer
+        /// </summary>
+        /// <returns>true if reading was paused and has resumed; otherwise, false</returns>
+        [[maybe_unused]]
+        bool resume();
+
+        /// <summary>
+        /// returns true once reading has ended
+        /// </summary>
+        [[nodiscard]]
+        bool is_closed() const;
+
+        /// <summary>
+        /// blocks until reading has ended or <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if reading has ended; otherwise, false</returns>
+        [[nodiscard]]
+        bool wait_for_close(std::chrono::milliseconds const& timeout) const;
+
+        void on_completion(threading::io_completion const& completion) noexcept override;
+
+    private:
+        enum class pipe_state : std::uint8_t
+        {
+            not_started,
+            reading,
+            paused,
+            closed,
+        };
+
+        invalid_handle server_;
+        invalid_handle child_;
+        process_output_handler& handler_;
+        OVERLAPPED overlapped_{};
+        process_output_buffer buffer_{};
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        mutable threading::slim_lock lock_{};
+        mutable threading::condition_variable changed_{};
+#       pragma warning(pop)
+        pipe_state state_{pipe_state::not_started};
+        bool stopping_{};
+
+        void read_next() noexcept;
+        void finish(DWORD error) noexcept;
+    };
+
+}
+
+#endif
+#endif
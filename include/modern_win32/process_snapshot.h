@@ -0,0 +1,193 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PROCESS_SNAPSHOT_H_
+#define MODERN_WIN32_PROCESS_SNAPSHOT_H_
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/process.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ratio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// source used to capture a <see cref="process_snapshot"/>
+    /// </summary>
+    enum class process_snapshot_source : std::uint8_t
+    {
+        /// <summary>captured using NtQuerySystemInformation, every field is populated</summary>
+        system_information,
+        /// <summary>
+        /// captured using CreateToolhelp32Snapshot, times, handle counts, session and memory figures are zero
+        /// </summary>
+        toolhelp,
+    };
+
+    /// <summary>
+    /// a single process of a <see cref="process_snapshot"/>, trivially copyable so snapshots can be copied and compared
+    /// cheaply; the image name is held by the owning snapshot, see <see cref="process_snapshot::name"/>
+    /// </summary>
+    struct process_snapshot_entry final
+    {
+        process_id_type id{};
+        process_id_type parent_id{};
+        std::uint32_t thread_count{};
+        std::uint32_t handle_count{};
+        std::uint32_t session_id{};
+        /// <summary>base priority of the process threads, 8 for normal priority class processes</summary>
+        std::int32_t base_priority{};
+        process_time_duration create_time{};
+        process_time_duration user_time{};
+        process_time_duration kernel_time{};
+        std::uint64_t working_set_bytes{};
+        std::uint64_t peak_working_set_bytes{};
+        std::uint64_t private_bytes{};
+        std::uint64_t virtual_bytes{};
+        std::uint64_t pagefile_bytes{};
+
+        std::uint32_t name_offset{};
+        std::uint32_t name_length{};
+
+        /// <summary>
+        /// returns true if <paramref name="other"/> is the same process rather than a later process re-using the id
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool same_process(process_snapshot_entry const& other) const noexcept
+        {
+            return id == other.id && create_time == other.create_time;
+        }
+    };
+
+    /// <summary>
+    /// ids of processes which started or exited between two snapshots
+    /// </summary>
+    struct process_snapshot_difference final
+    {
+        std::vector<process_id_type> started{};
+        std::vector<process_id_type> exited{};
+    };
+
+    /// <summary>
+    /// every process on the system captured in a single pass, without opening any of them
+    /// </summary>
+    /// <remarks>
+    /// entries are sorted by process id so that lookups are O(log n) and two snapshots can be compared with a
+    /// single merge, names are packed into one buffer shared by all entries
+    /// </remarks>
+    class MODERN_WIN32_EXPORT process_snapshot final
+    {
+    public:
+        using const_iterator = std::vector<process_snapshot_entry>::const_iterator;
+
+        /// <summary>
+        /// Instantiates a new, empty, instance of the process_snapshot class
+        /// </summary>
+        process_snapshot() = default;
+
+        /// <summary>
+        /// captures every process on the system, using NtQuerySystemInformation and falling back to
+        /// CreateToolhelp32Snapshot if it is unavailable
+        /// </summary>
+        /// <exception cref="windows_exception">if neither source could be queried</exception>
+        [[nodiscard]]
+        static process_snapshot capture();
+
+        /// <summary>
+        /// replaces the contents of this snapshot with a new capture, re-using the existing storage
+        /// </summary>
+        /// <exception cref="windows_exception">if neither source could be queried</exception>
+        void refresh();
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept;
+        [[nodiscard]]
+        const_iterator end() const noexcept;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+        [[nodiscard]]
+        bool empty() const noexcept;
+
+        [[nodiscard]]
+        process_snapshot_entry const& operator[](std::size_t index) const noexcept;
+
+        /// <summary>
+        /// returns the entries sorted by process id
+        /// </summary>
+        [[nodiscard]]
+        std::vector<process_snapshot_entry> const& entries() const noexcept;
+
+        /// <summary>
+        /// returns the entry for <paramref name="id"/> if the process was running when captured
+        /// </summary>
+        [[nodiscard]]
+        process_snapshot_entry const* find(process_id_type id) const noexcept;
+
+        /// <summary>
+        /// returns the image name of <paramref name="entry"/>, such as "explorer.exe", valid for the lifetime of this snapshot
+        /// </summary>
+        [[nodiscard]]
+        std::wstring_view name(process_snapshot_entry const& entry) const noexcept;
+
+        [[nodiscard]]
+        process_snapshot_source source() const noexcept;
+
+        /// <summary>
+        /// time the snapshot was captured, used to turn differences in process times into utilisation
+        /// </summary>
+        [[nodiscard]]
+        std::chrono::steady_clock::time_point captured_at() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<process_snapshot_entry> entries_{};
+        std::wstring names_{};
+#       pragma warning(pop)
+        std::chrono::steady_clock::time_point captured_at_{};
+        process_snapshot_source source_{ process_snapshot_source::system_information };
+
+        [[nodiscard]]
+        bool capture_system_information();
+        void capture_toolhelp();
+        [[nodiscard]]
+        std::uint32_t append_name(std::wstring_view name);
+    };
+
+    /// <summary>
+    /// returns the processes which started or exited between <paramref name="previous"/> and <paramref name="current"/>,
+    /// a process id re-used by a new process is reported as both exited and started
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT process_snapshot_difference difference(process_snapshot const& previous, process_snapshot const& current);
+
+    /// <summary>
+    /// returns the cpu time consumed by the process of <paramref name="current"/> since <paramref name="previous"/>,
+    /// or std::nullopt if <paramref name="previous"/> describes a different process
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<process_time_duration> cpu_time_delta(process_snapshot_entry const& previous, process_snapshot_entry const& current) noexcept;
+
+}
+
+#endif
+#endif
@@ -15,14 +15,21 @@
 #define MODERN_WIN32_PROCESS_STARTUP_INFO_H_
 #ifdef _WIN32
 
+#include <cstdint>
 #include <map>
 #include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
+#include <Windows.h>
 #include <modern_win32/window_handle.h>
 
 namespace modern_win32
 {
+    class process_output_pipe;
+    template <typename TCHAR>
+    class environment_block;
+
     /// <summary>
     /// data transfer object storing details for process start up include command line arguments,
     /// environment settings, ...
@@ -127,6 +134,92 @@ namespace modern_win32
         __declspec(property(get = get_redirect_standard_error, put = set_redirect_standard_error))
         bool redirect_standard_error;
 
+        /// <summary>
+        /// pipe receiving standard output of the child, null to use the standard output of this process
+        /// </summary>
+        [[nodiscard]]
+        process_output_pipe* get_stdout_pipe() const
+        {
+            return stdout_pipe_;
+        }
+        void set_stdout_pipe(process_output_pipe* const stdout_pipe)
+        {
+            stdout_pipe_ = stdout_pipe;
+        }
+        __declspec(property(get = get_stdout_pipe, put = set_stdout_pipe)) process_output_pipe* stdout_pipe;
+
+        /// <summary>
+        /// pipe receiving standard error of the child, null to use the standard error of this process
+        /// </summary>
+        [[nodiscard]]
+        process_output_pipe* get_stderr_pipe() const
+        {
+            return stderr_pipe_;
+        }
+        void set_stderr_pipe(process_output_pipe* const stderr_pipe)
+        {
+            stderr_pipe_ = stderr_pipe;
+        }
+        __declspec(property(get = get_stderr_pipe, put = set_stderr_pipe)) process_output_pipe* stderr_pipe;
+
+        /// <summary>
+        /// handles inherited by the child, when not empty only these (and the child end of any pipes) are inherited
+        /// rather than every inheritable handle of this process; each must be inheritable
+        /// </summary>
+        [[nodiscard]]
+        std::vector<HANDLE> const& get_inherited_handles() const
+        {
+            return inherited_handles_;
+        }
+        void set_inherited_handles(std::vector<HANDLE> const& inherited_handles)
+        {
+            inherited_handles_ = inherited_handles;
+        }
+        __declspec(property(get = get_inherited_handles, put = set_inherited_handles)) std::vector<HANDLE> inherited_handles;
+
+        /// <summary>
+        /// processor group and affinity of the child's initial thread
+        /// </summary>
+        [[nodiscard]]
+        std::optional<GROUP_AFFINITY> const& get_group_affinity() const
+        {
+            return group_affinity_;
+        }
+        void set_group_affinity(std::optional<GROUP_AFFINITY> const& group_affinity)
+        {
+            group_affinity_ = group_affinity;
+        }
+        __declspec(property(get = get_group_affinity, put = set_group_affinity)) std::optional<GROUP_AFFINITY> group_affinity;
+
+        /// <summary>
+        /// NUMA node preferred for the child's memory and threads
+        /// </summary>
+        [[nodiscard]]
+        std::optional<std::uint16_t> const& get_ideal_node() const
+        {
+            return ideal_node_;
+        }
+        void set_ideal_node(std::optional<std::uint16_t> const& ideal_node)
+        {
+            ideal_node_ = ideal_node;
+        }
+        __declspec(property(get = get_ideal_node, put = set_ideal_node)) std::optional<std::uint16_t> ideal_node;
+
+        /// <summary>
+        /// process used as the parent of the child in place of this process, opened with PROCESS_CREATE_PROCESS;
+        /// not owned and must remain open until the process has started
+        /// </summary>
+        [[nodiscard]]
+        HANDLE get_parent_process() const
+        {
+            return parent_process_;
+        }
+        void set_parent_process(HANDLE const parent_process)
+        {
+            parent_process_ = parent_process;
+        }
+        __declspec(property(get = get_parent_process, put = set_parent_process)) HANDLE parent_process;
+
         [[nodiscard]]
         bool get_create_window() const
         {
@@ -163,6 +256,22 @@ namespace modern_win32
         __declspec(property(get = get_environment, put = set_environment))
         environment_variable_container environment;
 
+        /// <summary>
+        /// prebuilt environment of the child, used as is in place of <see cref="environment"/> when set; not owned
+        /// and must outlive the process start
+        /// </summary>
+        [[nodiscard]]
+        environment_block<TCHAR> const* get_environment_block() const
+        {
+            return environment_block_;
+        }
+        void set_environment_block(environment_block<TCHAR> const* const environment_block)
+        {
+            environment_block_ = environment_block;
+        }
+        __declspec(property(get = get_environment_block, put = set_environment_block))
+        environment_block<TCHAR> const* prebuilt_environment;
+
         [[nodiscard]]
         static constexpr bool is_wide() 
         {
@@ -225,9 +334,16 @@ namespace modern_win32
         bool redirect_standard_input_{false};
         bool redirect_standard_output_{false};
         bool redirect_standard_error_{false};
+        process_output_pipe* stdout_pipe_{};
+        process_output_pipe* stderr_pipe_{};
+        std::vector<HANDLE> inherited_handles_{};
+        std::optional<GROUP_AFFINITY> group_affinity_{};
+        std::optional<std::uint16_t> ideal_node_{};
+        HANDLE parent_process_{};
         bool create_window_{true};
         bool inherit_handles_{true};
         environment_variable_container environment_;
+        environment_block<TCHAR> const* environment_block_{};
     };
 
     using narrow_process_startup_info = process_startup_info<char>;
@@ -281,6 +397,53 @@ namespace modern_win32
             startup_info_.redirect_standard_error = redirect_standard_error;
             return *this;
         }
+        /// <summary>
+        /// redirects standard output of the child to <paramref name="pipe"/>, which must outlive the process start
+        /// </summary>
+        process_startup_info_builder& with_stdout_pipe(process_output_pipe& pipe)
+        {
+            startup_info_.stdout_pipe = &pipe;
+            return *this;
+        }
+        /// <summary>
+        /// redirects standard error of the child to <paramref name="pipe"/>, which must outlive the process start
+        /// </summary>
+        process_startup_info_builder& with_stderr_pipe(process_output_pipe& pipe)
+        {
+            startup_info_.stderr_pipe = &pipe;
+            return *this;
+        }
+        /// <summary>
+        /// adds <paramref name="handle"/> to the handles inherited by the child, see
+        /// <see cref="process_startup_info::inherited_handles"/>
+        /// </summary>
+        process_startup_info_builder& with_inherited_handle(HANDLE handle)
+        {
+            auto handles = startup_info_.get_inherited_handles();
+            handles.push_back(handle);
+            startup_info_.inherited_handles = handles;
+            return *this;
+        }
+        process_startup_info_builder& with_inherited_handles(std::vector<HANDLE> const& handles)
+        {
+            startup_info_.inherited_handles = handles;
+            return *this;
+        }
+        process_startup_info_builder& with_group_affinity(GROUP_AFFINITY const& group_affinity)
+        {
+            startup_info_.group_affinity = group_affinity;
+            return *this;
+        }
+        process_startup_info_builder& with_ideal_node(std::uint16_t ideal_node)
+        {
+            startup_info_.ideal_node = ideal_node;
+            return *this;
+        }
+        process_startup_info_builder& with_parent_process(HANDLE parent_process)
+        {
+            startup_info_.parent_process = parent_process;
+            return *this;
+        }
         process_startup_info_builder& with_create_window(bool create_window)
         {
             startup_info_.create_window = create_window;
@@ -302,6 +465,16 @@ namespace modern_win32
             return *this;
         }
 
+        /// <summary>
+        /// starts the child with <paramref name="environment_block"/> as is, see
+        /// <see cref="process_startup_info::get_environment_block"/>
+        /// </summary>
+        process_startup_info_builder& with_environment_block(environment_block<TCHAR> const& environment_block)
+        {
+            startup_info_.set_environment_block(&environment_block);
+            return *this;
+        }
+
         void reset()
         {
             startup_info_ = process_startup_info<TCHAR>();
@@ -0,0 +1,157 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_PROCESS_SUPERVISOR_H_
+#define MODERN_WIN32_PROCESS_SUPERVISOR_H_
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/process.h>
+#include <modern_win32/threading/executor.h>
+#include <modern_win32/threading/io_completion_port.h>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// exit of a process watched by a <see cref="process_supervisor"/>
+    /// </summary>
+    struct process_exit_event final
+    {
+        /// <summary>
+        /// exit code reported if the code could not be read, a process can exit with this value so it is only a hint
+        /// </summary>
+        static constexpr process::exit_code_type exit_code_unavailable = (std::numeric_limits<process::exit_code_type>::max)();
+
+        process_id_type id{};
+        process::exit_code_type exit_code{};
+    };
+
+    /// <summary>
+    /// reports the exit of any number of processes without a waiting thread per process
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// each watched process is registered with the Win32 thread pool (CreateThreadpoolWait) which multiplexes the
+    /// waits over its wait threads, 63 handles per thread, so thousands of processes need only a handful of threads.
+    /// </para>
+    /// <para>
+    /// exits are delivered either to a callback, run on an executor with every exit which occurred while the previous
+    /// batch was being handled, or as packets queued to an <see cref="threading::io_completion_port"/> which can be
+    /// removed in batches using <see cref="threading::io_completion_port::dequeue"/>.
+    /// </para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT process_supervisor final
+    {
+    public:
+        using exit_callback = std::function<void(std::vector<process_exit_event> const& events)>;
+
+        /// <summary>
+        /// Instantiates a new instance of the process_supervisor class delivering exits to <paramref name="callback"/>
+        /// </summary>
+        /// <param name="callback">invoked with each batch of exits, never concurrently with itself</param>
+        /// <param name="target">executor used to run <paramref name="callback"/>, must outlive the supervisor</param>
+        /// <exception cref="std::invalid_argument">if callback is empty</exception>
+        explicit process_supervisor(exit_callback callback, threading::executor& target = threading::default_threadpool_executor::instance());
+
+        /// <summary>
+        /// Instantiates a new instance of the process_supervisor class queueing a packet to <paramref name="port"/>
+        /// for each exit
+        /// </summary>
+        /// <param name="port">port to queue packets to, must outlive the supervisor</param>
+        /// <param name="key">
+        /// completion key of each packet; the process id is stored in the packet's overlapped pointer, see
+        /// <see cref="to_exit_event"/>, and the exit code in its bytes transferred
+        /// </param>
+        explicit process_supervisor(threading::io_completion_port const& port, ULONG_PTR key);
+        process_supervisor(process_supervisor const&) = delete;
+        process_supervisor(process_supervisor&&) noexcept = delete;
+
+        /// <summary>
+        /// stops watching, see <see cref="shutdown"/>
+        /// </summary>
+        ~process_supervisor();
+        process_supervisor& operator=(process_supervisor const&) = delete;
+        process_supervisor& operator=(process_supervisor&&) noexcept = delete;
+
+        /// <summary>
+        /// starts watching <paramref name="child"/>, its handle is duplicated so <paramref name="child"/> need not
+        /// outlive the supervisor; processes constructed from an id are opened
+        /// </summary>
+        /// <returns>true if the process is now watched; otherwise, false if it was already being watched</returns>
+        /// <exception cref="std::invalid_argument">if child has neither a handle nor an id</exception>
+        /// <exception cref="windows_exception">if the process couldn't be opened or the wait couldn't be created</exception>
+        /// <exception cref="std::logic_error">if the supervisor has been shut down</exception>
+        [[maybe_unused]]
+        bool watch(process const& child);
+
+        /// <summary>
+        /// starts watching the process identified by <paramref name="id"/>
+        /// </summary>
+        /// <returns>true if the process is now watched; otherwise, false if it was already being watched</returns>
+        /// <exception cref="windows_exception">if the process couldn't be opened or the wait couldn't be created</exception>
+        /// <exception cref="std::logic_error">if the supervisor has been shut down</exception>
+        [[maybe_unused]]
+        bool watch(process_id_type id);
+
+        /// <summary>
+        /// stops watching the process identified by <paramref name="id"/>, its exit won't be reported unless it has
+        /// already been queued for delivery
+        /// </summary>
+        /// <returns>true if the process was being watched; otherwise, false</returns>
+        [[maybe_unused]]
+        bool unwatch(process_id_type id);
+
+        /// <summary>
+        /// returns the number of processes watched which have not yet exited
+        /// </summary>
+        [[nodiscard]]
+        std::size_t size() const;
+
+        /// <summary>
+        /// returns the number of exit callbacks which ended with an exception, exceptions are not rethrown
+        /// </summary>
+        [[nodiscard]]
+        std::size_t unhandled_exception_count() const noexcept;
+
+        /// <summary>
+        /// stops watching every process and blocks until any delivery in progress has completed, exits not yet
+        /// delivered are discarded
+        /// </summary>
+        /// <remarks>must not be called from within the exit callback</remarks>
+        void shutdown();
+
+        /// <summary>
+        /// converts a packet queued by a supervisor constructed with a completion port back into an exit event
+        /// </summary>
+        [[nodiscard]]
+        static process_exit_event to_exit_event(threading::io_completion const& packet) noexcept;
+
+    private:
+        struct state;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::unique_ptr<state> state_;
+#       pragma warning(pop)
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,226 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_QPC_CLOCK_H_
+#define MODERN_WIN32_QPC_CLOCK_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <modern_win32/modern_win32_export.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#   define MODERN_WIN32_HAS_TSC_CLOCK  // NOLINT(clang-diagnostic-unused-macros)
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <x86intrin.h>
+#   endif
+#endif
+
+namespace modern_win32
+{
+    /// <summary>
+    /// converts <paramref name="ticks"/> of a counter running at <paramref name="frequency"/> ticks per second to
+    /// nanoseconds without the intermediate ticks * 10^9 which overflows after a few weeks at 10MHz
+    /// </summary>
+    /// <remarks>exact for any frequency up to 9.2GHz</remarks>
+    [[nodiscard]]
+    constexpr std::chrono::nanoseconds ticks_to_nanoseconds(std::int64_t const ticks, std::int64_t const frequency) noexcept
+    {
+        constexpr std::int64_t nanoseconds_per_second = 1'000'000'000LL;
+        return std::chrono::nanoseconds(ticks / frequency * nanoseconds_per_second + ticks % frequency * nanoseconds_per_second / frequency);
+    }
+
+    /// <summary>
+    /// Clock backed by QueryPerformanceCounter, monotonic with sub-microsecond resolution and suitable for
+    /// measuring short intervals such as lock hold times
+    /// </summary>
+    /// <remarks>
+    /// the counter frequency is fixed at boot so it is read once and cached, <see cref="ticks"/> with
+    /// <see cref="to_duration"/> allows the conversion to be deferred until a measurement is reported
+    /// </remarks>
+    class MODERN_WIN32_EXPORT qpc_clock final
+    {
+    public:
+        using duration = std::chrono::nanoseconds;
+        using rep = duration::rep;
+        using period = duration::period;
+        using time_point = std::chrono::time_point<qpc_clock>;
+        static constexpr bool is_steady = true;
+
+        [[nodiscard]]
+        static time_point now() noexcept
+        {
+            return time_point(to_duration(ticks()));
+        }
+
+        /// <summary>
+        /// returns the raw counter value
+        /// </summary>
+        [[nodiscard]]
+        static std::int64_t ticks() noexcept
+        {
+            LARGE_INTEGER value{};
+            static_cast<void>(QueryPerformanceCounter(&value));
+            return value.QuadPart;
+        }
+
+        /// <summary>
+        /// returns the counter frequency in ticks per second
+        /// </summary>
+        [[nodiscard]]
+        static std::int64_t frequency() noexcept;
+
+        [[nodiscard]]
+        static duration to_duration(std::int64_t const ticks) noexcept
+        {
+            return ticks_to_nanoseconds(ticks, frequency());
+        }
+    };
+
+#ifdef MODERN_WIN32_HAS_TSC_CLOCK
+
+    /// <summary>
+    /// Clock reading the processor time stamp counter directly, a fraction of the cost of
+    /// <see cref="qpc_clock"/> for the hottest paths; the frequency is calibrated against QueryPerformanceCounter
+    /// the first time it is needed
+    /// </summary>
+    /// <remarks>
+    /// not steady as the counter is only synchronized between processors and unaffected by power states when
+    /// <see cref="is_invariant"/>; calibration sleeps for around 10ms, <see cref="frequency"/> may be called during
+    /// start up to take that cost early
+    /// </remarks>
+    class MODERN_WIN32_EXPORT tsc_clock final
+    {
+    public:
+        using duration = std::chrono::nanoseconds;
+        using rep = duration::rep;
+        using period = duration::period;
+        using time_point = std::chrono::time_point<tsc_clock>;
+        static constexpr bool is_steady = false;
+
+        [[nodiscard]]
+        static time_point now() noexcept
+        {
+            return time_point(to_duration(ticks()));
+        }
+
+        /// <summary>
+        /// returns the raw time stamp counter
+        /// </summary>
+        [[nodiscard]]
+        static std::int64_t ticks() noexcept
+        {
+            return static_cast<std::int64_t>(__rdtsc());
+        }
+
+        /// <summary>
+        /// returns the calibrated counter frequency in ticks per second
+        /// </summary>
+        [[nodiscard]]
+        static std::int64_t frequency() noexcept;
+
+        /// <summary>
+        /// returns true if the processor reports an invariant time stamp counter, one which runs at a constant
+        /// rate across processors and power states
+        /// </summary>
+        [[nodiscard]]
+        static bool is_invariant() noexcept;
+
+        [[nodiscard]]
+        static duration to_duration(std::int64_t const ticks) noexcept
+        {
+            return ticks_to_nanoseconds(ticks, frequency());
+        }
+    };
+
+#endif
+
+    /// <summary>
+    /// measures the time elapsed since construction or the last <see cref="restart"/>, only the raw counter is
+    /// read until a result is requested
+    /// </summary>
+    /// <typeparam name="CLOCK"><see cref="qpc_clock"/> or <see cref="tsc_clock"/></typeparam>
+    template <class CLOCK>
+    class basic_stopwatch final
+    {
+    public:
+        using clock = CLOCK;
+        using duration = typename CLOCK::duration;
+
+        basic_stopwatch() noexcept
+            : start_(CLOCK::ticks())
+        {
+        }
+
+        void restart() noexcept
+        {
+            start_ = CLOCK::ticks();
+        }
+
+        [[nodiscard]]
+        duration elapsed() const noexcept
+        {
+            return CLOCK::to_duration(CLOCK::ticks() - start_);
+        }
+
+        /// <summary>
+        /// returns the time elapsed and restarts in one counter read
+        /// </summary>
+        [[nodiscard]]
+        duration lap() noexcept
+        {
+            auto const now = CLOCK::ticks();
+            return CLOCK::to_duration(now - std::exchange(start_, now));
+        }
+
+    private:
+        std::int64_t start_;
+    };
+
+    using stopwatch = basic_stopwatch<qpc_clock>;
+
+    /// <summary>
+    /// invokes <typeparamref name="CALLABLE"/> with the lifetime of the timer on destruction
+    /// </summary>
+    /// <typeparam name="CALLABLE">callable taking <c>CLOCK::duration</c>, it must not throw</typeparam>
+    template <class CALLABLE, class CLOCK = qpc_clock>
+    class scoped_timer final
+    {
+    public:
+        explicit scoped_timer(CALLABLE callback) noexcept(std::is_nothrow_move_constructible_v<CALLABLE>)
+            : callback_(std::move(callback))
+        {
+        }
+        scoped_timer(scoped_timer const&) = delete;
+        scoped_timer(scoped_timer&&) noexcept = delete;
+        ~scoped_timer()
+        {
+            callback_(stopwatch_.elapsed());
+        }
+        scoped_timer& operator=(scoped_timer const&) = delete;
+        scoped_timer& operator=(scoped_timer&&) noexcept = delete;
+
+    private:
+        CALLABLE callback_;
+        basic_stopwatch<CLOCK> stopwatch_{};
+    };
+
+}
+
+#endif
+#endif
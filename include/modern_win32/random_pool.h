@@ -0,0 +1,110 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_RANDOM_POOL_H_
+#define MODERN_WIN32_RANDOM_POOL_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/windows_exception.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// per-thread buffer of cryptographically random bytes refilled from BCryptGenRandom in blocks of
+    /// <see cref="block_size"/>, amortising the kernel transition over many small requests
+    /// </summary>
+    /// <remarks>
+    /// bytes are wiped from the buffer as they are handed out, and any left over are wiped when the thread exits or
+    /// <see cref="discard"/> is called, so no byte is ever returned twice or left in memory once consumed
+    /// </remarks>
+    class MODERN_WIN32_EXPORT random_pool final
+    {
+    public:
+        static constexpr std::size_t block_size = 4096;
+
+        random_pool() = delete;
+
+        /// <summary>
+        /// fills <paramref name="data"/> with random bytes from the calling thread's buffer, requests of at least
+        /// <see cref="block_size"/> bytes go straight to BCryptGenRandom
+        /// </summary>
+        /// <returns>returns true on success; otherwise, false</returns>
+        [[nodiscard]]
+        static bool get_bytes(byte* data, std::size_t length) noexcept;
+
+        /// <summary>
+        /// returns a value of <typeparamref name="T"/> with every bit random
+        /// </summary>
+        /// <returns>the value or std::nullopt if random bytes could not be generated</returns>
+        template <typename T>
+        [[nodiscard]]
+        static std::optional<T> get() noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "T must be filled by copying random bytes");
+            T value{};
+            if (!get_bytes(reinterpret_cast<byte*>(&value), sizeof(T)))
+                return std::nullopt;
+            return value;
+        }
+
+        /// <summary>
+        /// wipes any bytes still buffered for the calling thread, the next request refills the buffer
+        /// </summary>
+        static void discard() noexcept;
+    };
+
+    /// <summary>
+    /// UniformRandomBitGenerator drawing from <see cref="random_pool"/>, for use with the &lt;random&gt;
+    /// distributions
+    /// </summary>
+    class random_pool_bit_generator final
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        [[nodiscard]]
+        static constexpr result_type min() noexcept
+        {
+            return (std::numeric_limits<result_type>::min)();
+        }
+        [[nodiscard]]
+        static constexpr result_type max() noexcept
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        /// <summary>
+        /// returns 64 random bits
+        /// </summary>
+        /// <exception cref="windows_exception">if random bytes could not be generated</exception>
+        [[nodiscard]]
+        result_type operator()() const
+        {
+            auto const value = random_pool::get<result_type>();
+            if (!value.has_value())
+                throw windows_exception(static_cast<native_windows_error>(ERROR_GEN_FAILURE), "unable to generate random bytes");
+            return value.value();
+        }
+    };
+
+}
+
+#endif
+#endif
@@ -14,11 +14,235 @@
 #ifndef MODERN_WIN32_SHARED_CASE_INSENSITIVE_CHARACTER_TRAITS_
 #define MODERN_WIN32_SHARED_CASE_INSENSITIVE_CHARACTER_TRAITS_  // NOLINT(clang-diagnostic-unused-macros)
 
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cwctype>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <modern_win32/shared/simd.h>
 
 namespace modern_win32::shared
 {
+    namespace details
+    {
+        /// <summary>
+        /// true if <typeparamref name="TCHARACTER"/> is narrow enough for the vectorized ASCII paths, 32-bit
+        /// characters always take the scalar path
+        /// </summary>
+        template <typename TCHARACTER>
+        constexpr bool is_vectorized_character_v = sizeof(TCHARACTER) == 1 || sizeof(TCHARACTER) == 2;
+
+        [[nodiscard]]
+        constexpr bool is_ascii(unsigned long const value) noexcept
+        {
+            return value < 0x80;
+        }
+
+        [[nodiscard]]
+        constexpr unsigned long fold_ascii(unsigned long const value) noexcept
+        {
+            return value >= 'a' && value <= 'z' ? value - 0x20 : value;
+        }
+
+#   ifdef MODERN_WIN32_SSE2
+
+        using simd::lowest_set_bit;
+
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline __m128i broadcast(unsigned long const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return _mm_set1_epi8(static_cast<char>(value));
+            else
+                return _mm_set1_epi16(static_cast<short>(value));
+        }
+
+        /// <summary>
+        /// true if every character of <paramref name="value"/> is 7-bit ASCII
+        /// </summary>
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline bool is_ascii(__m128i const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return _mm_movemask_epi8(value) == 0;
+            else
+                return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128())) == 0xFFFF;
+        }
+
+        /// <summary>
+        /// upper cases a-z, only valid once <see cref="is_ascii"/> holds for <paramref name="value"/>
+        /// </summary>
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline __m128i fold_ascii(__m128i const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1) {
+                auto const is_lower = _mm_and_si128(_mm_cmpgt_epi8(value, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(value, _mm_set1_epi8('z' + 1)));
+                return _mm_sub_epi8(value, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+            } else {
+                auto const is_lower = _mm_and_si128(_mm_cmpgt_epi16(value, _mm_set1_epi16('a' - 1)), _mm_cmplt_epi16(value, _mm_set1_epi16('z' + 1)));
+                return _mm_sub_epi16(value, _mm_and_si128(is_lower, _mm_set1_epi16(0x20)));
+            }
+        }
+
+        /// <summary>
+        /// byte mask with both bytes of each equal character set
+        /// </summary>
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline unsigned int equal_mask(__m128i const left, __m128i const right) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)));
+            else
+                return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi16(left, right)));
+        }
+
+#   endif
+
+#   ifdef MODERN_WIN32_AVX2
+
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline __m256i broadcast_wide(unsigned long const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return _mm256_set1_epi8(static_cast<char>(value));
+            else
+                return _mm256_set1_epi16(static_cast<short>(value));
+        }
+
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline bool is_ascii(__m256i const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return _mm256_movemask_epi8(value) == 0;
+            else
+                return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(value, _mm256_set1_epi16(static_cast<short>(0xFF80))), _mm256_setzero_si256()))) == 0xFFFFFFFFU;
+        }
+
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline __m256i fold_ascii(__m256i const value) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1) {
+                auto const is_lower = _mm256_and_si256(_mm256_cmpgt_epi8(value, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), value));
+                return _mm256_sub_epi8(value, _mm256_and_si256(is_lower, _mm256_set1_epi8(0x20)));
+            } else {
+                auto const is_lower = _mm256_and_si256(_mm256_cmpgt_epi16(value, _mm256_set1_epi16('a' - 1)), _mm256_cmpgt_epi16(_mm256_set1_epi16('z' + 1), value));
+                return _mm256_sub_epi16(value, _mm256_and_si256(is_lower, _mm256_set1_epi16(0x20)));
+            }
+        }
+
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline unsigned int equal_mask(__m256i const left, __m256i const right) noexcept
+        {
+            if constexpr (sizeof(TCHARACTER) == 1)
+                return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+            else
+                return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(left, right)));
+        }
+
+#   endif
+
+        /// <summary>
+        /// returns the number of leading characters of <paramref name="first1"/> and <paramref name="first2"/> which
+        /// are equal ignoring ASCII case, stopping at the first mismatch or at the start of the first block holding
+        /// a non-ASCII character or too short to load
+        /// </summary>
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline std::size_t ascii_equal_prefix([[maybe_unused]] TCHARACTER const* first1, [[maybe_unused]] TCHARACTER const* first2, [[maybe_unused]] std::size_t const count) noexcept
+        {
+            std::size_t index{};
+            if constexpr (is_vectorized_character_v<TCHARACTER>) {
+#           ifdef MODERN_WIN32_AVX2
+                constexpr std::size_t wide_block = sizeof(__m256i) / sizeof(TCHARACTER);
+                for (; index + wide_block <= count; index += wide_block) {
+                    auto const left = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first1 + index));
+                    auto const right = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first2 + index));
+                    if (!is_ascii<TCHARACTER>(_mm256_or_si256(left, right)))
+                        return index;
+
+                    if (auto const mask = equal_mask<TCHARACTER>(fold_ascii<TCHARACTER>(left), fold_ascii<TCHARACTER>(right)); mask != 0xFFFFFFFFU)
+                        return index + lowest_set_bit(~mask) / sizeof(TCHARACTER);
+                }
+#           endif
+#           ifdef MODERN_WIN32_SSE2
+                constexpr std::size_t block = sizeof(__m128i) / sizeof(TCHARACTER);
+                for (; index + block <= count; index += block) {
+                    auto const left = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first1 + index));
+                    auto const right = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first2 + index));
+                    if (!is_ascii<TCHARACTER>(_mm_or_si128(left, right)))
+                        return index;
+
+                    if (auto const mask = equal_mask<TCHARACTER>(fold_ascii<TCHARACTER>(left), fold_ascii<TCHARACTER>(right)); mask != 0xFFFFU)
+                        return index + lowest_set_bit(~mask & 0xFFFFU) / sizeof(TCHARACTER);
+                }
+#           endif
+            }
+            return index;
+        }
+
+        /// <summary>
+        /// returns the number of leading characters of <paramref name="first"/> known not to upper case to
+        /// <paramref name="upper"/>, stopping at the first ASCII candidate or at the start of the first block holding
+        /// a non-ASCII character or too short to load
+        /// </summary>
+        /// <remarks>
+        /// ASCII characters only ever upper case to ASCII so a non-ASCII <paramref name="upper"/> skips every ASCII block
+        /// </remarks>
+        template <typename TCHARACTER>
+        [[nodiscard]]
+        inline std::size_t ascii_mismatch_prefix([[maybe_unused]] TCHARACTER const* first, [[maybe_unused]] std::size_t const count, [[maybe_unused]] unsigned long const upper) noexcept
+        {
+            std::size_t index{};
+            if constexpr (is_vectorized_character_v<TCHARACTER>) {
+                [[maybe_unused]] auto const searching_ascii = is_ascii(upper);
+#           ifdef MODERN_WIN32_AVX2
+                constexpr std::size_t wide_block = sizeof(__m256i) / sizeof(TCHARACTER);
+                auto const wide_target = broadcast_wide<TCHARACTER>(upper);
+                for (; index + wide_block <= count; index += wide_block) {
+                    auto const value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + index));
+                    if (!is_ascii<TCHARACTER>(value))
+                        return index;
+                    if (!searching_ascii)
+                        continue;
+
+                    if (auto const mask = equal_mask<TCHARACTER>(fold_ascii<TCHARACTER>(value), wide_target); mask != 0U)
+                        return index + lowest_set_bit(mask) / sizeof(TCHARACTER);
+                }
+#           endif
+#           ifdef MODERN_WIN32_SSE2
+                constexpr std::size_t block = sizeof(__m128i) / sizeof(TCHARACTER);
+                auto const target = broadcast<TCHARACTER>(upper);
+                for (; index + block <= count; index += block) {
+                    auto const value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + index));
+                    if (!is_ascii<TCHARACTER>(value))
+                        return index;
+                    if (!searching_ascii)
+                        continue;
+
+                    if (auto const mask = equal_mask<TCHARACTER>(fold_ascii<TCHARACTER>(value), target); mask != 0U)
+                        return index + lowest_set_bit(mask) / sizeof(TCHARACTER);
+                }
+#           endif
+            }
+            return index;
+        }
+    }
+
+    /// <summary>
+    /// character traits comparing characters by their upper case value, ASCII characters are folded directly (16 or
+    /// 32 bytes at a time by compare and find) while all others use the current locale's toupper/towupper
+    /// </summary>
     template <typename TCHARACTER>
     class case_insensitive_char_traits : public std::char_traits<TCHARACTER>
     {
@@ -42,37 +266,80 @@ namespace modern_win32::shared
         [[nodiscard]]
         static int compare(_In_reads_(count) TCHARACTER const* first1, _In_reads_(count) TCHARACTER const* first2, size_t count) noexcept
         {
-            for (; 0 < count; --count, ++first1, ++first2) {
-                auto const upper_first1 = to_upper(*first1);
-                auto const upper_first2 = to_upper(*first2);
-                if (upper_first1 != upper_first2) {
-                    return upper_first1 < upper_first2 ? -1 : +1;
+            while (0 < count) {
+                auto const equal = details::ascii_equal_prefix(first1, first2, count);
+                first1 += equal;
+                first2 += equal;
+                count -= equal;
+
+                // whatever stopped the vectorized comparison; a mismatch, a non-ASCII block or the tail
+                for (auto remaining = (std::min)(count, scalar_block); 0 < remaining; --remaining, --count, ++first1, ++first2) {
+                    auto const upper_first1 = to_upper(*first1);
+                    auto const upper_first2 = to_upper(*first2);
+                    if (upper_first1 != upper_first2) {
+                        return upper_first1 < upper_first2 ? -1 : +1;
+                    }
                 }
             }
 
             return 0;
         }
 
+        /// <summary>
+        /// returns a pointer to the first character in the range equal to <paramref name="ch"/>, or nullptr if none is
+        /// </summary>
+        [[nodiscard]]
+        static TCHARACTER const* find(_In_reads_(count) TCHARACTER const* first, size_t count, TCHARACTER const& ch) noexcept
+        {
+            auto const upper = to_upper(ch);
+            while (0 < count) {
+                auto const skipped = details::ascii_mismatch_prefix(first, count, upper);
+                first += skipped;
+                count -= skipped;
+
+                for (auto remaining = (std::min)(count, scalar_block); 0 < remaining; --remaining, --count, ++first) {
+                    if (to_upper(*first) == upper) {
+                        return first;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        /// <summary>
+        /// FNV-1a hash of the upper case value of each character, consistent with <see cref="eq"/>
+        /// </summary>
         [[nodiscard]]
-        static wchar_t const* find(_In_reads_(count) TCHARACTER const* first, const size_t count, TCHARACTER const& ch) noexcept
+        static std::size_t hash(_In_reads_(count) TCHARACTER const* first, size_t count) noexcept
         {
-            auto mutable_count = count;
-            while (mutable_count-- > 0 && to_upper(*first) != to_upper(ch)) {
-                ++first;
+            constexpr auto offset_basis = sizeof(std::size_t) == 8 ? static_cast<std::size_t>(14695981039346656037ULL) : static_cast<std::size_t>(2166136261U);
+            constexpr auto prime = sizeof(std::size_t) == 8 ? static_cast<std::size_t>(1099511628211ULL) : static_cast<std::size_t>(16777619U);
+
+            auto result = offset_basis;
+            for (; 0 < count; --count, ++first) {
+                result ^= static_cast<std::size_t>(to_upper(*first));
+                result *= prime;
             }
-            return first;
+            return result;
         }
+
     private:
-        static int to_upper(int ch)
+        static constexpr std::size_t scalar_block = 16;
+
+        static unsigned long to_upper(TCHARACTER const ch) noexcept
         {
 #           if __cplusplus > 201703L 
             static_assert(!std::is_same_v<TCHARACTER, char8_t> && !std::is_same_v<TCHARACTER, char16_t> && !std::is_same_v<TCHARACTER, char32_t>, "unicode strings not supported due to lack of toupper method");
 #           endif
 
+            auto const value = static_cast<unsigned long>(static_cast<std::make_unsigned_t<TCHARACTER>>(ch));
+            if (details::is_ascii(value))
+                return details::fold_ascii(value);
+
             if constexpr (std::is_same_v<TCHARACTER, wchar_t>) {
-                return static_cast<int>(towupper(static_cast<wint_t>(ch)));
+                return static_cast<unsigned long>(towupper(static_cast<wint_t>(value)));
             } else {
-                return toupper(ch);
+                return static_cast<unsigned long>(static_cast<unsigned char>(toupper(static_cast<int>(value))));
             }
         }
     };
@@ -85,4 +352,27 @@ namespace modern_win32::shared
 
 }
 
+namespace std
+{
+    template <typename TCHARACTER, typename ALLOCATOR>
+    struct hash<basic_string<TCHARACTER, modern_win32::shared::case_insensitive_char_traits<TCHARACTER>, ALLOCATOR>>
+    {
+        [[nodiscard]]
+        std::size_t operator()(std::basic_string<TCHARACTER, modern_win32::shared::case_insensitive_char_traits<TCHARACTER>, ALLOCATOR> const& value) const noexcept
+        {
+            return modern_win32::shared::case_insensitive_char_traits<TCHARACTER>::hash(value.data(), value.size());
+        }
+    };
+
+    template <typename TCHARACTER>
+    struct hash<basic_string_view<TCHARACTER, modern_win32::shared::case_insensitive_char_traits<TCHARACTER>>>
+    {
+        [[nodiscard]]
+        std::size_t operator()(std::basic_string_view<TCHARACTER, modern_win32::shared::case_insensitive_char_traits<TCHARACTER>> const value) const noexcept
+        {
+            return modern_win32::shared::case_insensitive_char_traits<TCHARACTER>::hash(value.data(), value.size());
+        }
+    };
+}
+
 #endif
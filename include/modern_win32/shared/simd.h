@@ -0,0 +1,56 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_SHARED_SIMD_H_
+#define MODERN_WIN32_SHARED_SIMD_H_
+
+#include <cstddef>
+
+// SSE2 is part of the x64 baseline, AVX2 paths are only compiled when the translation unit targets it (/arch:AVX2)
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#   define MODERN_WIN32_SSE2  // NOLINT(clang-diagnostic-unused-macros)
+#   include <emmintrin.h>
+#   if defined(__AVX2__)
+#       define MODERN_WIN32_AVX2  // NOLINT(clang-diagnostic-unused-macros)
+#       include <immintrin.h>
+#   endif
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   endif
+#endif
+
+namespace modern_win32::shared::simd
+{
+
+#ifdef MODERN_WIN32_SSE2
+
+    /// <summary>
+    /// returns the index of the lowest set bit of <paramref name="mask"/>, which must not be zero
+    /// </summary>
+    [[nodiscard]]
+    inline std::size_t lowest_set_bit(unsigned int const mask) noexcept
+    {
+#   ifdef _MSC_VER
+        unsigned long index{};
+        static_cast<void>(_BitScanForward(&index, mask));
+        return static_cast<std::size_t>(index);
+#   else
+        return static_cast<std::size_t>(__builtin_ctz(mask));
+#   endif
+    }
+
+#endif
+
+}
+
+#endif
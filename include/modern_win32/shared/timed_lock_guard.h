@@ -56,6 +56,46 @@ namespace modern_win32::shared
 
     };
 
+    /// <summary>
+    /// RAII guard which attempts to acquire shared ownership of <typeparamref name="MUTEX"/> within a timeout,
+    /// the shared counterpart of <see cref="timed_lock_guard"/>
+    /// </summary>
+    template <class MUTEX>
+    class timed_shared_lock_guard final
+    {
+        MUTEX& mutex_;
+        bool locked_{ false };
+    public:
+        using mutex_type = MUTEX;
+
+        /// <summary>
+        /// Checks whether *this owns a locked mutex or not.
+        /// </summary>
+        /// <returns>true if *this has an associated mutex and has acquired shared ownership of it, false otherwise.</returns>
+        [[nodiscard]]
+        constexpr bool owns_lock() const noexcept
+        {
+            return locked_;
+        }
+
+        template <class REP, class PERIOD>
+        explicit timed_shared_lock_guard(MUTEX& mutex, std::chrono::duration<REP, PERIOD> timeout)
+            : mutex_{ mutex }
+            , locked_{ mutex.try_lock_shared_for(timeout) }
+        {
+        }
+        ~timed_shared_lock_guard()
+        {
+            if (locked_) {
+                mutex_.unlock_shared();
+            }
+        }
+        timed_shared_lock_guard(timed_shared_lock_guard const&) = delete;
+        timed_shared_lock_guard(timed_shared_lock_guard &&) noexcept = delete;
+        timed_shared_lock_guard& operator=(timed_shared_lock_guard const&) = delete;
+        timed_shared_lock_guard& operator=(timed_shared_lock_guard &&) noexcept = delete;
+    };
+
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,242 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_SHARED_MEMORY_RING_H_
+#define MODERN_WIN32_SHARED_MEMORY_RING_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <modern_win32/file_mapping.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/process.h>
+#include <modern_win32/process_startup_info.h>
+#include <modern_win32/threading/event.h>
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+#include <span>
+#endif
+
+namespace modern_win32
+{
+    namespace details
+    {
+        struct ring_header;
+    }
+
+    enum class ring_producers : std::uint32_t
+    {
+        /// <summary>
+        /// one thread, in any process, writes at a time; writes publish without contention
+        /// </summary>
+        single,
+
+        /// <summary>
+        /// any number of threads in any number of processes write concurrently, space is claimed with a compare
+        /// exchange and published in claim order
+        /// </summary>
+        /// <remarks>
+        /// publishing waits, without a bound, for every earlier claim to be published, so a producer process which
+        /// dies between claiming and publishing blocks every later writer; the ring must then be recreated
+        /// </remarks>
+        multiple,
+    };
+
+    /// <summary>
+    /// a message within a <see cref="shared_memory_ring"/>, valid until <see cref="shared_memory_ring::pop"/> is called
+    /// </summary>
+    struct ring_message final
+    {
+        std::byte const* data{};
+        std::size_t size{};
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+        [[nodiscard]]
+        std::span<std::byte const> as_span() const noexcept
+        {
+            return { data, size };
+        }
+#endif
+    };
+
+    /// <summary>
+    /// ring buffer of variable length messages in a named shared memory mapping, letting processes exchange
+    /// messages without copying them through pipes or sockets
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// positions are 64-bit atomics in the mapping, readers consume messages in place and writers only signal the
+    /// named readable event while the reader is idle, so a busy ring makes no kernel calls
+    /// </para>
+    /// <para>
+    /// there must only ever be one reader. a parent creates the ring, hands it to a child with
+    /// <see cref="share_with"/> before starting it and confirms the child has opened it with
+    /// <see cref="wait_for_attach"/>
+    /// </para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT shared_memory_ring final
+    {
+    public:
+        /// <summary>
+        /// environment variable used to pass the ring name to a child process
+        /// </summary>
+        static constexpr wchar_t const* default_environment_variable = L"MODERN_WIN32_SHARED_MEMORY_RING";
+
+        /// <summary>
+        /// creates a ring with a unique name generated from a new guid
+        /// </summary>
+        /// <param name="capacity">bytes available for messages, rounded up to a power of 2 of at least 4096</param>
+        /// <param name="producers">whether writes may be concurrent</param>
+        /// <exception cref="windows_exception">if the mapping or events could not be created</exception>
+        /// <exception cref="std::invalid_argument">if <paramref name="capacity"/> exceeds 4 GiB</exception>
+        [[nodiscard]]
+        static shared_memory_ring create(std::size_t capacity, ring_producers producers = ring_producers::single);
+
+        /// <summary>
+        /// creates a ring named <paramref name="name"/>
+        /// </summary>
+        /// <exception cref="windows_exception">if the mapping or events could not be created, or the name is in use</exception>
+        /// <exception cref="std::invalid_argument">if <paramref name="capacity"/> exceeds 4 GiB</exception>
+        [[nodiscard]]
+        static shared_memory_ring create(std::wstring const& name, std::size_t capacity, ring_producers producers = ring_producers::single);
+
+        /// <summary>
+        /// opens the ring named <paramref name="name"/> and signals the creator that it has been attached to
+        /// </summary>
+        /// <exception cref="windows_exception">if the mapping or events could not be opened</exception>
+        /// <exception cref="std::runtime_error">if the mapping is not a compatible ring</exception>
+        [[nodiscard]]
+        static shared_memory_ring open(std::wstring const& name);
+
+        /// <summary>
+        /// opens the ring whose name is in environment variable <paramref name="variable"/>, as set by <see cref="share_with"/>
+        /// </summary>
+        /// <exception cref="windows_exception">if the variable is not set or the ring could not be opened</exception>
+        /// <exception cref="std::runtime_error">if the mapping is not a compatible ring</exception>
+        [[nodiscard]]
+        static shared_memory_ring open_from_environment(wchar_t const* variable = default_environment_variable);
+
+        shared_memory_ring(shared_memory_ring const&) = delete;
+        shared_memory_ring(shared_memory_ring&&) noexcept = default;
+        ~shared_memory_ring() = default;
+        shared_memory_ring& operator=(shared_memory_ring const&) = delete;
+        shared_memory_ring& operator=(shared_memory_ring&&) noexcept = default;
+
+        /// <summary>
+        /// adds the ring name to the environment of <paramref name="startup_info"/> as <paramref name="variable"/>,
+        /// copying the current environment first if none has been set so the child still inherits it
+        /// </summary>
+        /// <exception cref="windows_exception">if the current environment could not be read</exception>
+        void share_with(wide_process_startup_info& startup_info, wchar_t const* variable = default_environment_variable) const;
+
+        /// <summary>
+        /// waits for the ring to be opened with <see cref="open"/>
+        /// </summary>
+        /// <returns>true if the ring has been opened; otherwise, false</returns>
+        [[nodiscard]]
+        bool wait_for_attach(std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) const;
+
+        /// <summary>
+        /// waits for another process to open the ring, returning early if <paramref name="child"/> exits first
+        /// </summary>
+        /// <returns>true if the ring has been opened; otherwise, false</returns>
+        [[nodiscard]]
+        bool wait_for_attach(process const& child, std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) const;
+
+        /// <summary>
+        /// copies <paramref name="size"/> bytes from <paramref name="data"/> into the ring as a single message
+        /// </summary>
+        /// <returns>true if the message was written; false if the ring is full or the message exceeds <see cref="max_message_size"/></returns>
+        [[nodiscard]]
+        bool try_write(void const* data, std::size_t size) noexcept;
+
+        /// <summary>
+        /// writes a message, waiting up to <paramref name="timeout"/> for the reader to free space
+        /// </summary>
+        /// <returns>true if the message was written; otherwise, false</returns>
+        [[nodiscard]]
+        bool write(void const* data, std::size_t size, std::optional<std::chrono::milliseconds> const& timeout = std::nullopt);
+
+        /// <summary>
+        /// returns the oldest message without removing it, the message stays valid until <see cref="pop"/>
+        /// </summary>
+        /// <remarks>
+        /// a record whose size would reach past the published records or the end of the mapping, as written by a
+        /// corrupt or hostile peer, is never returned; the ring reports no message from then on
+        /// </remarks>
+        [[nodiscard]]
+        std::optional<ring_message> try_read() noexcept;
+
+        /// <summary>
+        /// returns the oldest message, waiting up to <paramref name="timeout"/> for one to be written
+        /// </summary>
+        [[nodiscard]]
+        std::optional<ring_message> read(std::optional<std::chrono::milliseconds> const& timeout = std::nullopt);
+
+        /// <summary>
+        /// removes the message returned by the last <see cref="try_read"/> or <see cref="read"/>, freeing its space
+        /// </summary>
+        void pop() noexcept;
+
+        /// <summary>
+        /// returns the number of bytes available for messages, including the 8 byte header of each
+        /// </summary>
+        [[nodiscard]]
+        std::size_t capacity() const noexcept;
+
+        /// <summary>
+        /// returns the largest message which can be written
+        /// </summary>
+        [[nodiscard]]
+        std::size_t max_message_size() const noexcept;
+
+        /// <summary>
+        /// returns the name shared by the mapping and events of the ring
+        /// </summary>
+        [[nodiscard]]
+        std::wstring const& name() const noexcept;
+
+    private:
+        static constexpr std::uint32_t default_spin_count = 256;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::wstring name_;
+#       pragma warning(pop)
+        file_mapping mapping_;
+        mapped_view view_;
+        details::ring_header* header_{};
+        std::byte* data_{};
+        std::uint64_t mask_{};
+        std::uint64_t read_position_{};
+        std::uint64_t pending_size_{};
+        threading::event<threading::event_type::auto_reset> readable_;
+        threading::event<threading::event_type::auto_reset> writable_;
+        threading::event<threading::event_type::manual_reset> attached_;
+
+        explicit shared_memory_ring(std::wstring name, file_mapping&& mapping);
+
+        [[nodiscard]]
+        bool claim_and_write(void const* data, std::size_t size) noexcept;
+        void notify_reader() noexcept;
+        void notify_writers() noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -16,38 +16,91 @@
 #ifdef _WIN32
 
 #include <Windows.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
+#include <modern_win32/shared/simd.h>
 #include <modern_win32/windows_exception.h>
 
 namespace modern_win32
 {
-    template <typename TCHAR>
-    [[nodiscard]] std::optional<typename std::basic_string<TCHAR>::size_type> index_of(TCHAR const* source, TCHAR const& value = 0)
+    namespace details
     {
-        using size_type = typename std::basic_string<TCHAR>::size_type;
-#       if __cplusplus > 201703L 
-        
-        if (size_type position = 0; value == 0) {
-#       else
-        size_type position = 0;
-        if (value == 0) {
+        /// <summary>
+        /// returns the index of the first <paramref name="value"/> or terminator in <paramref name="source"/>
+        /// </summary>
+        /// <remarks>
+        /// the vectorized path only issues aligned 16 byte loads, these never cross a page boundary so reading past
+        /// the terminator or before <paramref name="source"/> cannot fault; address sanitizer builds still report
+        /// them so those use the scalar loop
+        /// </remarks>
+        template <typename TCHAR>
+        [[nodiscard]]
+        std::size_t scan_to(TCHAR const* const source, TCHAR const value) noexcept
+        {
+#       if defined(MODERN_WIN32_SSE2) && !defined(__SANITIZE_ADDRESS__)
+            if constexpr (sizeof(TCHAR) == 1 || sizeof(TCHAR) == 2) {
+                auto const address = reinterpret_cast<std::uintptr_t>(source);
+                if (address % sizeof(TCHAR) == 0) {
+                    auto const target = sizeof(TCHAR) == 1
+                        ? _mm_set1_epi8(static_cast<char>(value))
+                        : _mm_set1_epi16(static_cast<short>(value));
+                    auto const matches = [&target](__m128i const* const block) noexcept {
+                        auto const loaded = _mm_load_si128(block);
+                        auto const zero = _mm_setzero_si128();
+                        if constexpr (sizeof(TCHAR) == 1)
+                            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(loaded, zero), _mm_cmpeq_epi8(loaded, target))));
+                        else
+                            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(loaded, zero), _mm_cmpeq_epi16(loaded, target))));
+                    };
+
+                    auto const* block = reinterpret_cast<__m128i const*>(address & ~std::uintptr_t{sizeof(__m128i) - 1U});
+                    auto mask = matches(block) & (0xFFFFU << (address & (sizeof(__m128i) - 1U)));
+                    while (mask == 0U)
+                        mask = matches(++block);
+
+                    auto const found = reinterpret_cast<std::uintptr_t>(block) + shared::simd::lowest_set_bit(mask);
+                    return static_cast<std::size_t>(found - address) / sizeof(TCHAR);
+                }
+            }
 #       endif
-            while (source[position] != 0)
+            std::size_t position = 0;
+            while (source[position] != value && source[position] != 0)
                 ++position;
+            return position;
+        }
+    }
+
+    /// <summary>
+    /// returns the number of characters in <paramref name="source"/> before the first <paramref name="value"/> or
+    /// terminator, whichever comes first
+    /// </summary>
+    template <typename TCHAR>
+    [[nodiscard]] std::size_t length_until(TCHAR const* source, TCHAR const& value) noexcept
+    {
+        return value == 0
+            ? std::char_traits<TCHAR>::length(source)
+            : details::scan_to(source, value);
+    }
 
+    template <typename TCHAR>
+    [[nodiscard]] std::optional<typename std::basic_string<TCHAR>::size_type> index_of(TCHAR const* source, TCHAR const& value = 0)
+    {
+        using size_type = typename std::basic_string<TCHAR>::size_type;
+        auto const position = static_cast<size_type>(length_until(source, value));
+        if (value == 0)
             return position > 0
                 ?  std::optional(position)
                 : std::nullopt;
 
-        } else {
-            while (source[position] != value && source[position] != 0)
-                ++position;
-            return source[position] == value && position > 0
-                ? std::optional(position)
-                : std::nullopt;
-        }
+        return source[position] == value && position > 0
+            ? std::optional(position)
+            : std::nullopt;
     }
 
     template <typename TCHAR>
@@ -60,55 +113,406 @@ namespace modern_win32
         return string_view_type(start, end.value());
     }
 
+    /// <summary>
+    /// invokes <paramref name="callback"/> with a view of each string in a double null terminated block such as
+    /// those returned by GetEnvironmentStrings, each character is visited once
+    /// </summary>
+    /// <returns>the size of <paramref name="block"/> in characters, including the final terminator</returns>
+    template <typename TCHAR, typename CALLABLE>
+    std::size_t for_each_multi_string(TCHAR const* const block, CALLABLE&& callback)
+    {
+        auto const* cursor = block;
+        while (*cursor != 0) {
+            auto const length = std::char_traits<TCHAR>::length(cursor);
+            callback(std::basic_string_view<TCHAR>(cursor, length));
+            cursor += length + 1U;
+        }
+        return static_cast<std::size_t>(cursor - block) + 1U;
+    }
+
+    /// <summary>
+    /// splits a double null terminated block into views of each string it contains
+    /// </summary>
+    template <typename TCHAR>
+    [[nodiscard]] std::vector<std::basic_string_view<TCHAR>> split_multi_string(TCHAR const* const block)
+    {
+        std::vector<std::basic_string_view<TCHAR>> strings{};
+        static_cast<void>(for_each_multi_string(block, [&strings](std::basic_string_view<TCHAR> const value) {
+            strings.push_back(value);
+        }));
+        return strings;
+    }
+
     namespace convert
     {
-        template <class ALLOC = std::allocator<wchar_t>>
-        [[nodiscard]] inline std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> to_wstring(char const* value)
+        namespace details
+        {
+            /// <summary>
+            /// widens the leading ASCII characters of <paramref name="source"/> into <paramref name="destination"/>
+            /// </summary>
+            /// <returns>the number of characters converted, conversion stops at the first non-ASCII character</returns>
+            [[nodiscard]]
+            inline std::size_t widen_ascii(char const* const source, std::size_t const count, wchar_t* const destination) noexcept
+            {
+                std::size_t index = 0;
+#           ifdef MODERN_WIN32_SSE2
+                if constexpr (sizeof(wchar_t) == 2) {
+                    auto const zero = _mm_setzero_si128();
+                    for (; index + sizeof(__m128i) <= count; index += sizeof(__m128i)) {
+                        auto const value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index));
+                        if (_mm_movemask_epi8(value) != 0)
+                            break;
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_unpacklo_epi8(value, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index + 8U), _mm_unpackhi_epi8(value, zero));
+                    }
+                }
+#           endif
+                for (; index < count && static_cast<unsigned char>(source[index]) < 0x80U; ++index)
+                    destination[index] = static_cast<wchar_t>(source[index]);
+                return index;
+            }
+
+            /// <summary>
+            /// narrows the leading ASCII characters of <paramref name="source"/> into <paramref name="destination"/>
+            /// </summary>
+            /// <returns>the number of characters converted, conversion stops at the first non-ASCII character</returns>
+            [[nodiscard]]
+            inline std::size_t narrow_ascii(wchar_t const* const source, std::size_t const count, char* const destination) noexcept
+            {
+                std::size_t index = 0;
+#           ifdef MODERN_WIN32_SSE2
+                if constexpr (sizeof(wchar_t) == 2) {
+                    auto const non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+                    auto const zero = _mm_setzero_si128();
+                    for (; index + sizeof(__m128i) <= count; index += sizeof(__m128i)) {
+                        auto const low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index));
+                        auto const high = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + index + 8U));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(low, high), non_ascii), zero)) != 0xFFFF)
+                            break;
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_packus_epi16(low, high));
+                    }
+                }
+#           endif
+                for (; index < count && static_cast<unsigned long>(source[index]) < 0x80U; ++index)
+                    destination[index] = static_cast<char>(source[index]);
+                return index;
+            }
+
+            [[nodiscard]]
+            constexpr std::size_t utf8_sequence_length(char const lead) noexcept
+            {
+                auto const value = static_cast<unsigned char>(lead);
+                if (value >= 0xF0U && value <= 0xF7U)
+                    return 4U;
+                if (value >= 0xE0U)
+                    return value <= 0xEFU ? 3U : 1U;
+                return value >= 0xC0U ? 2U : 1U;
+            }
+
+            /// <summary>
+            /// returns the length of <paramref name="value"/> excluding a trailing incomplete UTF-8 sequence
+            /// </summary>
+            [[nodiscard]]
+            constexpr std::size_t complete_utf8_length(std::string_view const value) noexcept
+            {
+                auto const size = value.size();
+                for (std::size_t back = 1U; back <= 3U && back <= size; ++back) {
+                    auto const lead = value[size - back];
+                    if ((static_cast<unsigned char>(lead) & 0xC0U) == 0x80U)
+                        continue;
+                    return utf8_sequence_length(lead) > back
+                        ? size - back
+                        : size;
+                }
+                return size;
+            }
+
+            [[nodiscard]]
+            constexpr bool is_high_surrogate(wchar_t const value) noexcept
+            {
+                return value >= 0xD800 && value <= 0xDBFF;
+            }
+
+            [[nodiscard]]
+            constexpr bool is_low_surrogate(wchar_t const value) noexcept
+            {
+                return value >= 0xDC00 && value <= 0xDFFF;
+            }
+        }
+
+        /// <summary>
+        /// the largest number of UTF-16 code units <paramref name="utf8_length"/> bytes of UTF-8 can convert to
+        /// </summary>
+        [[nodiscard]]
+        constexpr std::size_t max_wide_length(std::size_t const utf8_length) noexcept
+        {
+            return utf8_length;
+        }
+
+        /// <summary>
+        /// the largest number of UTF-8 bytes <paramref name="wide_length"/> UTF-16 code units can convert to
+        /// </summary>
+        [[nodiscard]]
+        constexpr std::size_t max_utf8_length(std::size_t const wide_length) noexcept
+        {
+            return wide_length * 3U;
+        }
+
+        /// <summary>
+        /// converts UTF-8 <paramref name="value"/> to UTF-16 in <paramref name="buffer"/> without allocating, ASCII
+        /// input is widened directly without calling MultiByteToWideChar
+        /// </summary>
+        /// <returns>
+        /// the number of characters written, which are not null terminated, or std::nullopt if
+        /// <paramref name="buffer"/> is too small; <see cref="max_wide_length"/> is always large enough
+        /// </returns>
+        [[nodiscard]]
+        inline std::optional<std::size_t> try_to_wstring(std::string_view const value, wchar_t* const buffer, std::size_t const buffer_size) noexcept
         {
-            using string_custom_alloc = std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC>;
-            if (value == nullptr)
-                return L"";
+            auto const ascii = details::widen_ascii(value.data(), (std::min)(value.size(), buffer_size), buffer);
+            if (ascii == value.size())
+                return ascii;
+
+            auto const remaining = value.substr(ascii);
+            if (ascii == buffer_size || remaining.size() > static_cast<std::size_t>((std::numeric_limits<int>::max)()))
+                return std::nullopt;
 
-            std::string_view const value_view{value};
-            auto const size_needed = MultiByteToWideChar(CP_UTF8, 0, value, static_cast<int>(value_view.size()), nullptr, 0);
+            auto const output_size = static_cast<int>((std::min)(buffer_size - ascii, static_cast<std::size_t>((std::numeric_limits<int>::max)())));
+            auto const written = MultiByteToWideChar(CP_UTF8, 0, remaining.data(), static_cast<int>(remaining.size()), buffer + ascii, output_size);
+            if (written == 0)
+                return std::nullopt;
+            return ascii + static_cast<std::size_t>(written);
+        }
+
+        /// <summary>
+        /// converts UTF-16 <paramref name="value"/> to UTF-8 in <paramref name="buffer"/> without allocating, ASCII
+        /// input is narrowed directly without calling WideCharToMultiByte
+        /// </summary>
+        /// <returns>
+        /// the number of characters written, which are not null terminated, or std::nullopt if
+        /// <paramref name="buffer"/> is too small; <see cref="max_utf8_length"/> is always large enough
+        /// </returns>
+        [[nodiscard]]
+        inline std::optional<std::size_t> try_to_string(std::wstring_view const value, char* const buffer, std::size_t const buffer_size) noexcept
+        {
+            auto const ascii = details::narrow_ascii(value.data(), (std::min)(value.size(), buffer_size), buffer);
+            if (ascii == value.size())
+                return ascii;
+
+            auto const remaining = value.substr(ascii);
+            if (ascii == buffer_size || remaining.size() > static_cast<std::size_t>((std::numeric_limits<int>::max)()))
+                return std::nullopt;
+
+            auto const output_size = static_cast<int>((std::min)(buffer_size - ascii, static_cast<std::size_t>((std::numeric_limits<int>::max)())));
+            auto const written = WideCharToMultiByte(CP_UTF8, 0, remaining.data(), static_cast<int>(remaining.size()), buffer + ascii, output_size, nullptr, nullptr);
+            if (written == 0)
+                return std::nullopt;
+            return ascii + static_cast<std::size_t>(written);
+        }
+
+        /// <summary>
+        /// appends UTF-8 <paramref name="value"/> converted to UTF-16 to <paramref name="output"/>, converting in a
+        /// single pass and only allocating if <paramref name="output"/> lacks the capacity
+        /// </summary>
+        template <class TRAITS, class ALLOC>
+        void append_wstring(std::string_view const value, std::basic_string<wchar_t, TRAITS, ALLOC>& output)
+        {
+            auto const offset = output.size();
+            output.resize(offset + max_wide_length(value.size()));
+            auto const written = try_to_wstring(value, output.data() + offset, output.size() - offset);
+            if (!written.has_value()) {
+                output.resize(offset);
+                throw modern_win32::windows_exception();
+            }
+            output.resize(offset + written.value());
+        }
 
-            string_custom_alloc output(static_cast<typename string_custom_alloc::size_type>(size_needed), 0);
-            if (0 != MultiByteToWideChar(CP_UTF8, 0, value, static_cast<int>(value_view.size()), &output[0], size_needed))
+        /// <summary>
+        /// appends UTF-16 <paramref name="value"/> converted to UTF-8 to <paramref name="output"/>, converting in a
+        /// single pass and only allocating if <paramref name="output"/> lacks the capacity
+        /// </summary>
+        template <class TRAITS, class ALLOC>
+        void append_string(std::wstring_view const value, std::basic_string<char, TRAITS, ALLOC>& output)
+        {
+            auto const offset = output.size();
+            output.resize(offset + max_utf8_length(value.size()));
+            auto const written = try_to_string(value, output.data() + offset, output.size() - offset);
+            if (!written.has_value()) {
+                output.resize(offset);
                 throw modern_win32::windows_exception();
+            }
+            output.resize(offset + written.value());
+        }
+
+        /// <summary>
+        /// replaces the contents of <paramref name="output"/> with <paramref name="value"/> converted to UTF-16,
+        /// reusing its capacity
+        /// </summary>
+        template <class TRAITS, class ALLOC>
+        void to_wstring(std::string_view const value, std::basic_string<wchar_t, TRAITS, ALLOC>& output)
+        {
+            output.clear();
+            append_wstring(value, output);
+        }
+
+        /// <summary>
+        /// replaces the contents of <paramref name="output"/> with <paramref name="value"/> converted to UTF-8,
+        /// reusing its capacity
+        /// </summary>
+        template <class TRAITS, class ALLOC>
+        void to_string(std::wstring_view const value, std::basic_string<char, TRAITS, ALLOC>& output)
+        {
+            output.clear();
+            append_string(value, output);
+        }
+
+        template <class ALLOC = std::allocator<wchar_t>>
+        [[nodiscard]] inline std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> to_wstring(char const* value)
+        {
+            std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> output;
+            if (value != nullptr)
+                append_wstring(std::string_view(value), output);
             return output;
         }
 
         template <class ALLOC = std::allocator<wchar_t>>
-        [[nodiscard]] constexpr std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> to_wstring(std::string const& value)
+        [[nodiscard]] inline std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> to_wstring(std::string const& value)
         {
-            return to_wstring<ALLOC>(value.c_str());
+            std::basic_string<wchar_t, std::char_traits<wchar_t>, ALLOC> output;
+            append_wstring(std::string_view(value), output);
+            return output;
         }
 
         template <class ALLOC = std::allocator<char>>
-        [[nodiscard]] std::basic_string<char, std::char_traits<char>, ALLOC> to_string(wchar_t const* value)
+        [[nodiscard]] inline std::basic_string<char, std::char_traits<char>, ALLOC> to_string(wchar_t const* value)
         {
-            using string_custom_alloc = std::basic_string<char, std::char_traits<char>, ALLOC>;
-            if (value == nullptr)
-                return "";
-
-            std::wstring_view const value_view(value);
-            auto const size_needed = WideCharToMultiByte(CP_UTF8, 0, value, static_cast<int>(value_view.size()), nullptr, 0, nullptr, nullptr);
-
-            string_custom_alloc output(static_cast<typename string_custom_alloc::size_type>(size_needed), 0);
-            if (0 != WideCharToMultiByte(CP_UTF8, 0, value, static_cast<int>(value_view.size()), &output[0], static_cast<std::wstring::size_type>(size_needed), nullptr, nullptr))
-                throw modern_win32::windows_exception();
+            std::basic_string<char, std::char_traits<char>, ALLOC> output;
+            if (value != nullptr)
+                append_string(std::wstring_view(value), output);
             return output;
         }
 
         template <class ALLOC = std::allocator<char>>
-        [[nodiscard]] constexpr std::basic_string<char, std::char_traits<char>, ALLOC> to_string(std::wstring const& value)
+        [[nodiscard]] inline std::basic_string<char, std::char_traits<char>, ALLOC> to_string(std::wstring const& value)
         {
-            return to_string<ALLOC>(value.c_str());
+            std::basic_string<char, std::char_traits<char>, ALLOC> output;
+            append_string(std::wstring_view(value), output);
+            return output;
         }
 
-#       if __cplusplus > 201703L || _MSVC_LANG > 201703L
+        /// <summary>
+        /// converts UTF-8 supplied in arbitrary chunks, a multi-byte sequence split across chunks is held back until
+        /// the chunk completing it arrives
+        /// </summary>
+        class utf8_to_wide_converter final
+        {
+        public:
+            /// <summary>
+            /// appends the complete sequences of <paramref name="chunk"/>, and any held back from the previous chunk,
+            /// to <paramref name="output"/>
+            /// </summary>
+            template <class TRAITS, class ALLOC>
+            void convert(std::string_view chunk, std::basic_string<wchar_t, TRAITS, ALLOC>& output)
+            {
+                if (pending_size_ > 0U) {
+                    // only continuation bytes can complete the held back sequence, anything else leaves it invalid
+                    auto const length = details::utf8_sequence_length(pending_[0]);
+                    while (pending_size_ < length && !chunk.empty() && (static_cast<unsigned char>(chunk.front()) & 0xC0U) == 0x80U) {
+                        pending_[pending_size_++] = chunk.front();
+                        chunk.remove_prefix(1U);
+                    }
+                    if (pending_size_ < length && chunk.empty())
+                        return;
 
-#       endif
+                    append_wstring(std::string_view(pending_, pending_size_), output);
+                    pending_size_ = 0U;
+                }
+
+                auto const complete = details::complete_utf8_length(chunk);
+                append_wstring(chunk.substr(0U, complete), output);
+                pending_size_ = chunk.copy(pending_, chunk.size() - complete, complete);
+            }
+
+            /// <summary>
+            /// appends any sequence still held back, which being incomplete converts to the replacement character
+            /// </summary>
+            template <class TRAITS, class ALLOC>
+            void finish(std::basic_string<wchar_t, TRAITS, ALLOC>& output)
+            {
+                if (pending_size_ == 0U)
+                    return;
+                append_wstring(std::string_view(pending_, pending_size_), output);
+                pending_size_ = 0U;
+            }
+
+            [[nodiscard]]
+            bool has_pending() const noexcept
+            {
+                return pending_size_ > 0U;
+            }
+
+        private:
+            char pending_[4]{};
+            std::size_t pending_size_{};
+        };
+
+        /// <summary>
+        /// converts UTF-16 supplied in arbitrary chunks, a surrogate pair split across chunks is held back until the
+        /// chunk completing it arrives
+        /// </summary>
+        class wide_to_utf8_converter final
+        {
+        public:
+            /// <summary>
+            /// appends the complete code points of <paramref name="chunk"/>, and any high surrogate held back from the
+            /// previous chunk, to <paramref name="output"/>
+            /// </summary>
+            template <class TRAITS, class ALLOC>
+            void convert(std::wstring_view chunk, std::basic_string<char, TRAITS, ALLOC>& output)
+            {
+                if (chunk.empty())
+                    return;
+
+                if (pending_.has_value()) {
+                    wchar_t const pair[] = { pending_.value(), chunk.front() };
+                    if (details::is_low_surrogate(chunk.front())) {
+                        append_string(std::wstring_view(pair, 2U), output);
+                        chunk.remove_prefix(1U);
+                    } else {
+                        append_string(std::wstring_view(pair, 1U), output);
+                    }
+                    pending_.reset();
+                }
+
+                if (!chunk.empty() && details::is_high_surrogate(chunk.back())) {
+                    pending_ = chunk.back();
+                    chunk.remove_suffix(1U);
+                }
+                append_string(chunk, output);
+            }
+
+            /// <summary>
+            /// appends any unpaired high surrogate still held back, which converts to the replacement character
+            /// </summary>
+            template <class TRAITS, class ALLOC>
+            void finish(std::basic_string<char, TRAITS, ALLOC>& output)
+            {
+                if (!pending_.has_value())
+                    return;
+                wchar_t const pending[] = { pending_.value() };
+                pending_.reset();
+                append_string(std::wstring_view(pending, 1U), output);
+            }
+
+            [[nodiscard]]
+            bool has_pending() const noexcept
+            {
+                return pending_.has_value();
+            }
+
+        private:
+            std::optional<wchar_t> pending_{};
+        };
     }
 
 }
@@ -0,0 +1,123 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_ADAPTIVE_MUTEX_H_
+#define MODERN_WIN32_THREADING_ADAPTIVE_MUTEX_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32::threading
+{
+
+    /// <summary>
+    /// exclusive lock which spins for a budget learned from recent acquisitions before parking on WaitOnAddress,
+    /// mirrors std::timed_mutex so it can replace <see cref="slim_lock"/> where only exclusive ownership is needed
+    /// </summary>
+    /// <remarks>
+    /// the budget follows the number of spins recent contended acquisitions needed, so it tracks how long the lock is
+    /// typically held, and is halved each time spinning fails; short critical sections are acquired without a kernel
+    /// transition while long ones stop spinning
+    /// </remarks>
+    class MODERN_WIN32_EXPORT adaptive_mutex final
+    {
+    public:
+        static constexpr std::uint32_t default_max_spin_count = 4000;
+
+        /// <summary>
+        /// creates an unlocked mutex which never spins more than <paramref name="max_spin_count"/> times before blocking
+        /// </summary>
+        /// <param name="max_spin_count">upper bound on the spins made before blocking</param>
+        /// <param name="initial_spin_budget">budget used until one is learned, limited to <paramref name="max_spin_count"/></param>
+        explicit adaptive_mutex(std::uint32_t max_spin_count = default_max_spin_count, std::uint32_t initial_spin_budget = 0) noexcept;
+        adaptive_mutex(adaptive_mutex const&) = delete;
+        adaptive_mutex(adaptive_mutex&&) noexcept = delete;
+        ~adaptive_mutex() = default;
+
+        /// <summary>
+        /// Acquires the mutex, spinning for the learned budget before blocking
+        /// </summary>
+        void lock() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire the mutex without spinning or blocking
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        [[nodiscard]]
+        bool try_lock() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire the mutex, blocking until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return acquire(std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout));
+        }
+
+        /// <summary>
+        /// Attempts to acquire the mutex, blocking until <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return acquire(std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(deadline - CLOCK::now()));
+        }
+
+        /// <summary>
+        /// Releases the mutex, waking one blocked thread if any are parked
+        /// </summary>
+        void unlock() noexcept;
+
+        /// <summary>
+        /// number of spins the next contended acquisition will be based on
+        /// </summary>
+        [[nodiscard]]
+        std::uint32_t spin_budget() const noexcept;
+
+        /// <summary>
+        /// upper bound on the spins made before blocking
+        /// </summary>
+        [[nodiscard]]
+        std::uint32_t max_spin_count() const noexcept;
+
+        adaptive_mutex& operator=(adaptive_mutex const&) = delete;
+        adaptive_mutex& operator=(adaptive_mutex&&) noexcept = delete;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::atomic<std::uint32_t> state_{};
+        std::atomic<std::uint32_t> spin_budget_{};
+#       pragma warning(pop)
+        std::uint32_t max_spin_count_;
+
+        [[nodiscard]]
+        bool acquire(std::optional<std::chrono::steady_clock::time_point> const& deadline) noexcept;
+        void update_spin_budget(std::uint32_t spins) noexcept;
+    };
+
+}
+
+#endif
+#endif
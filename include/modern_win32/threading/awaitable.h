@@ -0,0 +1,153 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_AWAITABLE_H_
+#define MODERN_WIN32_THREADING_AWAITABLE_H_
+
+#ifdef _WIN32
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define MODERN_WIN32_HAS_COROUTINES 1
+
+#include <Windows.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/shared/chrono_extensions.h>
+#include <modern_win32/wait_for_result.h>
+#include <chrono>
+#include <coroutine>
+#include <optional>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// awaitable which suspends the awaiting coroutine until a waitable handle is signaled or an optional timeout
+    /// elapses, the wait is registered with the Win32 thread pool (CreateThreadpoolWait) so no thread is blocked
+    /// while the coroutine is suspended
+    /// </summary>
+    /// <remarks>
+    /// the coroutine is resumed on a thread pool thread.  As with WaitForSingleObject, a successful wait on an
+    /// auto reset event or semaphore consumes the signal.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT wait_awaitable final
+    {
+    public:
+        explicit wait_awaitable(HANDLE handle, std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) noexcept;
+        wait_awaitable(wait_awaitable const&) = delete;
+        wait_awaitable(wait_awaitable&&) noexcept = delete;
+        ~wait_awaitable();
+        wait_awaitable& operator=(wait_awaitable const&) = delete;
+        wait_awaitable& operator=(wait_awaitable&&) noexcept = delete;
+
+        /// <summary>
+        /// completes without suspending if the handle is already signaled or the timeout is zero
+        /// </summary>
+        [[nodiscard]]
+        bool await_ready() noexcept;
+
+        [[nodiscard]]
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+
+        /// <summary>
+        /// returns <see cref="wait_for_result::object"/> if signaled, <see cref="wait_for_result::timeout"/> if the
+        /// timeout elapsed or <see cref="wait_for_result::failed"/> if the wait could not be registered
+        /// </summary>
+        [[nodiscard]]
+        wait_for_result await_resume() const noexcept;
+
+    private:
+        HANDLE handle_;
+        std::optional<std::chrono::milliseconds> timeout_;
+        std::coroutine_handle<> continuation_{};
+        PTP_WAIT wait_{};
+        wait_for_result result_{ wait_for_result::failed };
+
+        static void CALLBACK on_wait(PTP_CALLBACK_INSTANCE, void* context, PTP_WAIT wait, TP_WAIT_RESULT wait_result) noexcept;
+    };
+
+    /// <summary>
+    /// awaitable which resumes the awaiting coroutine on a thread pool thread once the requested delay has elapsed
+    /// </summary>
+    class MODERN_WIN32_EXPORT delay_awaitable final
+    {
+    public:
+        using delay_duration = std::chrono::duration<long long, std::ratio<1, 10'000'000>>;
+
+        explicit delay_awaitable(delay_duration delay) noexcept;
+        delay_awaitable(delay_awaitable const&) = delete;
+        delay_awaitable(delay_awaitable&&) noexcept = delete;
+        ~delay_awaitable();
+        delay_awaitable& operator=(delay_awaitable const&) = delete;
+        delay_awaitable& operator=(delay_awaitable&&) noexcept = delete;
+
+        [[nodiscard]]
+        bool await_ready() const noexcept;
+
+        [[nodiscard]]
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+
+        /// <summary>
+        /// returns true if the delay elapsed; otherwise, false if the timer could not be created
+        /// </summary>
+        [[nodiscard]]
+        bool await_resume() const noexcept;
+
+    private:
+        delay_duration delay_;
+        std::coroutine_handle<> continuation_{};
+        PTP_TIMER timer_{};
+        bool elapsed_{};
+
+        static void CALLBACK on_timer(PTP_CALLBACK_INSTANCE, void* context, PTP_TIMER timer) noexcept;
+    };
+
+    /// <summary>
+    /// returns an awaitable for <paramref name="waitable"/>, any type exposing native_handle() such as
+    /// <see cref="event"/>, <see cref="semaphore"/>, <see cref="process"/> or a manual reset <see cref="timer"/>
+    /// </summary>
+    /// <param name="waitable">object to wait on, must outlive the co_await</param>
+    /// <param name="timeout">optional interval after which the wait completes with <see cref="wait_for_result::timeout"/></param>
+    template <typename WAITABLE, class REP = long long, class PERIOD = std::milli>
+    [[nodiscard]]
+    wait_awaitable async_wait_one(WAITABLE const& waitable, std::optional<std::chrono::duration<REP, PERIOD>> const& timeout = std::nullopt) noexcept
+    {
+        using modern_win32::shared::to_milliseconds;
+        return wait_awaitable(waitable.native_handle(), timeout.has_value()
+            ? std::optional(to_milliseconds(timeout.value()))
+            : std::nullopt);
+    }
+
+    /// <summary>
+    /// returns an awaitable for <paramref name="waitable"/> which completes when signaled or <paramref name="timeout"/> elapses
+    /// </summary>
+    template <typename WAITABLE, class REP, class PERIOD>
+    [[nodiscard]]
+    wait_awaitable async_wait_one(WAITABLE const& waitable, std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+    {
+        return async_wait_one(waitable, std::optional(timeout));
+    }
+
+    /// <summary>
+    /// returns an awaitable which completes once <paramref name="delay"/> has elapsed
+    /// </summary>
+    template <class REP, class PERIOD>
+    [[nodiscard]]
+    delay_awaitable async_delay(std::chrono::duration<REP, PERIOD> const& delay) noexcept
+    {
+        return delay_awaitable(std::chrono::ceil<delay_awaitable::delay_duration>(delay));
+    }
+
+}
+
+#endif
+#endif
+#endif
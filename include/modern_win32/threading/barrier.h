@@ -0,0 +1,93 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_BARRIER_H_
+#define MODERN_WIN32_THREADING_BARRIER_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <synchapi.h>
+#include <cstddef>
+#include <limits>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// reusable thread barrier over SYNCHRONIZATION_BARRIER, each phase completes once the expected number of
+    /// threads have arrived; mirrors the arrive_and_wait subset of std::barrier
+    /// </summary>
+    /// <remarks>
+    /// the native barrier cannot arrive without waiting, nor drop a participant, so arrive, wait and
+    /// arrive_and_drop are not provided. every participating thread must arrive each phase
+    /// </remarks>
+    class MODERN_WIN32_EXPORT barrier final
+    {
+    public:
+        using native_handle_type = LPSYNCHRONIZATION_BARRIER;
+
+        /// <summary>
+        /// Instantiates a new instance of the barrier class.
+        /// </summary>
+        /// <param name="expected">number of threads which must arrive to complete a phase, greater than zero</param>
+        /// <param name="spin_count">
+        /// number of times an arriving thread spins before blocking, -1 uses the system default
+        /// </param>
+        /// <exception cref="std::invalid_argument">if expected is less than or equal to zero or greater than max()</exception>
+        /// <exception cref="windows_exception">if the barrier cannot be initialized</exception>
+        explicit barrier(std::ptrdiff_t expected, long spin_count = -1);
+        barrier(barrier const&) = delete;
+        barrier(barrier&&) noexcept = delete;
+        ~barrier();
+
+        /// <summary>
+        /// largest expected count supported
+        /// </summary>
+        [[nodiscard]]
+        static constexpr std::ptrdiff_t (max)() noexcept
+        {
+            return (std::numeric_limits<LONG>::max)();
+        }
+
+        /// <summary>
+        /// arrives at the barrier and blocks until the current phase completes
+        /// </summary>
+        /// <returns>true for exactly one of the threads released from each phase; otherwise, false</returns>
+        bool arrive_and_wait() noexcept;
+
+        /// <summary>
+        /// arrives at the barrier and spins, without blocking, until the current phase completes, ignoring the spin
+        /// count; for short phases where every participant has its own processor
+        /// </summary>
+        /// <remarks>every participant in a phase should arrive the same way</remarks>
+        /// <returns>true for exactly one of the threads released from each phase; otherwise, false</returns>
+        bool arrive_and_spin() noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() noexcept;
+
+        barrier& operator=(barrier const&) = delete;
+        barrier& operator=(barrier&&) noexcept = delete;
+
+    private:
+        SYNCHRONIZATION_BARRIER barrier_{};
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,367 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_CHANNEL_H_
+#define MODERN_WIN32_THREADING_CHANNEL_H_
+
+#ifdef _WIN32
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <modern_win32/threading/cache_line.h>
+#include <modern_win32/threading/wait_on_address.h>
+
+namespace modern_win32::threading
+{
+
+#   pragma warning(push)
+#   pragma warning(disable : 4324)
+
+    /// <summary>
+    /// bounded multi-producer multi-consumer queue of <typeparamref name="N"/> elements, each slot carries a sequence
+    /// number so producers and consumers only contend on the slot they claim; elements are move constructed in place
+    /// </summary>
+    /// <remarks>
+    /// try_ operations never block, the blocking operations park on WaitOnAddress only while the channel is full or
+    /// empty and a push or pop only pays for a wake when a thread is actually parked
+    /// </remarks>
+    template <typename T, std::size_t N>
+    class channel final
+    {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "channel capacity must be a power of two");
+        static_assert(std::is_nothrow_move_constructible_v<T>, "channel elements must be nothrow move constructible");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        channel() noexcept
+        {
+            for (size_type i = 0; i < N; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        channel(channel const&) = delete;
+        channel(channel&&) noexcept = delete;
+        ~channel()
+        {
+            while (dequeue().has_value()) {
+            }
+        }
+
+        [[nodiscard]]
+        static constexpr size_type capacity() noexcept
+        {
+            return N;
+        }
+
+        /// <summary>
+        /// number of elements in the channel, only exact while no other thread is pushing or popping
+        /// </summary>
+        [[nodiscard]]
+        size_type size_approx() const noexcept
+        {
+            auto const pushed = enqueue_position_.load(std::memory_order_relaxed);
+            auto const popped = dequeue_position_.load(std::memory_order_relaxed);
+            return pushed > popped ? (std::min)(pushed - popped, N) : 0;
+        }
+
+        /// <summary>
+        /// constructs an element from <paramref name="args"/> in the next free slot
+        /// </summary>
+        /// <returns>true if the element was added; otherwise, false if the channel is full</returns>
+        template <typename... ARGS>
+        [[nodiscard]]
+        bool try_emplace(ARGS&&... args)
+        {
+            bool added{};
+            if constexpr (std::is_nothrow_constructible_v<T, ARGS...>) {
+                added = enqueue(std::forward<ARGS>(args)...);
+            } else {
+                // a claimed slot cannot be given back, so anything that may throw is constructed before claiming
+                T value(std::forward<ARGS>(args)...);
+                added = enqueue(std::move(value));
+            }
+            if (added) {
+                notify(consumers_waiting_, pushed_, false);
+            }
+            return added;
+        }
+
+        /// <returns>true if <paramref name="value"/> was moved into the channel; otherwise, false and value is untouched</returns>
+        [[nodiscard]]
+        bool try_push(T&& value) noexcept
+        {
+            return try_emplace(std::move(value));
+        }
+
+        /// <returns>true if <paramref name="value"/> was copied into the channel; otherwise, false</returns>
+        [[nodiscard]]
+        bool try_push(T const& value)
+        {
+            return try_emplace(value);
+        }
+
+        /// <summary>
+        /// moves <paramref name="value"/> into the channel, blocking while it is full
+        /// </summary>
+        /// <param name="value">element to add, left untouched if the timeout elapses</param>
+        /// <param name="timeout">optional interval to wait for, if std::nullopt waits until space is available</param>
+        /// <returns>true if the element was added; otherwise, false if the timeout elapsed</returns>
+        [[nodiscard]]
+        bool push(T&& value, std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) noexcept
+        {
+            bool const added = wait_for_ready(popped_, producers_waiting_, timeout,
+                [this, &value]() { return enqueue(std::move(value)); });
+            if (added) {
+                notify(consumers_waiting_, pushed_, false);
+            }
+            return added;
+        }
+
+        /// <summary>
+        /// moves elements from [<paramref name="first"/>, <paramref name="last"/>) into the channel until it is full,
+        /// waking consumers once for the whole batch
+        /// </summary>
+        /// <returns>number of elements added, taken from the front of the range</returns>
+        template <class INPUT_ITERATOR>
+        [[nodiscard]]
+        size_type try_push_batch(INPUT_ITERATOR first, INPUT_ITERATOR const last) noexcept
+        {
+            static_assert(std::is_nothrow_constructible_v<T, decltype(std::move(*first))>,
+                "try_push_batch requires a range of elements that can be moved into the channel without throwing");
+
+            size_type count{};
+            for (; first != last && enqueue(std::move(*first)); ++first) {
+                ++count;
+            }
+            if (count > 0) {
+                notify(consumers_waiting_, pushed_, count > 1);
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// removes the oldest element without blocking
+        /// </summary>
+        /// <returns>the element, or std::nullopt if the channel is empty</returns>
+        [[nodiscard]]
+        std::optional<T> try_pop() noexcept
+        {
+            auto value = dequeue();
+            if (value.has_value()) {
+                notify(producers_waiting_, popped_, false);
+            }
+            return value;
+        }
+
+        /// <summary>
+        /// removes the oldest element, blocking while the channel is empty
+        /// </summary>
+        /// <param name="timeout">optional interval to wait for, if std::nullopt waits until an element is available</param>
+        /// <returns>the element, or std::nullopt if the timeout elapsed</returns>
+        [[nodiscard]]
+        std::optional<T> pop(std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) noexcept
+        {
+            std::optional<T> value{};
+            std::ignore = wait_for_ready(pushed_, consumers_waiting_, timeout,
+                [this, &value]() {
+                    value = dequeue();
+                    return value.has_value();
+                });
+            if (value.has_value()) {
+                notify(producers_waiting_, popped_, false);
+            }
+            return value;
+        }
+
+        /// <summary>
+        /// moves up to <paramref name="max_count"/> elements to <paramref name="output"/> without blocking,
+        /// waking producers once for the whole batch
+        /// </summary>
+        /// <returns>number of elements removed</returns>
+        template <class OUTPUT_ITERATOR>
+        [[nodiscard]]
+        size_type try_pop_batch(OUTPUT_ITERATOR output, size_type const max_count)
+        {
+            size_type count{};
+            for (; count < max_count; ++count) {
+                auto value = dequeue();
+                if (!value.has_value()) {
+                    break;
+                }
+                *output++ = std::move(value.value());
+            }
+            if (count > 0) {
+                notify(producers_waiting_, popped_, count > 1);
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// blocks until at least one element is available, then moves up to <paramref name="max_count"/> elements
+        /// to <paramref name="output"/>
+        /// </summary>
+        /// <returns>number of elements removed, 0 if the timeout elapsed</returns>
+        template <class OUTPUT_ITERATOR>
+        [[nodiscard]]
+        size_type pop_batch(OUTPUT_ITERATOR output, size_type const max_count,
+            std::optional<std::chrono::milliseconds> const& timeout = std::nullopt)
+        {
+            if (max_count == 0) {
+                return 0;
+            }
+            auto first = pop(timeout);
+            if (!first.has_value()) {
+                return 0;
+            }
+            *output++ = std::move(first.value());
+            return 1 + try_pop_batch(output, max_count - 1);
+        }
+
+        channel& operator=(channel const&) = delete;
+        channel& operator=(channel&&) noexcept = delete;
+
+    private:
+        static constexpr size_type mask = N - 1;
+
+        struct cell final
+        {
+            std::atomic<size_type> sequence{};
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        alignas(cache_line_size) std::atomic<size_type> enqueue_position_{};
+        alignas(cache_line_size) std::atomic<size_type> dequeue_position_{};
+        alignas(cache_line_size) std::atomic<std::uint32_t> pushed_{};
+        std::atomic<std::uint32_t> consumers_waiting_{};
+        alignas(cache_line_size) std::atomic<std::uint32_t> popped_{};
+        std::atomic<std::uint32_t> producers_waiting_{};
+        alignas(cache_line_size) std::array<cell, N> cells_;
+
+        template <typename... ARGS>
+        [[nodiscard]]
+        bool enqueue(ARGS&&... args) noexcept
+        {
+            auto position = enqueue_position_.load(std::memory_order_relaxed);
+            while (true) {
+                auto& slot = cells_[position & mask];
+                auto const sequence = slot.sequence.load(std::memory_order_acquire);
+                auto const difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (difference == 0) {
+                    if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        ::new (static_cast<void*>(slot.storage)) T(std::forward<ARGS>(args)...);
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = enqueue_position_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]]
+        std::optional<T> dequeue() noexcept
+        {
+            auto position = dequeue_position_.load(std::memory_order_relaxed);
+            while (true) {
+                auto& slot = cells_[position & mask];
+                auto const sequence = slot.sequence.load(std::memory_order_acquire);
+                auto const difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+                if (difference == 0) {
+                    if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        auto* const element = std::launder(reinterpret_cast<T*>(slot.storage));
+                        std::optional<T> value(std::move(*element));
+                        element->~T();
+                        slot.sequence.store(position + N, std::memory_order_release);
+                        return value;
+                    }
+                } else if (difference < 0) {
+                    return std::nullopt;
+                } else {
+                    position = dequeue_position_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        static void notify(std::atomic<std::uint32_t>& waiters, std::atomic<std::uint32_t>& epoch, bool const all) noexcept
+        {
+            // orders the slot publication before the waiter check, pairs with the registration in wait_for_ready
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+            ++epoch;
+            if (all) {
+                wake_all(epoch);
+            } else {
+                wake_one(epoch);
+            }
+        }
+
+        template <typename TRY_OPERATION>
+        [[nodiscard]]
+        static bool wait_for_ready(std::atomic<std::uint32_t>& epoch, std::atomic<std::uint32_t>& waiters,
+            std::optional<std::chrono::milliseconds> const& timeout, TRY_OPERATION try_operation) noexcept
+        {
+            if (try_operation()) {
+                return true;
+            }
+            if (timeout.has_value() && timeout.value().count() <= 0) {
+                return false;
+            }
+
+            auto const deadline = timeout.has_value()
+                ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+                : std::nullopt;
+
+            ++waiters;
+            bool ready{};
+            while (true) {
+                // read before trying so an operation completing in between changes the epoch and the wait returns
+                auto const observed = epoch.load();
+                if ((ready = try_operation())) {
+                    break;
+                }
+                std::optional<std::chrono::milliseconds> remaining{};
+                if (deadline.has_value()) {
+                    auto const now = std::chrono::steady_clock::now();
+                    if (now >= deadline.value()) {
+                        break;
+                    }
+                    remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now);
+                }
+                std::ignore = wait_on_address(epoch, observed, remaining);
+            }
+            --waiters;
+            return ready;
+        }
+    };
+
+#   pragma warning(pop)
+
+}
+
+#endif
+#endif
@@ -0,0 +1,158 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_CONDITION_VARIABLE_H_
+#define MODERN_WIN32_THREADING_CONDITION_VARIABLE_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <synchapi.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/wait_for.h>
+#include <chrono>
+#include <condition_variable>
+#include <optional>
+#include <utility>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// modern C++ wrapper around CONDITION_VARIABLE paired with <see cref="slim_lock"/>, mirrors
+    /// std::condition_variable but may wait while holding the lock in either exclusive or shared mode
+    /// </summary>
+    /// <remarks>
+    /// the lock is released while waiting and re-acquired in the same mode before returning, as with any
+    /// condition variable waits may end spuriously so the predicate overloads should be preferred
+    /// </remarks>
+    class MODERN_WIN32_EXPORT condition_variable final
+    {
+    public:
+        using native_handle_type = PCONDITION_VARIABLE;
+
+        condition_variable() noexcept;
+        condition_variable(condition_variable const&) = delete;
+        condition_variable(condition_variable&&) noexcept = delete;
+        ~condition_variable() = default;
+        condition_variable& operator=(condition_variable const&) = delete;
+        condition_variable& operator=(condition_variable&&) noexcept = delete;
+
+        /// <summary>
+        /// Wake a single thread waiting on the condition variable.
+        /// </summary>
+        void notify_one() noexcept;
+
+        /// <summary>
+        /// Wake all threads waiting on the condition variable.
+        /// </summary>
+        void notify_all() noexcept;
+
+        /// <summary>
+        /// releases <paramref name="lock"/>, held in exclusive mode, and blocks until notified
+        /// </summary>
+        /// <exception cref="windows_exception">if the wait fails</exception>
+        void wait(unique_slim_lock& lock);
+
+        /// <summary>
+        /// releases <paramref name="lock"/>, held in shared mode, and blocks until notified
+        /// </summary>
+        /// <exception cref="windows_exception">if the wait fails</exception>
+        void wait(shared_slim_lock& lock);
+
+        /// <summary>
+        /// blocks until <paramref name="predicate"/> returns true, equivalent to while (!predicate()) wait(lock);
+        /// </summary>
+        template <typename LOCK, typename PREDICATE>
+        void wait(LOCK& lock, PREDICATE predicate)
+        {
+            while (!predicate()) {
+                wait(lock);
+            }
+        }
+
+        /// <summary>
+        /// releases <paramref name="lock"/> and blocks until notified or <paramref name="timeout"/> elapses
+        /// </summary>
+        /// <returns>std::cv_status::timeout if the timeout elapsed; otherwise, std::cv_status::no_timeout</returns>
+        /// <exception cref="windows_exception">if the wait fails for any reason other than the timeout</exception>
+        template <typename LOCK, class REP, class PERIOD>
+        std::cv_status wait_for(LOCK& lock, std::chrono::duration<REP, PERIOD> const& timeout)
+        {
+            return sleep(lock, to_numeric_milliseconds<DWORD>(timeout))
+                ? std::cv_status::no_timeout
+                : std::cv_status::timeout;
+        }
+
+        /// <summary>
+        /// blocks until <paramref name="predicate"/> returns true or <paramref name="timeout"/> elapses
+        /// </summary>
+        /// <returns>the result of <paramref name="predicate"/></returns>
+        template <typename LOCK, class REP, class PERIOD, typename PREDICATE>
+        bool wait_for(LOCK& lock, std::chrono::duration<REP, PERIOD> const& timeout, PREDICATE predicate)
+        {
+            return wait_until(lock, std::chrono::steady_clock::now() + timeout, std::move(predicate));
+        }
+
+        /// <summary>
+        /// releases <paramref name="lock"/> and blocks until notified or <paramref name="deadline"/> is reached
+        /// </summary>
+        /// <returns>std::cv_status::timeout if the deadline was reached; otherwise, std::cv_status::no_timeout</returns>
+        template <typename LOCK, class CLOCK, class DURATION>
+        std::cv_status wait_until(LOCK& lock, std::chrono::time_point<CLOCK, DURATION> const& deadline)
+        {
+            auto const now = CLOCK::now();
+            if (now >= deadline) {
+                return std::cv_status::timeout;
+            }
+            // rounded up so that a no_timeout result is never returned before the deadline on a timed out wait
+            auto const status = wait_for(lock, std::chrono::ceil<std::chrono::milliseconds>(deadline - now));
+            return status == std::cv_status::timeout || CLOCK::now() >= deadline
+                ? std::cv_status::timeout
+                : std::cv_status::no_timeout;
+        }
+
+        /// <summary>
+        /// blocks until <paramref name="predicate"/> returns true or <paramref name="deadline"/> is reached
+        /// </summary>
+        /// <returns>the result of <paramref name="predicate"/></returns>
+        template <typename LOCK, class CLOCK, class DURATION, typename PREDICATE>
+        bool wait_until(LOCK& lock, std::chrono::time_point<CLOCK, DURATION> const& deadline, PREDICATE predicate)
+        {
+            while (!predicate()) {
+                if (wait_until(lock, deadline) == std::cv_status::timeout) {
+                    return predicate();
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() noexcept;
+
+    private:
+        CONDITION_VARIABLE condition_{};
+
+        [[nodiscard]]
+        bool sleep(unique_slim_lock& lock, DWORD timeout);
+        [[nodiscard]]
+        bool sleep(shared_slim_lock& lock, DWORD timeout);
+    };
+
+}
+
+#endif
+#endif
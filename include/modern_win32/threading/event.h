@@ -40,6 +40,15 @@ namespace modern_win32::threading
             : event_{CreateEvent(nullptr, EVENT_TYPE == event_type::manual_reset, initial_state ? TRUE : FALSE, nullptr)}
         {
         }
+
+        /// <summary>
+        /// creates, or opens if it already exists, the event named <paramref name="name"/>; events with the same name
+        /// are shared between processes and <paramref name="initial_state"/> only applies when the event is created
+        /// </summary>
+        explicit event(bool const initial_state, wchar_t const* const name) noexcept
+            : event_{CreateEventW(nullptr, EVENT_TYPE == event_type::manual_reset, initial_state ? TRUE : FALSE, name)}
+        {
+        }
         event(event const& other) = delete;
         event(event&& other) noexcept
             : event_(other.event_.release())
@@ -104,6 +113,24 @@ namespace modern_win32::threading
             return wait_one(std::optional(timeout), alertable);
         }
 
+        /// <summary>
+        /// returns true if the event was created or opened successfully
+        /// </summary>
+        [[nodiscard]]
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(event_);
+        }
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        modern_handle_type::native_handle_type native_handle() const noexcept
+        {
+            return event_.native_handle();
+        }
+
         /// <summary>
         /// Swaps the values this and other.
         /// </summary>
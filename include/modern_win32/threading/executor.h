@@ -0,0 +1,82 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_EXECUTOR_H_
+#define MODERN_WIN32_THREADING_EXECUTOR_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// unit of work posted to an <see cref="executor"/>, owned by the poster which must keep it alive until
+    /// <see cref="callback"/> has been invoked
+    /// </summary>
+    struct executor_work final
+    {
+        using work_callback = void (*)(void* context);
+
+        work_callback callback{};
+        void* context{};
+
+        void operator()() const
+        {
+            if (callback != nullptr) {
+                callback(context);
+            }
+        }
+    };
+
+    /// <summary>
+    /// runs posted work on some thread other than the caller, posting must not block or allocate
+    /// </summary>
+    class MODERN_WIN32_EXPORT executor
+    {
+    public:
+        executor() = default;
+        executor(executor const&) = delete;
+        executor(executor&&) noexcept = delete;
+        virtual ~executor() = default;
+        executor& operator=(executor const&) = delete;
+        executor& operator=(executor&&) noexcept = delete;
+
+        /// <summary>
+        /// queues <paramref name="work"/> to be run exactly once
+        /// </summary>
+        /// <returns>true if the work was queued; otherwise, false</returns>
+        [[nodiscard]]
+        virtual bool post(executor_work& work) noexcept = 0;
+    };
+
+    /// <summary>
+    /// executor backed by the process default Win32 thread pool (TrySubmitThreadpoolCallback)
+    /// </summary>
+    class MODERN_WIN32_EXPORT default_threadpool_executor final : public executor
+    {
+    public:
+        [[nodiscard]]
+        bool post(executor_work& work) noexcept override;
+
+        /// <summary>
+        /// returns a process wide instance
+        /// </summary>
+        [[nodiscard]]
+        static default_threadpool_executor& instance() noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,330 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_INSTRUMENTED_LOCK_H_
+#define MODERN_WIN32_THREADING_INSTRUMENTED_LOCK_H_
+
+#ifdef _WIN32
+
+#include <chrono>
+#include <string_view>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/threading/lock_statistics.h>
+#include <modern_win32/threading/slim_lock.h>
+
+namespace modern_win32::threading
+{
+
+    /// <summary>
+    /// wraps <typeparamref name="LOCK"/> reporting acquisitions, waits and exclusive hold times to
+    /// <typeparamref name="POLICY"/>, either <see cref="lock_statistics"/> or <see cref="no_lock_statistics"/>
+    /// which removes every clock read at compile time
+    /// </summary>
+    /// <remarks>
+    /// shared holds are not timed as the lock cannot tell readers apart, use <see cref="instrumented_timed_shared_lock_guard"/>
+    /// at the call site where reader hold times matter
+    /// </remarks>
+    template <class LOCK, class POLICY = lock_statistics>
+    class instrumented_lock final
+    {
+    public:
+        using lock_type = LOCK;
+        using instrumentation_type = POLICY;
+
+        explicit instrumented_lock(std::wstring_view const name = {})
+            : instrumentation_(name)
+        {
+        }
+        instrumented_lock(instrumented_lock const&) = delete;
+        instrumented_lock(instrumented_lock&&) noexcept = delete;
+        ~instrumented_lock() = default;
+
+        void lock() noexcept
+        {
+            if constexpr (POLICY::enabled) {
+                if (lock_.try_lock()) {
+                    acquired_exclusive(false, clock::now(), {});
+                    return;
+                }
+                auto const start = clock::now();
+                lock_.lock();
+                auto const now = clock::now();
+                acquired_exclusive(true, now, now - start);
+            } else {
+                lock_.lock();
+            }
+        }
+
+        [[nodiscard]]
+        bool try_lock() noexcept
+        {
+            if (!lock_.try_lock()) {
+                return false;
+            }
+            if constexpr (POLICY::enabled) {
+                acquired_exclusive(false, clock::now(), {});
+            }
+            return true;
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            if constexpr (POLICY::enabled) {
+                if (lock_.try_lock()) {
+                    acquired_exclusive(false, clock::now(), {});
+                    return true;
+                }
+                auto const start = clock::now();
+                bool const acquired = lock_.try_lock_for(timeout);
+                auto const now = clock::now();
+                if (acquired) {
+                    acquired_exclusive(true, now, now - start);
+                } else {
+                    instrumentation_.on_timed_out(now - start);
+                }
+                return acquired;
+            } else {
+                return lock_.try_lock_for(timeout);
+            }
+        }
+
+        void unlock() noexcept
+        {
+            if constexpr (POLICY::enabled) {
+                // read before release, once unlocked the next owner overwrites it
+                auto const hold = clock::now() - exclusive_since_;
+                lock_.unlock();
+                instrumentation_.on_held(hold);
+            } else {
+                lock_.unlock();
+            }
+        }
+
+        void lock_shared() noexcept
+        {
+            if constexpr (POLICY::enabled) {
+                if (lock_.try_lock_shared()) {
+                    instrumentation_.on_acquired(false, {});
+                    return;
+                }
+                auto const start = clock::now();
+                lock_.lock_shared();
+                instrumentation_.on_acquired(true, clock::now() - start);
+            } else {
+                lock_.lock_shared();
+            }
+        }
+
+        [[nodiscard]]
+        bool try_lock_shared() noexcept
+        {
+            if (!lock_.try_lock_shared()) {
+                return false;
+            }
+            instrumentation_.on_acquired(false, {});
+            return true;
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_shared_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            if constexpr (POLICY::enabled) {
+                if (lock_.try_lock_shared()) {
+                    instrumentation_.on_acquired(false, {});
+                    return true;
+                }
+                auto const start = clock::now();
+                bool const acquired = lock_.try_lock_shared_for(timeout);
+                if (acquired) {
+                    instrumentation_.on_acquired(true, clock::now() - start);
+                } else {
+                    instrumentation_.on_timed_out(clock::now() - start);
+                }
+                return acquired;
+            } else {
+                return lock_.try_lock_shared_for(timeout);
+            }
+        }
+
+        void unlock_shared() noexcept
+        {
+            lock_.unlock_shared();
+        }
+
+        [[nodiscard]]
+        POLICY const& instrumentation() const noexcept
+        {
+            return instrumentation_;
+        }
+
+        instrumented_lock& operator=(instrumented_lock const&) = delete;
+        instrumented_lock& operator=(instrumented_lock&&) noexcept = delete;
+
+    private:
+        using clock = qpc_clock;
+
+        LOCK lock_{};
+        POLICY instrumentation_;
+        clock::time_point exclusive_since_{};
+
+        void acquired_exclusive(bool const contended, clock::time_point const now, clock::duration const wait) noexcept
+        {
+            exclusive_since_ = now;
+            instrumentation_.on_acquired(contended, wait);
+        }
+    };
+
+    using instrumented_slim_lock = instrumented_lock<slim_lock>;
+
+    /// <summary>
+    /// <see cref="modern_win32::shared::timed_lock_guard"/> which reports its wait, or timeout, and hold time to
+    /// <paramref name="instrumentation"/>, allowing an uninstrumented lock to be measured at a single call site
+    /// </summary>
+    template <class MUTEX, class POLICY = lock_statistics>
+    class instrumented_timed_lock_guard final
+    {
+        using clock = qpc_clock;
+
+        MUTEX& mutex_;
+        POLICY& instrumentation_;
+        bool locked_{ false };
+        clock::time_point acquired_at_{};
+    public:
+        using mutex_type = MUTEX;
+
+        /// <summary>
+        /// Checks whether *this owns a locked mutex or not.
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool owns_lock() const noexcept
+        {
+            return locked_;
+        }
+
+        template <class REP, class PERIOD>
+        explicit instrumented_timed_lock_guard(MUTEX& mutex, POLICY& instrumentation, std::chrono::duration<REP, PERIOD> timeout)
+            : mutex_{ mutex }
+            , instrumentation_{ instrumentation }
+        {
+            if constexpr (POLICY::enabled) {
+                if (mutex_.try_lock()) {
+                    locked_ = true;
+                    acquired_at_ = clock::now();
+                    instrumentation_.on_acquired(false, {});
+                    return;
+                }
+                auto const start = clock::now();
+                locked_ = mutex_.try_lock_for(timeout);
+                acquired_at_ = clock::now();
+                if (locked_) {
+                    instrumentation_.on_acquired(true, acquired_at_ - start);
+                } else {
+                    instrumentation_.on_timed_out(acquired_at_ - start);
+                }
+            } else {
+                locked_ = mutex_.try_lock_for(timeout);
+            }
+        }
+        ~instrumented_timed_lock_guard()
+        {
+            if (!locked_) {
+                return;
+            }
+            if constexpr (POLICY::enabled) {
+                auto const hold = clock::now() - acquired_at_;
+                mutex_.unlock();
+                instrumentation_.on_held(hold);
+            } else {
+                mutex_.unlock();
+            }
+        }
+        instrumented_timed_lock_guard(instrumented_timed_lock_guard const&) = delete;
+        instrumented_timed_lock_guard(instrumented_timed_lock_guard &&) noexcept = delete;
+        instrumented_timed_lock_guard& operator=(instrumented_timed_lock_guard const&) = delete;
+        instrumented_timed_lock_guard& operator=(instrumented_timed_lock_guard &&) noexcept = delete;
+    };
+
+    /// <summary>
+    /// shared counterpart of <see cref="instrumented_timed_lock_guard"/>
+    /// </summary>
+    template <class MUTEX, class POLICY = lock_statistics>
+    class instrumented_timed_shared_lock_guard final
+    {
+        using clock = qpc_clock;
+
+        MUTEX& mutex_;
+        POLICY& instrumentation_;
+        bool locked_{ false };
+        clock::time_point acquired_at_{};
+    public:
+        using mutex_type = MUTEX;
+
+        /// <summary>
+        /// Checks whether *this owns a locked mutex or not.
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool owns_lock() const noexcept
+        {
+            return locked_;
+        }
+
+        template <class REP, class PERIOD>
+        explicit instrumented_timed_shared_lock_guard(MUTEX& mutex, POLICY& instrumentation, std::chrono::duration<REP, PERIOD> timeout)
+            : mutex_{ mutex }
+            , instrumentation_{ instrumentation }
+        {
+            if constexpr (POLICY::enabled) {
+                if (mutex_.try_lock_shared()) {
+                    locked_ = true;
+                    acquired_at_ = clock::now();
+                    instrumentation_.on_acquired(false, {});
+                    return;
+                }
+                auto const start = clock::now();
+                locked_ = mutex_.try_lock_shared_for(timeout);
+                acquired_at_ = clock::now();
+                if (locked_) {
+                    instrumentation_.on_acquired(true, acquired_at_ - start);
+                } else {
+                    instrumentation_.on_timed_out(acquired_at_ - start);
+                }
+            } else {
+                locked_ = mutex_.try_lock_shared_for(timeout);
+            }
+        }
+        ~instrumented_timed_shared_lock_guard()
+        {
+            if (!locked_) {
+                return;
+            }
+            if constexpr (POLICY::enabled) {
+                auto const hold = clock::now() - acquired_at_;
+                mutex_.unlock_shared();
+                instrumentation_.on_held(hold);
+            } else {
+                mutex_.unlock_shared();
+            }
+        }
+        instrumented_timed_shared_lock_guard(instrumented_timed_shared_lock_guard const&) = delete;
+        instrumented_timed_shared_lock_guard(instrumented_timed_shared_lock_guard &&) noexcept = delete;
+        instrumented_timed_shared_lock_guard& operator=(instrumented_timed_shared_lock_guard const&) = delete;
+        instrumented_timed_shared_lock_guard& operator=(instrumented_timed_shared_lock_guard &&) noexcept = delete;
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,121 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_IO_COMPLETION_EXECUTOR_H_
+#define MODERN_WIN32_THREADING_IO_COMPLETION_EXECUTOR_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/executor.h>
+#include <modern_win32/threading/io_completion_port.h>
+#include <modern_win32/threading/thread.h>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// receives completions for the handles associated with it through <see cref="io_completion_executor::associate"/>
+    /// </summary>
+    class MODERN_WIN32_EXPORT io_completion_handler
+    {
+    public:
+        io_completion_handler() = default;
+        io_completion_handler(io_completion_handler const&) = delete;
+        io_completion_handler(io_completion_handler&&) noexcept = delete;
+        virtual ~io_completion_handler() = default;
+        io_completion_handler& operator=(io_completion_handler const&) = delete;
+        io_completion_handler& operator=(io_completion_handler&&) noexcept = delete;
+
+        /// <summary>
+        /// called on one of the executor threads each time an operation on an associated handle completes
+        /// </summary>
+        virtual void on_completion(io_completion const& completion) noexcept = 0;
+    };
+
+    /// <summary>
+    /// executor whose fixed set of threads drain an <see cref="io_completion_port"/>, running both posted work and
+    /// completions of overlapped I/O on the associated handles
+    /// </summary>
+    /// <remarks>
+    /// packets are removed in batches with GetQueuedCompletionStatusEx so a busy port costs one kernel transition per
+    /// batch rather than per operation.  The port concurrency limit lets the system wake only as many threads as there
+    /// are processors even when more threads are blocked in completion handlers.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT io_completion_executor final : public executor
+    {
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the io_completion_executor class
+        /// </summary>
+        /// <param name="thread_count">number of threads, if zero the number of logical processors is used</param>
+        /// <param name="concurrency">port concurrency limit, 0 for one per processor</param>
+        /// <param name="name">prefix used to name each thread, threads are named "{name} #{index}"</param>
+        /// <exception cref="windows_exception">if unable to create the port or a thread</exception>
+        explicit io_completion_executor(std::size_t thread_count = 0, DWORD concurrency = 0, std::wstring const& name = L"io_completion_executor");
+        io_completion_executor(io_completion_executor const&) = delete;
+        io_completion_executor(io_completion_executor&&) noexcept = delete;
+        ~io_completion_executor() override;
+        io_completion_executor& operator=(io_completion_executor const&) = delete;
+        io_completion_executor& operator=(io_completion_executor&&) noexcept = delete;
+
+        /// <summary>
+        /// associates <paramref name="file"/> with the port, each completion is passed to <paramref name="handler"/>
+        /// </summary>
+        /// <param name="file">handle opened with FILE_FLAG_OVERLAPPED</param>
+        /// <param name="handler">handler for completions, must outlive any outstanding I/O on <paramref name="file"/></param>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool associate(HANDLE file, io_completion_handler& handler) const noexcept;
+
+        /// <summary>
+        /// queues <paramref name="work"/> as a completion packet, the caller retains ownership and must keep it alive until it has run
+        /// </summary>
+        [[nodiscard]]
+        bool post(executor_work& work) noexcept override;
+
+        /// <summary>
+        /// stops the threads once every packet queued before the call has been processed, then joins them
+        /// </summary>
+        /// <remarks>must not be called from one of the executor threads</remarks>
+        void shutdown();
+
+        [[nodiscard]]
+        std::size_t thread_count() const noexcept;
+
+        /// <summary>
+        /// returns the port drained by this executor
+        /// </summary>
+        [[nodiscard]]
+        io_completion_port const& port() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        io_completion_port port_;
+        std::vector<thread> threads_{};
+        std::atomic<bool> stopping_{};
+#       pragma warning(pop)
+
+        void stop_threads(std::size_t count) const noexcept;
+
+        static DWORD __stdcall worker_proc(thread::thread_parameter parameter);
+    };
+
+}
+
+#endif
+#endif
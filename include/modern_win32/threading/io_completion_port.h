@@ -0,0 +1,131 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_IO_COMPLETION_PORT_H_
+#define MODERN_WIN32_THREADING_IO_COMPLETION_PORT_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/null_handle.h>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace modern_win32::threading
+{
+    using io_completion_port_handle = null_handle;
+
+    /// <summary>
+    /// a single completion packet removed from an <see cref="io_completion_port"/>
+    /// </summary>
+    struct io_completion final
+    {
+        ULONG_PTR key{};
+        OVERLAPPED* overlapped{};
+        DWORD bytes_transferred{};
+        /// <summary>
+        /// NTSTATUS of the operation as stored in OVERLAPPED::Internal, use GetOverlappedResult for the Win32 error
+        /// </summary>
+        ULONG_PTR native_status{};
+
+        [[nodiscard]]
+        constexpr bool succeeded() const noexcept
+        {
+            return native_status == 0;
+        }
+
+        [[nodiscard]]
+        static constexpr io_completion from_entry(OVERLAPPED_ENTRY const& entry) noexcept
+        {
+            return io_completion{ entry.lpCompletionKey, entry.lpOverlapped, entry.dwNumberOfBytesTransferred, entry.Internal };
+        }
+    };
+
+    /// <summary>
+    /// owns an I/O completion port, file handles associated with the port queue a completion packet each time an
+    /// overlapped operation finishes
+    /// </summary>
+    class MODERN_WIN32_EXPORT io_completion_port final
+    {
+    public:
+        using native_handle_type = io_completion_port_handle::native_handle_type;
+
+        /// <summary>
+        /// creates a new completion port
+        /// </summary>
+        /// <param name="concurrency">maximum number of threads the system allows to process packets concurrently, 0 for one per processor</param>
+        /// <exception cref="windows_exception">if the port could not be created</exception>
+        explicit io_completion_port(DWORD concurrency = 0);
+        io_completion_port(io_completion_port const&) = delete;
+        io_completion_port(io_completion_port&& other) noexcept = default;
+        ~io_completion_port() = default;
+        io_completion_port& operator=(io_completion_port const&) = delete;
+        io_completion_port& operator=(io_completion_port&& other) noexcept = default;
+
+        /// <summary>
+        /// associates <paramref name="file"/> with the port, completions for the handle are queued with <paramref name="key"/>
+        /// </summary>
+        /// <param name="file">handle opened with FILE_FLAG_OVERLAPPED, such as a file, socket or named pipe</param>
+        /// <param name="key">value returned with each completion packet for <paramref name="file"/></param>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool associate(HANDLE file, ULONG_PTR key) const noexcept;
+
+        /// <summary>
+        /// queues a completion packet without an I/O operation
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool post(ULONG_PTR key, OVERLAPPED* overlapped = nullptr, DWORD bytes_transferred = 0) const noexcept;
+
+        /// <summary>
+        /// removes a single completion packet, waiting up to <paramref name="timeout"/>
+        /// </summary>
+        /// <returns>the packet if one was dequeued before the timeout; otherwise, <see cref="std::nullopt"/></returns>
+        /// <remarks>
+        /// a packet for a failed I/O operation is still returned with <see cref="io_completion::succeeded"/> false
+        /// </remarks>
+        [[nodiscard]]
+        std::optional<io_completion> dequeue(std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) const noexcept;
+
+        /// <summary>
+        /// removes up to <paramref name="capacity"/> completion packets with a single call to GetQueuedCompletionStatusEx
+        /// </summary>
+        /// <param name="entries">destination for the packets</param>
+        /// <param name="capacity">number of elements in <paramref name="entries"/></param>
+        /// <param name="timeout">time to wait for at least one packet, waits indefinitely if empty</param>
+        /// <param name="alertable">if true the wait may return early to run queued APCs</param>
+        /// <returns>the number of packets removed, 0 on timeout, alert or failure</returns>
+        [[nodiscard]]
+        std::size_t dequeue(OVERLAPPED_ENTRY* entries, std::size_t capacity,
+            std::optional<std::chrono::milliseconds> const& timeout = std::nullopt, bool alertable = false) const noexcept;
+
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        native_handle_type native_handle() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        io_completion_port_handle handle_{};
+#       pragma warning(pop)
+    };
+
+}
+
+#endif
+#endif
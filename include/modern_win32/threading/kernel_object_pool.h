@@ -0,0 +1,326 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_KERNEL_OBJECT_POOL_H_
+#define MODERN_WIN32_THREADING_KERNEL_OBJECT_POOL_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <modern_win32/threading/channel.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/wait_for.h>
+#include <modern_win32/windows_exception.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// pool traits creating unnamed, initially non-signaled events of <typeparamref name="EVENT_TYPE"/>
+    /// </summary>
+    template <event_type EVENT_TYPE>
+    struct event_pool_traits final
+    {
+        /// <exception cref="windows_exception">if the event cannot be created</exception>
+        [[nodiscard]]
+        static HANDLE create()
+        {
+            auto const handle = CreateEventW(nullptr, EVENT_TYPE == event_type::manual_reset ? TRUE : FALSE, FALSE, nullptr);
+            if (handle == nullptr) {
+                throw windows_exception();
+            }
+            return handle;
+        }
+
+        [[nodiscard]]
+        static bool signal(HANDLE const handle) noexcept
+        {
+            return SetEvent(handle) != 0;
+        }
+
+        [[nodiscard]]
+        static bool reset(HANDLE const handle) noexcept
+        {
+            return ResetEvent(handle) != 0;
+        }
+    };
+
+    /// <summary>
+    /// pool traits creating unnamed semaphores with a count of zero and a maximum of <typeparamref name="MAXIMUM_COUNT"/>
+    /// </summary>
+    template <LONG MAXIMUM_COUNT>
+    struct semaphore_pool_traits final
+    {
+        static_assert(MAXIMUM_COUNT > 0, "semaphore maximum count must be greater than zero");
+
+        /// <exception cref="windows_exception">if the semaphore cannot be created</exception>
+        [[nodiscard]]
+        static HANDLE create()
+        {
+            auto const handle = CreateSemaphoreW(nullptr, 0, MAXIMUM_COUNT, nullptr);
+            if (handle == nullptr) {
+                throw windows_exception();
+            }
+            return handle;
+        }
+
+        [[nodiscard]]
+        static bool signal(HANDLE const handle) noexcept
+        {
+            return ReleaseSemaphore(handle, 1, nullptr) != 0;
+        }
+
+        [[nodiscard]]
+        static bool reset(HANDLE const handle) noexcept
+        {
+            DWORD result{};
+            while ((result = WaitForSingleObject(handle, 0)) == WAIT_OBJECT_0) {
+            }
+            return result == WAIT_TIMEOUT;
+        }
+    };
+
+    /// <summary>
+    /// counters describing how a <see cref="kernel_object_pool"/> has been used
+    /// </summary>
+    struct kernel_object_pool_statistics final
+    {
+        /// <summary>objects created because the free list was empty</summary>
+        std::uint64_t created{};
+        /// <summary>acquisitions served from the free list</summary>
+        std::uint64_t reused{};
+        /// <summary>objects reset and returned to the free list</summary>
+        std::uint64_t recycled{};
+        /// <summary>objects closed on return because the free list was full or the reset failed</summary>
+        std::uint64_t discarded{};
+        /// <summary>objects currently leased</summary>
+        std::uint64_t outstanding{};
+    };
+
+    /// <summary>
+    /// recycles kernel objects created by <typeparamref name="TRAITS"/> so request scoped code does not pay for a
+    /// create and close per use; objects are reset when returned and at most <typeparamref name="CAPACITY"/> are kept
+    /// </summary>
+    /// <remarks>
+    /// the free list is a lock-free <see cref="channel"/> of handles. every <see cref="pooled_object"/> must be
+    /// destroyed before the pool, and a returned object may still be signaled by a thread holding its native handle
+    /// so handles must not be retained past the lease
+    /// </remarks>
+    template <typename TRAITS, std::size_t CAPACITY = 64>
+    class kernel_object_pool final
+    {
+    public:
+        using traits_type = TRAITS;
+
+        /// <summary>
+        /// lease on a pooled object which returns it to the pool when destroyed
+        /// </summary>
+        class pooled_object final
+        {
+        public:
+            pooled_object(pooled_object const&) = delete;
+            pooled_object(pooled_object&& other) noexcept
+                : pool_{ other.pool_ }
+                , handle_{ other.handle_ }
+            {
+                other.pool_ = nullptr;
+                other.handle_ = nullptr;
+            }
+            ~pooled_object()
+            {
+                if (pool_ != nullptr) {
+                    pool_->recycle(handle_);
+                }
+            }
+
+            /// <summary>
+            /// signals the object, setting an event or releasing one unit of a semaphore
+            /// </summary>
+            /// <returns>true on success; otherwise, false</returns>
+            [[maybe_unused]]
+            bool set() noexcept
+            {
+                return TRAITS::signal(handle_);
+            }
+
+            /// <summary>
+            /// returns the object to its non-signaled state
+            /// </summary>
+            /// <returns>true on success; otherwise, false</returns>
+            [[maybe_unused]]
+            bool clear() noexcept
+            {
+                return TRAITS::reset(handle_);
+            }
+
+            /// <summary>
+            /// wait for the object to be signaled
+            /// </summary>
+            /// <returns>true if the object was signaled; otherwise, false</returns>
+            template <class REP = long long, class PERIOD = std::milli>
+            [[nodiscard]]
+            bool wait_one(std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt, bool const alertable = false) const
+            {
+                return is_complete(modern_win32::wait_one(*this, timeout, alertable));
+            }
+
+            /// <summary>
+            /// wait for the object to be signaled
+            /// </summary>
+            /// <returns>true if the object was signaled; otherwise, false</returns>
+            template <class REP = long long, class PERIOD = std::milli>
+            [[nodiscard]]
+            bool wait_one(std::chrono::duration<REP, PERIOD> const timeout, bool const alertable = false) const
+            {
+                return wait_one(std::optional(timeout), alertable);
+            }
+
+            /// <summary>
+            /// returns the underlying handle, valid only for the lifetime of the lease
+            /// </summary>
+            [[nodiscard]]
+            HANDLE native_handle() const noexcept
+            {
+                return handle_;
+            }
+
+            [[nodiscard]]
+            explicit operator bool() const noexcept
+            {
+                return handle_ != nullptr;
+            }
+
+            pooled_object& operator=(pooled_object const&) = delete;
+            pooled_object& operator=(pooled_object&& other) noexcept
+            {
+                if (this == &other) {
+                    return *this;
+                }
+                if (pool_ != nullptr) {
+                    pool_->recycle(handle_);
+                }
+                pool_ = other.pool_;
+                handle_ = other.handle_;
+                other.pool_ = nullptr;
+                other.handle_ = nullptr;
+                return *this;
+            }
+
+        private:
+            friend class kernel_object_pool;
+
+            kernel_object_pool* pool_;
+            HANDLE handle_;
+
+            pooled_object(kernel_object_pool* const pool, HANDLE const handle) noexcept
+                : pool_{ pool }
+                , handle_{ handle }
+            {
+            }
+        };
+
+        kernel_object_pool() = default;
+        kernel_object_pool(kernel_object_pool const&) = delete;
+        kernel_object_pool(kernel_object_pool&&) noexcept = delete;
+        ~kernel_object_pool()
+        {
+            trim();
+        }
+
+        /// <summary>
+        /// leases a non-signaled object, reusing an idle one when available
+        /// </summary>
+        /// <exception cref="windows_exception">if a new object is needed and cannot be created</exception>
+        [[nodiscard]]
+        pooled_object acquire()
+        {
+            if (auto const idle = free_.try_pop(); idle.has_value()) {
+                reused_.fetch_add(1, std::memory_order_relaxed);
+                return pooled_object(this, idle.value());
+            }
+            auto const handle = TRAITS::create();
+            created_.fetch_add(1, std::memory_order_relaxed);
+            return pooled_object(this, handle);
+        }
+
+        /// <summary>
+        /// closes every idle object
+        /// </summary>
+        void trim() noexcept
+        {
+            while (auto const idle = free_.try_pop()) {
+                CloseHandle(idle.value());
+            }
+        }
+
+        /// <summary>
+        /// number of objects waiting to be reused
+        /// </summary>
+        [[nodiscard]]
+        std::size_t idle_count() const noexcept
+        {
+            return free_.size_approx();
+        }
+
+        [[nodiscard]]
+        kernel_object_pool_statistics statistics() const noexcept
+        {
+            kernel_object_pool_statistics statistics{};
+            statistics.created = created_.load(std::memory_order_relaxed);
+            statistics.reused = reused_.load(std::memory_order_relaxed);
+            statistics.recycled = recycled_.load(std::memory_order_relaxed);
+            statistics.discarded = discarded_.load(std::memory_order_relaxed);
+            auto const leased = statistics.created + statistics.reused;
+            auto const returned = statistics.recycled + statistics.discarded;
+            statistics.outstanding = leased > returned ? leased - returned : 0;
+            return statistics;
+        }
+
+        kernel_object_pool& operator=(kernel_object_pool const&) = delete;
+        kernel_object_pool& operator=(kernel_object_pool&&) noexcept = delete;
+
+    private:
+        channel<HANDLE, CAPACITY> free_{};
+        std::atomic<std::uint64_t> created_{};
+        std::atomic<std::uint64_t> reused_{};
+        std::atomic<std::uint64_t> recycled_{};
+        std::atomic<std::uint64_t> discarded_{};
+
+        void recycle(HANDLE const handle) noexcept
+        {
+            if (TRAITS::reset(handle) && free_.try_push(HANDLE{ handle })) {
+                recycled_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            CloseHandle(handle);
+            discarded_.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    template <std::size_t CAPACITY = 64>
+    using manual_reset_event_pool = kernel_object_pool<event_pool_traits<event_type::manual_reset>, CAPACITY>;
+
+    template <std::size_t CAPACITY = 64>
+    using auto_reset_event_pool = kernel_object_pool<event_pool_traits<event_type::auto_reset>, CAPACITY>;
+
+    template <LONG MAXIMUM_COUNT, std::size_t CAPACITY = 64>
+    using semaphore_pool = kernel_object_pool<semaphore_pool_traits<MAXIMUM_COUNT>, CAPACITY>;
+
+}
+
+#endif
+#endif
@@ -0,0 +1,106 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_LATCH_H_
+#define MODERN_WIN32_THREADING_LATCH_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/shared/chrono_extensions.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// single use countdown which releases its waiters once the count reaches zero, mirrors std::latch and adds a
+    /// timed wait; waiting threads park on WaitOnAddress so no kernel object is needed per latch
+    /// </summary>
+    class MODERN_WIN32_EXPORT latch final
+    {
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the latch class.
+        /// </summary>
+        /// <param name="expected">initial count, between zero and max()</param>
+        /// <exception cref="std::invalid_argument">if expected is negative or greater than max()</exception>
+        explicit latch(std::ptrdiff_t expected);
+        latch(latch const&) = delete;
+        latch(latch&&) noexcept = delete;
+        ~latch() = default;
+
+        /// <summary>
+        /// largest expected count supported
+        /// </summary>
+        [[nodiscard]]
+        static constexpr std::ptrdiff_t (max)() noexcept
+        {
+            return (std::numeric_limits<std::int32_t>::max)();
+        }
+
+        /// <summary>
+        /// decrements the count by <paramref name="update"/>, releasing every waiter when it reaches zero
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if update is negative or greater than the current count</exception>
+        void count_down(std::ptrdiff_t update = 1);
+
+        /// <summary>
+        /// returns true if the count has reached zero
+        /// </summary>
+        [[nodiscard]]
+        bool try_wait() const noexcept;
+
+        /// <summary>
+        /// blocks until the count reaches zero
+        /// </summary>
+        void wait() const noexcept;
+
+        /// <summary>
+        /// blocks until the count reaches zero or <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if the count reached zero; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool wait_for(std::chrono::duration<REP, PERIOD> const timeout) const noexcept
+        {
+            return wait_until_zero(modern_win32::shared::to_milliseconds(timeout));
+        }
+
+        /// <summary>
+        /// decrements the count by <paramref name="update"/> then blocks until it reaches zero
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if update is negative or greater than the current count</exception>
+        void arrive_and_wait(std::ptrdiff_t update = 1);
+
+        latch& operator=(latch const&) = delete;
+        latch& operator=(latch&&) noexcept = delete;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        mutable std::atomic<std::uint32_t> count_;
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        bool wait_until_zero(std::optional<std::chrono::milliseconds> const& timeout) const noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,143 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_LIGHT_EVENT_H_
+#define MODERN_WIN32_THREADING_LIGHT_EVENT_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/shared/chrono_extensions.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// in-process counterpart of <see cref="event"/> built on an atomic word and WaitOnAddress, signaling and
+    /// waiting only enter the kernel when a thread actually has to block
+    /// </summary>
+    /// <remarks>
+    /// there is no handle so a light_event cannot be shared with other processes or waited on together with
+    /// other objects; use <see cref="event"/> for that
+    /// </remarks>
+    template <event_type EVENT_TYPE>
+    class light_event final
+    {
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the light_event class
+        /// </summary>
+        /// <param name="initial_state">true if the event starts signaled</param>
+        /// <param name="spin_count">number of times a waiter polls the event before blocking</param>
+        explicit light_event(bool const initial_state, std::uint32_t const spin_count = 0) noexcept
+            : state_{ initial_state ? signaled : nonsignaled }
+            , spin_count_{ spin_count }
+        {
+        }
+        light_event(light_event const&) = delete;
+        light_event(light_event&&) noexcept = delete;
+        ~light_event() = default;
+        light_event& operator=(light_event const&) = delete;
+        light_event& operator=(light_event&&) noexcept = delete;
+
+        /// <summary>
+        /// Sets the event object to the signaled state.
+        /// </summary>
+        /// <returns>true</returns>
+        [[maybe_unused]]
+        bool set() noexcept
+        {
+            if (state_.exchange(signaled) == signaled) {
+                return true;
+            }
+            if (waiters_ != 0) {
+                if constexpr (EVENT_TYPE == event_type::manual_reset) {
+                    wake_all(state_);
+                } else {
+                    wake_one(state_);
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Sets the event object to the nonsignaled state.
+        /// </summary>
+        /// <returns>true</returns>
+        [[maybe_unused]]
+        bool clear() noexcept
+        {
+            state_ = nonsignaled;
+            return true;
+        }
+
+        /// <summary>
+        /// wait for event to be signaled, an auto reset event is returned to the nonsignaled state
+        /// </summary>
+        /// <param name="timeout">
+        /// optional interval to wait for, if std::nullopt waits until signaled; zero tests the state without blocking
+        /// </param>
+        /// <returns>true if event was signaled; otherwise, false</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool wait_one(std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt) const
+        {
+            using modern_win32::shared::to_milliseconds;
+            return acquire_on_address(state_, waiters_, nonsignaled, spin_count_,
+                timeout.has_value() ? std::optional(to_milliseconds(timeout.value())) : std::nullopt,
+                [this]() { return try_acquire(); });
+        }
+
+        /// <summary>
+        /// wait for event to be signaled, an auto reset event is returned to the nonsignaled state
+        /// </summary>
+        /// <returns>true if event was signaled; otherwise, false</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool wait_one(std::chrono::duration<REP, PERIOD> const timeout) const
+        {
+            return wait_one(std::optional(timeout));
+        }
+
+    private:
+        static constexpr std::uint32_t nonsignaled = 0;
+        static constexpr std::uint32_t signaled = 1;
+
+        // mutable as waiting on an auto reset event consumes the signal, mirroring event::wait_one
+        mutable std::atomic<std::uint32_t> state_;
+        mutable std::atomic<std::uint32_t> waiters_{};
+        std::uint32_t spin_count_;
+
+        [[nodiscard]]
+        bool try_acquire() const noexcept
+        {
+            if constexpr (EVENT_TYPE == event_type::manual_reset) {
+                return state_.load() == signaled;
+            } else {
+                auto expected = signaled;
+                return state_.compare_exchange_strong(expected, nonsignaled);
+            }
+        }
+    };
+
+    using light_auto_reset_event = light_event<event_type::auto_reset>;
+    using light_manual_reset_event = light_event<event_type::manual_reset>;
+
+}
+
+#endif
+#endif
@@ -0,0 +1,166 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_LIGHT_SEMAPHORE_H_
+#define MODERN_WIN32_THREADING_LIGHT_SEMAPHORE_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/shared/chrono_extensions.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// in-process counterpart of <see cref="semaphore"/> built on an atomic count and WaitOnAddress, release and
+    /// acquire only enter the kernel when a thread actually has to block
+    /// </summary>
+    /// <remarks>
+    /// there is no handle so a light_semaphore cannot be shared with other processes; use <see cref="semaphore"/> for that
+    /// </remarks>
+    class MODERN_WIN32_EXPORT light_semaphore final
+    {
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the light_semaphore class.
+        /// </summary>
+        /// <param name="initial_count">initial count, between zero and <paramref name="maximum_count"/></param>
+        /// <param name="maximum_count">maximum count, must be greater than zero</param>
+        /// <param name="spin_count">number of times a waiter polls the count before blocking</param>
+        /// <exception cref="std::invalid_argument">
+        /// If initial_count is less than 0, or greater than maximum_count.
+        /// If maximum_count is less than or equal to 0
+        /// </exception>
+        explicit light_semaphore(int initial_count, int maximum_count, std::uint32_t spin_count = 0);
+        light_semaphore(light_semaphore const&) = delete;
+        light_semaphore(light_semaphore&&) noexcept = delete;
+        ~light_semaphore() = default;
+        light_semaphore& operator=(light_semaphore const&) = delete;
+        light_semaphore& operator=(light_semaphore&&) noexcept = delete;
+
+        /// <summary>
+        /// wait for the count to be greater than zero then decrement it
+        /// </summary>
+        /// <param name="timeout">
+        /// optional interval to wait for, if std::nullopt waits until acquired; zero tests the count without blocking
+        /// </param>
+        /// <returns>true if the count was decremented; otherwise, false</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool wait_one(std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt) const
+        {
+            using modern_win32::shared::to_milliseconds;
+            return acquire_units(1, timeout.has_value() ? std::optional(to_milliseconds(timeout.value())) : std::nullopt);
+        }
+
+        /// <summary>
+        /// wait for the count to be greater than zero then decrement it
+        /// </summary>
+        /// <returns>true if the count was decremented; otherwise, false</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool wait_one(std::chrono::duration<REP, PERIOD> const timeout) const
+        {
+            return wait_one(std::optional(timeout));
+        }
+
+        /// <summary>
+        /// wait for the count to reach <paramref name="count"/> then decrement it by that amount in a single step
+        /// </summary>
+        /// <param name="count">number of units to take, greater than zero and no more than the maximum count</param>
+        /// <param name="timeout">
+        /// optional interval to wait for, if std::nullopt waits until acquired; zero tests the count without blocking
+        /// </param>
+        /// <returns>true if the count was decremented; otherwise, false and the count is unchanged</returns>
+        /// <exception cref="std::invalid_argument">
+        /// if count is less than or equal to zero, or greater than maximum value
+        /// </exception>
+        /// <remarks>
+        /// waiters for a single unit are not held back for a waiter needing several, a large request may wait
+        /// indefinitely while smaller ones keep the count low
+        /// </remarks>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool acquire(int const count, std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt) const
+        {
+            using modern_win32::shared::to_milliseconds;
+            return acquire_units(to_units(count), timeout.has_value() ? std::optional(to_milliseconds(timeout.value())) : std::nullopt);
+        }
+
+        /// <summary>
+        /// wait for the count to reach <paramref name="count"/> then decrement it by that amount in a single step
+        /// </summary>
+        /// <returns>true if the count was decremented; otherwise, false and the count is unchanged</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool acquire(int const count, std::chrono::duration<REP, PERIOD> const timeout) const
+        {
+            return acquire(count, std::optional(timeout));
+        }
+
+        /// <summary>
+        /// decrements the count by <paramref name="count"/> only if that many units are available now
+        /// </summary>
+        /// <returns>true if the count was decremented; otherwise, false and the count is unchanged</returns>
+        /// <exception cref="std::invalid_argument">
+        /// if count is less than or equal to zero, or greater than maximum value
+        /// </exception>
+        [[nodiscard]]
+        bool try_acquire(int count) const;
+
+        /// <summary>
+        /// Increases the count by <paramref name="count"/>, waking up to that many waiters
+        /// </summary>
+        /// <exception cref="std::invalid_argument">
+        /// if count is less than or equal to zero, or greater than maximum value
+        /// </exception>
+        /// <exception cref="windows_exception">
+        /// with ERROR_TOO_MANY_POSTS if the count would exceed the maximum, the count is unchanged
+        /// </exception>
+        void release(int count = 1);
+
+        /// <summary>
+        /// returns the current count, it may have changed by the time it is used
+        /// </summary>
+        [[nodiscard]]
+        int count() const noexcept;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        mutable std::atomic<std::uint32_t> count_;
+        mutable std::atomic<std::uint32_t> waiters_{};
+        mutable std::atomic<std::uint32_t> multi_unit_waiters_{};
+#       pragma warning(pop)
+        std::uint32_t maximum_count_;
+        std::uint32_t spin_count_;
+
+        [[nodiscard]]
+        std::uint32_t to_units(int count) const;
+
+        [[nodiscard]]
+        bool acquire_units(std::uint32_t units, std::optional<std::chrono::milliseconds> const& timeout) const;
+
+        [[nodiscard]]
+        bool try_acquire_units(std::uint32_t units) const noexcept;
+    };
+
+}
+
+#endif
+#endif
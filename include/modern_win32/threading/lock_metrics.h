@@ -0,0 +1,116 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_LOCK_METRICS_H_
+#define MODERN_WIN32_THREADING_LOCK_METRICS_H_
+
+#ifdef _WIN32
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <modern_win32/metrics.h>
+#include <modern_win32/threading/instrumented_lock.h>
+#include <modern_win32/threading/slim_lock.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// instrumentation policy for <see cref="instrumented_lock"/> recording to <see cref="metrics::registry"/>
+    /// under <c>name.acquisitions</c>, <c>name.contended</c>, <c>name.timeouts</c>, <c>name.wait</c> and <c>name.hold</c>
+    /// </summary>
+    /// <remarks>
+    /// locks sharing a name share their metrics, which outlive the lock, so a name is intended to identify a
+    /// class of lock rather than an instance
+    /// </remarks>
+    class lock_metrics final
+    {
+    public:
+        static constexpr bool enabled = true;
+
+        explicit lock_metrics(std::wstring_view const name)
+            : lock_metrics(name, metrics::registry::instance())
+        {
+        }
+        explicit lock_metrics(std::wstring_view const name, metrics::registry& registry)
+            : acquisitions_(registry.get_counter(metric_name(name, L".acquisitions")))
+            , contended_acquisitions_(registry.get_counter(metric_name(name, L".contended")))
+            , timeouts_(registry.get_counter(metric_name(name, L".timeouts")))
+            , wait_(registry.get_histogram(metric_name(name, L".wait")))
+            , hold_(registry.get_histogram(metric_name(name, L".hold")))
+        {
+        }
+        lock_metrics(lock_metrics const&) = delete;
+        lock_metrics(lock_metrics&&) noexcept = delete;
+        ~lock_metrics() = default;
+
+        void on_acquired(bool const contended, std::chrono::nanoseconds const wait) noexcept
+        {
+            acquisitions_.add();
+            if (contended) {
+                contended_acquisitions_.add();
+            }
+            wait_.record(wait);
+        }
+
+        void on_timed_out(std::chrono::nanoseconds const wait) noexcept
+        {
+            timeouts_.add();
+            wait_.record(wait);
+        }
+
+        void on_held(std::chrono::nanoseconds const hold) noexcept
+        {
+            hold_.record(hold);
+        }
+
+        [[nodiscard]]
+        metrics::latency_histogram const& wait_histogram() const noexcept
+        {
+            return wait_;
+        }
+
+        [[nodiscard]]
+        metrics::latency_histogram const& hold_histogram() const noexcept
+        {
+            return hold_;
+        }
+
+        lock_metrics& operator=(lock_metrics const&) = delete;
+        lock_metrics& operator=(lock_metrics&&) noexcept = delete;
+
+    private:
+        metrics::counter& acquisitions_;
+        metrics::counter& contended_acquisitions_;
+        metrics::counter& timeouts_;
+        metrics::latency_histogram& wait_;
+        metrics::latency_histogram& hold_;
+
+        [[nodiscard]]
+        static std::wstring metric_name(std::wstring_view const name, std::wstring_view const suffix)
+        {
+            std::wstring value{ name.empty() ? std::wstring_view(L"lock") : name };
+            value.append(suffix);
+            return value;
+        }
+    };
+
+    /// <summary>
+    /// <see cref="slim_lock"/> recording its waits and hold times to <see cref="metrics::registry::instance"/>
+    /// </summary>
+    using metered_slim_lock = instrumented_lock<slim_lock, lock_metrics>;
+
+}
+
+#endif
+#endif
@@ -0,0 +1,136 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_LOCK_STATISTICS_H_
+#define MODERN_WIN32_THREADING_LOCK_STATISTICS_H_
+
+#ifdef _WIN32
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// number of buckets in the wait and hold time histograms, bucket i counts durations below 2^i nanoseconds
+    /// which were not counted by bucket i - 1; the last bucket also counts everything larger
+    /// </summary>
+    constexpr std::size_t lock_histogram_bucket_count = 32;
+
+    using lock_histogram = std::array<std::uint64_t, lock_histogram_bucket_count>;
+
+    /// <summary>
+    /// point in time copy of the counters held by <see cref="lock_statistics"/>
+    /// </summary>
+    struct lock_statistics_snapshot final
+    {
+        std::wstring name{};
+        std::uint64_t acquisitions{};
+        std::uint64_t contended_acquisitions{};
+        std::uint64_t timeouts{};
+        std::chrono::nanoseconds total_wait_time{};
+        std::chrono::nanoseconds total_hold_time{};
+        lock_histogram wait_histogram{};
+        lock_histogram hold_histogram{};
+    };
+
+    /// <summary>
+    /// instrumentation policy which records nothing, every hook compiles away
+    /// </summary>
+    struct no_lock_statistics final
+    {
+        static constexpr bool enabled = false;
+
+        constexpr explicit no_lock_statistics(std::wstring_view) noexcept
+        {
+        }
+
+        constexpr void on_acquired(bool, std::chrono::nanoseconds) noexcept
+        {
+        }
+        constexpr void on_timed_out(std::chrono::nanoseconds) noexcept
+        {
+        }
+        constexpr void on_held(std::chrono::nanoseconds) noexcept
+        {
+        }
+    };
+
+    /// <summary>
+    /// instrumentation policy counting acquisitions and recording wait and hold time histograms for a named lock,
+    /// updates are relaxed atomics so <see cref="snapshot"/> may be called from any thread at any time
+    /// </summary>
+    class MODERN_WIN32_EXPORT lock_statistics final
+    {
+    public:
+        static constexpr bool enabled = true;
+
+        explicit lock_statistics(std::wstring_view name);
+        lock_statistics(lock_statistics const&) = delete;
+        lock_statistics(lock_statistics&&) noexcept = delete;
+        ~lock_statistics() = default;
+
+        /// <summary>
+        /// records an acquisition, <paramref name="wait"/> is the time spent blocked when <paramref name="contended"/>
+        /// </summary>
+        void on_acquired(bool contended, std::chrono::nanoseconds wait) noexcept;
+
+        /// <summary>
+        /// records a timed acquisition which gave up after waiting <paramref name="wait"/>
+        /// </summary>
+        void on_timed_out(std::chrono::nanoseconds wait) noexcept;
+
+        /// <summary>
+        /// records the time between acquisition and release
+        /// </summary>
+        void on_held(std::chrono::nanoseconds hold) noexcept;
+
+        [[nodiscard]]
+        std::wstring const& name() const noexcept;
+
+        /// <summary>
+        /// copies the current counters, individual counters are read independently so a snapshot taken during
+        /// updates may be off by the acquisitions in flight
+        /// </summary>
+        [[nodiscard]]
+        lock_statistics_snapshot snapshot() const;
+
+        lock_statistics& operator=(lock_statistics const&) = delete;
+        lock_statistics& operator=(lock_statistics&&) noexcept = delete;
+
+    private:
+        using atomic_histogram = std::array<std::atomic<std::uint64_t>, lock_histogram_bucket_count>;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::wstring name_;
+        std::atomic<std::uint64_t> acquisitions_{};
+        std::atomic<std::uint64_t> contended_acquisitions_{};
+        std::atomic<std::uint64_t> timeouts_{};
+        std::atomic<std::int64_t> total_wait_ns_{};
+        std::atomic<std::int64_t> total_hold_ns_{};
+        atomic_histogram wait_histogram_{};
+        atomic_histogram hold_histogram_{};
+#       pragma warning(pop)
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,282 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_PARALLEL_H_
+#define MODERN_WIN32_THREADING_PARALLEL_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/cache_line.h>
+#include <modern_win32/threading/thread_pool.h>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    namespace details
+    {
+        /// <summary>
+        /// division of <see cref="item_count"/> items into <see cref="chunk_count"/> chunks of <see cref="grain"/>
+        /// items, the final chunk may be shorter
+        /// </summary>
+        struct chunk_plan final
+        {
+            std::size_t item_count{};
+            std::size_t grain{};
+            std::size_t chunk_count{};
+
+            [[nodiscard]]
+            constexpr std::size_t begin(std::size_t const chunk) const noexcept
+            {
+                return chunk * grain;
+            }
+
+            [[nodiscard]]
+            constexpr std::size_t end(std::size_t const chunk) const noexcept
+            {
+                return (std::min)(begin(chunk) + grain, item_count);
+            }
+        };
+
+        using chunk_callback = void (*)(void* context, std::size_t chunk);
+
+        /// <summary>
+        /// splits <paramref name="item_count"/> items into chunks of <paramref name="grain"/>, a grain of zero
+        /// selects one giving roughly four chunks per participating thread
+        /// </summary>
+        [[nodiscard]]
+        MODERN_WIN32_EXPORT chunk_plan make_chunk_plan(thread_pool const& pool, std::size_t item_count, std::size_t grain) noexcept;
+
+        /// <summary>
+        /// runs <paramref name="callback"/> once for each chunk in [0, <paramref name="chunk_count"/>) using the
+        /// calling thread and the workers of <paramref name="pool"/>, returning once every chunk has completed
+        /// </summary>
+        /// <remarks>
+        /// chunks are claimed dynamically so uneven work balances itself; the calling thread takes part and never
+        /// waits on a chunk which hasn't been claimed, so calling from a worker of the same pool cannot deadlock.
+        /// once a chunk throws no further chunks are started and the first exception is rethrown to the caller
+        /// </remarks>
+        MODERN_WIN32_EXPORT void run_chunks(thread_pool& pool, std::size_t chunk_count, chunk_callback callback, void* context);
+
+        template <typename CALLABLE>
+        void run_chunks(thread_pool& pool, std::size_t const chunk_count, CALLABLE& callable)
+        {
+            run_chunks(pool, chunk_count,
+                [](void* context, std::size_t const chunk) {
+                    (*static_cast<CALLABLE*>(context))(chunk);
+                },
+                static_cast<void*>(std::addressof(callable)));
+        }
+
+        template <typename T, typename = void>
+        struct is_random_access_iterator : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_random_access_iterator<T, std::void_t<typename std::iterator_traits<T>::iterator_category>>
+            : std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<T>::iterator_category>
+        {
+        };
+
+        template <typename T>
+        constexpr bool is_random_access_iterator_v = is_random_access_iterator<T>::value;
+
+        template <typename INDEX>
+        [[nodiscard]]
+        constexpr std::size_t distance(INDEX const first, INDEX const last) noexcept
+        {
+            using unsigned_index = std::make_unsigned_t<INDEX>;
+            return first < last
+                ? static_cast<std::size_t>(static_cast<unsigned_index>(last) - static_cast<unsigned_index>(first))
+                : std::size_t{};
+        }
+
+        template <typename INDEX>
+        [[nodiscard]]
+        constexpr INDEX advance(INDEX const first, std::size_t const offset) noexcept
+        {
+            using unsigned_index = std::make_unsigned_t<INDEX>;
+            return static_cast<INDEX>(static_cast<unsigned_index>(first) + static_cast<unsigned_index>(offset));
+        }
+
+#       pragma warning(push)
+#       pragma warning(disable : 4324)
+
+        /// <summary>
+        /// result of a single chunk of a reduce, each on its own cache line so chunks finishing on different threads
+        /// never write to the same object, which std::vector&lt;bool&gt; would otherwise do
+        /// </summary>
+        template <typename T>
+        struct alignas((std::max)(cache_line_size, alignof(T))) partial_result final
+        {
+            T value;
+        };
+
+#       pragma warning(pop)
+    }
+
+    /// <summary>
+    /// invokes <paramref name="body"/> with the bounds of each chunk of [<paramref name="first"/>, <paramref name="last"/>),
+    /// chunks run concurrently on the calling thread and the workers of <paramref name="pool"/>
+    /// </summary>
+    /// <param name="body">callable accepting (INDEX begin, INDEX end)</param>
+    /// <param name="grain">items per chunk, zero selects a grain based on the size of the range and the pool</param>
+    /// <exception>rethrows the first exception thrown by <paramref name="body"/></exception>
+    template <typename INDEX, typename BODY, std::enable_if_t<std::is_integral_v<INDEX>, int> = 0>
+    void parallel_for_chunks(thread_pool& pool, INDEX const first, INDEX const last, BODY&& body, std::size_t const grain = 0)
+    {
+        static_assert(std::is_invocable_v<BODY&, INDEX, INDEX>, "BODY must be invokable with (INDEX, INDEX)");
+
+        auto const plan = details::make_chunk_plan(pool, details::distance(first, last), grain);
+        auto invoke_chunk = [&](std::size_t const chunk) {
+            std::invoke(body, details::advance(first, plan.begin(chunk)), details::advance(first, plan.end(chunk)));
+        };
+        details::run_chunks(pool, plan.chunk_count, invoke_chunk);
+    }
+
+    /// <summary>
+    /// invokes <paramref name="body"/> once for each index in [<paramref name="first"/>, <paramref name="last"/>),
+    /// see <see cref="parallel_for_chunks"/>
+    /// </summary>
+    /// <param name="body">callable accepting (INDEX index)</param>
+    /// <param name="grain">items per chunk, zero selects a grain based on the size of the range and the pool</param>
+    /// <exception>rethrows the first exception thrown by <paramref name="body"/></exception>
+    template <typename INDEX, typename BODY, std::enable_if_t<std::is_integral_v<INDEX>, int> = 0>
+    void parallel_for(thread_pool& pool, INDEX const first, INDEX const last, BODY&& body, std::size_t const grain = 0)
+    {
+        static_assert(std::is_invocable_v<BODY&, INDEX>, "BODY must be invokable with INDEX");
+
+        parallel_for_chunks(pool, first, last,
+            [&body](INDEX begin, INDEX const end) {
+                for (; begin != end; ++begin) {
+                    std::invoke(body, begin);
+                }
+            },
+            grain);
+    }
+
+    /// <summary>
+    /// invokes <paramref name="body"/> once for each element in [<paramref name="first"/>, <paramref name="last"/>),
+    /// see <see cref="parallel_for_chunks"/>
+    /// </summary>
+    /// <param name="body">callable accepting the iterator's reference type</param>
+    /// <param name="grain">items per chunk, zero selects a grain based on the size of the range and the pool</param>
+    /// <exception>rethrows the first exception thrown by <paramref name="body"/></exception>
+    template <typename ITERATOR, typename BODY, std::enable_if_t<details::is_random_access_iterator_v<ITERATOR>, int> = 0>
+    void parallel_for(thread_pool& pool, ITERATOR const first, ITERATOR const last, BODY&& body, std::size_t const grain = 0)
+    {
+        auto const count = first < last ? static_cast<std::size_t>(last - first) : std::size_t{};
+        parallel_for_chunks(pool, std::size_t{}, count,
+            [first, &body](std::size_t const begin, std::size_t const end) {
+                auto const chunk_last = first + static_cast<std::ptrdiff_t>(end);
+                for (auto element = first + static_cast<std::ptrdiff_t>(begin); element != chunk_last; ++element) {
+                    std::invoke(body, *element);
+                }
+            },
+            grain);
+    }
+
+    /// <summary>
+    /// reduces [<paramref name="first"/>, <paramref name="last"/>) by combining <paramref name="map"/> of each index,
+    /// each chunk is reduced starting from <paramref name="identity"/> and the chunk results are then combined in
+    /// index order on the calling thread
+    /// </summary>
+    /// <param name="identity">value which leaves the result unchanged when combined, such as 0 for addition</param>
+    /// <param name="map">callable accepting (INDEX index) returning T</param>
+    /// <param name="combine">associative callable accepting (T, T) returning T</param>
+    /// <param name="grain">items per chunk, zero selects a grain based on the size of the range and the pool</param>
+    /// <exception>rethrows the first exception thrown by <paramref name="map"/> or <paramref name="combine"/></exception>
+    template <typename INDEX, typename T, typename MAP, typename COMBINE, std::enable_if_t<std::is_integral_v<INDEX>, int> = 0>
+    [[nodiscard]]
+    T parallel_reduce(thread_pool& pool, INDEX const first, INDEX const last, T identity, MAP&& map, COMBINE&& combine, std::size_t const grain = 0)
+    {
+        auto const plan = details::make_chunk_plan(pool, details::distance(first, last), grain);
+        std::vector<details::partial_result<T>> partials(plan.chunk_count, details::partial_result<T>{ identity });
+        auto reduce_chunk = [&](std::size_t const chunk) {
+            auto result = identity;
+            auto const end = details::advance(first, plan.end(chunk));
+            for (auto index = details::advance(first, plan.begin(chunk)); index != end; ++index) {
+                result = std::invoke(combine, std::move(result), std::invoke(map, index));
+            }
+            partials[chunk].value = std::move(result);
+        };
+        details::run_chunks(pool, plan.chunk_count, reduce_chunk);
+
+        for (auto& partial : partials) {
+            identity = std::invoke(combine, std::move(identity), std::move(partial.value));
+        }
+        return identity;
+    }
+
+    /// <summary>
+    /// reduces the elements of [<paramref name="first"/>, <paramref name="last"/>) using <paramref name="combine"/>,
+    /// see the index overload
+    /// </summary>
+    /// <param name="identity">value which leaves the result unchanged when combined, such as 0 for addition</param>
+    /// <param name="combine">
+    /// associative callable accepting (T, element) returning T, also used to combine chunk results as (T, T)
+    /// </param>
+    /// <param name="grain">items per chunk, zero selects a grain based on the size of the range and the pool</param>
+    /// <exception>rethrows the first exception thrown by <paramref name="combine"/></exception>
+    template <typename ITERATOR, typename T, typename COMBINE, std::enable_if_t<details::is_random_access_iterator_v<ITERATOR>, int> = 0>
+    [[nodiscard]]
+    T parallel_reduce(thread_pool& pool, ITERATOR const first, ITERATOR const last, T identity, COMBINE&& combine, std::size_t const grain = 0)
+    {
+        auto const count = first < last ? static_cast<std::size_t>(last - first) : std::size_t{};
+        auto const plan = details::make_chunk_plan(pool, count, grain);
+        std::vector<details::partial_result<T>> partials(plan.chunk_count, details::partial_result<T>{ identity });
+        auto reduce_chunk = [&](std::size_t const chunk) {
+            auto result = identity;
+            auto const chunk_last = first + static_cast<std::ptrdiff_t>(plan.end(chunk));
+            for (auto element = first + static_cast<std::ptrdiff_t>(plan.begin(chunk)); element != chunk_last; ++element) {
+                result = std::invoke(combine, std::move(result), *element);
+            }
+            partials[chunk].value = std::move(result);
+        };
+        details::run_chunks(pool, plan.chunk_count, reduce_chunk);
+
+        for (auto& partial : partials) {
+            identity = std::invoke(combine, std::move(identity), std::move(partial.value));
+        }
+        return identity;
+    }
+
+    /// <summary>
+    /// runs each of <paramref name="functions"/> concurrently on the calling thread and the workers of
+    /// <paramref name="pool"/>, returning once all have completed
+    /// </summary>
+    /// <exception>rethrows the first exception thrown by any of <paramref name="functions"/></exception>
+    template <typename... FUNCTIONS>
+    void parallel_invoke(thread_pool& pool, FUNCTIONS&&... functions)
+    {
+        static_assert(sizeof...(FUNCTIONS) > 0, "at least one function is required");
+        static_assert((std::is_invocable_v<FUNCTIONS&> && ...), "FUNCTIONS must be invokable");
+
+        auto invoke_one = [&](std::size_t const index) {
+            std::size_t current{};
+            ((current++ == index ? static_cast<void>(std::invoke(functions)) : static_cast<void>(0)), ...);
+        };
+        details::run_chunks(pool, sizeof...(FUNCTIONS), invoke_one);
+    }
+
+}
+
+#endif
+#endif
@@ -0,0 +1,190 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_PROCESSOR_TOPOLOGY_H_
+#define MODERN_WIN32_THREADING_PROCESSOR_TOPOLOGY_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <modern_win32/modern_win32_export.h>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// set of logical processors within a single processor group
+    /// </summary>
+    struct group_affinity final
+    {
+        WORD group{};
+        KAFFINITY mask{};
+
+        [[nodiscard]]
+        constexpr bool empty() const noexcept
+        {
+            return mask == 0;
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(group_affinity const& left, group_affinity const& right) noexcept
+        {
+            return left.group == right.group && left.mask == right.mask;
+        }
+        [[nodiscard]]
+        friend constexpr bool operator!=(group_affinity const& left, group_affinity const& right) noexcept
+        {
+            return !(left == right);
+        }
+    };
+
+    /// <summary>
+    /// a single logical processor identified by group and number within that group
+    /// </summary>
+    struct processor_number final
+    {
+        WORD group{};
+        BYTE number{};
+
+        [[nodiscard]]
+        friend constexpr bool operator==(processor_number const& left, processor_number const& right) noexcept
+        {
+            return left.group == right.group && left.number == right.number;
+        }
+        [[nodiscard]]
+        friend constexpr bool operator!=(processor_number const& left, processor_number const& right) noexcept
+        {
+            return !(left == right);
+        }
+    };
+
+    struct processor_group_info final
+    {
+        WORD group{};
+        BYTE maximum_processor_count{};
+        BYTE active_processor_count{};
+        KAFFINITY active_processor_mask{};
+    };
+
+    struct numa_node_info final
+    {
+        DWORD node{};
+        group_affinity affinity{};
+    };
+
+    struct processor_core_info final
+    {
+        /// <summary>true if the core has more than one logical processor (SMT)</summary>
+        bool simultaneous_multithreading{};
+        /// <summary>higher values are more performant, zero on systems without heterogeneous cores</summary>
+        BYTE efficiency_class{};
+        group_affinity affinity{};
+    };
+
+    enum class cache_kind : std::uint8_t
+    {
+        unified,
+        instruction,
+        data,
+        trace,
+    };
+
+    struct processor_cache_info final
+    {
+        BYTE level{};
+        cache_kind kind{};
+        WORD line_size{};
+        DWORD size{};
+        /// <summary>logical processors sharing this cache</summary>
+        group_affinity affinity{};
+    };
+
+    struct cpu_set_info final
+    {
+        /// <summary>id used with SetThreadSelectedCpuSets</summary>
+        ULONG id{};
+        WORD group{};
+        BYTE logical_processor_index{};
+        BYTE core_index{};
+        BYTE last_level_cache_index{};
+        BYTE numa_node_index{};
+        BYTE efficiency_class{};
+    };
+
+    /// <summary>
+    /// snapshot of processor groups, NUMA nodes, cores, caches and CPU sets, used to place threads near their data
+    /// </summary>
+    class MODERN_WIN32_EXPORT processor_topology final
+    {
+    public:
+        /// <summary>
+        /// queries the current topology using GetLogicalProcessorInformationEx and GetSystemCpuSetInformation
+        /// </summary>
+        /// <exception cref="windows_exception">if GetLogicalProcessorInformationEx fails</exception>
+        [[nodiscard]]
+        static processor_topology query();
+
+        [[nodiscard]]
+        std::vector<processor_group_info> const& groups() const noexcept;
+
+        [[nodiscard]]
+        std::vector<numa_node_info> const& numa_nodes() const noexcept;
+
+        [[nodiscard]]
+        std::vector<processor_core_info> const& cores() const noexcept;
+
+        [[nodiscard]]
+        std::vector<processor_cache_info> const& caches() const noexcept;
+
+        /// <summary>
+        /// CPU sets, empty if CPU sets are not supported by the OS
+        /// </summary>
+        [[nodiscard]]
+        std::vector<cpu_set_info> const& cpu_sets() const noexcept;
+
+        /// <summary>
+        /// returns the total number of active logical processors across all groups
+        /// </summary>
+        [[nodiscard]]
+        std::size_t logical_processor_count() const noexcept;
+
+        /// <summary>
+        /// returns the NUMA node containing <paramref name="processor"/>
+        /// </summary>
+        [[nodiscard]]
+        std::optional<DWORD> numa_node_of(processor_number const& processor) const noexcept;
+
+        /// <summary>
+        /// returns the affinity of each cache of <paramref name="level"/>, i.e. groups of logical processors
+        /// which share that cache
+        /// </summary>
+        [[nodiscard]]
+        std::vector<group_affinity> cache_sharing_sets(BYTE level) const;
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<processor_group_info> groups_{};
+        std::vector<numa_node_info> numa_nodes_{};
+        std::vector<processor_core_info> cores_{};
+        std::vector<processor_cache_info> caches_{};
+        std::vector<cpu_set_info> cpu_sets_{};
+#       pragma warning(pop)
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,198 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_SCHEDULER_H_
+#define MODERN_WIN32_THREADING_SCHEDULER_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/executor.h>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace modern_win32::threading
+{
+    namespace details
+    {
+        struct scheduled_task;
+        struct scheduler_state;
+    }
+
+    /// <summary>
+    /// cancellation token for work queued on a <see cref="scheduler"/>, tokens are cheap to copy and remain safe to
+    /// use after the task has completed or the scheduler has been destroyed
+    /// </summary>
+    class MODERN_WIN32_EXPORT scheduled_task_token final
+    {
+    public:
+        scheduled_task_token() noexcept = default;
+
+        /// <summary>
+        /// cancels the task, a pending task is removed from the queue and a recurring task is not run again,
+        /// a callback already in progress is allowed to complete
+        /// </summary>
+        /// <returns>true if the task had not already been cancelled or completed; otherwise, false</returns>
+        [[maybe_unused]]
+        bool cancel() const noexcept;
+
+        /// <summary>
+        /// returns true if the task was cancelled using this or any other copy of the token
+        /// </summary>
+        [[nodiscard]]
+        bool is_cancelled() const noexcept;
+
+        /// <summary>
+        /// returns true if the task is pending, running or recurring
+        /// </summary>
+        [[nodiscard]]
+        bool is_active() const noexcept;
+
+    private:
+        friend class scheduler;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::weak_ptr<details::scheduled_task> task_{};
+#       pragma warning(pop)
+
+        explicit scheduled_task_token(std::weak_ptr<details::scheduled_task> task) noexcept;
+    };
+
+    /// <summary>
+    /// runs delayed and recurring work on an <see cref="executor"/> using a single thread pool timer which is
+    /// re-armed to the earliest deadline, replacing a timer and thread per callback
+    /// </summary>
+    /// <remarks>
+    /// deadlines are kept in a binary heap so scheduling is O(log n), tasks with equal deadlines run in the order
+    /// they were scheduled.  A recurring task isn't queued again until its callback has returned so it never
+    /// overlaps itself, periods which elapse while it runs are skipped rather than run back to back.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT scheduler final
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+        using task_callback = std::function<void()>;
+
+        /// <summary>
+        /// Instantiates a new instance of the scheduler class
+        /// </summary>
+        /// <param name="target">executor used to run callbacks, must outlive the scheduler</param>
+        /// <param name="tolerable_delay">time the OS may delay expiry by to coalesce it with other timers</param>
+        /// <exception cref="std::invalid_argument">if tolerable_delay is less than zero</exception>
+        /// <exception cref="windows_exception">if unable to create the thread pool timer</exception>
+        explicit scheduler(executor& target = default_threadpool_executor::instance(), std::chrono::milliseconds tolerable_delay = std::chrono::milliseconds(0));
+        scheduler(scheduler const&) = delete;
+        scheduler(scheduler&&) noexcept = delete;
+        ~scheduler();
+        scheduler& operator=(scheduler const&) = delete;
+        scheduler& operator=(scheduler&&) noexcept = delete;
+
+        /// <summary>
+        /// runs <paramref name="callback"/> once <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <remarks>deadlines of clocks other than steady_clock are converted relative to now</remarks>
+        /// <exception cref="std::invalid_argument">if callback is empty</exception>
+        /// <exception cref="std::logic_error">if the scheduler has been shut down</exception>
+        template <class CLOCK, class DURATION>
+        [[maybe_unused]]
+        scheduled_task_token schedule_at(std::chrono::time_point<CLOCK, DURATION> const& deadline, task_callback callback)
+        {
+            if constexpr (std::is_same_v<CLOCK, clock>) {
+                return schedule(std::chrono::ceil<clock::duration>(deadline), clock::duration::zero(), std::move(callback));
+            } else {
+                return schedule(clock::now() + std::chrono::ceil<clock::duration>(deadline - CLOCK::now()), clock::duration::zero(), std::move(callback));
+            }
+        }
+
+        /// <summary>
+        /// runs <paramref name="callback"/> once <paramref name="due_time"/> has elapsed
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if callback is empty</exception>
+        /// <exception cref="std::logic_error">if the scheduler has been shut down</exception>
+        template <class REP, class PERIOD>
+        [[maybe_unused]]
+        scheduled_task_token schedule_after(std::chrono::duration<REP, PERIOD> const& due_time, task_callback callback)
+        {
+            return schedule(clock::now() + std::chrono::ceil<clock::duration>(due_time), clock::duration::zero(), std::move(callback));
+        }
+
+        /// <summary>
+        /// runs <paramref name="callback"/> every <paramref name="period"/> until cancelled, starting one period from now
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if period is less than or equal to zero or callback is empty</exception>
+        /// <exception cref="std::logic_error">if the scheduler has been shut down</exception>
+        template <class REP, class PERIOD>
+        [[maybe_unused]]
+        scheduled_task_token schedule_every(std::chrono::duration<REP, PERIOD> const& period, task_callback callback)
+        {
+            return schedule_every(period, period, std::move(callback));
+        }
+
+        /// <summary>
+        /// runs <paramref name="callback"/> once <paramref name="due_time"/> has elapsed and every
+        /// <paramref name="period"/> thereafter until cancelled
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if period is less than or equal to zero or callback is empty</exception>
+        /// <exception cref="std::logic_error">if the scheduler has been shut down</exception>
+        template <class DUE_REP, class DUE_PERIOD, class PERIOD_REP, class PERIOD_PERIOD>
+        [[maybe_unused]]
+        scheduled_task_token schedule_every(
+            std::chrono::duration<DUE_REP, DUE_PERIOD> const& due_time,
+            std::chrono::duration<PERIOD_REP, PERIOD_PERIOD> const& period,
+            task_callback callback)
+        {
+            auto const interval = std::chrono::ceil<clock::duration>(period);
+            if (interval <= clock::duration::zero()) {
+                throw std::invalid_argument("period must be greater than zero");
+            }
+            return schedule(clock::now() + std::chrono::ceil<clock::duration>(due_time), interval, std::move(callback));
+        }
+
+        /// <summary>
+        /// returns the number of tasks waiting for their deadline, recurring tasks which are running aren't included
+        /// </summary>
+        [[nodiscard]]
+        std::size_t size() const;
+
+        /// <summary>
+        /// returns the number of callbacks which ended with an exception, exceptions are not rethrown
+        /// </summary>
+        [[nodiscard]]
+        std::size_t unhandled_exception_count() const noexcept;
+
+        /// <summary>
+        /// discards pending tasks and blocks until callbacks already in progress have completed, further scheduling
+        /// throws std::logic_error
+        /// </summary>
+        /// <remarks>must not be called from within a scheduled callback</remarks>
+        void shutdown();
+
+    private:
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::shared_ptr<details::scheduler_state> state_;
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        scheduled_task_token schedule(clock::time_point deadline, clock::duration period, task_callback callback);
+    };
+
+}
+
+#endif
+#endif
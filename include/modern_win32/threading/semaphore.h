@@ -16,11 +16,16 @@
 
 #ifdef _WIN32
 
+#include <chrono>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <sstream>
+#include <modern_win32/metrics.h>
 #include <modern_win32/modern_win32_export.h>
 #include <modern_win32/null_handle.h>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/threading/slim_lock.h>
 #include <modern_win32/wait_for.h>
 #include <modern_win32/windows_exception.h>
 
@@ -35,7 +40,13 @@ namespace modern_win32::threading
         static auto create(int const initial_count, int const maximum_count) -> native_handle_type;
 
         [[nodiscard]]
-        static auto release(modern_handle_type handle, int count) -> bool;
+        static auto release(native_handle_type handle, int count) -> bool;
+
+        /// <summary>
+        /// returns the current count of <paramref name="handle"/>, or std::nullopt if it cannot be queried
+        /// </summary>
+        [[nodiscard]]
+        static auto current_count(native_handle_type handle) noexcept -> std::optional<int>;
     };
 
     template <typename TRAITS = semaphore_traits>
@@ -45,6 +56,7 @@ namespace modern_win32::threading
 
         modern_handle_type handle_{};
         int maximum_count_;
+        slim_lock gather_lock_{};
 
     public:
 
@@ -62,7 +74,82 @@ namespace modern_win32::threading
         [[nodiscard]]
         bool wait_one(std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt) const 
         {
-            return is_complete(modern_win32::wait_one(handle_, timeout));
+            if constexpr (metrics::metrics_enabled) {
+                auto const started = qpc_clock::now();
+                return record_acquire(is_complete(modern_win32::wait_one(handle_, timeout)), started);
+            } else {
+                return is_complete(modern_win32::wait_one(handle_, timeout));
+            }
+        }
+
+        /// <summary>
+        /// takes <paramref name="count"/> units, waiting for each in turn until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <param name="count">number of units to take, greater than zero and no more than the maximum count</param>
+        /// <param name="timeout">optional interval to wait for all units, if std::nullopt waits until they are taken</param>
+        /// <returns>true if every unit was taken; otherwise, false and any units taken have been returned</returns>
+        /// <exception cref="std::invalid_argument">
+        /// if count is less than or equal to zero, or greater than maximum value
+        /// </exception>
+        /// <exception cref="windows_exception">if units taken before the timeout cannot be returned</exception>
+        /// <remarks>
+        /// the kernel object can only hand out one unit per wait, so units are not taken atomically and other waiters
+        /// may be served in between; callers taking more than one unit from this object gather them one caller at a
+        /// time so two of them can never each hold part of what the other needs. Callers in other processes or using
+        /// the native handle are not serialized, use <see cref="light_semaphore"/> where an atomic multi-unit
+        /// acquire matters
+        /// </remarks>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool acquire(int const count, std::optional<std::chrono::duration<REP, PERIOD>> const timeout = std::nullopt)
+        {
+            if (count <= 0 || count > maximum_count_) {
+                throw std::invalid_argument((std::string("invalid count value") + std::to_string(count)).c_str());
+            }
+
+            if constexpr (metrics::metrics_enabled) {
+                auto const started = qpc_clock::now();
+                return record_acquire(acquire_units(count, timeout), started);
+            } else {
+                return acquire_units(count, timeout);
+            }
+        }
+
+        /// <summary>
+        /// takes <paramref name="count"/> units, waiting for each in turn until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if every unit was taken; otherwise, false and any units taken have been returned</returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        bool acquire(int const count, std::chrono::duration<REP, PERIOD> const timeout)
+        {
+            return acquire(count, std::optional(timeout));
+        }
+
+        /// <summary>
+        /// takes <paramref name="count"/> units only if they are all available now
+        /// </summary>
+        /// <returns>true if every unit was taken; otherwise, false and none are held</returns>
+        /// <exception cref="std::invalid_argument">
+        /// if count is less than or equal to zero, or greater than maximum value
+        /// </exception>
+        /// <remarks>
+        /// the count is checked before any unit is taken so a failed attempt does not briefly drain units other
+        /// waiters could see, unless another caller takes units between the check and the take
+        /// </remarks>
+        [[nodiscard]]
+        bool try_acquire(int const count)
+        {
+            if (count <= 0 || count > maximum_count_) {
+                throw std::invalid_argument((std::string("invalid count value") + std::to_string(count)).c_str());
+            }
+
+            if constexpr (metrics::metrics_enabled) {
+                auto const started = qpc_clock::now();
+                return record_acquire(try_acquire_units(count), started);
+            } else {
+                return try_acquire_units(count);
+            }
         }
 
         /// <summary>
@@ -88,6 +175,15 @@ namespace modern_win32::threading
             }
         }
 
+        /// <summary>
+        /// returns the underlying implementation-defined native handle object
+        /// </summary>
+        [[nodiscard]]
+        typename modern_handle_type::native_handle_type native_handle() const noexcept
+        {
+            return handle_.native_handle();
+        }
+
         /// <summary>
         /// Swaps the values this and other.
         /// </summary>
@@ -190,6 +286,84 @@ namespace modern_win32::threading
             return !(handle_ == other.handle_);
         }
 #       endif
+
+    private:
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool acquire_units(int const count, std::optional<std::chrono::duration<REP, PERIOD>> const timeout)
+        {
+            auto const deadline = timeout.has_value()
+                ? std::optional(std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout.value()))
+                : std::nullopt;
+
+            if (count == 1) {
+                return gather_units(count, deadline);
+            }
+            if (!deadline.has_value()) {
+                slim_lock_guard guard{ gather_lock_ };
+                return gather_units(count, deadline);
+            }
+            if (!gather_lock_.try_lock_until(deadline.value())) {
+                return false;
+            }
+            std::lock_guard guard{ gather_lock_, std::adopt_lock };
+            return gather_units(count, deadline);
+        }
+
+        [[nodiscard]]
+        bool try_acquire_units(int const count)
+        {
+            if (count == 1) {
+                return gather_units(count, std::optional(std::chrono::steady_clock::now()));
+            }
+            if (!gather_lock_.try_lock()) {
+                return false;
+            }
+            std::lock_guard guard{ gather_lock_, std::adopt_lock };
+            if (auto const available = TRAITS::current_count(handle_.native_handle());
+                !available.has_value() || available.value() < count) {
+                return false;
+            }
+            return gather_units(count, std::optional(std::chrono::steady_clock::now()));
+        }
+
+        [[nodiscard]]
+        bool gather_units(int const count, std::optional<std::chrono::steady_clock::time_point> const deadline)
+        {
+            int taken{};
+            for (; taken < count; ++taken) {
+                std::optional<std::chrono::milliseconds> remaining{};
+                if (deadline.has_value()) {
+                    auto const now = std::chrono::steady_clock::now();
+                    remaining = now < deadline.value()
+                        ? std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now)
+                        : std::chrono::milliseconds(0);
+                }
+                if (!is_complete(modern_win32::wait_one(handle_, remaining))) {
+                    break;
+                }
+            }
+
+            if (taken == count) {
+                return true;
+            }
+            if (taken > 0) {
+                release(taken);
+            }
+            return false;
+        }
+
+        [[nodiscard]]
+        static bool record_acquire(bool const acquired, qpc_clock::time_point const started) noexcept
+        {
+            auto const& library = metrics::library();
+            if (acquired) {
+                library.semaphore_acquire.record(qpc_clock::now() - started);
+            } else {
+                library.semaphore_timeouts.add();
+            }
+            return acquired;
+        }
     };
 
 #   if __cplusplus > 201703L 
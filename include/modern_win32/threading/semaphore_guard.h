@@ -0,0 +1,98 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_SEMAPHORE_GUARD_H_
+#define MODERN_WIN32_THREADING_SEMAPHORE_GUARD_H_
+
+#include <chrono>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// RAII guard which takes a number of units from <typeparamref name="SEMAPHORE"/>, either
+    /// <see cref="semaphore"/> or <see cref="light_semaphore"/>, and returns all of them on scope exit
+    /// </summary>
+    template <typename SEMAPHORE>
+    class semaphore_guard final
+    {
+        SEMAPHORE& semaphore_;
+        int count_{};
+    public:
+        using semaphore_type = SEMAPHORE;
+
+        /// <summary>
+        /// blocks until <paramref name="count"/> units have been taken
+        /// </summary>
+        explicit semaphore_guard(SEMAPHORE& semaphore, int const count = 1)
+            : semaphore_{ semaphore }
+            , count_{ semaphore.acquire(count) ? count : 0 }
+        {
+        }
+
+        /// <summary>
+        /// attempts to take <paramref name="count"/> units within <paramref name="timeout"/>, check
+        /// <see cref="owns_lock"/> to determine whether they were taken
+        /// </summary>
+        template <class REP, class PERIOD>
+        explicit semaphore_guard(SEMAPHORE& semaphore, int const count, std::chrono::duration<REP, PERIOD> const timeout)
+            : semaphore_{ semaphore }
+            , count_{ semaphore.acquire(count, timeout) ? count : 0 }
+        {
+        }
+
+        ~semaphore_guard()
+        {
+            if (count_ > 0) {
+                semaphore_.release(count_);
+            }
+        }
+
+        /// <summary>
+        /// Checks whether *this holds the units it was constructed to take
+        /// </summary>
+        [[nodiscard]]
+        constexpr bool owns_lock() const noexcept
+        {
+            return count_ > 0;
+        }
+
+        /// <summary>
+        /// number of units held, zero once released or if acquisition timed out
+        /// </summary>
+        [[nodiscard]]
+        constexpr int count() const noexcept
+        {
+            return count_;
+        }
+
+        /// <summary>
+        /// returns the held units before scope exit
+        /// </summary>
+        void release()
+        {
+            if (count_ > 0) {
+                auto const count = count_;
+                count_ = 0;
+                semaphore_.release(count);
+            }
+        }
+
+        semaphore_guard(semaphore_guard const&) = delete;
+        semaphore_guard(semaphore_guard &&) noexcept = delete;
+        semaphore_guard& operator=(semaphore_guard const&) = delete;
+        semaphore_guard& operator=(semaphore_guard &&) noexcept = delete;
+    };
+
+}
+
+#endif
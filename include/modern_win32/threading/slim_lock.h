@@ -21,6 +21,10 @@
 
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <shared_mutex>
 #include <modern_win32/modern_win32_export.h>
 
@@ -30,9 +34,14 @@ namespace modern_win32::threading
 #ifdef _WIN32
 
     /// <summary>
-    /// modern C++ wrapper around SRWLOCK intended to mirror std::shared_mutex such that it be used by both
+    /// modern C++ wrapper around SRWLOCK intended to mirror std::shared_timed_mutex such that it be used by both
     /// std::lock_guard and std::shared_lock to provide RAII release of the lock
     /// </summary>
+    /// <remarks>
+    /// SRWLOCK has no timed acquire, timed waiters spin briefly then park on the lock word using WaitOnAddress;
+    /// unlock reads the waiter count before releasing and only wakes by address afterwards, so the last owner may
+    /// destroy the lock straight after unlocking
+    /// </remarks>
     class MODERN_WIN32_EXPORT slim_lock final
     {
         using native_handle_type = PSRWLOCK;
@@ -40,6 +49,12 @@ namespace modern_win32::threading
     public:
         explicit slim_lock();
         slim_lock(slim_lock const&) = delete;
+
+        /// <summary>
+        /// creates a new unlocked lock, lock state is never transferred so moving only exists to allow slim_lock to
+        /// be stored in containers which relocate their elements
+        /// </summary>
+        /// <remarks>neither lock may be held while being moved</remarks>
         slim_lock(slim_lock&& other) noexcept;
         ~slim_lock() noexcept = default;
 
@@ -55,6 +70,28 @@ namespace modern_win32::threading
         [[nodiscard]]
         bool try_lock() noexcept;
 
+        /// <summary>
+        /// Attempts to acquire the lock in exclusive mode, blocking until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return timed_lock(to_steady_deadline(std::chrono::steady_clock::now(), timeout), false);
+        }
+
+        /// <summary>
+        /// Attempts to acquire the lock in exclusive mode, blocking until <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return timed_lock(to_steady_deadline(std::chrono::steady_clock::now(), deadline - CLOCK::now()), false);
+        }
+
         /// <summary>
         /// Releases an SRW lock that was opened in exclusive mode.
         /// </summary>
@@ -72,6 +109,28 @@ namespace modern_win32::threading
         [[nodiscard]]
         bool try_lock_shared() noexcept;
 
+        /// <summary>
+        /// Attempts to acquire the lock in shared mode, blocking until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_shared_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return timed_lock(to_steady_deadline(std::chrono::steady_clock::now(), timeout), true);
+        }
+
+        /// <summary>
+        /// Attempts to acquire the lock in shared mode, blocking until <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_shared_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return timed_lock(to_steady_deadline(std::chrono::steady_clock::now(), deadline - CLOCK::now()), true);
+        }
+
         /// <summary>
         /// Releases an SRW lock that was opened in shared mode.
         /// </summary>
@@ -85,15 +144,35 @@ namespace modern_win32::threading
         native_handle_type native_handle() noexcept;
 
         slim_lock& operator=(slim_lock const&) = delete;
+        /// <summary>
+        /// leaves both locks unlocked, see the move constructor
+        /// </summary>
         slim_lock& operator=(slim_lock&& other) noexcept;
 
     private:
         SRWLOCK lock_{};
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::atomic<std::uint32_t> timed_waiters_{};
+#       pragma warning(pop)
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        static std::chrono::steady_clock::time_point to_steady_deadline(std::chrono::steady_clock::time_point const now, std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return timeout <= std::chrono::duration<REP, PERIOD>::zero()
+                ? now
+                : now + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+        }
+
+        [[nodiscard]]
+        bool timed_lock(std::chrono::steady_clock::time_point deadline, bool shared) noexcept;
+        static void wake_timed_waiters(void* address) noexcept;
     };
 
 #else
 
-    using slim_lock = std::shared_mutex;
+    using slim_lock = std::shared_timed_mutex;
 
 #endif
 
@@ -0,0 +1,202 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_SLIM_LOCK_ARRAY_H_
+#define MODERN_WIN32_THREADING_SLIM_LOCK_ARRAY_H_
+
+#ifdef _WIN32
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <modern_win32/threading/cache_line.h>
+#include <modern_win32/threading/slim_lock.h>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// maps <paramref name="hash"/> onto one of <paramref name="stripe_count"/> stripes, the hash is mixed first so
+    /// identity hashes of sequential keys or aligned pointers still spread across every stripe
+    /// </summary>
+    [[nodiscard]]
+    constexpr std::size_t hash_to_stripe(std::size_t const hash, std::size_t const stripe_count) noexcept
+    {
+        // fibonacci hashing, the high bits of the product depend on every input bit
+        auto const mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+        auto const folded = static_cast<std::size_t>(mixed ^ (mixed >> 32));
+        return (stripe_count & (stripe_count - 1)) == 0
+            ? folded & (stripe_count - 1)
+            : folded % stripe_count;
+    }
+
+    /// <summary>
+    /// <see cref="slim_lock"/> occupying its own cache line so neighbouring locks in an array or container do not
+    /// suffer false sharing; like slim_lock it may be moved, but only while unlocked
+    /// </summary>
+    class alignas(cache_line_size) padded_slim_lock final
+    {
+    public:
+        using native_handle_type = PSRWLOCK;
+
+        padded_slim_lock() = default;
+        padded_slim_lock(padded_slim_lock const&) = delete;
+        padded_slim_lock(padded_slim_lock&&) noexcept = default;
+        ~padded_slim_lock() = default;
+
+        void lock() noexcept
+        {
+            lock_.lock();
+        }
+
+        [[nodiscard]]
+        bool try_lock() noexcept
+        {
+            return lock_.try_lock();
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return lock_.try_lock_for(timeout);
+        }
+
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return lock_.try_lock_until(deadline);
+        }
+
+        void unlock() noexcept
+        {
+            lock_.unlock();
+        }
+
+        void lock_shared() noexcept
+        {
+            lock_.lock_shared();
+        }
+
+        [[nodiscard]]
+        bool try_lock_shared() noexcept
+        {
+            return lock_.try_lock_shared();
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_shared_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return lock_.try_lock_shared_for(timeout);
+        }
+
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_shared_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return lock_.try_lock_shared_until(deadline);
+        }
+
+        void unlock_shared() noexcept
+        {
+            lock_.unlock_shared();
+        }
+
+        [[nodiscard]]
+        native_handle_type native_handle() noexcept
+        {
+            return lock_.native_handle();
+        }
+
+        padded_slim_lock& operator=(padded_slim_lock const&) = delete;
+        padded_slim_lock& operator=(padded_slim_lock&&) noexcept = default;
+
+    private:
+        slim_lock lock_{};
+    };
+
+    static_assert(sizeof(padded_slim_lock) % cache_line_size == 0, "padded_slim_lock must fill whole cache lines");
+
+    /// <summary>
+    /// fixed set of <typeparamref name="N"/> cache-line padded locks for striping a hash table or similar,
+    /// <see cref="for_hash"/> selects the lock guarding a given key
+    /// </summary>
+    template <std::size_t N>
+    class slim_lock_array final
+    {
+        static_assert(N > 0, "slim_lock_array requires at least one lock");
+
+    public:
+        using value_type = padded_slim_lock;
+        using size_type = std::size_t;
+
+        [[nodiscard]]
+        static constexpr size_type size() noexcept
+        {
+            return N;
+        }
+
+        /// <summary>
+        /// index of the stripe guarding keys with <paramref name="hash"/>
+        /// </summary>
+        [[nodiscard]]
+        static constexpr size_type index_for(std::size_t const hash) noexcept
+        {
+            return hash_to_stripe(hash, N);
+        }
+
+        /// <summary>
+        /// lock guarding keys with <paramref name="hash"/>
+        /// </summary>
+        [[nodiscard]]
+        padded_slim_lock& for_hash(std::size_t const hash) noexcept
+        {
+            return locks_[index_for(hash)];
+        }
+
+        [[nodiscard]]
+        padded_slim_lock& operator[](size_type const index) noexcept
+        {
+            return locks_[index];
+        }
+
+        /// <summary>
+        /// acquires every lock in index order, for operations such as rehashing which touch every stripe
+        /// </summary>
+        void lock_all() noexcept
+        {
+            for (auto& lock : locks_) {
+                lock.lock();
+            }
+        }
+
+        /// <summary>
+        /// releases every lock acquired by <see cref="lock_all"/>
+        /// </summary>
+        void unlock_all() noexcept
+        {
+            for (auto lock = locks_.rbegin(); lock != locks_.rend(); ++lock) {
+                lock->unlock();
+            }
+        }
+
+    private:
+        std::array<padded_slim_lock, N> locks_{};
+    };
+
+}
+
+#endif
+#endif
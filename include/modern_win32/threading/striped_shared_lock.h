@@ -0,0 +1,177 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_STRIPED_SHARED_LOCK_H_
+#define MODERN_WIN32_THREADING_STRIPED_SHARED_LOCK_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/slim_lock_array.h>
+
+namespace modern_win32::threading
+{
+
+#ifdef _WIN32
+
+    /// <summary>
+    /// reader/writer lock sharded into cache-line padded stripes, readers acquire only the stripe belonging to
+    /// their processor while writers acquire every stripe; meets the same requirements as <see cref="slim_lock"/>
+    /// so it can be used with std::lock_guard, std::shared_lock and timed_lock_guard
+    /// </summary>
+    /// <remarks>
+    /// a thread's stripe is chosen from the processor it first takes a shared lock on and is kept for the
+    /// lifetime of that thread so that unlock_shared always releases the stripe lock_shared acquired.
+    /// exclusive acquisition cost grows with the stripe count, intended for read-mostly data
+    /// </remarks>
+    class MODERN_WIN32_EXPORT striped_shared_lock final
+    {
+    public:
+        /// <summary>
+        /// creates a lock with <paramref name="stripe_count"/> stripes, or one stripe per active logical
+        /// processor when <paramref name="stripe_count"/> is 0
+        /// </summary>
+        explicit striped_shared_lock(std::size_t stripe_count = 0);
+        striped_shared_lock(striped_shared_lock const&) = delete;
+        striped_shared_lock(striped_shared_lock&&) noexcept = delete;
+        ~striped_shared_lock() = default;
+
+        /// <summary>
+        /// Acquires every stripe in exclusive mode
+        /// </summary>
+        void lock() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire every stripe in exclusive mode without blocking
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        [[nodiscard]]
+        bool try_lock() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire the lock in exclusive mode, blocking until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return try_lock_until(std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout));
+        }
+
+        /// <summary>
+        /// Attempts to acquire the lock in exclusive mode, blocking until <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            for (std::size_t i = 0; i < stripe_count_; ++i) {
+                if (!stripes_[i].try_lock_until(deadline)) {
+                    release_exclusive(i);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Releases every stripe held in exclusive mode
+        /// </summary>
+        void unlock() noexcept;
+
+        /// <summary>
+        /// Acquires the calling thread's stripe in shared mode
+        /// </summary>
+        void lock_shared() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire the calling thread's stripe in shared mode without blocking
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        [[nodiscard]]
+        bool try_lock_shared() noexcept;
+
+        /// <summary>
+        /// Attempts to acquire the lock in shared mode, blocking until <paramref name="timeout"/> has elapsed
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        bool try_lock_shared_for(std::chrono::duration<REP, PERIOD> const& timeout) noexcept
+        {
+            return current_stripe().try_lock_shared_for(timeout);
+        }
+
+        /// <summary>
+        /// Attempts to acquire the lock in shared mode, blocking until <paramref name="deadline"/> has been reached
+        /// </summary>
+        /// <returns>true if lock has been obtained; otherwise, false</returns>
+        template <class CLOCK, class DURATION>
+        [[nodiscard]]
+        bool try_lock_shared_until(std::chrono::time_point<CLOCK, DURATION> const& deadline) noexcept
+        {
+            return current_stripe().try_lock_shared_until(deadline);
+        }
+
+        /// <summary>
+        /// Releases the calling thread's stripe held in shared mode
+        /// </summary>
+        void unlock_shared() noexcept;
+
+        /// <summary>
+        /// number of stripes readers are spread across
+        /// </summary>
+        [[nodiscard]]
+        std::size_t stripe_count() const noexcept;
+
+        striped_shared_lock& operator=(striped_shared_lock const&) = delete;
+        striped_shared_lock& operator=(striped_shared_lock&&) noexcept = delete;
+
+    private:
+        using stripe = padded_slim_lock;
+
+        std::size_t stripe_count_;
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::unique_ptr<stripe[]> stripes_;
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        stripe& current_stripe() noexcept;
+
+        /// <summary>
+        /// releases the first <paramref name="count"/> stripes in reverse acquisition order
+        /// </summary>
+        void release_exclusive(std::size_t count) noexcept;
+    };
+
+#else
+
+    using striped_shared_lock = std::shared_timed_mutex;
+
+#endif
+
+}
+
+#endif
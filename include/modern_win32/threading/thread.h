@@ -16,13 +16,19 @@
 #ifdef _WIN32
 
 #include <modern_win32/null_handle.h>
+#include <modern_win32/threading/processor_topology.h>
+#include <modern_win32/threading/thread_options.h>
 #include <modern_win32/threading/thread_start.h>
 #include <modern_win32/windows_exception.h>
+#include <modern_win32/windows_result.h>
 #include <modern_win32/modern_win32_export.h>
 #include <chrono>
 #include <optional>
 #include <memory>
 #include <string>
+#include <vector>
+#include <type_traits>
+#include <utility>
 
 namespace modern_win32::threading
 {
@@ -57,6 +63,69 @@ namespace modern_win32::threading
     [[nodiscard]]
     MODERN_WIN32_EXPORT std::optional<std::wstring> get_thread_name(thread_handle::native_handle_type const handle);
 
+    /// <summary>
+    /// restricts the thread to the processors in <paramref name="affinity"/>, moving it to that processor group if required
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <param name="affinity">group and mask of processors the thread may run on</param>
+    /// <returns>true on success; otherwise, false</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool set_thread_group_affinity(thread_handle::native_handle_type const handle, group_affinity const& affinity);
+
+    /// <summary>
+    /// returns the processor group affinity of the thread
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <returns>optional containing the affinity on success; otherwise <see cref="std::nullopt"/></returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<group_affinity> get_thread_group_affinity(thread_handle::native_handle_type const handle);
+
+    /// <summary>
+    /// restricts the thread to the processors of NUMA node <paramref name="node"/>, keeping it close to memory
+    /// allocated on that node
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <param name="node">NUMA node number as returned by <see cref="processor_topology::numa_nodes"/></param>
+    /// <returns>true on success; otherwise, false</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool set_thread_numa_node(thread_handle::native_handle_type const handle, DWORD node);
+
+    /// <summary>
+    /// sets the preferred processor of the thread, the scheduler runs the thread on that processor when possible
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <param name="processor">the preferred processor</param>
+    /// <returns>true on success; otherwise, false</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool set_thread_ideal_processor(thread_handle::native_handle_type const handle, processor_number const& processor);
+
+    /// <summary>
+    /// returns the preferred processor of the thread
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <returns>optional containing the ideal processor on success; otherwise <see cref="std::nullopt"/></returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<processor_number> get_thread_ideal_processor(thread_handle::native_handle_type const handle);
+
+    /// <summary>
+    /// sets the CPU sets the thread is assigned to, an empty collection clears the assignment
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <param name="cpu_set_ids">ids as returned by <see cref="processor_topology::cpu_sets"/></param>
+    /// <returns>true on success; otherwise, false</returns>
+    /// <remarks>only works on Windows Server 2016+ or Windows 10+</remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool set_thread_selected_cpu_sets(thread_handle::native_handle_type const handle, std::vector<ULONG> const& cpu_set_ids);
+
+    /// <summary>
+    /// returns the CPU sets the thread is assigned to
+    /// </summary>
+    /// <param name="handle">native handle for the thread</param>
+    /// <returns>optional containing the CPU set ids on success; otherwise <see cref="std::nullopt"/></returns>
+    /// <remarks>only works on Windows Server 2016+ or Windows 10+</remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::optional<std::vector<ULONG>> get_thread_selected_cpu_sets(thread_handle::native_handle_type const handle);
+
     class MODERN_WIN32_EXPORT thread final
     {
     public:
@@ -100,12 +169,87 @@ namespace modern_win32::threading
         [[nodiscard]]
         std::optional<std::wstring> get_name() const;
 
+        /// <summary>
+        /// restricts the thread represented by this object to the processors in <paramref name="affinity"/>
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_group_affinity(group_affinity const& affinity) const;
+
+        /// <summary>
+        /// returns the processor group affinity of the thread represented by this object
+        /// </summary>
+        [[nodiscard]]
+        std::optional<group_affinity> get_group_affinity() const;
+
+        /// <summary>
+        /// restricts the thread represented by this object to the processors of NUMA node <paramref name="node"/>
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_numa_node(DWORD node) const;
+
+        /// <summary>
+        /// sets the preferred processor of the thread represented by this object
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_ideal_processor(processor_number const& processor) const;
+
+        /// <summary>
+        /// returns the preferred processor of the thread represented by this object
+        /// </summary>
+        [[nodiscard]]
+        std::optional<processor_number> get_ideal_processor() const;
+
+        /// <summary>
+        /// assigns the thread represented by this object to <paramref name="cpu_set_ids"/>, empty clears the assignment
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        /// <remarks>only works on Windows Server 2016+ or Windows 10+</remarks>
+        [[nodiscard]]
+        bool set_selected_cpu_sets(std::vector<ULONG> const& cpu_set_ids) const;
+
+        /// <summary>
+        /// returns the CPU sets the thread represented by this object is assigned to
+        /// </summary>
+        /// <remarks>only works on Windows Server 2016+ or Windows 10+</remarks>
+        [[nodiscard]]
+        std::optional<std::vector<ULONG>> get_selected_cpu_sets() const;
+
         /// <summary>
         /// Retrieves the termination status of the specified thread.
         /// </summary>
         /// <returns>
         /// std::optional{int} if thread was running; otherwise std::nullopt
         /// </returns>
+        /// <summary>
+        /// sets the priority of the thread represented by this object
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_priority(thread_priority priority) const;
+
+        /// <summary>
+        /// returns the priority of the thread represented by this object
+        /// </summary>
+        [[nodiscard]]
+        std::optional<thread_priority> get_priority() const;
+
+        /// <summary>
+        /// enables or disables the temporary priority boost the system applies to the thread represented by this object
+        /// </summary>
+        /// <returns>true on success; otherwise, false</returns>
+        [[nodiscard]]
+        bool set_priority_boost(bool enabled) const;
+
+        /// <summary>
+        /// resumes a thread started with <see cref="thread_options::start_suspended"/>
+        /// </summary>
+        /// <returns>true if the thread was resumed; otherwise, false</returns>
+        [[nodiscard]]
+        bool resume() const;
+
         [[nodiscard]]
         std::optional<int> exit_code() const;
 
@@ -170,6 +314,28 @@ namespace modern_win32::threading
         [[nodiscard]]
         bool start();
 
+        /// <summary>
+        /// starts <paramref name="worker"/> using the stack, priority and scheduling settings of <paramref name="options"/>
+        /// </summary>
+        /// <returns>true if the thread was created; otherwise, false</returns>
+        /// <remarks>failure to apply priority or priority boost does not prevent the thread from starting</remarks>
+        [[nodiscard]]
+        bool start(thread_proc worker, thread_parameter parameter, thread_options const& options);
+
+        /// <summary>
+        /// starts <paramref name="worker"/> using the stack, priority and scheduling settings of <paramref name="options"/>
+        /// </summary>
+        /// <returns>true if the thread was created; otherwise, false</returns>
+        [[nodiscard]]
+        bool start(thread_start* worker, thread_options const& options);
+
+        /// <summary>
+        /// starts the owned thread_start using the stack, priority and scheduling settings of <paramref name="options"/>
+        /// </summary>
+        /// <returns>true if the thread was created; otherwise, false</returns>
+        [[nodiscard]]
+        bool start(thread_options const& options);
+
         /// <summary>
         /// Blocks the calling thread until the thread represented by this instance terminates.
         /// </summary>
@@ -204,6 +370,9 @@ namespace modern_win32::threading
 #       pragma warning(pop)
 
         static DWORD __stdcall thread_adapter(void* state);
+
+        [[nodiscard]]
+        bool create(thread_proc worker, thread_parameter parameter, thread_options const& options);
     };
 
     /// <summary>
@@ -224,6 +393,74 @@ namespace modern_win32::threading
         return new_thread;
     }
 
+    /// <summary>
+    /// true if <typeparamref name="WORKER"/> is started through <see cref="callable_thread_start"/>; workers convertible
+    /// to <see cref="thread::thread_proc"/> are excluded so a typed parameter still selects the thread_proc overloads,
+    /// which keep the worker's return value as the thread exit code and need no allocation
+    /// </summary>
+    template <typename WORKER, typename... ARGS>
+    constexpr bool is_thread_callable_v =
+        std::is_invocable_v<std::decay_t<WORKER>, std::decay_t<ARGS>...> &&
+        !std::is_convertible_v<std::decay_t<WORKER>, thread::thread_proc>;
+
+    /// <summary>
+    /// starts a new thread running <paramref name="worker"/> taking <paramref name="parameter"/>
+    /// </summary>
+    /// <returns>the running thread, or the error if it could not be created</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<thread> try_start_thread(thread::thread_proc const worker, thread::thread_parameter parameter) noexcept;
+
+    /// <summary>
+    /// starts a new thread using <paramref name="worker"/>, which must outlive the thread
+    /// </summary>
+    /// <returns>the running thread, or the error if it could not be created</returns>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<thread> try_start_thread(thread_start* const worker) noexcept;
+
+    /// <summary>
+    /// starts <paramref name="worker"/> on a new thread created using <paramref name="options"/>
+    /// </summary>
+    /// <returns>the running thread, or the error if it could not be created</returns>
+    /// <exception cref="std::bad_alloc">if options requiring launch state are used and it could not be allocated</exception>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<thread> try_start_thread(thread_options const& options, thread::thread_proc const worker, thread::thread_parameter parameter);
+
+    /// <summary>
+    /// starts a new thread invoking <paramref name="worker"/> with <paramref name="arguments"/>
+    /// </summary>
+    /// <returns>the running thread, which owns the worker, or the error if it could not be created</returns>
+    /// <exception cref="std::bad_alloc">if the worker could not be allocated</exception>
+    template <typename WORKER, typename... ARGS,
+        typename = std::enable_if_t<is_thread_callable_v<WORKER, ARGS...>>>
+    [[nodiscard]]
+    windows_result<thread> try_start_thread(WORKER&& worker, ARGS&&... arguments)
+    {
+        using thread_start_type = callable_thread_start<std::decay_t<WORKER>, std::decay_t<ARGS>...>;
+        thread new_thread(std::unique_ptr<thread_start>(
+            std::make_unique<thread_start_type>(std::in_place, std::forward<WORKER>(worker), std::forward<ARGS>(arguments)...)));
+        if (!new_thread.start())
+            return windows_error_details();
+        return new_thread;
+    }
+
+    /// <summary>
+    /// starts <paramref name="worker"/> with <paramref name="arguments"/> on a new thread created using <paramref name="options"/>
+    /// </summary>
+    /// <returns>the running thread, which owns the worker, or the error if it could not be created</returns>
+    /// <exception cref="std::bad_alloc">if the worker could not be allocated</exception>
+    template <typename WORKER, typename... ARGS,
+        typename = std::enable_if_t<is_thread_callable_v<WORKER, ARGS...>>>
+    [[nodiscard]]
+    windows_result<thread> try_start_thread(thread_options const& options, WORKER&& worker, ARGS&&... arguments)
+    {
+        using thread_start_type = callable_thread_start<std::decay_t<WORKER>, std::decay_t<ARGS>...>;
+        thread new_thread(std::unique_ptr<thread_start>(
+            std::make_unique<thread_start_type>(std::in_place, std::forward<WORKER>(worker), std::forward<ARGS>(arguments)...)));
+        if (!new_thread.start(options))
+            return windows_error_details();
+        return new_thread;
+    }
+
     /// <summary>
     /// starts a new thread running <paramref name="worker"/> taking <paramref name="parameter"/>
     /// </summary>
@@ -246,6 +483,40 @@ namespace modern_win32::threading
     [[nodiscard]]
     MODERN_WIN32_EXPORT thread start_thread(thread_start* const worker);
 
+    /// <summary>
+    /// starts a new thread invoking <paramref name="worker"/> with <paramref name="arguments"/>
+    /// </summary>
+    /// <param name="worker">callable moved into the thread, alongside the arguments, in a single allocation</param>
+    /// <param name="arguments">arguments decay copied and passed to worker as rvalues, as std::thread does</param>
+    /// <returns>the running thread, which owns the worker</returns>
+    /// <exception cref="windows_exception">thrown if unable to create thread</exception>
+    template <typename WORKER, typename... ARGS,
+        typename = std::enable_if_t<is_thread_callable_v<WORKER, ARGS...>>>
+    [[nodiscard]]
+    thread start_thread(WORKER&& worker, ARGS&&... arguments)
+    {
+        return try_start_thread(std::forward<WORKER>(worker), std::forward<ARGS>(arguments)...).value();
+    }
+
+    /// <summary>
+    /// starts <paramref name="worker"/> on a new thread created using <paramref name="options"/>
+    /// </summary>
+    /// <exception cref="windows_exception">if the thread could not be created</exception>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT thread start_thread(thread_options const& options, thread::thread_proc const worker, thread::thread_parameter parameter);
+
+    /// <summary>
+    /// starts <paramref name="worker"/> with <paramref name="arguments"/> on a new thread created using <paramref name="options"/>
+    /// </summary>
+    /// <exception cref="windows_exception">if the thread could not be created</exception>
+    template <typename WORKER, typename... ARGS,
+        typename = std::enable_if_t<is_thread_callable_v<WORKER, ARGS...>>>
+    [[nodiscard]]
+    thread start_thread(thread_options const& options, WORKER&& worker, ARGS&&... arguments)
+    {
+        return try_start_thread(options, std::forward<WORKER>(worker), std::forward<ARGS>(arguments)...).value();
+    }
+
 }
 
 #endif
@@ -0,0 +1,75 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_THREAD_OPTIONS_H_
+#define MODERN_WIN32_THREADING_THREAD_OPTIONS_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// relative thread priority within the priority class of the owning process
+    /// </summary>
+    enum class thread_priority : int
+    {
+        idle = THREAD_PRIORITY_IDLE,
+        lowest = THREAD_PRIORITY_LOWEST,
+        below_normal = THREAD_PRIORITY_BELOW_NORMAL,
+        normal = THREAD_PRIORITY_NORMAL,
+        above_normal = THREAD_PRIORITY_ABOVE_NORMAL,
+        highest = THREAD_PRIORITY_HIGHEST,
+        time_critical = THREAD_PRIORITY_TIME_CRITICAL,
+    };
+
+    /// <summary>
+    /// creation options applied by <see cref="thread::start"/> before the new thread runs any user code
+    /// </summary>
+    struct thread_options final
+    {
+        /// <summary>
+        /// size of the stack reservation in bytes, 0 uses the default reservation of the executable.
+        /// only the first page is committed so many threads can be created with a small memory footprint
+        /// </summary>
+        std::size_t stack_reservation{};
+
+        /// <summary>
+        /// when true the thread is left suspended after creation and must be started using <see cref="thread::resume"/>
+        /// </summary>
+        bool start_suspended{};
+
+        /// <summary>
+        /// priority applied before the thread runs, unchanged if empty
+        /// </summary>
+        std::optional<thread_priority> priority{};
+
+        /// <summary>
+        /// when true the system will not temporarily boost the priority of the thread
+        /// </summary>
+        bool disable_priority_boost{};
+
+        /// <summary>
+        /// Multimedia Class Scheduler Service task the thread registers with on entry, such as L"Pro Audio".
+        /// registration is best effort, the thread still runs if the service is unavailable
+        /// </summary>
+        std::optional<std::wstring> mmcss_task{};
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,177 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_THREAD_POOL_H_
+#define MODERN_WIN32_THREADING_THREAD_POOL_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/executor.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/threading/thread.h>
+#include <modern_win32/threading/thread_start.h>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// fixed size pool of worker threads, each worker owns a deque of work which it runs LIFO while idle
+    /// workers steal FIFO from the others
+    /// </summary>
+    /// <remarks>
+    /// work submitted from a worker thread is pushed onto that worker's own deque, work submitted from any other
+    /// thread is distributed round robin.  The destructor stops accepting work, runs whatever is still queued and
+    /// joins the workers.
+    /// </remarks>
+    class MODERN_WIN32_EXPORT thread_pool final : public executor
+    {
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the thread_pool class
+        /// </summary>
+        /// <param name="worker_count">
+        /// number of workers, if zero the number of logical processors across all processor groups is used. on
+        /// systems with more than one processor group workers are spread across the groups in proportion to their size
+        /// </param>
+        /// <param name="name">prefix used to name each worker, workers are named "{name} #{index}"</param>
+        /// <param name="options">creation options applied to each worker, such as a reduced stack reservation</param>
+        /// <exception cref="windows_exception">if unable to create a worker thread</exception>
+        explicit thread_pool(std::size_t worker_count = 0, std::wstring const& name = L"thread_pool", thread_options const& options = {});
+        thread_pool(thread_pool const&) = delete;
+        thread_pool(thread_pool&&) noexcept = delete;
+        ~thread_pool() override;
+        thread_pool& operator=(thread_pool const&) = delete;
+        thread_pool& operator=(thread_pool&&) noexcept = delete;
+
+        /// <summary>
+        /// queues <paramref name="worker"/> to be run by the pool
+        /// </summary>
+        /// <typeparam name="WORKER">any callable accepted by <see cref="anonymous_thread_start"/></typeparam>
+        /// <returns>true if the work was queued; otherwise, false if the pool is shutting down</returns>
+        template <typename WORKER>
+        [[maybe_unused]]
+        bool submit(WORKER worker)
+        {
+            static_assert(std::is_invocable_v<WORKER>, "WORKER must be invokable");
+            return submit(std::unique_ptr<thread_start>(std::make_unique<callable_thread_start<WORKER>>(std::in_place, std::move(worker))));
+        }
+
+        /// <summary>
+        /// queues <paramref name="work"/> to be run by the pool, the pool takes ownership
+        /// </summary>
+        /// <returns>true if the work was queued; otherwise, false if the pool is shutting down or work is null</returns>
+        [[maybe_unused]]
+        bool submit(std::unique_ptr<thread_start> work);
+
+        /// <summary>
+        /// queues each callable in [<paramref name="first"/>, <paramref name="last"/>) spreading them across the workers,
+        /// each worker deque is locked once for the whole batch
+        /// </summary>
+        /// <returns>the number of items queued, zero if the pool is shutting down</returns>
+        template <typename ITERATOR>
+        [[maybe_unused]]
+        std::size_t submit_bulk(ITERATOR first, ITERATOR last)
+        {
+            using worker_type = typename std::iterator_traits<ITERATOR>::value_type;
+            static_assert(std::is_invocable_v<worker_type>, "WORKER must be invokable");
+
+            std::vector<std::unique_ptr<thread_start>> work{};
+            if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<ITERATOR>::iterator_category>) {
+                work.reserve(static_cast<std::size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first) {
+                work.emplace_back(std::make_unique<callable_thread_start<worker_type>>(std::in_place, *first));
+            }
+            return submit_bulk(std::move(work));
+        }
+
+        /// <summary>
+        /// queues each item of <paramref name="work"/> spreading them across the workers
+        /// </summary>
+        /// <returns>the number of items queued, zero if the pool is shutting down</returns>
+        [[maybe_unused]]
+        std::size_t submit_bulk(std::vector<std::unique_ptr<thread_start>> work);
+
+        /// <summary>
+        /// queues <paramref name="work"/>, the caller retains ownership and must keep it alive until it has run
+        /// </summary>
+        [[nodiscard]]
+        bool post(executor_work& work) noexcept override;
+
+        /// <summary>
+        /// blocks until all queued and running work has completed
+        /// </summary>
+        /// <remarks>must not be called from a worker thread</remarks>
+        void wait_idle() const;
+
+        /// <summary>
+        /// stops accepting work, runs whatever is still queued and joins the workers
+        /// </summary>
+        void shutdown();
+
+        [[nodiscard]]
+        std::size_t worker_count() const noexcept;
+
+        /// <summary>
+        /// returns the number of work items which ended with an exception, exceptions are not rethrown
+        /// </summary>
+        [[nodiscard]]
+        std::size_t unhandled_exception_count() const noexcept;
+
+        /// <summary>
+        /// returns true if the calling thread is one of this pool's workers
+        /// </summary>
+        [[nodiscard]]
+        bool is_worker_thread() const noexcept;
+
+    private:
+        struct work_item;
+        struct worker_queue;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<std::unique_ptr<worker_queue>> queues_{};
+        std::vector<thread> workers_{};
+        std::atomic<std::size_t> pending_{};
+        std::atomic<std::size_t> outstanding_{};
+        std::atomic<std::size_t> idle_workers_{};
+        std::atomic<std::size_t> next_queue_{};
+        std::atomic<std::size_t> unhandled_exceptions_{};
+        std::atomic<bool> stopping_{};
+        mutable slim_lock park_lock_{};
+        mutable condition_variable park_condition_{};
+        mutable condition_variable idle_condition_{};
+#       pragma warning(pop)
+
+        [[nodiscard]]
+        bool enqueue(work_item&& item);
+        [[nodiscard]]
+        bool try_take(std::size_t index, work_item& item);
+        void run(work_item& item) noexcept;
+        void wake(std::size_t count);
+
+        static DWORD __stdcall worker_proc(thread::thread_parameter parameter);
+    };
+
+}
+
+#endif
+#endif
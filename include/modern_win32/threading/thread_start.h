@@ -17,6 +17,12 @@
 
 #include <Windows.h>
 #include <any>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/tracing.h>
 
 namespace modern_win32::threading
 {
@@ -43,6 +49,11 @@ namespace modern_win32::threading
         {
             return state_;
         }
+        [[nodiscard]]
+        std::any& get_state()
+        {
+            return state_;
+        }
     private:
         std::any state_;
 
@@ -52,7 +63,15 @@ namespace modern_win32::threading
             auto * that = static_cast<thread_start*>(this_ptr);
             if (that == nullptr)
                 return 1;
+            if (!tracing::is_enabled(tracing::keyword::thread)) {
+                that->operator()();
+                return 0;
+            }
+
+            tracing::thread_started();
+            auto const started = qpc_clock::ticks();
             that->operator()();
+            tracing::thread_exited(0, qpc_clock::ticks() - started);
             return 0;
         }
     };
@@ -74,11 +93,58 @@ namespace modern_win32::threading
 
         void operator()() override
         {
-            auto worker = std::any_cast<WORKER>(get_state());
-            worker();
+            // invoked in place, copying out of the any would allocate for any worker larger than the small buffer
+            if (auto* const worker = std::any_cast<WORKER>(&get_state());
+                worker != nullptr) {
+                (*worker)();
+            }
         }
     };
 
+    /// <summary>
+    /// thread_start storing <typeparamref name="WORKER"/> and its arguments directly rather than in a std::any,
+    /// the worker is invoked in place with its arguments moved as std::thread would
+    /// </summary>
+    /// <remarks>
+    /// may be used as caller provided storage with <see cref="start_thread(thread_start*)"/>, in which case it must
+    /// outlive the thread and, as arguments are moved, should only be run once
+    /// </remarks>
+    template <typename WORKER, typename... ARGS>
+    class callable_thread_start final : public thread_start
+    {
+    public:
+        template <typename W, typename... A>
+        explicit callable_thread_start(std::in_place_t, W&& worker, A&&... arguments)
+            : worker_(std::forward<W>(worker))
+            , arguments_(std::forward<A>(arguments)...)
+        {
+        }
+
+        void operator()() override
+        {
+            std::apply(
+                [this](auto&&... arguments) {
+                    static_cast<void>(std::invoke(std::move(worker_), std::forward<decltype(arguments)>(arguments)...));
+                },
+                std::move(arguments_));
+        }
+
+    private:
+        WORKER worker_;
+        std::tuple<ARGS...> arguments_;
+    };
+
+    /// <summary>
+    /// constructs a <see cref="callable_thread_start"/> in place, for use as caller provided storage
+    /// </summary>
+    template <typename WORKER, typename... ARGS>
+    [[nodiscard]]
+    auto make_thread_start(WORKER&& worker, ARGS&&... arguments) -> callable_thread_start<std::decay_t<WORKER>, std::decay_t<ARGS>...>
+    {
+        return callable_thread_start<std::decay_t<WORKER>, std::decay_t<ARGS>...>(
+            std::in_place, std::forward<WORKER>(worker), std::forward<ARGS>(arguments)...);
+    }
+
 
 }
 
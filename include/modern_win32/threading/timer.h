@@ -18,23 +18,65 @@
 
 #include <Windows.h>
 #include <modern_win32/modern_win32_export.h>
-#include <modern_win32/shared/timed_lock_guard.h>
 #include "modern_win32/null_handle.h"
+#include <modern_win32/metrics.h>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/threading/executor.h>
 #include <modern_win32/threading/thread.h>
 #include <modern_win32/threading/event.h>
+#include <modern_win32/tracing.h>
+#include <modern_win32/unique_handle.h>
+#include <atomic>
 #include <chrono>
-#include <mutex>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ratio>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace modern_win32::threading
 {
+    /// <summary>
+    /// native resolution of waitable timer due times, 100 nanosecond intervals
+    /// </summary>
+    using waitable_timer_duration = std::chrono::duration<long long, std::ratio<1, 10'000'000>>;
+
+    /// <summary>
+    /// precision class of a timer, coalesced timers allow the OS to delay expiry by up to a tolerable delay
+    /// so that wakeups can be batched with other timers
+    /// </summary>
+    enum class timer_precision : std::uint8_t
+    {
+        exact,
+        coalesced,
+    };
+
     struct MODERN_WIN32_EXPORT timer_traits
     {
         using modern_handle_type = modern_win32::null_handle;
         using native_handle_type = modern_win32::null_handle::native_handle_type;
 
+        /// <summary>
+        /// waitable timers deliver their callback as an APC so a dedicated alertable thread is required
+        /// </summary>
+        static constexpr bool uses_notification_thread = true;
+
         [[nodiscard]]
         static auto create(bool manual_reset) -> native_handle_type;
 
+        /// <summary>
+        /// creates a waitable timer, optionally using CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        /// </summary>
+        /// <remarks>
+        /// falls back to a standard resolution timer if high resolution timers are not supported by the OS
+        /// </remarks>
+        /// <exception cref="modern_win32::windows_exception">if CreateWaitableTimerEx fails</exception>
+        [[nodiscard]]
+        static auto create(bool manual_reset, bool high_resolution) -> native_handle_type;
+
         [[nodiscard]]
         static constexpr auto invalid() noexcept -> decltype(modern_handle_type::invalid())
         {
@@ -50,26 +92,222 @@ namespace modern_win32::threading
             void *state,
             bool const restore) -> bool;
 
+        /// <summary>
+        /// arms the timer using SetWaitableTimerEx allowing expiry to be coalesced within <paramref name="tolerable_delay"/>
+        /// </summary>
+        /// <param name="tolerable_delay">tolerable delay in milliseconds</param>
+        [[nodiscard]]
+        static auto set_waitable_timer_ex(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            ULONG tolerable_delay) -> bool;
+
+        [[nodiscard]]
+        static bool cancel_waitable_timer(native_handle_type handle);
+    };
+
+    /// <summary>
+    /// timer traits creating waitable timers with CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, intended for pacing loops
+    /// which require due times and periods finer than the default system timer resolution
+    /// </summary>
+    struct MODERN_WIN32_EXPORT high_resolution_timer_traits : timer_traits
+    {
+        [[nodiscard]]
+        static auto create(bool manual_reset) -> native_handle_type;
+    };
+
+    /// <summary>
+    /// state shared between <see cref="threadpool_timer_traits"/> and the thread pool callback,
+    /// holds the target callback so that the pool timer can be created before the owning timer is armed
+    /// </summary>
+    struct threadpool_timer_state final
+    {
+        PTP_TIMER timer{};
+        PTIMERAPCROUTINE callback{};
+        void* state{};
+    };
+
+    struct MODERN_WIN32_EXPORT threadpool_timer_handle_traits
+    {
+        using native_handle_type = threadpool_timer_state*;
+
+        static constexpr native_handle_type invalid() noexcept
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const handle) noexcept;
+    };
+
+    using threadpool_timer_handle = unique_handle<threadpool_timer_handle_traits>;
+
+    /// <summary>
+    /// timer traits backed by the Win32 thread pool (CreateThreadpoolTimer), callbacks are run by a pool
+    /// worker so no notification thread is created per timer
+    /// </summary>
+    struct MODERN_WIN32_EXPORT threadpool_timer_traits
+    {
+        using modern_handle_type = threadpool_timer_handle;
+        using native_handle_type = threadpool_timer_handle_traits::native_handle_type;
+
+        static constexpr bool uses_notification_thread = false;
+
+        /// <summary>
+        /// creates a new thread pool timer, <paramref name="manual_reset"/> is unused as pool timers
+        /// have no signaled state
+        /// </summary>
+        /// <exception cref="modern_win32::windows_exception">if CreateThreadpoolTimer fails</exception>
+        [[nodiscard]]
+        static auto create(bool manual_reset) -> native_handle_type;
+
+        [[nodiscard]]
+        static constexpr auto invalid() noexcept -> decltype(threadpool_timer_handle_traits::invalid())
+        {
+            return threadpool_timer_handle_traits::invalid();
+        }
+
+        [[nodiscard]]
+        static auto set_waitable_timer(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            bool const restore) -> bool;
+
+        /// <summary>
+        /// arms the pool timer with a window of <paramref name="tolerable_delay"/> milliseconds
+        /// </summary>
+        [[nodiscard]]
+        static auto set_waitable_timer_ex(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            ULONG tolerable_delay) -> bool;
+
         [[nodiscard]]
         static bool cancel_waitable_timer(native_handle_type handle);
+
+        /// <summary>
+        /// blocks until any outstanding callbacks have completed, must not be called from within the callback
+        /// </summary>
+        static void wait_for_callbacks(native_handle_type handle) noexcept;
     };
 
+    /// <summary>
+    /// true if <typeparamref name="TRAITS"/> requires a dedicated alertable thread to deliver callbacks,
+    /// traits which don't declare uses_notification_thread are assumed to require one
+    /// </summary>
+    template <typename TRAITS, typename = void>
+    struct timer_uses_notification_thread : std::true_type
+    {
+    };
+
+    template <typename TRAITS>
+    struct timer_uses_notification_thread<TRAITS, std::void_t<decltype(TRAITS::uses_notification_thread)>>
+        : std::bool_constant<TRAITS::uses_notification_thread>
+    {
+    };
+
+    template <typename TRAITS>
+    constexpr bool timer_uses_notification_thread_v = timer_uses_notification_thread<TRAITS>::value;
+
+    /// <summary>
+    /// true if <typeparamref name="TRAITS"/> provides set_waitable_timer_ex, traits without it always use exact precision
+    /// </summary>
+    template <typename TRAITS, typename = void>
+    struct timer_supports_coalescing : std::false_type
+    {
+    };
+
+    template <typename TRAITS>
+    struct timer_supports_coalescing<TRAITS, std::void_t<decltype(TRAITS::set_waitable_timer_ex(
+            std::declval<typename TRAITS::native_handle_type>(),
+            std::declval<LARGE_INTEGER&>(),
+            LONG{},
+            PTIMERAPCROUTINE{},
+            static_cast<void*>(nullptr),
+            ULONG{}))>>
+        : std::true_type
+    {
+    };
+
+    template <typename TRAITS>
+    constexpr bool timer_supports_coalescing_v = timer_supports_coalescing<TRAITS>::value;
+
+    /// <summary>
+    /// tolerable delay used when a timer is coalesced without specifying one
+    /// </summary>
+    constexpr auto default_tolerable_delay = std::chrono::milliseconds(50);
+
+    /// <summary>
+    /// counters describing how well timer callbacks are keeping up with expiry
+    /// </summary>
+    struct timer_statistics final
+    {
+        /// <summary>number of expiries observed</summary>
+        std::uint64_t ticks{};
+        /// <summary>
+        /// periodic expiries which were never delivered, detected as a gap of two or more periods between expiries,
+        /// or which an executor refused to queue
+        /// </summary>
+        std::uint64_t missed_ticks{};
+        /// <summary>expiries dropped because the callback posted to an executor for a previous expiry was still running</summary>
+        std::uint64_t overlapped_ticks{};
+    };
+
+    /// <summary>
+    /// waitable timer invoking <typeparamref name="TIMER_CALLBACK"/> with the state it owns on each expiry
+    /// </summary>
+    /// <typeparam name="STATE">state owned by the timer, may be move-only or constructed in place using std::in_place</typeparam>
+    /// <typeparam name="TIMER_CALLBACK">function pointer or any callable, including lambdas with captures, stored by value</typeparam>
     template <bool MANUAL_RESET, typename STATE, class TIMER_CALLBACK = void (*)(STATE&), typename TRAITS = timer_traits>
     class timer final
     {
-        static_assert(std::is_trivially_copyable_v<STATE>, "STATE must be trivially copyable");
+        static_assert(std::is_object_v<STATE> && !std::is_const_v<STATE>, "STATE must be a non-const object type");
+        static_assert(std::is_invocable_v<TIMER_CALLBACK&, STATE&>, "TIMER_CALLBACK must be invokable with STATE&");
         friend class timer_test;
 
         using modern_handle_type = typename TRAITS::modern_handle_type;
 
+        /// <summary>
+        /// lifecycle of the timer, only the thread which moves the timer into starting or stopping may
+        /// modify the notification thread or timer settings until it leaves that state
+        /// </summary>
+        enum class lifecycle : std::uint8_t
+        {
+            idle,
+            starting,
+            running,
+            stopping,
+        };
+
         modern_handle_type handle_;
         TIMER_CALLBACK callback_;
         STATE state_;
         std::optional<thread> callback_thread_{};
-        std::optional<std::pair<std::chrono::milliseconds, std::chrono::milliseconds>> timer_settings_{};
-        std::atomic<bool> stopped_{};
+        std::optional<std::pair<waitable_timer_duration, waitable_timer_duration>> timer_settings_{};
+        std::atomic<waitable_timer_duration::rep> rearm_period_{};
+        std::atomic<lifecycle> lifecycle_{ lifecycle::idle };
         std::atomic<int> last_exit_code_{};
-        mutable std::recursive_timed_mutex lock_{};
+        std::atomic<ULONG> tolerable_delay_{};
+        std::atomic<ULONG> start_delay_{};
+        std::atomic<thread::native_thread_id> callback_thread_id_{};
+        std::atomic<thread::native_thread_id> notification_thread_id_{};
+        std::atomic<executor*> executor_{};
+        executor_work dispatch_work_{ &timer::dispatch_proc, this };
+        std::atomic<bool> dispatch_in_flight_{};
+        std::atomic<std::int64_t> dispatch_posted_ticks_{};
+        std::atomic<thread::native_thread_id> dispatch_thread_id_{};
+        std::atomic<waitable_timer_duration::rep> period_{};
+        std::atomic<waitable_timer_duration::rep> last_tick_{};
+        std::atomic<std::uint64_t> tick_count_{};
+        std::atomic<std::uint64_t> missed_ticks_{};
+        std::atomic<std::uint64_t> overlapped_ticks_{};
         manual_reset_event stop_event_{ false };
     public:
 
@@ -85,28 +323,7 @@ namespace modern_win32::threading
             std::chrono::duration<DUE_REP, DUE_PERIOD> const& due_time,
             std::chrono::duration<PERIOD_REP, PERIOD_PERIOD> const& period)
         {
-            // timer already active
-            std::lock_guard lock{ lock_ };
-
-            if (is_running()) {
-                return;
-            }
-
-            using std::chrono::duration_cast;
-            using std::chrono::milliseconds;
-
-            if (duration_cast<milliseconds>(due_time) < milliseconds(0)) {
-                throw std::invalid_argument("due_time must be greater than or equal to zero");
-            }
-            if (duration_cast<milliseconds>(period) < milliseconds(0)) {
-                throw std::invalid_argument("period must be greater than or equal to zero");
-            }
-
-            timer_settings_ = std::make_pair(duration_cast<milliseconds>(due_time), duration_cast<milliseconds>(period));
-
-            callback_thread_ = std::optional(start_thread(&timer::notification_thread_worker,
-                static_cast<thread::thread_parameter>(this)));
-
+            start_periodic(due_time, period, tolerable_delay_.load());
         }
 
         /// <summary>
@@ -118,24 +335,108 @@ namespace modern_win32::threading
         template <class REP, class PERIOD, bool T = MANUAL_RESET, typename = std::enable_if_t<(T)>>
         void start(std::chrono::duration<REP, PERIOD> const& due_time)
         {
-            // timer already active
-            std::lock_guard lock{ lock_ };
-            stop();
+            start_once(due_time, tolerable_delay_.load());
+        }
 
-            if (is_running()) {
+        /// <summary>
+        /// Starts the timer as a coalesced timer
+        /// </summary>
+        /// <param name="due_time">time before first callback is performed</param>
+        /// <param name="period">period between subsequent callbacks</param>
+        /// <param name="tolerable_delay">window within which the OS may delay each expiry to batch wakeups</param>
+        /// <remarks>
+        /// <paramref name="tolerable_delay"/> applies to this start only, <see cref="precision"/> and
+        /// <see cref="tolerable_delay"/> are unchanged
+        /// </remarks>
+        /// <exception cref="modern_win32::windows_exception">if internal API fails</exception>
+        /// <exception cref="std::invalid_argument">if tolerable_delay is less than or equal to zero</exception>
+        template <class DUE_REP, class DUE_PERIOD, class PERIOD_REP, class PERIOD_PERIOD, class DELAY_REP, class DELAY_PERIOD,
+            bool T = MANUAL_RESET, typename = std::enable_if_t<!(T)>>
+        void start(
+            std::chrono::duration<DUE_REP, DUE_PERIOD> const& due_time,
+            std::chrono::duration<PERIOD_REP, PERIOD_PERIOD> const& period,
+            std::chrono::duration<DELAY_REP, DELAY_PERIOD> const& tolerable_delay)
+        {
+            start_periodic(due_time, period, to_native_tolerable_delay(std::chrono::duration_cast<std::chrono::milliseconds>(tolerable_delay)));
+        }
+
+        /// <summary>
+        /// Starts the timer as a coalesced timer
+        /// </summary>
+        /// <param name="due_time">time before first callback is performed</param>
+        /// <param name="tolerable_delay">window within which the OS may delay expiry to batch wakeups</param>
+        /// <remarks>
+        /// <paramref name="tolerable_delay"/> applies to this start only, <see cref="precision"/> and
+        /// <see cref="tolerable_delay"/> are unchanged
+        /// </remarks>
+        /// <exception cref="modern_win32::windows_exception">if internal API fails</exception>
+        /// <exception cref="std::invalid_argument">if tolerable_delay is less than or equal to zero</exception>
+        template <class REP, class PERIOD, class DELAY_REP, class DELAY_PERIOD, bool T = MANUAL_RESET, std::enable_if_t<(T), int> = 0>
+        void start(std::chrono::duration<REP, PERIOD> const& due_time, std::chrono::duration<DELAY_REP, DELAY_PERIOD> const& tolerable_delay)
+        {
+            start_once(due_time, to_native_tolerable_delay(std::chrono::duration_cast<std::chrono::milliseconds>(tolerable_delay)));
+        }
+
+        /// <summary>
+        /// sets the precision class of the timer, takes effect the next time the timer is started
+        /// </summary>
+        /// <param name="precision">exact or coalesced</param>
+        /// <param name="tolerable_delay">window used when <paramref name="precision"/> is coalesced</param>
+        /// <exception cref="std::invalid_argument">if precision is coalesced and tolerable_delay is less than or equal to zero</exception>
+        void set_precision(timer_precision const precision, std::chrono::milliseconds const tolerable_delay = default_tolerable_delay)
+        {
+            if (precision == timer_precision::exact) {
+                tolerable_delay_ = 0UL;
                 return;
             }
+            tolerable_delay_ = to_native_tolerable_delay(tolerable_delay);
+        }
 
-            using std::chrono::duration_cast;
-            using std::chrono::milliseconds;
+        [[nodiscard]]
+        timer_precision precision() const noexcept
+        {
+            return tolerable_delay_ == 0UL
+                ? timer_precision::exact
+                : timer_precision::coalesced;
+        }
 
-            if (duration_cast<milliseconds>(due_time) < milliseconds(0)) {
-                throw std::invalid_argument("due_time must be greater than or equal to zero");
-            }
-            timer_settings_ = std::make_pair(duration_cast<milliseconds>(due_time), milliseconds(0));
+        [[nodiscard]]
+        std::chrono::milliseconds tolerable_delay() const noexcept
+        {
+            return std::chrono::milliseconds(tolerable_delay_.load());
+        }
 
-            callback_thread_ = std::optional(start_thread(&timer::notification_thread_worker,
-                static_cast<thread::thread_parameter>(this)));
+        /// <summary>
+        /// posts each expiry to <paramref name="value"/> rather than invoking the callback on the timer thread,
+        /// nullptr restores inline callbacks
+        /// </summary>
+        /// <remarks>
+        /// callbacks posted to an executor never overlap, an expiry arriving while the previous callback is still
+        /// running is dropped and counted in <see cref="timer_statistics::overlapped_ticks"/>.
+        /// <paramref name="value"/> must outlive the timer.
+        /// </remarks>
+        void set_executor(executor* const value) noexcept
+        {
+            executor_ = value;
+        }
+
+        [[nodiscard]]
+        executor* get_executor() const noexcept
+        {
+            return executor_.load();
+        }
+
+        [[nodiscard]]
+        timer_statistics statistics() const noexcept
+        {
+            return timer_statistics{ tick_count_.load(), missed_ticks_.load(), overlapped_ticks_.load() };
+        }
+
+        void reset_statistics() noexcept
+        {
+            tick_count_ = 0ULL;
+            missed_ticks_ = 0ULL;
+            overlapped_ticks_ = 0ULL;
         }
 
         [[maybe_unused]]
@@ -144,10 +445,14 @@ namespace modern_win32::threading
             return stop(false);
         }
 
+        /// <summary>
+        /// returns true if the timer has been started and not yet stopped, does not block or query the notification thread
+        /// </summary>
         [[nodiscard]]
-        bool is_running() const
+        bool is_running() const noexcept
         {
-            return !stopped_ && callback_thread_.has_value() && callback_thread_.value().is_running();
+            auto const current = lifecycle_.load();
+            return current == lifecycle::running || current == lifecycle::starting;
         }
 
         /// <summary>
@@ -168,11 +473,11 @@ namespace modern_win32::threading
         }
 
         [[nodiscard]]
-        auto timer_thread_id() const -> std::optional<thread::native_thread_id>
+        auto timer_thread_id() const noexcept -> std::optional<thread::native_thread_id>
         {
-            std::lock_guard lock{ lock_ };
-            return callback_thread_.has_value()
-                ? std::optional{ callback_thread_->id() }
+            auto const id = notification_thread_id_.load();
+            return id != thread::native_thread_id{}
+                ? std::optional{ id }
                 : std::optional<thread::native_thread_id>{};
         }
 
@@ -190,27 +495,52 @@ namespace modern_win32::threading
         }
         explicit timer(TIMER_CALLBACK callback, STATE&& state)
             : handle_{ TRAITS::create(MANUAL_RESET) }
-            , callback_{ callback }
+            , callback_{ std::move(callback) }
             , state_{ std::move(state) }
         {
         }
 
+        /// <summary>
+        /// constructs the state in place from <paramref name="arguments"/>, allowing state which is neither
+        /// copyable nor movable
+        /// </summary>
+        template <typename... ARGS, typename = std::enable_if_t<std::is_constructible_v<STATE, ARGS...>>>
+        explicit timer(TIMER_CALLBACK callback, std::in_place_t, ARGS&&... arguments)
+            : handle_{ TRAITS::create(MANUAL_RESET) }
+            , callback_{ std::move(callback) }
+            , state_(std::forward<ARGS>(arguments)...)
+        {
+        }
+
         ~timer()
         {
             stop(true);
+
+            // a timer stopped from its own callback leaves the callback in progress, wait for it before members are destroyed
+            if constexpr (timer_uses_notification_thread_v<TRAITS>) {
+                join_notification_thread();
+            } else {
+                if (static_cast<bool>(handle_) && callback_thread_id_ != thread::current_thread_id()) {
+                    TRAITS::wait_for_callbacks(handle_.native_handle());
+                }
+            }
+            wait_for_dispatch();
         }
 
         timer(timer&& other) noexcept
             : handle_{ other.handle_.release() }
-            , callback_{ other.callback_ }
-            , state_{ (other.state_) }
+            , callback_{ std::move(other.callback_) }
+            , state_{ std::move(other.state_) }
             , callback_thread_{ std::move(other.callback_thread_) }
             , timer_settings_{ std::move(other.timer_settings_) }
-            , stopped_{ other.stopped_.load() }
-            , lock_{ }
+            , rearm_period_{ other.rearm_period_.load() }
+            , lifecycle_{ other.lifecycle_.exchange(lifecycle::idle) }
+            , tolerable_delay_{ other.tolerable_delay_.load() }
+            , start_delay_{ other.start_delay_.load() }
+            , notification_thread_id_{ other.notification_thread_id_.exchange(thread::native_thread_id{}) }
+            , executor_{ other.executor_.load() }
             , stop_event_{ std::move(other.stop_event_) }
         {
-            other.stopped_ = true;
         }
         timer& operator=(timer&& other) noexcept
         {
@@ -218,17 +548,19 @@ namespace modern_win32::threading
                 return *this;
             }
             std::ignore = handle_.reset(other.handle_.release());
-            callback_ = other.callback_;
-            state_ = other.state_;
+            callback_ = std::move(other.callback_);
+            state_ = std::move(other.state_);
 
             callback_thread_ = std::move(other.callback_thread_);
             timer_settings_ = std::move(other.timer_settings_);
-            stopped_ = std::move(other.stopped_);
-            lock_ = other.lock_;
+            rearm_period_ = other.rearm_period_.load();
+            lifecycle_ = other.lifecycle_.exchange(lifecycle::idle);
+            tolerable_delay_ = other.tolerable_delay_.load();
+            start_delay_ = other.start_delay_.load();
+            notification_thread_id_ = other.notification_thread_id_.exchange(thread::native_thread_id{});
+            executor_ = other.executor_.load();
             stop_event_ = std::move(other.stop_event_);
 
-            other.stopped_ = true;
-
             return *this;
         }
 
@@ -239,23 +571,26 @@ namespace modern_win32::threading
         /// swaps the contents of this with other
         /// </summary>
         /// <param name="other">instance to swap values with</param>
+        /// <remarks>neither timer may be started or stopped concurrently with a swap</remarks>
         void swap(timer& other) noexcept
         {
-            if (&this == &other) {
+            if (this == &other) {
                 return;
             }
 
-            std::lock_guard this_lock{ lock_ };
-            std::lock_guard other_lock{ other.lock_ };
-
+            using std::swap;
             swap(handle_, other.handle_);
-            std::swap(callback_, other.callback_);
-            std::swap(state_, other.state_);
+            swap(callback_, other.callback_);
+            swap(state_, other.state_);
             swap(callback_thread_, other.callback_thread_);
             swap(timer_settings_, other.timer_settings_);
-            swap(stopped_, other.stopped_);
-            swap(lock_, other.lock_);
             swap(stop_event_, other.stop_event_);
+            rearm_period_ = other.rearm_period_.exchange(rearm_period_.load());
+            lifecycle_ = other.lifecycle_.exchange(lifecycle_.load());
+            tolerable_delay_ = other.tolerable_delay_.exchange(tolerable_delay_.load());
+            start_delay_ = other.start_delay_.exchange(start_delay_.load());
+            notification_thread_id_ = other.notification_thread_id_.exchange(notification_thread_id_.load());
+            executor_ = other.executor_.exchange(executor_.load());
         }
 
 #       if __cplusplus > 201703L 
@@ -294,98 +629,396 @@ namespace modern_win32::threading
         }
 
     private:
-        void reset_stopped()
+        [[nodiscard]]
+        bool try_begin_start() noexcept
+        {
+            auto expected = lifecycle::idle;
+            return lifecycle_.compare_exchange_strong(expected, lifecycle::starting);
+        }
+
+        /// <summary>
+        /// moves the timer from running to stopping
+        /// </summary>
+        /// <param name="wait_for_other_stop">if true and another thread is stopping the timer, waits for it to complete</param>
+        /// <returns>true if this thread now owns the stopping state; otherwise, false</returns>
+        [[nodiscard]]
+        bool try_begin_stop(bool const wait_for_other_stop) noexcept
         {
-            stopped_ = false;
-            std::ignore = stop_event_.clear();
+            auto current = lifecycle_.load();
+            while (current != lifecycle::idle) {
+                if (current == lifecycle::running) {
+                    if (lifecycle_.compare_exchange_weak(current, lifecycle::stopping)) {
+                        return true;
+                    }
+                    continue;
+                }
+                if (current == lifecycle::stopping && !wait_for_other_stop) {
+                    return false;
+                }
+
+                // start never blocks while in starting so this only spins briefly
+                std::this_thread::yield();
+                current = lifecycle_.load();
+            }
+            return false;
         }
 
         [[maybe_unused]]
         bool stop(bool destructing)
         {
-            std::lock_guard lock{ lock_ };
+            if (!try_begin_stop(destructing)) {
+                return true;
+            }
+
             if (static_cast<bool>(handle_) && !TRAITS::cancel_waitable_timer(handle_.native_handle())) {
                 if (!destructing) {
+                    lifecycle_ = lifecycle::running;
                     return false;
                 }
             }
 
-            stopped_ = true;
-            std::ignore = stop_event_.set();
+            if constexpr (!timer_uses_notification_thread_v<TRAITS>) {
+                // waiting from within the callback would deadlock, it will be done by whichever thread destroys the handle
+                if (static_cast<bool>(handle_) && callback_thread_id_ != thread::current_thread_id()) {
+                    TRAITS::wait_for_callbacks(handle_.native_handle());
 
-            if (!callback_thread_.has_value()) {
-                reset_stopped();
-                return true;
-            }
+                    // a callback in flight may have re-armed a sub-millisecond period before observing the stop
+                    if (rearm_period_ != 0) {
+                        std::ignore = TRAITS::cancel_waitable_timer(handle_.native_handle());
+                    }
+                }
+            } else {
+                std::ignore = stop_event_.set();
 
-            if (thread::current_thread_id() != callback_thread_.value().id()) {
-                callback_thread_.value().join();
-                last_exit_code_ = callback_thread_.value().exit_code().value_or(0);
-                callback_thread_ = std::nullopt;
+                // the notification thread can't join itself, the stop event is left set so that it exits once the
+                // callback returns and is joined by the next start or the destructor
+                if (notification_thread_id_ != thread::current_thread_id()) {
+                    join_notification_thread();
+                    std::ignore = stop_event_.clear();
+                }
             }
-            reset_stopped();
+
+            wait_for_dispatch();
+            lifecycle_ = lifecycle::idle;
             return true;
         }
 
+        /// <summary>
+        /// waits for a callback posted to the executor to complete, unless called from that callback or from the
+        /// timer callback which will go on to post the next one
+        /// </summary>
+        void wait_for_dispatch() const noexcept
+        {
+            if (auto const current = thread::current_thread_id();
+                current == dispatch_thread_id_ || current == callback_thread_id_) {
+                return;
+            }
+            while (dispatch_in_flight_) {
+                std::this_thread::yield();
+            }
+        }
+
+        void join_notification_thread()
+        {
+            if (!callback_thread_.has_value() || notification_thread_id_ == thread::current_thread_id()) {
+                return;
+            }
+            callback_thread_.value().join();
+            last_exit_code_ = callback_thread_.value().exit_code().value_or(0);
+            callback_thread_ = std::nullopt;
+            notification_thread_id_ = thread::native_thread_id{};
+        }
 
         static void CALLBACK timer_proc(void* state, DWORD, DWORD)
         {
-            
             if (auto* timer_object = static_cast<timer*>(state);
                 timer_object != nullptr) {
-                timer_object->callback_(timer_object->state_);
+                timer_object->callback_thread_id_ = thread::current_thread_id();
+                timer_object->record_tick();
                 if constexpr (MANUAL_RESET) {
-                    timer_object->stop();
+                    // stopped before the callback so that the callback is free to restart the timer
+                    std::ignore = timer_object->stop();
+                } else {
+                    std::ignore = timer_object->rearm_timer();
                 }
+
+                if (tracing::is_enabled(tracing::keyword::timer)) {
+                    tracing::timer_fired(timer_object, timer_object->tick_count_.load(), timer_object->missed_ticks_.load());
+                }
+
+                if (auto* const target = timer_object->executor_.load();
+                    target != nullptr) {
+                    timer_object->dispatch(*target);
+                } else {
+                    timer_object->invoke_callback();
+                }
+                timer_object->callback_thread_id_ = thread::native_thread_id{};
             }
         }
-        static DWORD __stdcall notification_thread_worker(thread::thread_parameter state)
+
+        void dispatch(executor& target) noexcept
         {
-            // TODO: add constants for these error codes, even if they're inaccessible they shouldn't be magic
-            auto self = static_cast<timer*>(state);
+            if (dispatch_in_flight_.exchange(true)) {
+                ++overlapped_ticks_;
+                return;
+            }
+            if constexpr (metrics::metrics_enabled) {
+                dispatch_posted_ticks_.store(qpc_clock::ticks(), std::memory_order_relaxed);
+            }
+            if (!target.post(dispatch_work_)) {
+                ++missed_ticks_;
+                dispatch_in_flight_ = false;
+            }
+        }
 
-            if (self == nullptr) {
-                return 1UL;
+        static void dispatch_proc(void* context)
+        {
+            auto* timer_object = static_cast<timer*>(context);
+            if (timer_object == nullptr) {
+                return;
+            }
+            if constexpr (metrics::metrics_enabled) {
+                auto const posted = timer_object->dispatch_posted_ticks_.load(std::memory_order_relaxed);
+                metrics::library().timer_dispatch_delay.record(qpc_clock::to_duration(qpc_clock::ticks() - posted));
             }
+            timer_object->dispatch_thread_id_ = thread::current_thread_id();
+            timer_object->invoke_callback();
+            timer_object->dispatch_thread_id_ = thread::native_thread_id{};
 
-            // only stop should hold the lock this long
-            bool timer_started{ false };
-            if (modern_win32::shared::timed_lock_guard lock(self->lock_, std::chrono::milliseconds(100));
-                !self->stopped_) {
-                timer_started = true;
+            // last access, once cleared a thread waiting in stop may destroy the timer
+            timer_object->dispatch_in_flight_ = false;
+        }
 
-                if (!lock.owns_lock()) {
-                    return 3UL;
-                }
+        void invoke_callback()
+        {
+            auto const traced = tracing::is_enabled(tracing::keyword::timer);
+            if (!metrics::metrics_enabled && !traced) {
+                std::invoke(callback_, state_);
+                return;
+            }
 
-                if (!self->timer_settings_.has_value()) {
-                    return 2UL;
+            auto const started = qpc_clock::ticks();
+            std::invoke(callback_, state_);
+            auto const elapsed = qpc_clock::ticks() - started;
+            if constexpr (metrics::metrics_enabled) {
+                metrics::library().timer_callback.record(qpc_clock::to_duration(elapsed));
+            }
+            if (traced) {
+                tracing::timer_callback_completed(this, elapsed);
+            }
+        }
+
+        void record_tick() noexcept
+        {
+            ++tick_count_;
+
+            auto const now = std::chrono::duration_cast<waitable_timer_duration>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            auto const previous = last_tick_.exchange(now);
+            auto const period = period_.load();
+            if (previous == 0 || period <= 0) {
+                return;
+            }
+
+            // expiries folded together because delivery fell behind show up as a gap of two or more periods
+            if (auto const elapsed = now - previous;
+                elapsed >= 2 * period) {
+                missed_ticks_ += static_cast<std::uint64_t>(elapsed / period - 1);
+            }
+        }
+
+        /// <summary>
+        /// validates and stores the settings of a periodic timer then arms it, coalescing expiry within
+        /// <paramref name="tolerable_delay"/> milliseconds unless it is zero
+        /// </summary>
+        template <class DUE_REP, class DUE_PERIOD, class PERIOD_REP, class PERIOD_PERIOD>
+        void start_periodic(
+            std::chrono::duration<DUE_REP, DUE_PERIOD> const& due_time,
+            std::chrono::duration<PERIOD_REP, PERIOD_PERIOD> const& period,
+            ULONG const tolerable_delay)
+        {
+            using std::chrono::ceil;
+            using std::chrono::milliseconds;
+
+            auto const native_due_time = ceil<waitable_timer_duration>(due_time);
+            auto const native_period = ceil<waitable_timer_duration>(period);
+            if (native_due_time < waitable_timer_duration::zero()) {
+                throw std::invalid_argument("due_time must be greater than or equal to zero");
+            }
+            if (native_period < waitable_timer_duration::zero()) {
+                throw std::invalid_argument("period must be greater than or equal to zero");
+            }
+            if (std::chrono::duration_cast<milliseconds>(native_period).count() > (std::numeric_limits<LONG>::max)()) {
+                throw std::invalid_argument("period must fit within a LONG number of milliseconds");
+            }
+
+            // timer already active, or being started by another thread
+            if (!try_begin_start()) {
+                return;
+            }
+            timer_settings_ = std::make_pair(native_due_time, native_period);
+            start_delay_ = tolerable_delay;
+            start_timer();
+        }
+
+        /// <summary>
+        /// validates and stores the settings of a one-shot timer then arms it, coalescing expiry within
+        /// <paramref name="tolerable_delay"/> milliseconds unless it is zero
+        /// </summary>
+        template <class REP, class PERIOD>
+        void start_once(std::chrono::duration<REP, PERIOD> const& due_time, ULONG const tolerable_delay)
+        {
+            auto const native_due_time = std::chrono::ceil<waitable_timer_duration>(due_time);
+            if (native_due_time < waitable_timer_duration::zero()) {
+                throw std::invalid_argument("due_time must be greater than or equal to zero");
+            }
+
+            stop();
+            if (!try_begin_start()) {
+                return;
+            }
+            timer_settings_ = std::make_pair(native_due_time, waitable_timer_duration::zero());
+            start_delay_ = tolerable_delay;
+            start_timer();
+        }
+
+        [[nodiscard]]
+        static ULONG to_native_tolerable_delay(std::chrono::milliseconds const tolerable_delay)
+        {
+            if (tolerable_delay <= std::chrono::milliseconds(0) ||
+                tolerable_delay.count() > static_cast<std::chrono::milliseconds::rep>((std::numeric_limits<ULONG>::max)())) {
+                throw std::invalid_argument("tolerable_delay must be greater than zero");
+            }
+            return static_cast<ULONG>(tolerable_delay.count());
+        }
+
+        /// <summary>
+        /// arms the timer or launches the notification thread, must only be called while in the starting state
+        /// </summary>
+        void start_timer()
+        {
+            try {
+                if constexpr (timer_uses_notification_thread_v<TRAITS>) {
+                    if (notification_thread_id_ == thread::current_thread_id()) {
+                        // restarted from within the callback, APCs are queued to the thread which sets the timer so it's re-used
+                        std::ignore = stop_event_.clear();
+                        if (!set_timer()) {
+                            throw windows_exception();
+                        }
+                    } else {
+                        join_notification_thread();
+                        std::ignore = stop_event_.clear();
+                        callback_thread_ = std::optional(start_thread(&timer::notification_thread_worker,
+                            static_cast<thread::thread_parameter>(this)));
+                        notification_thread_id_ = callback_thread_.value().id().value_or(thread::native_thread_id{});
+                    }
+                } else {
+                    if (!set_timer()) {
+                        throw windows_exception();
+                    }
                 }
-                auto [due_time, poll_period] = self->timer_settings_.value();
-                if (LARGE_INTEGER due = to_large_integer(due_time);
-                    !TRAITS::set_waitable_timer(
-                        self->handle_.native_handle(),
+            } catch (...) {
+                lifecycle_ = lifecycle::idle;
+                throw;
+            }
+            lifecycle_ = lifecycle::running;
+        }
+
+        [[nodiscard]]
+        bool set_timer()
+        {
+            if (!timer_settings_.has_value()) {
+                return false;
+            }
+            auto [due_time, poll_period] = timer_settings_.value();
+
+            // the native period is whole milliseconds, anything finer is re-armed from the callback as a one-shot due time
+            auto const period_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(poll_period);
+            rearm_period_ = period_milliseconds == poll_period
+                ? waitable_timer_duration::rep{}
+                : poll_period.count();
+            period_ = poll_period.count();
+            last_tick_ = waitable_timer_duration::rep{};
+
+            LARGE_INTEGER due = to_large_integer(due_time);
+            auto const armed = arm_timer(due, rearm_period_ == 0 ? static_cast<LONG>(period_milliseconds.count()) : 0L);
+            if (armed && tracing::is_enabled(tracing::keyword::timer)) {
+                tracing::timer_armed(this, due_time, poll_period);
+            }
+            return armed;
+        }
+
+        [[nodiscard]]
+        bool arm_timer(LARGE_INTEGER& due, LONG const period)
+        {
+            if constexpr (timer_supports_coalescing_v<TRAITS>) {
+                if (auto const tolerable_delay = start_delay_.load();
+                    tolerable_delay != 0UL) {
+                    return TRAITS::set_waitable_timer_ex(
+                        handle_.native_handle(),
                         due,
-                        static_cast<long>(poll_period.count() * 1000),
+                        period,
                         timer::timer_proc,
-                        state,
-                        false)) {
-                    return 4UL;
+                        static_cast<void*>(this),
+                        tolerable_delay);
                 }
             }
-            if (!timer_started) {
+            return TRAITS::set_waitable_timer(
+                handle_.native_handle(),
+                due,
+                period,
+                timer::timer_proc,
+                static_cast<void*>(this),
+                false);
+        }
+
+        [[nodiscard]]
+        bool rearm_timer()
+        {
+            auto const period = rearm_period_.load();
+            if (period == 0 || lifecycle_ != lifecycle::running) {
+                return false;
+            }
+            LARGE_INTEGER due = to_large_integer(waitable_timer_duration(period));
+            return arm_timer(due, 0L);
+        }
+        static DWORD __stdcall notification_thread_worker(thread::thread_parameter state)
+        {
+            // TODO: add constants for these error codes, even if they're inaccessible they shouldn't be magic
+            auto self = static_cast<timer*>(state);
+
+            if (self == nullptr) {
+                return 1UL;
+            }
+
+            // start publishes the thread before moving to running, so this only spins for as long as that takes
+            auto current = self->lifecycle_.load();
+            while (current == lifecycle::starting) {
+                std::this_thread::yield();
+                current = self->lifecycle_.load();
+            }
+            if (current != lifecycle::running) {
                 return 5UL;
             }
 
-            while (!self->stopped_) {
-                std::ignore = self->stop_event_.wait_one(std::chrono::milliseconds(500), true);
+            if (!self->timer_settings_.has_value()) {
+                return 2UL;
+            }
+            if (!self->set_timer()) {
+                auto expected = lifecycle::running;
+                std::ignore = self->lifecycle_.compare_exchange_strong(expected, lifecycle::idle);
+                return 4UL;
+            }
+
+            while (!self->stop_event_.wait_one(std::chrono::milliseconds(500), true)) {
+                // alerted by a timer callback or timed out, keep waiting until stopped
             }
 
             return 0UL;
         }
-        static LARGE_INTEGER to_large_integer(std::chrono::milliseconds const& value)
+        static LARGE_INTEGER to_large_integer(waitable_timer_duration const& value)
         {
-            auto const converted_time_value = value.count() * -10000;
+            // negative values are relative to now
+            auto const converted_time_value = -value.count();
             LARGE_INTEGER output_value;
             output_value.LowPart = static_cast<decltype(output_value.LowPart)>(converted_time_value & 0xFFFFFFFF);
             output_value.HighPart = static_cast<decltype(output_value.HighPart)>(converted_time_value >> 32);
@@ -399,6 +1032,12 @@ namespace modern_win32::threading
     template <typename STATE, class TIMER_CALLBACK = void(*)(STATE&), typename TRAITS = timer_traits>
     using synchronization_timer = timer<false, STATE, TIMER_CALLBACK, TRAITS>;
 
+    template <typename STATE, class TIMER_CALLBACK = void(*)(STATE&)>
+    using high_resolution_delayed_callback = delayed_callback<STATE, TIMER_CALLBACK, high_resolution_timer_traits>;
+
+    template <typename STATE, class TIMER_CALLBACK = void(*)(STATE&)>
+    using high_resolution_synchronization_timer = synchronization_timer<STATE, TIMER_CALLBACK, high_resolution_timer_traits>;
+
 
     /// <summary>
     /// swaps the values of left and right
@@ -409,7 +1048,7 @@ namespace modern_win32::threading
     /// <param name="left">one of the values to be swapped</param>
     /// <param name="right">one of the values to be swapped</param>
     template <bool MANUAL_RESET, typename STATE, class TIMER_CALLBACK = void(*)(STATE&), typename TRAITS = timer_traits>
-    void swap(timer<MANUAL_RESET, STATE, TIMER_CALLBACK, TRAITS> left, timer<MANUAL_RESET, STATE, TIMER_CALLBACK, TRAITS> right)
+    void swap(timer<MANUAL_RESET, STATE, TIMER_CALLBACK, TRAITS>& left, timer<MANUAL_RESET, STATE, TIMER_CALLBACK, TRAITS>& right) noexcept
     {
         left.swap(right);
     }
@@ -0,0 +1,515 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_TIMER_WHEEL_H_
+#define MODERN_WIN32_THREADING_TIMER_WHEEL_H_
+
+#ifdef _WIN32
+
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/threading/timer.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// identifies a logical timer scheduled on a <see cref="timer_wheel"/>, the generation guards against
+    /// a stale id cancelling a timer which has since re-used the same slot
+    /// </summary>
+    struct timer_wheel_id final
+    {
+        std::uint32_t index{ (std::numeric_limits<std::uint32_t>::max)() };
+        std::uint32_t generation{};
+
+        [[nodiscard]]
+        constexpr bool valid() const noexcept
+        {
+            return index != (std::numeric_limits<std::uint32_t>::max)();
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(timer_wheel_id const& left, timer_wheel_id const& right) noexcept
+        {
+            return left.index == right.index && left.generation == right.generation;
+        }
+        [[nodiscard]]
+        friend constexpr bool operator!=(timer_wheel_id const& left, timer_wheel_id const& right) noexcept
+        {
+            return !(left == right);
+        }
+    };
+
+    /// <summary>
+    /// hierarchical timing wheel multiplexing many logical timers onto a single <see cref="synchronization_timer"/>,
+    /// schedule, cancel and reschedule are O(1) and expired callbacks are invoked in batches outside of the lock
+    /// </summary>
+    /// <typeparam name="STATE">state passed to <typeparamref name="TIMER_CALLBACK"/> for each logical timer</typeparam>
+    /// <typeparam name="TIMER_CALLBACK">callback invoked on expiry, same shape as used by <see cref="timer"/></typeparam>
+    /// <typeparam name="TRAITS">traits used by the underlying tick timer</typeparam>
+    /// <remarks>
+    /// the root level has 256 slots of one tick each, the remaining three levels have 64 slots each which gives
+    /// a horizon of 2^26 ticks, timers due beyond that are parked in the top level and re-cascaded until they
+    /// are within range so they never fire early
+    /// </remarks>
+    template <typename STATE, class TIMER_CALLBACK = void (*)(STATE&), typename TRAITS = timer_traits>
+    class timer_wheel final
+    {
+        static constexpr std::uint32_t npos = (std::numeric_limits<std::uint32_t>::max)();
+        static constexpr std::uint32_t root_bits = 8;
+        static constexpr std::uint32_t level_bits = 6;
+        static constexpr std::uint32_t upper_level_count = 3;
+        static constexpr std::uint64_t root_size = 1ULL << root_bits;
+        static constexpr std::uint64_t level_size = 1ULL << level_bits;
+        static constexpr std::uint64_t root_mask = root_size - 1;
+        static constexpr std::uint64_t level_mask = level_size - 1;
+        static constexpr std::uint64_t horizon = 1ULL << (root_bits + upper_level_count * level_bits);
+        static constexpr std::size_t slot_count = static_cast<std::size_t>(root_size + upper_level_count * level_size);
+
+        enum class entry_status : std::uint8_t
+        {
+            free,
+            pending,
+            firing,
+            rescheduled,
+            cancelled,
+        };
+
+        struct entry final
+        {
+            std::optional<STATE> state{};
+            std::uint64_t expires{};
+            std::uint64_t period{};
+            std::uint32_t next{ npos };
+            std::uint32_t prev{ npos };
+            std::uint32_t slot{ npos };
+            std::uint32_t generation{};
+            entry_status status{ entry_status::free };
+        };
+
+        using tick_timer = synchronization_timer<timer_wheel*, void (*)(timer_wheel*&), TRAITS>;
+        using clock = std::chrono::steady_clock;
+
+    public:
+        /// <summary>
+        /// Instantiates a new instance of the timer_wheel class
+        /// </summary>
+        /// <param name="callback">callback invoked with the state of each expired timer</param>
+        /// <param name="resolution">length of a single tick, due times are rounded up to a whole number of ticks</param>
+        /// <exception cref="std::invalid_argument">if resolution is less than or equal to zero</exception>
+        explicit timer_wheel(TIMER_CALLBACK callback, std::chrono::milliseconds const resolution = std::chrono::milliseconds(10))
+            : callback_{ std::move(callback) }
+            , resolution_{ resolution }
+            , ticker_{ &timer_wheel::on_tick, this }
+        {
+            if (resolution_ <= std::chrono::milliseconds(0)) {
+                throw std::invalid_argument("resolution must be greater than zero");
+            }
+            heads_.fill(npos);
+        }
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) noexcept = delete;
+        ~timer_wheel()
+        {
+            stop();
+        }
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) noexcept = delete;
+
+        /// <summary>
+        /// starts the underlying tick timer
+        /// </summary>
+        /// <exception cref="modern_win32::windows_exception">if internal API fails</exception>
+        void start()
+        {
+            {
+                slim_lock_guard guard{ lock_ };
+                started_at_ = clock::now();
+                started_at_tick_ = current_tick_;
+            }
+            ticker_.start(resolution_, resolution_);
+        }
+
+        /// <summary>
+        /// stops the underlying tick timer, pending timers are retained and resume on the next call to start
+        /// </summary>
+        [[maybe_unused]]
+        bool stop()
+        {
+            return ticker_.stop();
+        }
+
+        [[nodiscard]]
+        bool is_running() const
+        {
+            return ticker_.is_running();
+        }
+
+        /// <summary>
+        /// schedules <paramref name="state"/> to be passed to the callback once <paramref name="due_time"/> has elapsed
+        /// </summary>
+        /// <param name="due_time">time before the callback is performed</param>
+        /// <param name="state">state passed to the callback</param>
+        /// <returns>id which can be used to cancel or reschedule the timer</returns>
+        /// <exception cref="std::invalid_argument">if due_time is less than zero</exception>
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        timer_wheel_id schedule(std::chrono::duration<REP, PERIOD> const& due_time, STATE state)
+        {
+            return schedule_entry(to_ticks(due_time, "due_time"), 0ULL, std::move(state));
+        }
+
+        /// <summary>
+        /// schedules <paramref name="state"/> to be passed to the callback once <paramref name="due_time"/> has elapsed and
+        /// every <paramref name="period"/> thereafter until cancelled
+        /// </summary>
+        /// <exception cref="std::invalid_argument">if due_time is less than zero or period is less than or equal to zero</exception>
+        template <class DUE_REP, class DUE_PERIOD, class PERIOD_REP, class PERIOD_PERIOD>
+        [[nodiscard]]
+        timer_wheel_id schedule(
+            std::chrono::duration<DUE_REP, DUE_PERIOD> const& due_time,
+            std::chrono::duration<PERIOD_REP, PERIOD_PERIOD> const& period,
+            STATE state)
+        {
+            auto const period_ticks = to_ticks(period, "period");
+            if (period_ticks == 0ULL) {
+                throw std::invalid_argument("period must be greater than zero");
+            }
+            return schedule_entry(to_ticks(due_time, "due_time"), period_ticks, std::move(state));
+        }
+
+        /// <summary>
+        /// cancels the timer identified by <paramref name="id"/>, a callback already in progress is allowed to complete
+        /// </summary>
+        /// <returns>true if the timer was pending or in progress; otherwise, false</returns>
+        [[maybe_unused]]
+        bool cancel(timer_wheel_id const& id)
+        {
+            slim_lock_guard guard{ lock_ };
+            auto* const item = find(id);
+            if (item == nullptr) {
+                return false;
+            }
+
+            switch (item->status) {  // NOLINT(clang-diagnostic-switch-enum)
+            case entry_status::pending:
+                unlink(id.index);
+                release(id.index);
+                return true;
+            case entry_status::firing:
+            case entry_status::rescheduled:
+                item->status = entry_status::cancelled;
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// moves the expiry of the timer identified by <paramref name="id"/> to <paramref name="due_time"/> from now
+        /// </summary>
+        /// <returns>true if the timer was found; otherwise, false</returns>
+        /// <exception cref="std::invalid_argument">if due_time is less than zero</exception>
+        template <class REP, class PERIOD>
+        [[maybe_unused]]
+        bool reschedule(timer_wheel_id const& id, std::chrono::duration<REP, PERIOD> const& due_time)
+        {
+            auto const ticks = to_ticks(due_time, "due_time");
+
+            slim_lock_guard guard{ lock_ };
+            auto* const item = find(id);
+            if (item == nullptr) {
+                return false;
+            }
+
+            switch (item->status) {  // NOLINT(clang-diagnostic-switch-enum)
+            case entry_status::pending:
+                unlink(id.index);
+                item->expires = current_tick_ + ticks;
+                link(id.index);
+                return true;
+            case entry_status::firing:
+            case entry_status::rescheduled:
+                item->expires = current_tick_ + ticks;
+                item->status = entry_status::rescheduled;
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// returns the number of timers which are pending or in progress
+        /// </summary>
+        [[nodiscard]]
+        std::size_t size() const
+        {
+            slim_lock_guard guard{ lock_ };
+            return active_count_;
+        }
+
+        [[nodiscard]]
+        constexpr std::chrono::milliseconds resolution() const noexcept
+        {
+            return resolution_;
+        }
+
+        /// <summary>
+        /// advances the wheel by <paramref name="ticks"/> invoking the callback for any timers which expire,
+        /// normally driven by the internal tick timer
+        /// </summary>
+        /// <remarks>must not be called concurrently with itself or while the wheel is running</remarks>
+        void advance(std::uint64_t const ticks = 1ULL)
+        {
+            advance_to(current_tick_ + ticks);
+        }
+
+    private:
+        TIMER_CALLBACK callback_;
+        std::chrono::milliseconds resolution_;
+        mutable slim_lock lock_{};
+        std::array<std::uint32_t, slot_count> heads_{};
+        std::deque<entry> entries_{};
+        std::vector<std::uint32_t> free_list_{};
+        std::vector<std::pair<std::uint32_t, entry*>> expired_{};
+        std::uint64_t current_tick_{};
+        std::uint64_t started_at_tick_{};
+        std::size_t active_count_{};
+        clock::time_point started_at_{};
+        tick_timer ticker_;
+
+        static void on_tick(timer_wheel*& self)
+        {
+            if (self == nullptr) {
+                return;
+            }
+            auto const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - self->started_at_);
+            self->advance_to(self->started_at_tick_ + static_cast<std::uint64_t>(elapsed.count() / self->resolution_.count()) + 1ULL);
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        std::uint64_t to_ticks(std::chrono::duration<REP, PERIOD> const& value, char const* name) const
+        {
+            auto const milliseconds = std::chrono::ceil<std::chrono::milliseconds>(value);
+            if (milliseconds < std::chrono::milliseconds(0)) {
+                throw std::invalid_argument(std::string(name) + " must be greater than or equal to zero");
+            }
+            auto const resolution = resolution_.count();
+            return static_cast<std::uint64_t>((milliseconds.count() + resolution - 1) / resolution);
+        }
+
+        [[nodiscard]]
+        timer_wheel_id schedule_entry(std::uint64_t const ticks, std::uint64_t const period, STATE&& state)
+        {
+            slim_lock_guard guard{ lock_ };
+
+            std::uint32_t index;
+            if (!free_list_.empty()) {
+                index = free_list_.back();
+                free_list_.pop_back();
+            } else {
+                if (entries_.size() >= static_cast<std::size_t>(npos)) {
+                    throw std::length_error("too many timers");
+                }
+                index = static_cast<std::uint32_t>(entries_.size());
+                entries_.emplace_back();
+            }
+
+            auto& item = entries_[index];
+            item.state.emplace(std::move(state));
+            item.expires = current_tick_ + ticks;
+            item.period = period;
+            item.status = entry_status::pending;
+            link(index);
+            ++active_count_;
+
+            return timer_wheel_id{ index, item.generation };
+        }
+
+        [[nodiscard]]
+        entry* find(timer_wheel_id const& id) noexcept
+        {
+            if (!id.valid() || id.index >= entries_.size()) {
+                return nullptr;
+            }
+            auto& item = entries_[id.index];
+            return item.generation == id.generation && item.status != entry_status::free
+                ? &item
+                : nullptr;
+        }
+
+        [[nodiscard]]
+        std::uint32_t slot_for(std::uint64_t& expires) const noexcept
+        {
+            if (expires < current_tick_) {
+                expires = current_tick_;
+            }
+            auto const delta = expires - current_tick_;
+            if (delta >= horizon) {
+                // the last top level slot within the horizon, the entry keeps its expiry and is linked again once
+                // that slot cascades
+                auto const shift = root_bits + (upper_level_count - 1) * level_bits;
+                return static_cast<std::uint32_t>(root_size + (upper_level_count - 1) * level_size + (((current_tick_ + horizon - 1) >> shift) & level_mask));
+            }
+            if (delta < root_size) {
+                return static_cast<std::uint32_t>(expires & root_mask);
+            }
+
+            for (std::uint32_t level = 0; level < upper_level_count; ++level) {
+                auto const shift = root_bits + level * level_bits;
+                if (delta < (1ULL << (shift + level_bits))) {
+                    return static_cast<std::uint32_t>(root_size + level * level_size + ((expires >> shift) & level_mask));
+                }
+            }
+            return static_cast<std::uint32_t>(slot_count - 1);
+        }
+
+        void link(std::uint32_t const index) noexcept
+        {
+            auto& item = entries_[index];
+            item.slot = slot_for(item.expires);
+            item.prev = npos;
+            item.next = heads_[item.slot];
+            if (item.next != npos) {
+                entries_[item.next].prev = index;
+            }
+            heads_[item.slot] = index;
+        }
+
+        void unlink(std::uint32_t const index) noexcept
+        {
+            auto& item = entries_[index];
+            if (item.prev != npos) {
+                entries_[item.prev].next = item.next;
+            } else {
+                heads_[item.slot] = item.next;
+            }
+            if (item.next != npos) {
+                entries_[item.next].prev = item.prev;
+            }
+            item.next = npos;
+            item.prev = npos;
+            item.slot = npos;
+        }
+
+        void release(std::uint32_t const index)
+        {
+            auto& item = entries_[index];
+            item.state.reset();
+            item.status = entry_status::free;
+            ++item.generation;
+            --active_count_;
+            free_list_.push_back(index);
+        }
+
+        void cascade(std::uint32_t const level, std::uint64_t const slot_index)
+        {
+            auto const slot = static_cast<std::size_t>(root_size + level * level_size + slot_index);
+            auto index = heads_[slot];
+            heads_[slot] = npos;
+            while (index != npos) {
+                auto const next = entries_[index].next;
+                link(index);
+                index = next;
+            }
+        }
+
+        void process_tick()
+        {
+            auto const root_index = current_tick_ & root_mask;
+            if (root_index == 0ULL) {
+                for (std::uint32_t level = 0; level < upper_level_count; ++level) {
+                    auto const slot_index = (current_tick_ >> (root_bits + level * level_bits)) & level_mask;
+                    cascade(level, slot_index);
+                    if (slot_index != 0ULL) {
+                        break;
+                    }
+                }
+            }
+
+            auto index = heads_[static_cast<std::size_t>(root_index)];
+            while (index != npos) {
+                auto& item = entries_[index];
+                auto const next = item.next;
+                if (item.expires <= current_tick_) {
+                    unlink(index);
+                    item.status = entry_status::firing;
+                    expired_.emplace_back(index, &item);
+                }
+                index = next;
+            }
+            ++current_tick_;
+        }
+
+        void advance_to(std::uint64_t const target_tick)
+        {
+            while (true) {
+                {
+                    // stops at the first tick with expiries so periodic timers are linked again before the ticks which follow
+                    slim_lock_guard guard{ lock_ };
+                    while (current_tick_ < target_tick && expired_.empty()) {
+                        process_tick();
+                    }
+                }
+                if (expired_.empty()) {
+                    return;
+                }
+                dispatch_expired();
+            }
+        }
+
+        void dispatch_expired()
+        {
+            for (auto const& [index, item] : expired_) {
+                callback_(*item->state);
+            }
+
+            slim_lock_guard guard{ lock_ };
+            for (auto const& [index, item] : expired_) {
+                switch (item->status) {  // NOLINT(clang-diagnostic-switch-enum)
+                case entry_status::firing:
+                    if (item->period == 0ULL) {
+                        release(index);
+                        break;
+                    }
+                    item->expires += item->period;
+                    item->status = entry_status::pending;
+                    link(index);
+                    break;
+                case entry_status::rescheduled:
+                    item->status = entry_status::pending;
+                    link(index);
+                    break;
+                default:
+                    release(index);
+                    break;
+                }
+            }
+            expired_.clear();
+        }
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,100 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_THREADING_WAIT_ON_ADDRESS_H_
+#define MODERN_WIN32_THREADING_WAIT_ON_ADDRESS_H_
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <modern_win32/modern_win32_export.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    /// <summary>
+    /// blocks while <paramref name="value"/> equals <paramref name="undesired"/> using WaitOnAddress, the wait is
+    /// entirely in user mode unless the value is unchanged
+    /// </summary>
+    /// <param name="value">value to monitor, must be woken by <see cref="wake_one"/> or <see cref="wake_all"/></param>
+    /// <param name="undesired">value to wait to change from</param>
+    /// <param name="timeout">optional interval to wait for, if std::nullopt waits until woken</param>
+    /// <returns>true if woken or the value differed; otherwise, false if the timeout elapsed</returns>
+    /// <remarks>as with WaitOnAddress the wait may end spuriously, callers must re-check the value</remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool wait_on_address(std::atomic<std::uint32_t> const& value, std::uint32_t undesired,
+        std::optional<std::chrono::milliseconds> const& timeout = std::nullopt) noexcept;
+
+    /// <summary>
+    /// wakes one thread waiting on <paramref name="value"/> with <see cref="wait_on_address"/>
+    /// </summary>
+    MODERN_WIN32_EXPORT void wake_one(std::atomic<std::uint32_t>& value) noexcept;
+
+    /// <summary>
+    /// wakes every thread waiting on <paramref name="value"/> with <see cref="wait_on_address"/>
+    /// </summary>
+    MODERN_WIN32_EXPORT void wake_all(std::atomic<std::uint32_t>& value) noexcept;
+
+    /// <summary>
+    /// spins up to <paramref name="spin_count"/> times waiting for <paramref name="try_acquire"/> to succeed, then
+    /// blocks on <paramref name="value"/> while it equals <paramref name="undesired"/> until the timeout elapses
+    /// </summary>
+    /// <returns>true if <paramref name="try_acquire"/> succeeded; otherwise, false</returns>
+    template <typename TRY_ACQUIRE>
+    [[nodiscard]]
+    bool acquire_on_address(std::atomic<std::uint32_t>& value, std::atomic<std::uint32_t>& waiters, std::uint32_t const undesired,
+        std::uint32_t const spin_count, std::optional<std::chrono::milliseconds> const& timeout, TRY_ACQUIRE try_acquire)
+    {
+        for (std::uint32_t spin = 0; spin < spin_count; ++spin) {
+            if (try_acquire()) {
+                return true;
+            }
+            YieldProcessor();
+        }
+        if (try_acquire()) {
+            return true;
+        }
+        if (timeout.has_value() && timeout.value().count() <= 0) {
+            return false;
+        }
+
+        auto const deadline = timeout.has_value()
+            ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+            : std::nullopt;
+
+        // registered before the final check so that a waker either sees the waiter or the waiter sees the change
+        ++waiters;
+        bool acquired{};
+        while (!(acquired = try_acquire())) {
+            std::optional<std::chrono::milliseconds> remaining{};
+            if (deadline.has_value()) {
+                auto const now = std::chrono::steady_clock::now();
+                if (now >= deadline.value()) {
+                    break;
+                }
+                remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now);
+            }
+            std::ignore = wait_on_address(value, undesired, remaining);
+        }
+        --waiters;
+        return acquired;
+    }
+
+}
+
+#endif
+#endif
@@ -0,0 +1,119 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_TRACING_H_
+#define MODERN_WIN32_TRACING_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <modern_win32/modern_win32_export.h>
+
+namespace modern_win32::tracing
+{
+    /// <summary>
+    /// true when built with MODERN_WIN32_TRACELOGGING, otherwise every check below is a constant false and the
+    /// instrumented code compiles as if it were not there
+    /// </summary>
+#ifdef MODERN_WIN32_TRACELOGGING
+    constexpr bool tracing_enabled = true;
+#else
+    constexpr bool tracing_enabled = false;
+#endif
+
+    /// <summary>
+    /// TraceLogging provider name, sessions can enable it by name as *ModernWin32
+    /// </summary>
+    constexpr wchar_t const* provider_name = L"ModernWin32";
+
+    /// <summary>
+    /// {c82012f2-bc99-5c66-327e-7444b9db9809}, the EventSource name based GUID of <see cref="provider_name"/>
+    /// </summary>
+    constexpr GUID provider_id{ 0xc82012f2, 0xbc99, 0x5c66, { 0x32, 0x7e, 0x74, 0x44, 0xb9, 0xdb, 0x98, 0x09 } };
+
+    /// <summary>
+    /// event keywords, a session enabling none of them receives every event
+    /// </summary>
+    enum class keyword : std::uint64_t
+    {
+        thread = 0x1,
+        timer = 0x2,
+        wait = 0x4,
+        process = 0x8,
+    };
+
+#ifdef MODERN_WIN32_TRACELOGGING
+    namespace details
+    {
+        /// <summary>
+        /// keywords enabled by any listening session, maintained by the provider enable callback
+        /// </summary>
+        MODERN_WIN32_EXPORT extern std::atomic<std::uint64_t> enabled_keywords;
+    }
+#endif
+
+    /// <summary>
+    /// returns true if a session is listening for <paramref name="value"/> events, a single relaxed load so
+    /// callers check it before reading any clock
+    /// </summary>
+    [[nodiscard]]
+    inline bool is_enabled(keyword const value) noexcept
+    {
+#ifdef MODERN_WIN32_TRACELOGGING
+        return (details::enabled_keywords.load(std::memory_order_relaxed) & static_cast<std::uint64_t>(value)) != 0;
+#else
+        static_cast<void>(value);
+        return false;
+#endif
+    }
+
+    /// <summary>
+    /// waits shorter than this are not reported, 1ms by default
+    /// </summary>
+    MODERN_WIN32_EXPORT void set_long_wait_threshold(std::chrono::nanoseconds threshold) noexcept;
+
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::chrono::nanoseconds long_wait_threshold() noexcept;
+
+    // event writers, each is only called once the matching is_enabled check has passed; elapsed times are raw
+    // qpc_clock ticks so the conversion is only paid while tracing
+
+    MODERN_WIN32_EXPORT void thread_created(DWORD thread_id, std::int64_t create_ticks) noexcept;
+    MODERN_WIN32_EXPORT void thread_started() noexcept;
+    MODERN_WIN32_EXPORT void thread_exited(DWORD exit_code, std::int64_t run_ticks) noexcept;
+
+    MODERN_WIN32_EXPORT void timer_armed(void const* timer, std::chrono::nanoseconds due_time, std::chrono::nanoseconds period) noexcept;
+    MODERN_WIN32_EXPORT void timer_fired(void const* timer, std::uint64_t tick_count, std::uint64_t missed_ticks) noexcept;
+    MODERN_WIN32_EXPORT void timer_callback_completed(void const* timer, std::int64_t callback_ticks) noexcept;
+
+    /// <summary>
+    /// reports a wait if it lasted at least <see cref="long_wait_threshold"/>
+    /// </summary>
+    MODERN_WIN32_EXPORT void wait_completed(std::size_t handle_count, HANDLE first_handle, bool wait_all, DWORD timeout_milliseconds,
+        DWORD native_result, std::int64_t wait_ticks) noexcept;
+
+    MODERN_WIN32_EXPORT void process_started(DWORD process_id, DWORD thread_id, char const* filename, std::int64_t create_ticks) noexcept;
+    MODERN_WIN32_EXPORT void process_started(DWORD process_id, DWORD thread_id, wchar_t const* filename, std::int64_t create_ticks) noexcept;
+
+    /// <summary>
+    /// reports the exit of the process owned by <paramref name="process"/>, including its lifetime and CPU time
+    /// </summary>
+    MODERN_WIN32_EXPORT void process_exited(DWORD process_id, DWORD exit_code, HANDLE process) noexcept;
+
+}
+
+#endif
+#endif
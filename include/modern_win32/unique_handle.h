@@ -17,6 +17,7 @@
 
 #include <tuple>
 #include <utility>
+#include <modern_win32/handle_diagnostics.h>
 
 namespace modern_win32
 {
@@ -24,6 +25,10 @@ namespace modern_win32
     /// C++ wrapper around Win32 HANDLE using template TRAITS to handle specific behaviour with regard to close and invalid value
     /// </summary>
     /// <typeparam name="TRAITS">template traits used to determine invalid/closed value and close method</typeparam>
+    /// <remarks>
+    /// when <see cref="handle_diagnostics_enabled"/> the number of handles owned is counted per TRAITS type, see
+    /// <see cref="get_handle_counts"/>
+    /// </remarks>
     template <typename TRAITS>
     class unique_handle final
     {
@@ -33,12 +38,12 @@ namespace modern_win32
         explicit unique_handle(native_handle_type handle = TRAITS::invalid())
             : handle_(handle)
         {
+            on_opened();
         }
         unique_handle(unique_handle const&) = delete;
         unique_handle(unique_handle&& other) noexcept
-            : handle_(other.release())
+            : handle_(std::exchange(other.handle_, TRAITS::invalid()))
         {
-            static_cast<void>(other.reset());
         }
         ~unique_handle()
         {
@@ -61,6 +66,7 @@ namespace modern_win32
         [[nodiscard]]
         native_handle_type release() noexcept
         {
+            on_closed();
             auto const handle = handle_;
             handle_ = TRAITS::invalid();
             return handle;
@@ -78,6 +84,7 @@ namespace modern_win32
             if (handle_ != TRAITS::invalid())
                 close();
             handle_ = handle;
+            on_opened();
             return static_cast<bool>(*this);
         }
 
@@ -153,7 +160,8 @@ namespace modern_win32
         {
             if (this == &other)
                 return *this;
-            static_cast<void>(reset(other.release()));
+            static_cast<void>(reset());
+            std::swap(handle_, other.handle_);
             return *this;
         }
     private:
@@ -164,8 +172,25 @@ namespace modern_win32
         /// </summary>
         void close() noexcept
         {
-            if (*this) 
+            if (*this) {
+                on_closed();
                 TRAITS::close(handle_);
+            }
+        }
+
+        void on_opened() const noexcept
+        {
+            if constexpr (handle_diagnostics_enabled) {
+                if (*this)
+                    handle_counter_for<TRAITS>().on_opened();
+            }
+        }
+        void on_closed() const noexcept
+        {
+            if constexpr (handle_diagnostics_enabled) {
+                if (*this)
+                    handle_counter_for<TRAITS>().on_closed();
+            }
         }
     };
 
@@ -0,0 +1,230 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_VIRTUAL_ARENA_H_
+#define MODERN_WIN32_VIRTUAL_ARENA_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/unique_handle.h>
+
+namespace modern_win32
+{
+    struct virtual_memory_traits final
+    {
+        using native_handle_type = void*;
+
+        static constexpr native_handle_type invalid() noexcept
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const address) noexcept
+        {
+            static_cast<void>(VirtualFree(address, 0, MEM_RELEASE));
+        }
+    };
+
+    /// <summary>
+    /// a region of address space reserved with VirtualAlloc, released with MEM_RELEASE
+    /// </summary>
+    using virtual_memory_handle = unique_handle<virtual_memory_traits>;
+
+    enum class arena_page_size
+    {
+        /// <summary>
+        /// standard pages, committed in chunks as the arena grows
+        /// </summary>
+        standard,
+
+        /// <summary>
+        /// large pages, the whole arena is committed up front and locked in physical memory; requires
+        /// SeLockMemoryPrivilege, see <see cref="enable_lock_memory_privilege"/>
+        /// </summary>
+        large,
+
+        /// <summary>
+        /// large pages if they can be allocated, otherwise standard pages
+        /// </summary>
+        prefer_large,
+    };
+
+    /// <summary>
+    /// returns the minimum large page size, or 0 if the processor does not support large pages
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::size_t large_page_minimum() noexcept;
+
+    /// <summary>
+    /// returns true if SeLockMemoryPrivilege is held and enabled in the process token
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool has_lock_memory_privilege() noexcept;
+
+    /// <summary>
+    /// enables SeLockMemoryPrivilege in the process token, which is needed to allocate large pages
+    /// </summary>
+    /// <remarks>
+    /// the privilege can only be enabled if it has been granted to the account, by the "Lock pages in memory" user
+    /// right, and the account has logged on again since it was granted
+    /// </remarks>
+    /// <returns>true if the privilege is now enabled; otherwise, false</returns>
+    MODERN_WIN32_EXPORT bool enable_lock_memory_privilege() noexcept;
+
+    /// <summary>
+    /// bump allocator over a single reserved range of virtual memory, committing in chunks as it grows
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// individual allocations are never freed, <see cref="reset"/> releases them all at once in O(1) keeping the
+    /// committed pages for reuse. memory is zero filled when first committed but not after a reset
+    /// </para>
+    /// <para>
+    /// the arena is not thread safe, it is intended to be owned by a single request or thread
+    /// </para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT virtual_arena final
+    {
+    public:
+        static constexpr std::size_t default_commit_size = 64U * 1024U;
+
+        /// <summary>
+        /// reserves <paramref name="reserve_size"/> bytes of address space, rounded up to a whole page
+        /// </summary>
+        /// <param name="reserve_size">the maximum size the arena can grow to</param>
+        /// <param name="page_size">the page size used to back the arena</param>
+        /// <param name="commit_size">minimum number of bytes committed each time the arena grows</param>
+        /// <param name="numa_node">
+        /// preferred NUMA node for the physical memory backing the arena, see <see cref="threading::processor_topology::numa_nodes"/>;
+        /// std::nullopt leaves placement to the system, normally the node of the thread which first touches each page
+        /// </param>
+        /// <exception cref="std::invalid_argument">if <paramref name="reserve_size"/> is 0</exception>
+        /// <exception cref="windows_exception">if the range could not be reserved</exception>
+        explicit virtual_arena(std::size_t reserve_size, arena_page_size page_size = arena_page_size::standard, std::size_t commit_size = default_commit_size,
+            std::optional<DWORD> numa_node = std::nullopt);
+        virtual_arena(virtual_arena const&) = delete;
+        virtual_arena(virtual_arena&& other) noexcept;
+        ~virtual_arena() = default;
+        virtual_arena& operator=(virtual_arena const&) = delete;
+        virtual_arena& operator=(virtual_arena&& other) noexcept;
+
+        /// <summary>
+        /// allocates <paramref name="size"/> bytes aligned to <paramref name="alignment"/>, which must be a power of 2
+        /// </summary>
+        /// <returns>the allocated memory or nullptr if the arena is exhausted or memory could not be committed</returns>
+        [[nodiscard]]
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+        /// <summary>
+        /// releases every allocation, committed memory is kept for the allocations which follow
+        /// </summary>
+        void reset() noexcept;
+
+        /// <summary>
+        /// releases every allocation and decommits all but the first commit chunk, returning memory to the system;
+        /// large page arenas cannot be decommitted and are only reset
+        /// </summary>
+        void trim() noexcept;
+
+        /// <summary>
+        /// returns the number of bytes handed out since construction or the last reset
+        /// </summary>
+        [[nodiscard]]
+        std::size_t used() const noexcept;
+
+        /// <summary>
+        /// returns the number of bytes currently committed
+        /// </summary>
+        [[nodiscard]]
+        std::size_t committed() const noexcept;
+
+        /// <summary>
+        /// returns the number of bytes reserved, the most the arena can allocate
+        /// </summary>
+        [[nodiscard]]
+        std::size_t reserved() const noexcept;
+
+        /// <summary>
+        /// returns true if the arena is backed by large pages
+        /// </summary>
+        [[nodiscard]]
+        bool uses_large_pages() const noexcept;
+
+        /// <summary>
+        /// returns true if <paramref name="memory"/> lies within the reserved range
+        /// </summary>
+        [[nodiscard]]
+        bool owns(void const* memory) const noexcept;
+
+    private:
+        virtual_memory_handle region_;
+        std::byte* base_{};
+        std::size_t offset_{};
+        std::size_t committed_{};
+        std::size_t reserved_{};
+        std::size_t commit_size_{};
+        bool large_pages_{};
+
+        [[nodiscard]]
+        bool commit(std::size_t required) noexcept;
+    };
+
+    /// <summary>
+    /// std::pmr::memory_resource allocating from a <see cref="virtual_arena"/>, deallocation does nothing and memory
+    /// is reclaimed by resetting the arena once the containers using it are gone
+    /// </summary>
+    class arena_memory_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit arena_memory_resource(virtual_arena& arena) noexcept
+            : arena_(&arena)
+        {
+        }
+
+        [[nodiscard]]
+        virtual_arena& arena() const noexcept
+        {
+            return *arena_;
+        }
+
+    private:
+        virtual_arena* arena_;
+
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            auto* const memory = arena_->allocate(bytes, alignment);
+            if (memory == nullptr)
+                throw std::bad_alloc();
+            return memory;
+        }
+
+        void do_deallocate(void*, std::size_t, std::size_t) override
+        {
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            auto const* const other_arena = dynamic_cast<arena_memory_resource const*>(&other);
+            return other_arena != nullptr && other_arena->arena_ == arena_;
+        }
+    };
+
+}
+
+#endif
+#endif
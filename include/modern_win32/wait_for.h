@@ -19,7 +19,10 @@
 #include <chrono>
 #include <optional>
 #include <modern_win32/wait_for_result.h>
+#include <modern_win32/windows_result.h>
 #include <modern_win32/modern_win32_export.h>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/tracing.h>
 #include <modern_win32/shared/chrono_extensions.h>
 
 namespace modern_win32
@@ -45,7 +48,7 @@ namespace modern_win32
         case WAIT_OBJECT_0:
             return wait_for_result::object;
         default:
-            if (WAIT_OBJECT_0 >= result && result < WAIT_OBJECT_0 + MAXIMUM_WAIT_OBJECTS)
+            if (result >= WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + MAXIMUM_WAIT_OBJECTS)
                 return wait_for_result::object;
             else
                 return wait_for_result::abandonded;
@@ -128,10 +131,20 @@ namespace modern_win32
             ? to_numeric_milliseconds<DWORD>(timeout.value())
             : INFINITE;
 
-        return to_wait_for_result(WaitForSingleObjectEx(
-            handle.native_handle(),
-            timeout_value,
-            alertable ? TRUE : FALSE));
+        if (!tracing::is_enabled(tracing::keyword::wait)) {
+            return to_wait_for_result(WaitForSingleObjectEx(
+                handle.native_handle(),
+                timeout_value,
+                alertable ? TRUE : FALSE));
+        }
+
+        auto const started = qpc_clock::ticks();
+        auto const native_result = WaitForSingleObjectEx(handle.native_handle(), timeout_value, alertable ? TRUE : FALSE);
+        // callers read GetLastError after a failed wait, the clock read and event write must not change it
+        auto const error = GetLastError();
+        tracing::wait_completed(1, handle.native_handle(), false, timeout_value, native_result, qpc_clock::ticks() - started);
+        SetLastError(error);
+        return to_wait_for_result(native_result);
     }
 
     /// <summary>
@@ -199,11 +212,20 @@ namespace modern_win32
         static_assert(sizeof...(HANDLES) < static_cast<size_t>(MAXIMUM_WAIT_OBJECTS));
         HANDLE handles[sizeof...(HANDLES)];
         add_to_array(handles, args...);
-        return to_wait_for_result(WaitForMultipleObjectsEx(
-            sizeof...(HANDLES),
-            handles, true,
-            timeout_value,
-            alertable ? TRUE : FALSE));
+        if (!tracing::is_enabled(tracing::keyword::wait)) {
+            return to_wait_for_result(WaitForMultipleObjectsEx(
+                sizeof...(HANDLES),
+                handles, true,
+                timeout_value,
+                alertable ? TRUE : FALSE));
+        }
+
+        auto const started = qpc_clock::ticks();
+        auto const native_result = WaitForMultipleObjectsEx(sizeof...(HANDLES), handles, true, timeout_value, alertable ? TRUE : FALSE);
+        auto const error = GetLastError();
+        tracing::wait_completed(sizeof...(HANDLES), handles[0], true, timeout_value, native_result, qpc_clock::ticks() - started);
+        SetLastError(error);
+        return to_wait_for_result(native_result);
     }
 
     /// <summary>
@@ -337,6 +359,37 @@ namespace modern_win32
     [[nodiscard]]
     MODERN_WIN32_EXPORT bool is_complete(wait_for_result const& result);
 
+    /// <summary>
+    /// returns true if result is <see cref="wait_for_result::object"/>, false if the wait timed out or was
+    /// interrupted by an APC; otherwise the error which ended the wait
+    /// </summary>
+    /// <remarks>
+    /// <see cref="wait_for_result::failed"/> reports the calling thread's last error so this must be called
+    /// immediately after the wait; <see cref="wait_for_result::abandonded"/> reports <see cref="windows_error::error_abandoned_wait_0"/>
+    /// </remarks>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT windows_result<bool> try_is_complete(wait_for_result const& result) noexcept;
+
+    /// <summary>
+    /// waits for <paramref name="handle"/> as <see cref="wait_one"/> does, returning whether it was signaled or the
+    /// error which ended the wait rather than throwing
+    /// </summary>
+    /// <returns>true if the handle was signaled, false if the wait timed out; otherwise, the error</returns>
+    template <typename HANDLE, class REP = long long, class PERIOD = std::milli>
+    [[nodiscard]]
+    auto try_wait_one(HANDLE const& handle, std::optional<std::chrono::duration<REP, PERIOD>> const& timeout = std::nullopt, bool const alertable = false) noexcept -> windows_result<bool>
+    {
+        return try_is_complete(wait_one(handle, timeout, alertable));
+    }
+
+    /// <inheritdoc cref="try_wait_one"/>
+    template <typename HANDLE, class REP = long long, class PERIOD = std::milli>
+    [[nodiscard]]
+    auto try_wait_one(HANDLE const& handle, std::chrono::duration<REP, PERIOD> const& timeout, bool const alertable = false) noexcept -> windows_result<bool>
+    {
+        return try_wait_one(handle, std::optional(timeout), alertable);
+    }
+
 }
 
 #endif
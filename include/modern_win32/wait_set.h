@@ -0,0 +1,186 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_WAIT_SET_H_
+#define MODERN_WIN32_WAIT_SET_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/shared/chrono_extensions.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/wait_for_result.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// runtime sized collection of handles which can be waited on repeatedly, without the
+    /// MAXIMUM_WAIT_OBJECTS limit of <see cref="wait_any"/> and <see cref="wait_all"/>
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// up to MAXIMUM_WAIT_OBJECTS handles are waited on directly using WaitForMultipleObjectsEx; beyond that each
+    /// handle is registered with the Win32 thread pool (CreateThreadpoolWait) which fans the waits out over its own
+    /// wait threads. Thread pool waits are created once and re-armed on each wait so the set can be reused cheaply.
+    /// </para>
+    /// <para>
+    /// beyond MAXIMUM_WAIT_OBJECTS each handle is acquired independently: <see cref="wait_all"/> is not atomic and
+    /// <see cref="wait_any"/> may report, and so consume, more than one auto reset event or semaphore.
+    /// </para>
+    /// <para>not thread safe, only one thread may wait on or modify a wait_set at a time</para>
+    /// </remarks>
+    class MODERN_WIN32_EXPORT wait_set final
+    {
+    public:
+        using native_handle_type = HANDLE;
+        using index_type = std::size_t;
+
+        wait_set();
+        explicit wait_set(std::vector<native_handle_type> handles);
+        wait_set(wait_set const&) = delete;
+        wait_set(wait_set&&) noexcept = delete;
+        ~wait_set();
+        wait_set& operator=(wait_set const&) = delete;
+        wait_set& operator=(wait_set&&) noexcept = delete;
+
+        /// <summary>
+        /// adds <paramref name="handle"/> to the set, the handle must remain open while it is part of the set
+        /// </summary>
+        /// <returns>index of the handle used by <see cref="signaled"/></returns>
+        [[maybe_unused]]
+        index_type add(native_handle_type handle);
+
+        /// <summary>
+        /// adds the handle of <paramref name="waitable"/>, any type exposing native_handle() such as
+        /// <see cref="threading::event"/> or <see cref="process"/>
+        /// </summary>
+        template <typename WAITABLE, typename = decltype(std::declval<WAITABLE const&>().native_handle())>
+        [[maybe_unused]]
+        index_type add(WAITABLE const& waitable)
+        {
+            return add(static_cast<native_handle_type>(waitable.native_handle()));
+        }
+
+        /// <summary>
+        /// removes all handles from the set
+        /// </summary>
+        void clear() noexcept;
+
+        [[nodiscard]]
+        std::size_t size() const noexcept;
+
+        [[nodiscard]]
+        bool empty() const noexcept;
+
+        [[nodiscard]]
+        native_handle_type handle(index_type index) const;
+
+        /// <summary>
+        /// wait for any handle in the set to be signaled or optional interval to be reached
+        /// </summary>
+        /// <param name="timeout">optional interval to wait for, if std::nullopt waits until a handle is signaled</param>
+        /// <param name="alertable">if true the wait can be interupted by alerts</param>
+        /// <returns>
+        /// <see cref="wait_for_result::object"/> if at least one handle was signaled with the indices available from
+        /// <see cref="signaled"/>; <see cref="wait_for_result::failed"/> if the set is empty
+        /// </returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        wait_for_result wait_any(std::optional<std::chrono::duration<REP, PERIOD>> const& timeout = std::nullopt, bool const alertable = false)
+        {
+            return wait(false, to_optional_milliseconds(timeout), alertable);
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        wait_for_result wait_any(std::chrono::duration<REP, PERIOD> const& timeout, bool const alertable = false)
+        {
+            return wait_any(std::optional(timeout), alertable);
+        }
+
+        /// <summary>
+        /// wait for every handle in the set to be signaled or optional interval to be reached
+        /// </summary>
+        /// <param name="timeout">optional interval to wait for, if std::nullopt waits until all handles are signaled</param>
+        /// <param name="alertable">if true the wait can be interupted by alerts</param>
+        /// <returns>
+        /// <see cref="wait_for_result::object"/> if all handles were signaled; otherwise the reason the wait ended,
+        /// in which case <see cref="signaled"/> contains the handles which were acquired before it did
+        /// </returns>
+        template <class REP = long long, class PERIOD = std::milli>
+        [[nodiscard]]
+        wait_for_result wait_all(std::optional<std::chrono::duration<REP, PERIOD>> const& timeout = std::nullopt, bool const alertable = false)
+        {
+            return wait(true, to_optional_milliseconds(timeout), alertable);
+        }
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        wait_for_result wait_all(std::chrono::duration<REP, PERIOD> const& timeout, bool const alertable = false)
+        {
+            return wait_all(std::optional(timeout), alertable);
+        }
+
+        /// <summary>
+        /// indices, in ascending order, of the handles signaled by the most recent wait
+        /// </summary>
+        [[nodiscard]]
+        std::vector<index_type> const& signaled() const noexcept;
+
+    private:
+        struct pool_wait;
+
+#       pragma warning(push)
+#       pragma warning(disable : 4251)
+        std::vector<native_handle_type> handles_{};
+        std::vector<std::unique_ptr<pool_wait>> pool_waits_{};
+        std::vector<index_type> signaled_{};
+        threading::slim_lock lock_{};
+        threading::manual_reset_event ready_{ false };
+#       pragma warning(pop)
+        std::size_t target_{};
+        bool abandoned_{};
+
+        template <class REP, class PERIOD>
+        [[nodiscard]]
+        static std::optional<std::chrono::milliseconds> to_optional_milliseconds(std::optional<std::chrono::duration<REP, PERIOD>> const& timeout)
+        {
+            using modern_win32::shared::to_milliseconds;
+            return timeout.has_value()
+                ? std::optional(to_milliseconds(timeout.value()))
+                : std::nullopt;
+        }
+
+        [[nodiscard]]
+        wait_for_result wait(bool all, std::optional<std::chrono::milliseconds> const& timeout, bool alertable);
+        [[nodiscard]]
+        wait_for_result wait_native(bool all, DWORD timeout, bool alertable);
+        [[nodiscard]]
+        wait_for_result wait_pooled(bool all, DWORD timeout, bool alertable);
+        void close_pool_waits() noexcept;
+
+        static void CALLBACK on_wait(PTP_CALLBACK_INSTANCE, void* context, PTP_WAIT wait, TP_WAIT_RESULT wait_result) noexcept;
+    };
+
+}
+
+#endif
+#endif
@@ -24,10 +24,24 @@ namespace modern_win32
 {
 
     /// <summary>
-    /// custom deleter used with unique_heap_ptr
+    /// custom deleter used with unique_heap_ptr, releasing memory back to the heap which allocated it
     /// </summary>
+    /// <remarks>
+    /// a default constructed deleter frees to the process heap, which is also where memory is returned if the
+    /// owning heap is nullptr
+    /// </remarks>
     struct heap_deleter final
     {
+        constexpr heap_deleter() noexcept = default;
+
+        /// <summary>
+        /// creates a deleter which returns memory to <paramref name="heap"/>
+        /// </summary>
+        constexpr explicit heap_deleter(HANDLE const heap) noexcept
+            : heap_(heap)
+        {
+        }
+
         /// <summary>
         /// release memory used by resource
         /// </summary>
@@ -35,9 +49,23 @@ namespace modern_win32
         inline void operator()(void* resource) const
         {
             if (resource) {
-                HeapFree(GetProcessHeap(), 0, resource);
+                HeapFree(heap(), 0, resource);
             }
         }
+
+        /// <summary>
+        /// returns the heap which owns memory released by this deleter
+        /// </summary>
+        [[nodiscard]]
+        HANDLE heap() const noexcept
+        {
+            return heap_ != nullptr
+                ? heap_
+                : GetProcessHeap();
+        }
+
+    private:
+        HANDLE heap_{};
     };
 
     /// <summary>
@@ -55,6 +83,14 @@ namespace modern_win32
             : base(static_cast<T*>(HeapAlloc(GetProcessHeap(), 0, size)))
         {
         }
+
+        /// <summary>
+        /// allocates <paramref name="size"/> bytes from <paramref name="heap"/>, which must outlive the pointer
+        /// </summary>
+        explicit unique_heap_ptr(HANDLE heap, SIZE_T size)
+            : base(static_cast<T*>(HeapAlloc(heap, 0, size)), heap_deleter(heap))
+        {
+        }
     };
 
     /// <summary>
@@ -78,6 +114,16 @@ namespace modern_win32
             : base(static_cast<T*>(HeapAlloc(GetProcessHeap(), 0, count * sizeof(T))))
         {
         }
+
+        /// <summary>
+        /// allocates count number of T items from <paramref name="heap"/>, which must outlive the array
+        /// </summary>
+        /// <param name="heap">heap to allocate from, such as <see cref="private_heap::native_handle"/></param>
+        /// <param name="count">number of items to allocate</param>
+        explicit unique_heap_array(HANDLE heap, SIZE_T count)
+            : base(static_cast<T*>(HeapAlloc(heap, 0, count * sizeof(T))), heap_deleter(heap))
+        {
+        }
     };
 }
 
@@ -0,0 +1,119 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_WINDOWS_ERROR_CATEGORY_H_
+#define MODERN_WIN32_WINDOWS_ERROR_CATEGORY_H_
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <string>
+#include <system_error>
+#include <modern_win32/modern_win32_export.h>
+#include <modern_win32/windows_error.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// error category for native windows error codes which formats each message once per error code and language,
+    /// the first time it is requested, and caches it for the life of the process
+    /// </summary>
+    /// <remarks>
+    /// error conditions map as std::system_category does so codes still compare equal to std::errc values
+    /// </remarks>
+#   pragma warning(push)
+#   pragma warning(disable : 4275)
+    class MODERN_WIN32_EXPORT windows_error_category final : public std::error_category
+    {
+    public:
+        /// <summary>
+        /// language used by <see cref="message"/>, letting FormatMessage choose based on the thread and user locale
+        /// </summary>
+        static constexpr LANGID default_language = MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL);
+
+        windows_error_category() noexcept = default;
+        windows_error_category(windows_error_category const&) = delete;
+        windows_error_category(windows_error_category&&) = delete;
+        ~windows_error_category() override = default;
+        windows_error_category& operator=(windows_error_category const&) = delete;
+        windows_error_category& operator=(windows_error_category&&) = delete;
+
+        [[nodiscard]]
+        char const* name() const noexcept override;
+
+        [[nodiscard]]
+        std::string message(int error_code) const override;
+
+        [[nodiscard]]
+        std::error_condition default_error_condition(int error_code) const noexcept override;
+
+        /// <summary>
+        /// returns the system message for <paramref name="error_code"/> in <paramref name="language"/>, formatting
+        /// and caching it if this is the first request
+        /// </summary>
+        /// <returns>UTF-8 message without trailing line break, valid for the life of the process</returns>
+        [[nodiscard]]
+        std::string const& cached_message(native_windows_error error_code, LANGID language = default_language) const;
+    };
+#   pragma warning(pop)
+
+    /// <summary>
+    /// returns the single instance of <see cref="windows_error_category"/>, used by <see cref="windows_exception"/>
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT std::error_category const& windows_category() noexcept;
+
+    /// <summary>
+    /// returns true if <paramref name="error"/> reports a condition which may clear on its own, such as a sharing
+    /// violation, a busy pipe or low resources, so the operation is worth retrying
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_transient_error(windows_error error) noexcept;
+
+    /// <summary>
+    /// returns true if <paramref name="error"/> reports missing rights or privileges
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_access_error(windows_error error) noexcept;
+
+    /// <summary>
+    /// returns true if <paramref name="error"/> is a failure which retrying will not fix, this includes access
+    /// errors and error codes without a <see cref="windows_error"/> enumerator
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_permanent_error(windows_error error) noexcept;
+
+    /// <summary>
+    /// <see cref="is_transient_error(windows_error)"/> for codes from <see cref="windows_category"/> or
+    /// std::system_category, any other category returns false
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_transient_error(std::error_code const& error) noexcept;
+
+    /// <summary>
+    /// <see cref="is_access_error(windows_error)"/> for codes from <see cref="windows_category"/> or
+    /// std::system_category, any other category returns false
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_access_error(std::error_code const& error) noexcept;
+
+    /// <summary>
+    /// <see cref="is_permanent_error(windows_error)"/> for codes from <see cref="windows_category"/> or
+    /// std::system_category, any other category returns false
+    /// </summary>
+    [[nodiscard]]
+    MODERN_WIN32_EXPORT bool is_permanent_error(std::error_code const& error) noexcept;
+
+}
+
+#endif
+#endif
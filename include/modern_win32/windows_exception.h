@@ -19,11 +19,13 @@
 #include <system_error>
 #include <Windows.h>
 #include <modern_win32/windows_error.h>
+#include <modern_win32/windows_error_category.h>
 
 namespace modern_win32
 {
     /// <summary>
-    /// wrapper around system_error which constructs error value from GetLastError result
+    /// wrapper around system_error which constructs error value from GetLastError result, messages come from the
+    /// cache in <see cref="windows_error_category"/> so repeated errors do not call FormatMessage again
     /// </summary>
     class windows_exception final : public std::system_error
     {
@@ -37,32 +39,32 @@ namespace modern_win32
         {
         }
         explicit windows_exception(native_windows_error const error_code) 
-            : std::system_error(error_code, std::system_category())
+            : std::system_error(error_code, windows_category())
             , error_(error_code)
         {
         }
         explicit windows_exception(native_windows_error const error_code, char const* message) 
-            : std::system_error(error_code, std::system_category(), message)
+            : std::system_error(error_code, windows_category(), message)
             , error_(error_code)
         {
         }
         explicit windows_exception(windows_error_details const& error) 
-            : std::system_error(error.native_error_code(), std::system_category())
+            : std::system_error(error.native_error_code(), windows_category())
             , error_(error)
         {
         }
         explicit windows_exception(windows_error_details const& error, char const* message) 
-            : std::system_error(error.native_error_code(), std::system_category(), message)
+            : std::system_error(error.native_error_code(), windows_category(), message)
             , error_(error)
         {
         }
         explicit windows_exception(windows_error const error) 
-            : std::system_error(static_cast<native_windows_error>(error), std::system_category())
+            : std::system_error(static_cast<native_windows_error>(error), windows_category())
             , error_(error)
         {
         }
         explicit windows_exception(windows_error const error, char const* message) 
-            : std::system_error(static_cast<native_windows_error>(error), std::system_category(), message)
+            : std::system_error(static_cast<native_windows_error>(error), windows_category(), message)
             , error_(error)
         {
         }
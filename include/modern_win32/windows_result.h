@@ -0,0 +1,177 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#ifndef MODERN_WIN32_WINDOWS_RESULT_H_
+#define MODERN_WIN32_WINDOWS_RESULT_H_
+#ifdef _WIN32
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <modern_win32/windows_error.h>
+#include <modern_win32/windows_exception.h>
+
+namespace modern_win32
+{
+    /// <summary>
+    /// holds either the value produced by an operation or the <see cref="windows_error_details"/> it failed with,
+    /// letting callers which expect failures check for them without the cost of unwinding
+    /// </summary>
+    /// <remarks>
+    /// mirrors the parts of std::expected the library needs, <see cref="value"/> throws the error as a
+    /// <see cref="windows_exception"/> which is how the throwing APIs are built on their try_ counterparts
+    /// </remarks>
+    template <typename T>
+    class windows_result final
+    {
+        static_assert(!std::is_reference_v<T> && !std::is_same_v<std::decay_t<T>, windows_error_details>);
+
+    public:
+        using value_type = T;
+
+        windows_result(T const& value)
+            : value_{ std::in_place_index<0>, value }
+        {
+        }
+        windows_result(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : value_{ std::in_place_index<0>, std::move(value) }
+        {
+        }
+        windows_result(windows_error_details const& error) noexcept
+            : value_{ std::in_place_index<1>, error }
+        {
+        }
+
+        /// <summary>
+        /// returns true if the result holds a value; otherwise, false
+        /// </summary>
+        [[nodiscard]]
+        bool has_value() const noexcept
+        {
+            return value_.index() == 0;
+        }
+
+        /// <summary>
+        /// <see cref="has_value"/>
+        /// </summary>
+        [[nodiscard]]
+        explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /// <summary>
+        /// returns the value
+        /// </summary>
+        /// <exception cref="windows_exception">if the result holds an error</exception>
+        [[nodiscard]]
+        T& value() &
+        {
+            throw_if_error();
+            return *std::get_if<0>(&value_);
+        }
+
+        /// <inheritdoc cref="value()"/>
+        [[nodiscard]]
+        T const& value() const&
+        {
+            throw_if_error();
+            return *std::get_if<0>(&value_);
+        }
+
+        /// <inheritdoc cref="value()"/>
+        [[nodiscard]]
+        T&& value() &&
+        {
+            throw_if_error();
+            return std::move(*std::get_if<0>(&value_));
+        }
+
+        /// <summary>
+        /// returns the value if present; otherwise, <paramref name="fallback"/>
+        /// </summary>
+        template <typename U>
+        [[nodiscard]]
+        T value_or(U&& fallback) const&
+        {
+            return has_value()
+                ? *std::get_if<0>(&value_)
+                : static_cast<T>(std::forward<U>(fallback));
+        }
+
+        /// <inheritdoc cref="value_or"/>
+        template <typename U>
+        [[nodiscard]]
+        T value_or(U&& fallback) &&
+        {
+            return has_value()
+                ? std::move(*std::get_if<0>(&value_))
+                : static_cast<T>(std::forward<U>(fallback));
+        }
+
+        /// <summary>
+        /// returns the error, or <see cref="windows_error::none"/> if the result holds a value
+        /// </summary>
+        [[nodiscard]]
+        windows_error_details error() const noexcept
+        {
+            auto const* const error = std::get_if<1>(&value_);
+            return error != nullptr
+                ? *error
+                : windows_error_details(windows_error::none);
+        }
+
+        /// <summary>
+        /// returns the value without checking, the result must hold one
+        /// </summary>
+        [[nodiscard]]
+        T& operator*() & noexcept
+        {
+            return *std::get_if<0>(&value_);
+        }
+
+        /// <inheritdoc cref="operator*"/>
+        [[nodiscard]]
+        T const& operator*() const& noexcept
+        {
+            return *std::get_if<0>(&value_);
+        }
+
+        /// <inheritdoc cref="operator*"/>
+        [[nodiscard]]
+        T* operator->() noexcept
+        {
+            return std::get_if<0>(&value_);
+        }
+
+        /// <inheritdoc cref="operator*"/>
+        [[nodiscard]]
+        T const* operator->() const noexcept
+        {
+            return std::get_if<0>(&value_);
+        }
+
+    private:
+        std::variant<T, windows_error_details> value_;
+
+        void throw_if_error() const
+        {
+            if (auto const* const error = std::get_if<1>(&value_); error != nullptr)
+                throw windows_exception(*error);
+        }
+    };
+
+}
+
+#endif
+#endif
@@ -0,0 +1,331 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/async_file.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <modern_win32/windows_exception.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <tuple>
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        std::size_t get_page_size() noexcept
+        {
+            SYSTEM_INFO system_info{};
+            GetSystemInfo(&system_info);
+            return static_cast<std::size_t>(system_info.dwPageSize);
+        }
+
+        [[nodiscard]]
+        std::size_t get_sector_size(HANDLE const file) noexcept
+        {
+            FILE_STORAGE_INFO storage_info{};
+            if (GetFileInformationByHandleEx(file, FileStorageInfo, &storage_info, sizeof(storage_info)) == FALSE ||
+                storage_info.PhysicalBytesPerSectorForPerformance == 0) {
+                // a page is a multiple of every sector size in use
+                return io_buffer::page_size();
+            }
+            return static_cast<std::size_t>(storage_info.PhysicalBytesPerSectorForPerformance);
+        }
+    }
+
+    io_buffer::io_buffer(std::size_t const size)
+    {
+        auto const page = page_size();
+        size_ = size == 0
+            ? page
+            : (size + page - 1) / page * page;
+
+        static_cast<void>(memory_.reset(VirtualAlloc(nullptr, size_, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)));
+        if (!static_cast<bool>(memory_))
+            throw windows_exception();
+    }
+
+    std::byte* io_buffer::data() const noexcept
+    {
+        return static_cast<std::byte*>(memory_.native_handle());
+    }
+
+    std::size_t io_buffer::size() const noexcept
+    {
+        return size_;
+    }
+
+    std::size_t io_buffer::page_count() const noexcept
+    {
+        return size_ / page_size();
+    }
+
+    std::size_t io_buffer::page_size() noexcept
+    {
+        static auto const page = get_page_size();
+        return page;
+    }
+
+    io_segment_list::io_segment_list()
+        : segments_(1, FILE_SEGMENT_ELEMENT{})
+    {
+    }
+
+    void io_segment_list::add(io_buffer const& buffer)
+    {
+        auto const page = io_buffer::page_size();
+        segments_.reserve(segments_.size() + buffer.page_count());
+        for (std::size_t index = 0; index < buffer.page_count(); ++index) {
+            add_page(buffer.data() + index * page);
+        }
+    }
+
+    void io_segment_list::add_page(void* const page)
+    {
+        if (reinterpret_cast<std::uintptr_t>(page) % io_buffer::page_size() != 0)
+            throw std::invalid_argument("segment must be page aligned");
+
+        // the last element is the terminator, the new page takes its place once a new terminator has been added
+        segments_.emplace_back(FILE_SEGMENT_ELEMENT{});
+        segments_[segments_.size() - 2].Buffer = PtrToPtr64(page);
+    }
+
+    void io_segment_list::clear() noexcept
+    {
+        segments_.resize(1);
+        segments_.front() = FILE_SEGMENT_ELEMENT{};
+    }
+
+    std::size_t io_segment_list::page_count() const noexcept
+    {
+        return segments_.size() - 1;
+    }
+
+    std::size_t io_segment_list::byte_count() const noexcept
+    {
+        return page_count() * io_buffer::page_size();
+    }
+
+    FILE_SEGMENT_ELEMENT* io_segment_list::data() noexcept
+    {
+        return segments_.data();
+    }
+
+    async_file::async_file(std::filesystem::path const& path, async_file_access const access, threading::io_completion_executor& executor, bool const unbuffered)
+        : unbuffered_(unbuffered)
+    {
+        auto const readable = access != async_file_access::write;
+        auto const writable = access != async_file_access::read;
+
+        static_cast<void>(file_.reset(CreateFileW(
+            path.c_str(),
+            (readable ? GENERIC_READ : 0UL) | (writable ? GENERIC_WRITE : 0UL),
+            writable ? FILE_SHARE_READ : FILE_SHARE_READ | FILE_SHARE_WRITE,
+            nullptr,
+            writable ? OPEN_ALWAYS : OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | (unbuffered ? FILE_FLAG_NO_BUFFERING : 0UL),
+            nullptr)));
+        if (!static_cast<bool>(file_))
+            throw windows_exception();
+
+        if (!executor.associate(file_.native_handle(), *this))
+            throw windows_exception();
+
+        // completions are always queued to the port, the event inside the file object is never waited on
+        std::ignore = SetFileCompletionNotificationModes(file_.native_handle(), FILE_SKIP_SET_EVENT_ON_HANDLE);
+        sector_size_ = get_sector_size(file_.native_handle());
+    }
+
+    async_file::~async_file()
+    {
+        if (outstanding_.load(std::memory_order_acquire) == 0)
+            return;
+
+        std::ignore = CancelIoEx(file_.native_handle(), nullptr);
+
+        // completions don't wake the destructor, doing so would touch the file after the last completion had
+        // released it; cancelled operations complete promptly so the timed wait only costs a little latency
+        for (auto remaining = outstanding_.load(std::memory_order_acquire); remaining != 0; remaining = outstanding_.load(std::memory_order_acquire)) {
+            std::ignore = threading::wait_on_address(outstanding_, remaining, std::chrono::milliseconds(1));
+        }
+    }
+
+    bool async_file::read(std::uint64_t const offset, void* const buffer, DWORD const length, async_file_request& request) noexcept
+    {
+        auto* const overlapped = prepare(offset, request);
+        return started(ReadFile(file_.native_handle(), buffer, length, nullptr, overlapped));
+    }
+
+    bool async_file::write(std::uint64_t const offset, void const* const buffer, DWORD const length, async_file_request& request) noexcept
+    {
+        auto* const overlapped = prepare(offset, request);
+        return started(WriteFile(file_.native_handle(), buffer, length, nullptr, overlapped));
+    }
+
+    bool async_file::read_scatter(std::uint64_t const offset, io_segment_list& segments, async_file_request& request) noexcept
+    {
+        auto* const overlapped = prepare(offset, request);
+        return started(ReadFileScatter(file_.native_handle(), segments.data(), static_cast<DWORD>(segments.byte_count()), nullptr, overlapped));
+    }
+
+    bool async_file::write_gather(std::uint64_t const offset, io_segment_list& segments, async_file_request& request) noexcept
+    {
+        auto* const overlapped = prepare(offset, request);
+        return started(WriteFileGather(file_.native_handle(), segments.data(), static_cast<DWORD>(segments.byte_count()), nullptr, overlapped));
+    }
+
+    bool async_file::cancel(async_file_request& request) const noexcept
+    {
+        return CancelIoEx(file_.native_handle(), &request.overlapped) != FALSE;
+    }
+
+    std::uint64_t async_file::size() const
+    {
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(file_.native_handle(), &size) == FALSE)
+            throw windows_exception();
+        return static_cast<std::uint64_t>(size.QuadPart);
+    }
+
+    bool async_file::set_size(std::uint64_t const size) const noexcept
+    {
+        FILE_END_OF_FILE_INFO end_of_file{};
+        end_of_file.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+        return SetFileInformationByHandle(file_.native_handle(), FileEndOfFileInfo, &end_of_file, sizeof(end_of_file)) != FALSE;
+    }
+
+    std::size_t async_file::sector_size() const noexcept
+    {
+        return sector_size_;
+    }
+
+    bool async_file::is_unbuffered() const noexcept
+    {
+        return unbuffered_;
+    }
+
+    std::size_t async_file::outstanding() const noexcept
+    {
+        return outstanding_.load(std::memory_order_relaxed);
+    }
+
+    async_file::native_handle_type async_file::native_handle() const noexcept
+    {
+        return file_.native_handle();
+    }
+
+    void async_file::on_completion(threading::io_completion const& completion) noexcept
+    {
+        auto& request = *reinterpret_cast<async_file_request*>(completion.overlapped);
+
+        // the packet carries the NTSTATUS, GetOverlappedResult translates it and never waits for a completed operation
+        DWORD bytes_transferred{};
+        request.error = GetOverlappedResult(file_.native_handle(), completion.overlapped, &bytes_transferred, FALSE) != FALSE
+            ? ERROR_SUCCESS
+            : GetLastError();
+        request.bytes_transferred = bytes_transferred;
+
+        // released before the callback, which may destroy the file once its last operation has completed
+        outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+        if (request.callback != nullptr) {
+            request.callback(request);
+        }
+    }
+
+    OVERLAPPED* async_file::prepare(std::uint64_t const offset, async_file_request& request) noexcept
+    {
+        request.overlapped = OVERLAPPED{};
+        request.overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFULL);
+        request.overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        request.error = ERROR_IO_PENDING;
+        request.bytes_transferred = 0;
+
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        return &request.overlapped;
+    }
+
+    bool async_file::started(BOOL const result) noexcept
+    {
+        // a synchronous success still queues a completion packet as skipping it on success is never enabled
+        if (result != FALSE || GetLastError() == ERROR_IO_PENDING)
+            return true;
+
+        auto const error = GetLastError();
+        outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+        SetLastError(error);
+        return false;
+    }
+
+#ifdef MODERN_WIN32_HAS_COROUTINES
+
+    async_file_awaitable::async_file_awaitable(async_file& file, operation const op, std::uint64_t const offset, void* const buffer, DWORD const length) noexcept
+        : file_(file)
+        , operation_(op)
+        , offset_(offset)
+        , buffer_(buffer)
+        , length_(length)
+    {
+    }
+
+    async_file_awaitable::async_file_awaitable(async_file& file, operation const op, std::uint64_t const offset, io_segment_list& segments) noexcept
+        : file_(file)
+        , operation_(op)
+        , offset_(offset)
+        , segments_(&segments)
+    {
+    }
+
+    bool async_file_awaitable::await_suspend(std::coroutine_handle<> const continuation) noexcept
+    {
+        continuation_ = continuation;
+        request_.callback = &async_file_awaitable::on_complete;
+        request_.context = this;
+
+        bool started{};
+        switch (operation_) {
+        case operation::read:
+            started = file_.read(offset_, buffer_, length_, request_);
+            break;
+        case operation::write:
+            started = file_.write(offset_, buffer_, length_, request_);
+            break;
+        case operation::read_scatter:
+            started = file_.read_scatter(offset_, *segments_, request_);
+            break;
+        case operation::write_gather:
+            started = file_.write_gather(offset_, *segments_, request_);
+            break;
+        }
+
+        if (!started) {
+            request_.error = GetLastError();
+        }
+        return started;
+    }
+
+    windows_result<DWORD> async_file_awaitable::await_resume() const noexcept
+    {
+        if (!request_.succeeded())
+            return windows_error_details(static_cast<native_windows_error>(request_.error));
+        return request_.bytes_transferred;
+    }
+
+    void async_file_awaitable::on_complete(async_file_request& request) noexcept
+    {
+        static_cast<async_file_awaitable*>(request.context)->continuation_.resume();
+    }
+
+#endif
+
+}
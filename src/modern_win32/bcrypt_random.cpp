@@ -31,4 +31,26 @@ namespace modern_win32
         return true;
     }
 
+    bool bcrypt_get_random_bytes(BCRYPT_ALG_HANDLE const algorithm, byte* data, unsigned long length) noexcept
+    {
+        if (algorithm == nullptr)
+            return false;
+        if (auto const result = BCryptGenRandom(algorithm, data, length, 0);
+            result != STATUS_SUCCESS) {
+            return false;
+        }
+        return true;
+    }
+
+    BCRYPT_ALG_HANDLE bcrypt_rng_algorithm() noexcept
+    {
+        static bcrypt_algorithm_handle const algorithm = [] {
+            BCRYPT_ALG_HANDLE handle{};
+            if (BCryptOpenAlgorithmProvider(&handle, BCRYPT_RNG_ALGORITHM, nullptr, 0) != STATUS_SUCCESS)
+                handle = nullptr;
+            return bcrypt_algorithm_handle(handle);
+        }();
+        return algorithm.native_handle();
+    }
+
 }
@@ -13,6 +13,7 @@
 
 #include <modern_win32/environment.h>
 #include <modern_win32/string.h>
+#include <modern_win32/windows_exception.h>
 #include <Windows.h>
 #include <processenv.h>
 #include <algorithm>
@@ -20,75 +21,246 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace modern_win32
 {
 
-template <typename TCHAR>
-[[nodiscard]] environment_map<TCHAR> to_environment_map(TCHAR const* environment_block)
+namespace
 {
-    environment_map<TCHAR> environment;
-    if (environment_block == nullptr)
-        return environment;
+    [[nodiscard]]
+    char* get_environment_strings(char) noexcept
+    {
+#       ifdef UNICODE
+#       undef GetEnvironmentStrings
+        auto* const block = GetEnvironmentStrings();
+#       define GetEnvironmentStrings GetEnvironmentStringsW  // NOLINT(cppcoreguidelines-macro-usage, clang-diagnostic-unused-macros) -- re-enabling GetEnvironmentStrings macro
+#       else
+        auto* const block = GetEnvironmentStrings();
+#       endif
+        return block;
+    }
+    [[nodiscard]]
+    wchar_t* get_environment_strings(wchar_t) noexcept
+    {
+        return GetEnvironmentStringsW();
+    }
 
-    using size_type = typename std::basic_string<TCHAR>::size_type;
-    size_type position = 0;
+    void free_environment_strings(char* const block) noexcept
+    {
+        FreeEnvironmentStringsA(block);
+    }
+    void free_environment_strings(wchar_t* const block) noexcept
+    {
+        FreeEnvironmentStringsW(block);
+    }
+
+    /// <summary>
+    /// orders names case-insensitively, the order Windows uses for both lookup and the blocks given to CreateProcess
+    /// </summary>
+    [[nodiscard]]
+    int compare_names(std::wstring_view const first, std::wstring_view const second) noexcept
+    {
+        return CompareStringOrdinal(first.data(), static_cast<int>(first.size()), second.data(), static_cast<int>(second.size()), TRUE) - CSTR_EQUAL;
+    }
+    [[nodiscard]]
+    int compare_names(std::string_view const first, std::string_view const second) noexcept
+    {
+        auto const fold = [](char const value) {
+            return value >= 'a' && value <= 'z'
+                ? static_cast<unsigned char>(value - ('a' - 'A'))
+                : static_cast<unsigned char>(value);
+        };
 
-    bool done = false;
-    while (!done) {
+        auto const length = (std::min)(first.size(), second.size());
+        for (std::size_t i = 0; i < length; ++i) {
+            if (auto const difference = static_cast<int>(fold(first[i])) - static_cast<int>(fold(second[i])); difference != 0)
+                return difference;
+        }
+        return first.size() == second.size()
+            ? 0
+            : (first.size() < second.size() ? -1 : 1);
+    }
+}
 
-        auto const equals = TCHAR('=');
-        auto const nul = TCHAR('\0');
+template <typename TCHAR>
+environment_block<TCHAR>::environment_block() = default;
 
-        auto const key_view = get_sub_string_view(&environment_block[position], equals);
-        if (!key_view.has_value())
-            return environment;
-        position += key_view.value().size() + 1;
-        auto const value_view = get_sub_string_view(&environment_block[position], nul);
-        if (!value_view.has_value())
-            return environment;
-        position += value_view.value().size() + 1;
+template <typename TCHAR>
+environment_block<TCHAR>::environment_block(TCHAR* const block, bool const owned_by_system)
+    : block_(block)
+    , owned_by_system_(owned_by_system)
+{
+    index();
+}
 
-        std::basic_string<TCHAR> key{std::begin(key_view.value()), std::end(key_view.value())};
-        std::basic_string<TCHAR> value{std::begin(value_view.value()), std::end(value_view.value())};
+template <typename TCHAR>
+environment_block<TCHAR>::environment_block(environment_map<TCHAR> const& environment)
+{
+    std::vector<typename environment_map<TCHAR>::value_type const*> ordered{};
+    ordered.reserve(environment.size());
+    std::size_t size = 1;
+    for (auto const& pair : environment) {
+        ordered.push_back(&pair);
+        size += pair.first.size() + pair.second.size() + 2;
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](auto const* const first, auto const* const second) {
+        return compare_names(first->first, second->first) < 0;
+    });
 
-        environment[key] = value;
-        done = environment_block[position + 1] == nul;
+    // an empty block still needs both terminators
+    size = (std::max)(size, std::size_t{2});
+    auto block = std::make_unique<TCHAR[]>(size);
+    auto* cursor = block.get();
+    for (auto const* const pair : ordered) {
+        cursor = std::copy(pair->first.begin(), pair->first.end(), cursor);
+        *cursor++ = TCHAR('=');
+        cursor = std::copy(pair->second.begin(), pair->second.end(), cursor);
+        *cursor++ = TCHAR('\0');
     }
 
+    block_ = block.release();
+    index();
+}
+
+template <typename TCHAR>
+environment_block<TCHAR>::environment_block(environment_block&& other) noexcept
+    : block_(std::exchange(other.block_, nullptr))
+    , block_size_(std::exchange(other.block_size_, 0U))
+    , owned_by_system_(std::exchange(other.owned_by_system_, false))
+    , entries_(std::move(other.entries_))
+    , sorted_(std::move(other.sorted_))
+{
+    other.entries_.clear();
+    other.sorted_.clear();
+}
+
+template <typename TCHAR>
+environment_block<TCHAR>::~environment_block()
+{
+    release();
+}
+
+template <typename TCHAR>
+environment_block<TCHAR>& environment_block<TCHAR>::operator=(environment_block&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+    block_ = std::exchange(other.block_, nullptr);
+    block_size_ = std::exchange(other.block_size_, 0U);
+    owned_by_system_ = std::exchange(other.owned_by_system_, false);
+    entries_ = std::move(other.entries_);
+    sorted_ = std::move(other.sorted_);
+    other.entries_.clear();
+    other.sorted_.clear();
+    return *this;
+}
+
+template <typename TCHAR>
+environment_block<TCHAR> environment_block<TCHAR>::current()
+{
+    auto* const block = get_environment_strings(TCHAR{});
+    if (block == nullptr)
+        throw windows_exception();
+    return environment_block(block, true);
+}
+
+template <typename TCHAR>
+std::optional<typename environment_block<TCHAR>::string_view_type> environment_block<TCHAR>::find(string_view_type const name) const noexcept
+{
+    auto const found = std::lower_bound(sorted_.begin(), sorted_.end(), name, [this](std::uint32_t const index, string_view_type const value) {
+        return compare_names(entries_[index].first, value) < 0;
+    });
+    if (found == sorted_.end() || compare_names(entries_[*found].first, name) != 0)
+        return std::nullopt;
+    return entries_[*found].second;
+}
+
+template <typename TCHAR>
+environment_map<TCHAR> environment_block<TCHAR>::to_map() const
+{
+    environment_map<TCHAR> environment;
+    for (auto const& [name, value] : entries_)
+        environment.emplace(std::basic_string<TCHAR>(name), std::basic_string<TCHAR>(value));
     return environment;
 }
 
-template <>
-bool try_get_all_environment_variables(environment_map<char>& environment)
+template <typename TCHAR>
+void environment_block<TCHAR>::index()
 {
-#   ifdef UNICODE
-#   undef GetEnvironmentStrings
-    auto deleter = [](char*& character) { FreeEnvironmentStringsA(character); };
-    auto const env_block = std::unique_ptr<char, decltype(deleter)>{GetEnvironmentStrings(), deleter};
-#   define GetEnvironmentStrings GetEnvironmentStringsW  // NOLINT(cppcoreguidelines-macro-usage, clang-diagnostic-unused-macros) -- re-enabling GetEnvironmentStrings macro
-#   else 
-    auto deleter = [](char* character) { FreeEnvironmentStringsA(character); };
-    auto env_block = std::unique_ptr<char, decltype(free)>{GetEnvironmentStrings(), deleter};
-#   endif
-
-    if (env_block == nullptr)
-        return false;
+    entries_.clear();
+    sorted_.clear();
+    if (block_ == nullptr) {
+        block_size_ = 0U;
+        return;
+    }
 
-    environment = to_environment_map(env_block.get());
+    auto const* cursor = block_;
+    while (*cursor != TCHAR('\0')) {
+        // hidden per drive variables begin with '=' so the separator is searched for after the first character,
+        // the name and value are each scanned once rather than measuring the entry and then searching it
+        auto const name_length = 1U + length_until(cursor + 1, TCHAR('='));
+        if (cursor[name_length] == TCHAR('\0')) {
+            entries_.emplace_back(string_view_type(cursor, name_length), string_view_type{});
+            cursor += name_length + 1U;
+            continue;
+        }
 
-    return true;
+        auto const* const value = cursor + name_length + 1U;
+        auto const value_length = std::char_traits<TCHAR>::length(value);
+        entries_.emplace_back(string_view_type(cursor, name_length), string_view_type(value, value_length));
+        cursor = value + value_length + 1U;
+    }
+    block_size_ = static_cast<std::size_t>(cursor - block_) + 1U;
+    if (block_size_ < 2U)
+        block_size_ = 2U;
+
+    sorted_.resize(entries_.size());
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(sorted_.size()); ++i)
+        sorted_[i] = i;
+    std::stable_sort(sorted_.begin(), sorted_.end(), [this](std::uint32_t const first, std::uint32_t const second) {
+        return compare_names(entries_[first].first, entries_[second].first) < 0;
+    });
+}
+
+template <typename TCHAR>
+void environment_block<TCHAR>::release() noexcept
+{
+    if (block_ == nullptr)
+        return;
+
+    if (owned_by_system_)
+        free_environment_strings(block_);
+    else
+        delete[] block_;
+    block_ = nullptr;
 }
 
+template class MODERN_WIN32_EXPORT environment_block<char>;
+template class MODERN_WIN32_EXPORT environment_block<wchar_t>;
+
 template <>
-bool try_get_all_environment_variables(environment_map<wchar_t>&)
+bool try_get_all_environment_variables(environment_map<char>& environment)
 {
-    auto deleter = [](wchar_t*& character) { FreeEnvironmentStringsW(character); };
-    auto const env_block = std::unique_ptr<wchar_t, decltype(deleter)>{GetEnvironmentStringsW(), deleter};
-    if (env_block == nullptr)
+    try {
+        environment = environment_block<char>::current().to_map();
+        return true;
+    } catch (windows_exception const&) {
         return false;
+    }
+}
 
-    return true;
+template <>
+bool try_get_all_environment_variables(environment_map<wchar_t>& environment)
+{
+    try {
+        environment = environment_block<wchar_t>::current().to_map();
+        return true;
+    } catch (windows_exception const&) {
+        return false;
+    }
 }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,298 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/file_mapping.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        constexpr DWORD high_part(std::uint64_t const value) noexcept
+        {
+            return static_cast<DWORD>(value >> 32);
+        }
+
+        [[nodiscard]]
+        constexpr DWORD low_part(std::uint64_t const value) noexcept
+        {
+            return static_cast<DWORD>(value & 0xFFFFFFFFULL);
+        }
+
+        [[nodiscard]]
+        std::uint64_t get_allocation_granularity() noexcept
+        {
+            SYSTEM_INFO system_info{};
+            GetSystemInfo(&system_info);
+            return system_info.dwAllocationGranularity;
+        }
+
+        [[nodiscard]]
+        DWORD to_page_protection(mapping_access const access) noexcept
+        {
+            switch (access) {
+            case mapping_access::copy_on_write:
+                return PAGE_WRITECOPY;
+            case mapping_access::read_write:
+                return PAGE_READWRITE;
+            case mapping_access::read_only:
+            default:
+                return PAGE_READONLY;
+            }
+        }
+
+        [[nodiscard]]
+        DWORD to_view_access(mapping_access const access) noexcept
+        {
+            switch (access) {
+            case mapping_access::copy_on_write:
+                return FILE_MAP_COPY;
+            case mapping_access::read_write:
+                return FILE_MAP_READ | FILE_MAP_WRITE;
+            case mapping_access::read_only:
+            default:
+                return FILE_MAP_READ;
+            }
+        }
+    }
+
+    mapped_view::mapped_view(mapped_view_handle&& base, std::byte* const data, std::size_t const size) noexcept
+        : base_{ std::move(base) }
+        , data_{ data }
+        , size_{ size }
+    {
+    }
+
+    mapped_view::mapped_view(mapped_view&& other) noexcept
+        : base_{ std::move(other.base_) }
+        , data_{ std::exchange(other.data_, nullptr) }
+        , size_{ std::exchange(other.size_, 0U) }
+    {
+    }
+
+    mapped_view& mapped_view::operator=(mapped_view&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        static_cast<void>(base_.reset(other.base_.release()));
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0U);
+        return *this;
+    }
+
+    std::byte* mapped_view::data() const noexcept
+    {
+        return data_;
+    }
+
+    std::size_t mapped_view::size() const noexcept
+    {
+        return size_;
+    }
+
+    bool mapped_view::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    bool mapped_view::prefetch() const noexcept
+    {
+        return prefetch(0, size_);
+    }
+
+    bool mapped_view::prefetch(std::size_t const offset, std::size_t const length) const noexcept
+    {
+        if (offset > size_ || length > size_ - offset)
+            return false;
+        if (length == 0)
+            return true;
+
+        WIN32_MEMORY_RANGE_ENTRY range{};
+        range.VirtualAddress = data_ + offset;
+        range.NumberOfBytes = length;
+        return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != FALSE;
+    }
+
+    bool mapped_view::flush() const noexcept
+    {
+        return flush(0, size_);
+    }
+
+    bool mapped_view::flush(std::size_t const offset, std::size_t const length) const noexcept
+    {
+        if (offset > size_ || length > size_ - offset)
+            return false;
+        if (length == 0)
+            return true;
+        return FlushViewOfFile(data_ + offset, length) != FALSE;
+    }
+
+    mapped_view::operator bool() const noexcept
+    {
+        return static_cast<bool>(base_);
+    }
+
+    file_mapping file_mapping::open(std::filesystem::path const& path, mapping_access const access, std::uint64_t const minimum_size)
+    {
+        // read-only and copy-on-write share writes so files still being appended to, such as logs, can be mapped
+        auto const writable = access == mapping_access::read_write;
+        file_handle file{ CreateFileW(
+            path.c_str(),
+            writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+            writable ? FILE_SHARE_READ : FILE_SHARE_READ | FILE_SHARE_WRITE,
+            nullptr,
+            writable ? OPEN_ALWAYS : OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr) };
+        if (!static_cast<bool>(file))
+            throw windows_exception();
+
+        return file_mapping(std::move(file), access, minimum_size);
+    }
+
+    file_mapping file_mapping::create_shared(wchar_t const* const name, std::uint64_t const size)
+    {
+        file_mapping_handle mapping{ CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, high_part(size), low_part(size), name) };
+        if (!static_cast<bool>(mapping))
+            throw windows_exception();
+
+        // CreateFileMappingW opens an existing mapping of the same name rather than failing
+        if (GetLastError() == ERROR_ALREADY_EXISTS)
+            throw windows_exception(static_cast<native_windows_error>(ERROR_ALREADY_EXISTS));
+
+        return file_mapping(std::move(mapping), size);
+    }
+
+    file_mapping file_mapping::open_shared(wchar_t const* const name)
+    {
+        file_mapping_handle mapping{ OpenFileMappingW(FILE_MAP_READ | FILE_MAP_WRITE, FALSE, name) };
+        if (!static_cast<bool>(mapping))
+            throw windows_exception();
+
+        // the size of a section is not queryable directly, mapping all of it and querying the region is
+        mapped_view_handle const view{ MapViewOfFile(mapping.native_handle(), FILE_MAP_READ, 0, 0, 0) };
+        if (!static_cast<bool>(view))
+            throw windows_exception();
+        MEMORY_BASIC_INFORMATION information{};
+        if (VirtualQuery(view.native_handle(), &information, sizeof(information)) == 0)
+            throw windows_exception();
+
+        return file_mapping(std::move(mapping), information.RegionSize);
+    }
+
+    file_mapping::file_mapping(file_mapping_handle&& mapping, std::uint64_t const size) noexcept
+        : mapping_{ std::move(mapping) }
+        , size_{ size }
+        , access_{ mapping_access::read_write }
+    {
+    }
+
+    file_mapping::file_mapping(file_handle&& file, mapping_access const access, std::uint64_t const minimum_size)
+        : file_{ std::move(file) }
+        , access_{ access }
+    {
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file_.native_handle(), &file_size) == FALSE)
+            throw windows_exception();
+
+        auto const size = static_cast<std::uint64_t>(file_size.QuadPart);
+        create_mapping(access_ == mapping_access::read_write
+            ? (std::max)(size, minimum_size)
+            : size);
+    }
+
+    mapped_view file_mapping::map(std::uint64_t const offset, std::size_t length) const
+    {
+        if (offset > size_)
+            throw std::out_of_range("offset is beyond the end of the mapping");
+
+        auto const remaining = size_ - offset;
+        if (length == 0) {
+            if (remaining > (std::numeric_limits<std::size_t>::max)())
+                throw std::out_of_range("remaining mapping is too large to fit in the address space");
+            length = static_cast<std::size_t>(remaining);
+        } else if (length > remaining) {
+            throw std::out_of_range("length extends beyond the end of the mapping");
+        }
+        if (length == 0)
+            return mapped_view();
+
+        // views must start on an allocation granularity boundary
+        static auto const granularity = get_allocation_granularity();
+        auto const aligned_offset = offset - offset % granularity;
+        auto const adjustment = static_cast<std::size_t>(offset - aligned_offset);
+
+        mapped_view_handle base{ MapViewOfFile(mapping_.native_handle(), to_view_access(access_), high_part(aligned_offset), low_part(aligned_offset), adjustment + length) };
+        if (!static_cast<bool>(base))
+            throw windows_exception();
+
+        auto* const data = static_cast<std::byte*>(base.native_handle()) + adjustment;
+        return mapped_view(std::move(base), data, length);
+    }
+
+    void file_mapping::grow(std::uint64_t const size)
+    {
+        if (access_ != mapping_access::read_write)
+            throw std::logic_error("only read-write mappings can grow");
+        if (!static_cast<bool>(file_))
+            throw std::logic_error("mappings backed by the paging file cannot grow");
+        if (size > size_)
+            create_mapping(size);
+    }
+
+    bool file_mapping::flush_file() const noexcept
+    {
+        return FlushFileBuffers(file_.native_handle()) != FALSE;
+    }
+
+    std::uint64_t file_mapping::size() const noexcept
+    {
+        return size_;
+    }
+
+    mapping_access file_mapping::access() const noexcept
+    {
+        return access_;
+    }
+
+    file_mapping::native_handle_type file_mapping::native_handle() const noexcept
+    {
+        return mapping_.native_handle();
+    }
+
+    void file_mapping::create_mapping(std::uint64_t const size)
+    {
+        // empty files cannot be mapped, leaving the mapping empty lets map() return empty views instead
+        if (size == 0) {
+            static_cast<void>(mapping_.reset());
+            size_ = 0;
+            return;
+        }
+
+        // a read-write mapping larger than the file extends the file to the mapping size
+        file_mapping_handle mapping{ CreateFileMappingW(file_.native_handle(), nullptr, to_page_protection(access_), high_part(size), low_part(size), nullptr) };
+        if (!static_cast<bool>(mapping))
+            throw windows_exception();
+
+        static_cast<void>(mapping_.reset(mapping.release()));
+        size_ = size;
+    }
+
+}
@@ -15,23 +15,10 @@
 #include <algorithm>
 #include <memory>
 #include <modern_win32/com_exception.h>
-#include <rpc.h>
-
-#pragma comment(lib, "rpcrt4.lib")
 
 namespace modern_win32
 {
 
-    template <typename TCHAR, typename CONVERTER>
-    GUID from_string(TCHAR *value, CONVERTER converter)
-    {
-        GUID output;
-        if (RPC_S_OK != converter(value, &output))
-            throw std::invalid_argument("invalid format");
-
-        return output;
-    }
-
     guid::guid() 
         : value_{}
     {
@@ -39,41 +26,25 @@ namespace modern_win32
             throw com_exception(hr);
     }
 
-    guid::guid(GUID const& value) noexcept
-        : value_(value)
-    {
-    }
-
     guid::guid(char const* value)
     {
         if (value == nullptr)
             throw std::invalid_argument("value is null");
 
-        using char_type = std::remove_pointer<RPC_CSTR>::type;
-        char_type buffer[64]{};
-        memcpy_s(buffer, sizeof(buffer), value, strlen(value)*sizeof(char_type));
-        buffer[63] = '\0';
-
-        value_ = from_string(buffer,   
-            [](char_type *value, UUID* out) {
-                return UuidFromStringA(value, out);
-            });
+        auto const parsed = try_parse_guid(std::string_view(value));
+        if (!parsed.has_value())
+            throw std::invalid_argument("invalid format");
+        value_ = parsed.value();
     }
     guid::guid(wchar_t const* value)
     {
         if (value == nullptr)
             throw std::invalid_argument("value is null");
 
-        using char_type = std::remove_pointer<RPC_WSTR>::type;
-        char_type buffer[64]{};
-        memcpy_s(buffer, sizeof(buffer), value, wcslen(value)*sizeof(char_type));
-        buffer[63] = '\0';
-
-        value_ = from_string(buffer,
-            [](char_type *value, UUID* out) {
-                return UuidFromStringW(value, out);
-            });
-
+        auto const parsed = try_parse_guid(std::wstring_view(value));
+        if (!parsed.has_value())
+            throw std::invalid_argument("invalid format");
+        value_ = parsed.value();
     }
 
     guid& guid::zero()
@@ -94,30 +65,15 @@ namespace modern_win32
 
     std::wstring to_wstring(guid const& uid)
     {
-        constexpr int NULL_TERMINATOR_SIZE = 1;
-        constexpr auto GUID_LENGTH = static_cast<std::wstring::size_type>(36);
-
-        constexpr auto SIZE = std::size(L"{00000000-0000-0000-0000-000000000000}") + NULL_TERMINATOR_SIZE;
-        wchar_t buffer[SIZE];
-        if (StringFromGUID2(uid.get(), buffer, static_cast<int>(SIZE)) == 0)
-            return L"********-****-****-****-************";
-
-        return std::wstring(buffer + 1, GUID_LENGTH);
+        wchar_t buffer[guid_string_length];
+        format_guid(uid.get(), buffer);
+        return std::wstring(buffer, guid_string_length);
     }
     std::string to_string(guid const& uid)
     {
-        auto value = to_wstring(uid);
-        std::string value_a{};
-
-        std::transform(std::begin(value), std::end(value), std::back_inserter(value_a),
-            [](auto const& wide_char) {
-                const wchar_t ascii_upper_bound = 127;
-                const wchar_t ascii_lower_bound = 0;
-                return wide_char > ascii_upper_bound || wide_char < ascii_lower_bound
-                    ? '?'
-                    : static_cast<char>(wide_char);
-            });
-        return value_a;
+        char buffer[guid_string_length];
+        format_guid(uid.get(), buffer);
+        return std::string(buffer, guid_string_length);
     }
     void swap(guid& left, guid&right) noexcept
     {
@@ -154,7 +110,9 @@ namespace modern_win32
 
     std::ostream& operator<<(std::ostream& os, const guid& obj)
     {
-        return os << to_string(obj).c_str();
+        char buffer[guid_string_length];
+        format_guid(obj.value_, buffer);
+        return os.write(buffer, static_cast<std::streamsize>(guid_string_length));
     }
 
     [[nodiscard]]
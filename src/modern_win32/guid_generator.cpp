@@ -0,0 +1,133 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/guid_generator.h>
+#include <modern_win32/bcrypt_random.h>
+#include <modern_win32/random_pool.h>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace modern_win32
+{
+    static_assert(sizeof(guid) == sizeof(GUID) && std::is_trivially_copyable_v<guid>, "guid is filled with random bytes in place");
+
+    namespace
+    {
+        constexpr std::uint64_t COUNTER_BITS = 12;
+
+        // 100ns intervals between 1601-01-01 (FILETIME epoch) and 1970-01-01 (unix epoch)
+        constexpr std::uint64_t UNIX_EPOCH_AS_FILETIME = 116444736000000000ULL;
+
+        [[nodiscard]]
+        GUID as_random_version(GUID value) noexcept
+        {
+            value.Data3 = static_cast<unsigned short>((value.Data3 & 0x0FFF) | 0x4000);
+            value.Data4[0] = static_cast<unsigned char>((value.Data4[0] & 0x3F) | 0x80);
+            return value;
+        }
+
+        [[nodiscard]]
+        std::uint64_t unix_time_milliseconds() noexcept
+        {
+            FILETIME now{};
+            GetSystemTimePreciseAsFileTime(&now);
+            auto const ticks = static_cast<std::uint64_t>(now.dwHighDateTime) << 32 | now.dwLowDateTime;
+            return ticks > UNIX_EPOCH_AS_FILETIME
+                ? (ticks - UNIX_EPOCH_AS_FILETIME) / 10000ULL
+                : 0ULL;
+        }
+
+        [[nodiscard]]
+        bool fill_random_bytes(void* const destination, std::size_t const count) noexcept
+        {
+            if (count > (std::numeric_limits<unsigned long>::max)() / sizeof(GUID))
+                return false;
+            return bcrypt_get_random_bytes(static_cast<byte*>(destination), static_cast<unsigned long>(count * sizeof(GUID)));
+        }
+
+        [[nodiscard]]
+        GUID as_time_ordered(std::uint64_t const sequence, GUID const& random) noexcept
+        {
+            auto const timestamp = sequence >> COUNTER_BITS;
+            auto const counter = sequence & ((1ULL << COUNTER_BITS) - 1ULL);
+
+            GUID value{};
+            value.Data1 = static_cast<unsigned long>(timestamp >> 16);
+            value.Data2 = static_cast<unsigned short>(timestamp);
+            value.Data3 = static_cast<unsigned short>(0x7000 | counter);
+            std::copy(std::begin(random.Data4), std::end(random.Data4), std::begin(value.Data4));
+            value.Data4[0] = static_cast<unsigned char>((value.Data4[0] & 0x3F) | 0x80);
+            return value;
+        }
+    }
+
+    bool guid_generator::generate_random(guid* const first, std::size_t const count) noexcept
+    {
+        if (count == 0)
+            return true;
+        if (first == nullptr || !fill_random_bytes(first, count))
+            return false;
+
+        std::transform(first, first + count, first, [](guid const& value) noexcept {
+            return guid(as_random_version(value.get()));
+        });
+        return true;
+    }
+
+    std::optional<guid> guid_generator::next_random() noexcept
+    {
+        auto const random = random_pool::get<GUID>();
+        if (!random.has_value())
+            return std::nullopt;
+        return guid(as_random_version(random.value()));
+    }
+
+    bool guid_generator::generate_time_ordered(guid* const first, std::size_t const count) noexcept
+    {
+        if (count == 0)
+            return true;
+        if (first == nullptr)
+            return false;
+
+        auto sequence = reserve(count);
+        for (auto* current = first; current != first + count; ++current) {
+            auto const random = random_pool::get<GUID>();
+            if (!random.has_value())
+                return false;
+            *current = guid(as_time_ordered(sequence++, random.value()));
+        }
+        return true;
+    }
+
+    std::optional<guid> guid_generator::next_time_ordered() noexcept
+    {
+        auto const random = random_pool::get<GUID>();
+        if (!random.has_value())
+            return std::nullopt;
+        return guid(as_time_ordered(reserve(1), random.value()));
+    }
+
+    std::uint64_t guid_generator::reserve(std::uint64_t const count) noexcept
+    {
+        auto const now = unix_time_milliseconds() << COUNTER_BITS;
+        auto last = sequence_.load(std::memory_order_relaxed);
+        std::uint64_t first{};
+        do {
+            // start a fresh counter when the clock has moved on, otherwise continue from the previous reservation
+            first = (std::max)(now, last + 1);
+        } while (!sequence_.compare_exchange_weak(last, first + count - 1, std::memory_order_relaxed));
+        return first;
+    }
+
+}
@@ -0,0 +1,95 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/handle_diagnostics.h>
+#include <modern_win32/threading/slim_lock.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace modern_win32
+{
+    namespace
+    {
+        struct counter_registry final
+        {
+            threading::slim_lock lock{};
+            std::vector<handle_counter*> counters{};
+        };
+
+        // the registry and its counters are never freed; unique_handles in static storage of other modules may
+        // still close handles after this module's statics are destroyed, and a module owning none of the
+        // counters can be unloaded without leaving anything behind
+        [[nodiscard]]
+        counter_registry& registry()
+        {
+            static auto* const instance = new counter_registry();
+            return *instance;
+        }
+    }
+
+    handle_counter::handle_counter(std::string traits_name) noexcept
+        : traits_name_(std::move(traits_name))
+    {
+    }
+
+    handle_count_snapshot handle_counter::snapshot() const
+    {
+        // closed is read first so that a handle opened and closed during the snapshot can't make open negative
+        auto const closed = closed_.load(std::memory_order_relaxed);
+        auto const opened = opened_.load(std::memory_order_relaxed);
+        return handle_count_snapshot{ traits_name_, static_cast<std::int64_t>(opened - closed), opened, closed };
+    }
+
+    handle_counter& get_handle_counter(char const* const traits_name)
+    {
+        auto& counters = registry();
+        threading::slim_lock_guard guard{ counters.lock };
+
+        auto const existing = std::find_if(counters.counters.begin(), counters.counters.end(),
+            [traits_name](handle_counter const* counter)
+            {
+                return counter->traits_name() == traits_name;
+            });
+        if (existing != counters.counters.end()) {
+            return **existing;
+        }
+
+        // the name is copied, the string returned by typeid belongs to the module asking for the counter
+        counters.counters.emplace_back(new handle_counter(traits_name));
+        return *counters.counters.back();
+    }
+
+    std::vector<handle_count_snapshot> get_handle_counts()
+    {
+        std::vector<handle_count_snapshot> counts;
+        {
+            auto& counters = registry();
+            threading::slim_lock_guard guard{ counters.lock };
+            counts.reserve(counters.counters.size());
+            std::transform(counters.counters.begin(), counters.counters.end(), std::back_inserter(counts),
+                [](handle_counter const* counter)
+                {
+                    return counter->snapshot();
+                });
+        }
+
+        std::sort(counts.begin(), counts.end(),
+            [](handle_count_snapshot const& first, handle_count_snapshot const& second)
+            {
+                return first.traits_name < second.traits_name;
+            });
+        return counts;
+    }
+
+}
@@ -0,0 +1,139 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/handle_reaper.h>
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+
+namespace modern_win32
+{
+    using threading::slim_lock_guard;
+    using threading::thread;
+    using threading::unique_slim_lock;
+
+    handle_reaper::handle_reaper(std::size_t const batch_size, std::chrono::milliseconds const flush_interval)
+        : batch_size_((std::max)(batch_size, std::size_t{ 1 }))
+        , flush_interval_(flush_interval)
+        , worker_(threading::start_thread(&handle_reaper::worker_proc, static_cast<thread::thread_parameter>(this)))
+    {
+        std::ignore = worker_.set_name(L"handle_reaper");
+    }
+
+    handle_reaper::~handle_reaper()
+    {
+        {
+            slim_lock_guard guard{ lock_ };
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        worker_.join();
+
+        // anything deferred while the worker was finishing its last batch
+        close_pending();
+    }
+
+    handle_reaper& handle_reaper::shared()
+    {
+        // deliberately leaked, see the remarks on shared
+        static auto* const instance = new handle_reaper();
+        return *instance;
+    }
+
+    void handle_reaper::defer(close_function const close, void* const handle) noexcept
+    {
+        std::size_t pending{};
+        try {
+            slim_lock_guard guard{ lock_ };
+            pending_.push_back(deferred_handle{ close, handle });
+            pending = pending_.size();
+        } catch (...) {
+            close(handle);
+            closed_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // the first handle starts the flush interval, a full batch ends it early
+        if (pending == 1 || pending == batch_size_) {
+            wake_.notify_one();
+        }
+    }
+
+    void handle_reaper::defer_to_shared(close_function const close, void* const handle) noexcept
+    {
+        handle_reaper* reaper{};
+        try {
+            reaper = &shared();
+        } catch (...) {
+            close(handle);
+            return;
+        }
+        reaper->defer(close, handle);
+    }
+
+    void handle_reaper::flush() noexcept
+    {
+        close_pending();
+    }
+
+    std::size_t handle_reaper::pending() const noexcept
+    {
+        slim_lock_guard guard{ lock_ };
+        return pending_.size();
+    }
+
+    std::uint64_t handle_reaper::closed() const noexcept
+    {
+        return closed_.load(std::memory_order_relaxed);
+    }
+
+    void handle_reaper::close_pending() noexcept
+    {
+        // held for the whole batch so that flush waits for a batch the worker is already closing; the buffers are
+        // swapped rather than moved so both keep their capacity and a steady stream of closes doesn't allocate
+        slim_lock_guard close_guard{ close_lock_ };
+        {
+            slim_lock_guard guard{ lock_ };
+            pending_.swap(closing_);
+        }
+
+        for (auto const& deferred : closing_) {
+            deferred.close(deferred.handle);
+        }
+        closed_.fetch_add(closing_.size(), std::memory_order_relaxed);
+        closing_.clear();
+    }
+
+    DWORD __stdcall handle_reaper::worker_proc(thread::thread_parameter parameter)
+    {
+        auto& reaper = *static_cast<handle_reaper*>(parameter);
+
+        unique_slim_lock lock{ reaper.lock_ };
+        while (true) {
+            reaper.wake_.wait(lock, [&reaper]() { return reaper.stopping_ || !reaper.pending_.empty(); });
+            if (!reaper.stopping_) {
+                std::ignore = reaper.wake_.wait_for(lock, reaper.flush_interval_,
+                    [&reaper]() { return reaper.stopping_ || reaper.pending_.size() >= reaper.batch_size_; });
+            }
+
+            lock.unlock();
+            reaper.close_pending();
+            lock.lock();
+
+            if (reaper.stopping_ && reaper.pending_.empty()) {
+                return 0;
+            }
+        }
+    }
+
+}
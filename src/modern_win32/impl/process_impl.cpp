@@ -16,6 +16,8 @@
 #include <modern_win32/windows_exception.h>
 #include <modern_win32/wait_for.h>
 
+#include <algorithm>
+
 namespace modern_win32::impl
 {
 
@@ -136,4 +138,62 @@ namespace modern_win32::impl
             : std::optional(exit_code);
     }
 
+    startup_attributes::startup_attributes(std::vector<HANDLE> inherited_handles, std::optional<GROUP_AFFINITY> const& group_affinity,
+        std::optional<std::uint16_t> const& ideal_node, HANDLE const parent_process)
+        : inherited_handles_(std::move(inherited_handles))
+        , group_affinity_(group_affinity.value_or(GROUP_AFFINITY{}))
+        , ideal_node_(ideal_node.value_or(std::uint16_t{}))
+        , parent_process_(parent_process)
+    {
+        auto const count = static_cast<DWORD>(!inherited_handles_.empty()) + static_cast<DWORD>(group_affinity.has_value()) +
+            static_cast<DWORD>(ideal_node.has_value()) + static_cast<DWORD>(parent_process_ != nullptr);
+        if (count == 0UL)
+            return;
+
+        SIZE_T size{};
+        static_cast<void>(InitializeProcThreadAttributeList(nullptr, count, 0UL, &size));
+        auto storage = std::make_unique<std::byte[]>(size);
+        auto* const list = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(storage.get());
+        if (InitializeProcThreadAttributeList(list, count, 0UL, &size) == FALSE)
+            throw windows_exception();
+
+        auto const update = [list](DWORD_PTR const attribute, void* const value, SIZE_T const value_size) {
+            if (UpdateProcThreadAttribute(list, 0UL, attribute, value, value_size, nullptr, nullptr) == FALSE) {
+                auto const error = windows_exception();
+                DeleteProcThreadAttributeList(list);
+                throw error;
+            }
+        };
+        if (!inherited_handles_.empty())
+            update(PROC_THREAD_ATTRIBUTE_HANDLE_LIST, inherited_handles_.data(), inherited_handles_.size() * sizeof(HANDLE));
+        if (group_affinity.has_value())
+            update(PROC_THREAD_ATTRIBUTE_GROUP_AFFINITY, &group_affinity_, sizeof(group_affinity_));
+        if (ideal_node.has_value())
+            update(PROC_THREAD_ATTRIBUTE_PREFERRED_NODE, &ideal_node_, sizeof(ideal_node_));
+        if (parent_process_ != nullptr)
+            update(PROC_THREAD_ATTRIBUTE_PARENT_PROCESS, &parent_process_, sizeof(parent_process_));
+
+        storage_ = std::move(storage);
+    }
+
+    startup_attributes::~startup_attributes()
+    {
+        if (storage_ != nullptr)
+            DeleteProcThreadAttributeList(get());
+    }
+
+    LPPROC_THREAD_ATTRIBUTE_LIST startup_attributes::get() const noexcept
+    {
+        return reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(storage_.get());
+    }
+
+    void add_inheritable_handle(std::vector<HANDLE>& handles, HANDLE const handle)
+    {
+        DWORD flags{};
+        if (handle == nullptr || handle == INVALID_HANDLE_VALUE || GetHandleInformation(handle, &flags) == FALSE || (flags & HANDLE_FLAG_INHERIT) == 0UL)
+            return;
+        if (std::find(handles.begin(), handles.end(), handle) == handles.end())
+            handles.push_back(handle);
+    }
+
 }
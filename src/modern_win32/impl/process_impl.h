@@ -16,11 +16,21 @@
 
 #ifdef _WIN32
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <vector>
+#include <modern_win32/environment.h>
+#include <modern_win32/metrics.h>
 #include <modern_win32/process.h>
+#include <modern_win32/process_pipe.h>
 #include <modern_win32/process_startup_info.h>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/tracing.h>
 #include <modern_win32/windows_exception.h>
+#include <modern_win32/windows_result.h>
 
 namespace modern_win32::impl
 {
@@ -61,14 +71,17 @@ namespace modern_win32::impl
         auto const nul_char = TCHAR(0);
         auto const equals_char = TCHAR('=');
 
-        using std::copy;
-        using std::back_inserter;
+        // "name=value\0" per variable plus the final terminator, sized up front so the block is allocated once
+        std::size_t block_size = 1;
+        for (auto const& pair : environment_map)
+            block_size += pair.first.size() + pair.second.size() + 2;
+        environment_block.reserve(block_size);
 
         for (auto& pair : environment_map)
         {
-            copy(begin(pair.first), end(pair.first), back_inserter(environment_block));
+            environment_block.insert(environment_block.end(), pair.first.begin(), pair.first.end());
             environment_block.push_back(equals_char);
-            copy(begin(pair.second), end(pair.second), back_inserter(environment_block));
+            environment_block.insert(environment_block.end(), pair.second.begin(), pair.second.end());
             environment_block.push_back(nul_char);
         }
         if (!environment_block.empty())
@@ -77,11 +90,92 @@ namespace modern_win32::impl
         return environment_block;
     }
 
+    template <typename TCHAR>
+    [[nodiscard]]
+    bool uses_pipes(process_startup_info<TCHAR> const& startup_info) noexcept
+    {
+        return startup_info.get_stdout_pipe() != nullptr || startup_info.get_stderr_pipe() != nullptr;
+    }
+
+    /// <summary>
+    /// replaces the standard handles of <paramref name="native_startup_info"/> with the child end of any pipes, the
+    /// remaining handles are those of this process
+    /// </summary>
+    template <typename STARTUP_INFO_T, typename TCHAR>
+    void apply_pipes(STARTUP_INFO_T& native_startup_info, process_startup_info<TCHAR> const& startup_info) noexcept
+    {
+        if (!uses_pipes(startup_info))
+            return;
+
+        auto const* const stdout_pipe = startup_info.get_stdout_pipe();
+        auto const* const stderr_pipe = startup_info.get_stderr_pipe();
+        native_startup_info.dwFlags |= STARTF_USESTDHANDLES;
+        native_startup_info.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+        native_startup_info.hStdOutput = stdout_pipe != nullptr ? stdout_pipe->child_handle() : GetStdHandle(STD_OUTPUT_HANDLE);
+        native_startup_info.hStdError = stderr_pipe != nullptr ? stderr_pipe->child_handle() : GetStdHandle(STD_ERROR_HANDLE);
+    }
+
+    /// <summary>
+    /// PROC_THREAD_ATTRIBUTE_LIST holding the extended start up settings, <see cref="get"/> returns null if none are set
+    /// </summary>
+    class startup_attributes final
+    {
+    public:
+        /// <exception cref="windows_exception">if the list could not be built</exception>
+        explicit startup_attributes(std::vector<HANDLE> inherited_handles, std::optional<GROUP_AFFINITY> const& group_affinity,
+            std::optional<std::uint16_t> const& ideal_node, HANDLE parent_process);
+        startup_attributes(startup_attributes const&) = delete;
+        startup_attributes(startup_attributes&&) noexcept = delete;
+        ~startup_attributes();
+        startup_attributes& operator=(startup_attributes const&) = delete;
+        startup_attributes& operator=(startup_attributes&&) noexcept = delete;
+
+        [[nodiscard]]
+        LPPROC_THREAD_ATTRIBUTE_LIST get() const noexcept;
+
+    private:
+        // UpdateProcThreadAttribute stores pointers to the values, not copies, so they must live as long as the list
+        std::vector<HANDLE> inherited_handles_;
+        GROUP_AFFINITY group_affinity_{};
+        USHORT ideal_node_{};
+        HANDLE parent_process_{};
+        std::unique_ptr<std::byte[]> storage_{};
+    };
+
+    /// <summary>
+    /// adds <paramref name="handle"/> to <paramref name="handles"/> if it is inheritable and not already present
+    /// </summary>
+    void add_inheritable_handle(std::vector<HANDLE>& handles, HANDLE handle);
+
+    /// <summary>
+    /// returns the explicit list of handles inherited by the child, empty if every inheritable handle is inherited
+    /// </summary>
+    /// <remarks>
+    /// pipes only need their child end inherited so using one restricts inheritance to it and the other standard
+    /// handles, rather than leaking every inheritable handle (including other pipes being set up concurrently)
+    /// </remarks>
+    template <typename TCHAR>
+    [[nodiscard]]
+    std::vector<HANDLE> select_inherited_handles(process_startup_info<TCHAR> const& startup_info)
+    {
+        auto handles = startup_info.get_inherited_handles();
+        if (!uses_pipes(startup_info))
+            return handles;
+
+        STARTUPINFOW standard_handles{};
+        apply_pipes(standard_handles, startup_info);
+        add_inheritable_handle(handles, standard_handles.hStdInput);
+        add_inheritable_handle(handles, standard_handles.hStdOutput);
+        add_inheritable_handle(handles, standard_handles.hStdError);
+        return handles;
+    }
+
     template <typename TCHAR>
     [[nodiscard]]
     bool create_process_t(TCHAR* command_line, bool inherit_handles, 
-        std::vector<TCHAR>& environment_block, TCHAR const* directory, 
-        process_startup_info<TCHAR> const& startup_info, PROCESS_INFORMATION& process_information)
+        void* environment, TCHAR const* directory, 
+        process_startup_info<TCHAR> const& startup_info, process_creation_options additional_options,
+        LPPROC_THREAD_ATTRIBUTE_LIST attributes, PROCESS_INFORMATION& process_information)
     {
         return false;
     }
@@ -89,50 +183,69 @@ namespace modern_win32::impl
     template <>
     [[nodiscard]]
     inline bool create_process_t(char* command_line, bool const inherit_handles, 
-        std::vector<char>& environment_block, char const* directory, 
-        process_startup_info<char> const& startup_info, PROCESS_INFORMATION& process_information)
+        void* const environment, char const* directory, 
+        process_startup_info<char> const& startup_info, process_creation_options const additional_options,
+        LPPROC_THREAD_ATTRIBUTE_LIST const attributes, PROCESS_INFORMATION& process_information)
     {
-        auto native_startup_info = startup_info.build_native_startup_info<STARTUPINFOA>();
+        STARTUPINFOEXA native_startup_info{};
+        native_startup_info.StartupInfo = startup_info.build_native_startup_info<STARTUPINFOA>();
+        apply_pipes(native_startup_info.StartupInfo, startup_info);
+        auto options = startup_info.build_creation_options() | additional_options;
+        if (attributes != nullptr) {
+            native_startup_info.StartupInfo.cb = sizeof(native_startup_info);
+            native_startup_info.lpAttributeList = attributes;
+            options |= process_creation_options::extended_startupinfo_present;
+        }
         return CreateProcessA(
             nullptr,
             command_line, 
             nullptr, 
             nullptr, 
             inherit_handles ? TRUE : FALSE, 
-            to_underlying_type(startup_info.build_creation_options()), 
-            environment_block.empty() ? static_cast<void*>(nullptr) : static_cast<void*>(&environment_block[0]),
+            to_underlying_type(options), 
+            environment,
             directory,
-            &native_startup_info, 
+            &native_startup_info.StartupInfo, 
             &process_information) == TRUE;
     }
     template <>
     [[nodiscard]]
     inline bool create_process_t(wchar_t* command_line, bool const inherit_handles, 
-        std::vector<wchar_t>& environment_block, wchar_t const* directory, 
-        process_startup_info<wchar_t> const& startup_info, PROCESS_INFORMATION& process_information)
+        void* const environment, wchar_t const* directory, 
+        process_startup_info<wchar_t> const& startup_info, process_creation_options const additional_options,
+        LPPROC_THREAD_ATTRIBUTE_LIST const attributes, PROCESS_INFORMATION& process_information)
     {
-        auto native_startup_info = startup_info.build_native_startup_info<STARTUPINFOW>();
+        STARTUPINFOEXW native_startup_info{};
+        native_startup_info.StartupInfo = startup_info.build_native_startup_info<STARTUPINFOW>();
+        apply_pipes(native_startup_info.StartupInfo, startup_info);
+        auto options = startup_info.build_creation_options() | additional_options;
+        if (attributes != nullptr) {
+            native_startup_info.StartupInfo.cb = sizeof(native_startup_info);
+            native_startup_info.lpAttributeList = attributes;
+            options |= process_creation_options::extended_startupinfo_present;
+        }
         return CreateProcessW(
             nullptr,
             command_line, 
             nullptr, 
             nullptr, 
             inherit_handles ? TRUE : FALSE, 
-            to_underlying_type(startup_info.build_creation_options()), 
-            environment_block.empty() ? static_cast<void*>(nullptr) : static_cast<void*>(&environment_block[0]),
+            to_underlying_type(options), 
+            environment,
             directory,
-            &native_startup_info, 
+            &native_startup_info.StartupInfo, 
             &process_information) == TRUE;
     }
 
+    /// <summary>
+    /// starts the process described by <paramref name="startup_info"/>, if <paramref name="job"/> is not null the
+    /// process is created suspended and only resumed once assigned to the job so neither it nor any child it starts
+    /// can run outside of the job
+    /// </summary>
     template <typename TCHAR>
     [[nodiscard]]
-    process start_process(process_startup_info<TCHAR> const& startup_info)
+    windows_result<process> create_process(process_startup_info<TCHAR> const& startup_info, HANDLE const job)
     {
-        std::filesystem::path const filename(startup_info.filename);
-        if (!exists(filename))
-            throw std::filesystem::filesystem_error("filename not found", std::error_code(static_cast<int>(windows_error::error_file_not_found), std::iostream_category()));
-
         auto command_buffer = startup_info.build_command_buffer();
 
         class process_info
@@ -165,23 +278,97 @@ namespace modern_win32::impl
 
         process_info process_information{};
 
-        auto environment_block = impl::build_environment_block<TCHAR>(startup_info.environment);
+        // CreateProcess only reads the environment so a prebuilt block is passed as is
+        auto const* const prebuilt = startup_info.get_environment_block();
+        auto environment_block = prebuilt == nullptr
+            ? impl::build_environment_block<TCHAR>(startup_info.environment)
+            : std::vector<TCHAR>{};
+        auto* const environment = prebuilt != nullptr
+            ? static_cast<void*>(const_cast<TCHAR*>(prebuilt->data()))
+            : (environment_block.empty() ? nullptr : static_cast<void*>(environment_block.data()));
+
+        auto inherited_handles = select_inherited_handles(startup_info);
+        auto const inherit_handles = startup_info.inherit_handles || !inherited_handles.empty();
+        startup_attributes const attributes{ std::move(inherited_handles), startup_info.group_affinity, startup_info.ideal_node, startup_info.parent_process };
 
+        auto const traced = tracing::is_enabled(tracing::keyword::process);
+        auto const started = metrics::metrics_enabled || traced ? qpc_clock::ticks() : 0LL;
         auto const result = impl::create_process_t<TCHAR>(
             command_buffer.get(), 
-            startup_info.inherit_handles,
-            environment_block,
+            inherit_handles,
+            environment,
             startup_info.directory.empty() 
                 ? nullptr
                 : startup_info.directory.c_str(), // working directory,
             startup_info,
+            job != nullptr ? process_creation_options::create_suspended : process_creation_options::none,
+            attributes.get(),
             process_information.value());
 
-        if (!result)
-            throw windows_exception();
+        auto const elapsed = metrics::metrics_enabled || traced ? qpc_clock::ticks() - started : 0LL;
+        if (!result) {
+            windows_error_details const error{};
+            if constexpr (metrics::metrics_enabled)
+                metrics::library().process_launch_failures.add();
+            return error;
+        }
+        if constexpr (metrics::metrics_enabled)
+            metrics::library().process_launch.record(qpc_clock::to_duration(elapsed));
+        if (traced) {
+            auto const& native_information = process_information.value();
+            tracing::process_started(native_information.dwProcessId, native_information.dwThreadId, startup_info.filename.c_str(), elapsed);
+        }
+
+        if (job != nullptr) {
+            auto const& native_information = process_information.value();
+            if (AssignProcessToJobObject(job, native_information.hProcess) == FALSE) {
+                windows_error_details const error{};
+                static_cast<void>(TerminateProcess(native_information.hProcess, 1U));
+                return error;
+            }
+            if (ResumeThread(native_information.hThread) == static_cast<DWORD>(-1)) {
+                windows_error_details const error{};
+                static_cast<void>(TerminateProcess(native_information.hProcess, 1U));
+                return error;
+            }
+        }
+
+        if (auto* const stdout_pipe = startup_info.get_stdout_pipe(); stdout_pipe != nullptr)
+            stdout_pipe->start();
+        if (auto* const stderr_pipe = startup_info.get_stderr_pipe(); stderr_pipe != nullptr)
+            stderr_pipe->start();
 
         return process(process_information.value().dwProcessId, process_information.release_process_handle());
     }
+
+    /// <summary>
+    /// starts a process, returning the error rather than throwing if it could not be created
+    /// </summary>
+    template <typename TCHAR>
+    [[nodiscard]]
+    windows_result<process> try_start_process(process_startup_info<TCHAR> const& startup_info, HANDLE const job = nullptr)
+    {
+        std::error_code exists_error{};
+        if (!exists(std::filesystem::path(startup_info.filename), exists_error))
+            return windows_error_details(windows_error::error_file_not_found);
+
+        return create_process(startup_info, job);
+    }
+
+    /// <summary>
+    /// starts a process, throwing std::filesystem::filesystem_error if the filename does not exist or
+    /// windows_exception if it could not be created
+    /// </summary>
+    template <typename TCHAR>
+    [[nodiscard]]
+    process start_process(process_startup_info<TCHAR> const& startup_info, HANDLE const job = nullptr)
+    {
+        std::filesystem::path const filename(startup_info.filename);
+        if (!exists(filename))
+            throw std::filesystem::filesystem_error("filename not found", std::error_code(static_cast<int>(windows_error::error_file_not_found), std::iostream_category()));
+
+        return create_process(startup_info, job).value();
+    }
 }
 
 #endif
@@ -0,0 +1,186 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/job_object.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#include "impl/process_impl.h"
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        process_time_duration to_duration(LARGE_INTEGER const& value) noexcept
+        {
+            return process_time_duration(value.QuadPart);
+        }
+    }
+
+    job_object::job_object()
+        : handle_{ CreateJobObjectW(nullptr, nullptr) }
+    {
+        if (!static_cast<bool>(handle_))
+            throw windows_exception();
+    }
+
+    job_object::job_object(job_handle&& handle) noexcept
+        : handle_{ std::move(handle) }
+    {
+    }
+
+    void job_object::set_limits(job_limits const& limits)
+    {
+        if (limits.cpu_rate_percent.has_value() && (limits.cpu_rate_percent.value() <= 0.0 || limits.cpu_rate_percent.value() > 100.0))
+            throw std::invalid_argument("cpu_rate_percent must be greater than 0 and at most 100");
+
+        JOBOBJECT_EXTENDED_LIMIT_INFORMATION extended{};
+        auto& flags = extended.BasicLimitInformation.LimitFlags;
+        if (limits.process_memory_bytes.has_value()) {
+            flags |= JOB_OBJECT_LIMIT_PROCESS_MEMORY;
+            extended.ProcessMemoryLimit = limits.process_memory_bytes.value();
+        }
+        if (limits.job_memory_bytes.has_value()) {
+            flags |= JOB_OBJECT_LIMIT_JOB_MEMORY;
+            extended.JobMemoryLimit = limits.job_memory_bytes.value();
+        }
+        if (limits.active_process_limit.has_value()) {
+            flags |= JOB_OBJECT_LIMIT_ACTIVE_PROCESS;
+            extended.BasicLimitInformation.ActiveProcessLimit = limits.active_process_limit.value();
+        }
+        if (limits.kill_on_close)
+            flags |= JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+
+        if (SetInformationJobObject(handle_.native_handle(), JobObjectExtendedLimitInformation, &extended, sizeof(extended)) == FALSE)
+            throw windows_exception();
+
+        // rate is in 1/100ths of a percent, no control flags removes any existing cap
+        JOBOBJECT_CPU_RATE_CONTROL_INFORMATION cpu_rate{};
+        if (limits.cpu_rate_percent.has_value()) {
+            cpu_rate.ControlFlags = JOB_OBJECT_CPU_RATE_CONTROL_ENABLE | JOB_OBJECT_CPU_RATE_CONTROL_HARD_CAP;
+            cpu_rate.CpuRate = (std::max)(1UL, static_cast<DWORD>(limits.cpu_rate_percent.value() * 100.0));
+        }
+        if (SetInformationJobObject(handle_.native_handle(), JobObjectCpuRateControlInformation, &cpu_rate, sizeof(cpu_rate)) == FALSE)
+            throw windows_exception();
+    }
+
+    void job_object::assign(process const& child)
+    {
+        if (AssignProcessToJobObject(handle_.native_handle(), child.native_handle()) == FALSE)
+            throw windows_exception();
+    }
+
+    bool job_object::contains(process const& child) const
+    {
+        BOOL result{};
+        if (IsProcessInJob(child.native_handle(), handle_.native_handle(), &result) == FALSE)
+            throw windows_exception();
+        return result == TRUE;
+    }
+
+    process job_object::start_process(narrow_process_startup_info const& startup_info) const
+    {
+        return impl::start_process<char>(startup_info, handle_.native_handle());
+    }
+
+    process job_object::start_process(wide_process_startup_info const& startup_info) const
+    {
+        return impl::start_process<wchar_t>(startup_info, handle_.native_handle());
+    }
+
+    process job_object::start_process(char const* filename, char const* arguments) const
+    {
+        auto const startup_info = narrow_process_startup_info_builder()
+            .with_filename(filename)
+            .with_arguments(arguments)
+            .build();
+        return start_process(startup_info);
+    }
+
+    process job_object::start_process(wchar_t const* filename, wchar_t const* arguments) const
+    {
+        auto const startup_info = wide_process_startup_info_builder()
+            .with_filename(filename)
+            .with_arguments(arguments)
+            .build();
+        return start_process(startup_info);
+    }
+
+    job_accounting job_object::get_accounting() const
+    {
+        JOBOBJECT_BASIC_AND_IO_ACCOUNTING_INFORMATION information{};
+        if (QueryInformationJobObject(handle_.native_handle(), JobObjectBasicAndIoAccountingInformation, &information, sizeof(information), nullptr) == FALSE)
+            throw windows_exception();
+
+        auto const& basic = information.BasicInfo;
+        auto const& io = information.IoInfo;
+        return job_accounting{
+            to_duration(basic.TotalUserTime),
+            to_duration(basic.TotalKernelTime),
+            basic.TotalPageFaultCount,
+            basic.TotalProcesses,
+            basic.ActiveProcesses,
+            basic.TotalTerminatedProcesses,
+            io.ReadOperationCount,
+            io.WriteOperationCount,
+            io.OtherOperationCount,
+            io.ReadTransferCount,
+            io.WriteTransferCount,
+            io.OtherTransferCount,
+        };
+    }
+
+    std::vector<process_id_type> job_object::get_process_ids() const
+    {
+        constexpr auto header_count = (offsetof(JOBOBJECT_BASIC_PROCESS_ID_LIST, ProcessIdList) + sizeof(ULONG_PTR) - 1) / sizeof(ULONG_PTR);
+
+        // processes can join between calls so retry until the list fits
+        std::vector<ULONG_PTR> buffer(header_count + 64U);
+        for (;;) {
+            auto* const list = reinterpret_cast<JOBOBJECT_BASIC_PROCESS_ID_LIST*>(buffer.data());
+            auto const size = static_cast<DWORD>(buffer.size() * sizeof(ULONG_PTR));
+            if (QueryInformationJobObject(handle_.native_handle(), JobObjectBasicProcessIdList, list, size, nullptr) == TRUE) {
+                std::vector<process_id_type> ids{};
+                ids.reserve(list->NumberOfProcessIdsInList);
+                for (auto i = 0UL; i < list->NumberOfProcessIdsInList; ++i)
+                    ids.push_back(static_cast<process_id_type>(list->ProcessIdList[i]));
+                return ids;
+            }
+            if (GetLastError() != ERROR_MORE_DATA)
+                throw windows_exception();
+
+            buffer.resize(header_count + (std::max)(static_cast<std::size_t>(list->NumberOfAssignedProcesses), buffer.size()) * 2U);
+        }
+    }
+
+    void job_object::terminate(process::exit_code_type const exit_code) const
+    {
+        if (TerminateJobObject(handle_.native_handle(), exit_code) == FALSE)
+            throw windows_exception();
+    }
+
+    job_object::operator bool() const noexcept
+    {
+        return static_cast<bool>(handle_);
+    }
+
+    job_object::native_handle_type job_object::native_handle() const noexcept
+    {
+        return handle_.native_handle();
+    }
+
+}
@@ -0,0 +1,260 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <intrin.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <modern_win32/metrics.h>
+
+namespace modern_win32::metrics
+{
+    namespace
+    {
+        constexpr std::int64_t no_minimum = (std::numeric_limits<std::int64_t>::max)();
+        constexpr std::uint64_t largest_bucketed_value = (std::uint64_t{ 1 } << histogram_max_exponent) - 1;
+
+        [[nodiscard]]
+        std::size_t current_shard() noexcept
+        {
+            static std::atomic<std::size_t> next_shard{};
+            thread_local std::size_t const shard = next_shard.fetch_add(1, std::memory_order_relaxed) % metric_shard_count;
+            return shard;
+        }
+
+        [[nodiscard]]
+        std::size_t bucket_for(std::uint64_t value) noexcept
+        {
+            value = (std::min)(value, largest_bucketed_value);
+            if (value < histogram_sub_bucket_count) {
+                return static_cast<std::size_t>(value);
+            }
+
+            unsigned long most_significant_bit{};
+            static_cast<void>(_BitScanReverse64(&most_significant_bit, value));
+            auto const shift = static_cast<std::size_t>(most_significant_bit) - histogram_sub_bucket_bits;
+            return shift * histogram_sub_bucket_count + static_cast<std::size_t>(value >> shift);
+        }
+
+        // only compare-exchanged when value would replace the current one, so once a shard has warmed up almost
+        // every call is a single relaxed load
+        template <class COMPARE>
+        void exchange_if(std::atomic<std::int64_t>& target, std::int64_t const value, COMPARE compare) noexcept
+        {
+            auto current = target.load(std::memory_order_relaxed);
+            if (!compare(value, current)) {
+                return;
+            }
+            while (!target.compare_exchange_weak(current, value, std::memory_order_relaxed) && compare(value, current)) {
+            }
+        }
+    }
+
+    struct alignas(threading::cache_line_size) latency_histogram::shard final
+    {
+        std::atomic<std::int64_t> total_ns{};
+        std::atomic<std::int64_t> min_ns{ no_minimum };
+        std::atomic<std::int64_t> max_ns{};
+        std::array<std::atomic<std::uint64_t>, histogram_bucket_count> buckets{};
+    };
+
+    std::chrono::nanoseconds value_at_percentile(latency_snapshot const& snapshot, double const percentile) noexcept
+    {
+        if (snapshot.count == 0) {
+            return std::chrono::nanoseconds(0);
+        }
+
+        auto const fraction = (std::clamp)(percentile, 0.0, 100.0) / 100.0;
+        auto const rank = (std::max)(static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(snapshot.count))), std::uint64_t{ 1 });
+
+        std::uint64_t seen{};
+        for (std::size_t i = 0; i < snapshot.buckets.size(); ++i) {
+            seen += snapshot.buckets[i];
+            if (seen >= rank) {
+                auto const upper = static_cast<std::int64_t>(bucket_upper_bound(i));
+                return std::chrono::nanoseconds((std::min)(upper, snapshot.max.count()));
+            }
+        }
+        return snapshot.max;
+    }
+
+    latency_histogram::latency_histogram(std::wstring_view const name)
+        : name_(name)
+        , shards_(std::make_unique<shard[]>(metric_shard_count))
+    {
+    }
+
+    latency_histogram::~latency_histogram() = default;
+
+    void latency_histogram::record(std::chrono::nanoseconds const value) noexcept
+    {
+        auto const nanoseconds = (std::max)(value.count(), std::chrono::nanoseconds::rep{});
+        auto& target = shards_[current_shard()];
+
+        target.buckets[bucket_for(static_cast<std::uint64_t>(nanoseconds))].fetch_add(1, std::memory_order_relaxed);
+        target.total_ns.fetch_add(nanoseconds, std::memory_order_relaxed);
+        exchange_if(target.min_ns, nanoseconds, std::less<>{});
+        exchange_if(target.max_ns, nanoseconds, std::greater<>{});
+    }
+
+    std::wstring const& latency_histogram::name() const noexcept
+    {
+        return name_;
+    }
+
+    latency_snapshot latency_histogram::snapshot() const
+    {
+        latency_snapshot snapshot{};
+        snapshot.name = name_;
+        snapshot.buckets.resize(histogram_bucket_count);
+
+        auto minimum = no_minimum;
+        std::int64_t maximum{};
+        std::int64_t total{};
+        for (std::size_t i = 0; i < metric_shard_count; ++i) {
+            auto const& source = shards_[i];
+            for (std::size_t bucket = 0; bucket < histogram_bucket_count; ++bucket) {
+                snapshot.buckets[bucket] += source.buckets[bucket].load(std::memory_order_relaxed);
+            }
+            total += source.total_ns.load(std::memory_order_relaxed);
+            minimum = (std::min)(minimum, source.min_ns.load(std::memory_order_relaxed));
+            maximum = (std::max)(maximum, source.max_ns.load(std::memory_order_relaxed));
+        }
+
+        for (auto const count : snapshot.buckets) {
+            snapshot.count += count;
+        }
+        if (snapshot.count == 0) {
+            return snapshot;
+        }
+
+        snapshot.total = std::chrono::nanoseconds(total);
+        snapshot.min = std::chrono::nanoseconds(minimum == no_minimum ? 0 : minimum);
+        snapshot.max = std::chrono::nanoseconds(maximum);
+        snapshot.p50 = value_at_percentile(snapshot, 50.0);
+        snapshot.p99 = value_at_percentile(snapshot, 99.0);
+        snapshot.p999 = value_at_percentile(snapshot, 99.9);
+        return snapshot;
+    }
+
+    void latency_histogram::reset() noexcept
+    {
+        for (std::size_t i = 0; i < metric_shard_count; ++i) {
+            auto& target = shards_[i];
+            for (auto& bucket : target.buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            target.total_ns.store(0, std::memory_order_relaxed);
+            target.min_ns.store(no_minimum, std::memory_order_relaxed);
+            target.max_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    counter::counter(std::wstring_view const name)
+        : name_(name)
+    {
+    }
+
+    void counter::add(std::uint64_t const value) noexcept
+    {
+        shards_[current_shard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    std::uint64_t counter::value() const noexcept
+    {
+        std::uint64_t total{};
+        for (auto const& source : shards_) {
+            total += source.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    std::wstring const& counter::name() const noexcept
+    {
+        return name_;
+    }
+
+    void counter::reset() noexcept
+    {
+        for (auto& target : shards_) {
+            target.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    latency_histogram& registry::get_histogram(std::wstring_view const name)
+    {
+        {
+            threading::shared_slim_lock guard{ lock_ };
+            if (auto const existing = histograms_.find(name); existing != histograms_.end()) {
+                return *existing->second;
+            }
+        }
+
+        threading::slim_lock_guard guard{ lock_ };
+        if (auto const existing = histograms_.find(name); existing != histograms_.end()) {
+            return *existing->second;
+        }
+        return *histograms_.emplace(std::wstring(name), std::make_unique<latency_histogram>(name)).first->second;
+    }
+
+    counter& registry::get_counter(std::wstring_view const name)
+    {
+        {
+            threading::shared_slim_lock guard{ lock_ };
+            if (auto const existing = counters_.find(name); existing != counters_.end()) {
+                return *existing->second;
+            }
+        }
+
+        threading::slim_lock_guard guard{ lock_ };
+        if (auto const existing = counters_.find(name); existing != counters_.end()) {
+            return *existing->second;
+        }
+        return *counters_.emplace(std::wstring(name), std::make_unique<counter>(name)).first->second;
+    }
+
+    metrics_snapshot registry::snapshot() const
+    {
+        metrics_snapshot snapshot{};
+        threading::shared_slim_lock guard{ lock_ };
+        snapshot.histograms.reserve(histograms_.size());
+        for (auto const& [name, histogram] : histograms_) {
+            snapshot.histograms.push_back(histogram->snapshot());
+        }
+        snapshot.counters.reserve(counters_.size());
+        for (auto const& [name, value] : counters_) {
+            snapshot.counters.push_back(counter_snapshot{ name, value->value() });
+        }
+        return snapshot;
+    }
+
+    registry& registry::instance() noexcept
+    {
+        static registry metrics{};
+        return metrics;
+    }
+
+    library_metrics const& library() noexcept
+    {
+        static library_metrics const metrics{
+            registry::instance().get_histogram(L"modern_win32.semaphore.acquire"),
+            registry::instance().get_counter(L"modern_win32.semaphore.timeouts"),
+            registry::instance().get_histogram(L"modern_win32.timer.dispatch_delay"),
+            registry::instance().get_histogram(L"modern_win32.timer.callback"),
+            registry::instance().get_histogram(L"modern_win32.process.launch"),
+            registry::instance().get_counter(L"modern_win32.process.launch_failures"),
+        };
+        return metrics;
+    }
+
+}
@@ -0,0 +1,411 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/named_pipe_server.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace modern_win32
+{
+    namespace
+    {
+        /// <summary>
+        /// header at the start of every block written from, the message follows it
+        /// </summary>
+        struct pipe_write final
+        {
+            OVERLAPPED overlapped;
+            bool pooled;
+        };
+
+        constexpr std::size_t header_size = (sizeof(pipe_write) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+    }
+
+    named_pipe_connection::named_pipe_connection(named_pipe_server& server, invalid_handle&& pipe) noexcept
+        : server_(server)
+        , pipe_(std::move(pipe))
+    {
+    }
+
+    bool named_pipe_connection::send(void const* const data, std::size_t const size) noexcept
+    {
+        if (size > MAXDWORD) {
+            SetLastError(ERROR_INVALID_PARAMETER);
+            return false;
+        }
+
+        threading::shared_slim_lock guard{ lock_ };
+        if (state_ != connection_state::connected) {
+            SetLastError(ERROR_PIPE_NOT_CONNECTED);
+            return false;
+        }
+
+        auto const pooled = size <= server_.options_.buffer_size;
+        auto* const block = pooled
+            ? server_.acquire_block()
+            : new (std::nothrow) std::byte[header_size + size];
+        if (block == nullptr) {
+            SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+            return false;
+        }
+
+        auto* const write = new (block) pipe_write{ OVERLAPPED{}, pooled };
+        if (size > 0)
+            std::memcpy(block + header_size, data, size);
+
+        server_.outstanding_.fetch_add(1, std::memory_order_relaxed);
+        if (WriteFile(pipe_.native_handle(), block + header_size, static_cast<DWORD>(size), nullptr, &write->overlapped) != FALSE)
+            return true;
+
+        auto const error = GetLastError();
+        if (error == ERROR_IO_PENDING)
+            return true;
+
+        server_.outstanding_.fetch_sub(1, std::memory_order_relaxed);
+        if (pooled)
+            server_.release_block(block);
+        else
+            delete[] block;
+        SetLastError(error);
+        return false;
+    }
+
+    bool named_pipe_connection::disconnect() noexcept
+    {
+        threading::shared_slim_lock guard{ lock_ };
+        return state_ == connection_state::connected &&
+            CancelIoEx(pipe_.native_handle(), &read_overlapped_) != FALSE;
+    }
+
+    std::uint64_t named_pipe_connection::id() const noexcept
+    {
+        return id_.load(std::memory_order_relaxed);
+    }
+
+    bool named_pipe_connection::is_connected() const noexcept
+    {
+        threading::shared_slim_lock guard{ lock_ };
+        return state_ == connection_state::connected;
+    }
+
+    named_pipe_connection::native_handle_type named_pipe_connection::native_handle() const noexcept
+    {
+        return pipe_.native_handle();
+    }
+
+    void named_pipe_connection::on_completion(threading::io_completion const& completion) noexcept
+    {
+        DWORD bytes_transferred{};
+        auto const error = GetOverlappedResult(pipe_.native_handle(), completion.overlapped, &bytes_transferred, FALSE) != FALSE
+            ? static_cast<DWORD>(ERROR_SUCCESS)
+            : GetLastError();
+
+        if (completion.overlapped == &connect_overlapped_) {
+            on_connect_completed(error);
+        } else if (completion.overlapped == &read_overlapped_) {
+            on_read_completed(error, bytes_transferred);
+        } else {
+            auto* const block = reinterpret_cast<std::byte*>(completion.overlapped);
+            if (reinterpret_cast<pipe_write const*>(block)->pooled)
+                server_.release_block(block);
+            else
+                delete[] block;
+        }
+
+        // the server waits for this count to reach zero before it is destroyed, nothing may be touched afterwards
+        server_.outstanding_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void named_pipe_connection::listen() noexcept
+    {
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            state_ = connection_state::listening;
+        }
+        id_.store(server_.next_id_.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        server_.listening_.fetch_add(1, std::memory_order_relaxed);
+
+        server_.outstanding_.fetch_add(1, std::memory_order_relaxed);
+        if (server_.stopping_) {
+            server_.outstanding_.fetch_sub(1, std::memory_order_relaxed);
+            on_connect_completed(ERROR_OPERATION_ABORTED);
+            return;
+        }
+
+        connect_overlapped_ = OVERLAPPED{};
+        // the completion is queued to the executor unless a client connected before the call
+        if (ConnectNamedPipe(pipe_.native_handle(), &connect_overlapped_) != FALSE)
+            return;
+
+        auto const error = GetLastError();
+        if (error == ERROR_IO_PENDING)
+            return;
+
+        server_.outstanding_.fetch_sub(1, std::memory_order_relaxed);
+        on_connect_completed(error == ERROR_PIPE_CONNECTED ? static_cast<DWORD>(ERROR_SUCCESS) : error);
+    }
+
+    void named_pipe_connection::on_connect_completed(DWORD const error) noexcept
+    {
+        auto const listening = server_.listening_.fetch_sub(1, std::memory_order_relaxed) - 1;
+
+        if (server_.stopping_ || (error != ERROR_SUCCESS && error != ERROR_NO_DATA)) {
+            if (error == ERROR_SUCCESS)
+                std::ignore = DisconnectNamedPipe(pipe_.native_handle());
+
+            threading::slim_lock_guard guard{ lock_ };
+            state_ = connection_state::closed;
+            return;
+        }
+
+        // the client closed its end before the connect completed, or no buffer could be taken for it
+        read_block_ = error == ERROR_SUCCESS
+            ? server_.acquire_block()
+            : nullptr;
+        if (read_block_ == nullptr) {
+            std::ignore = DisconnectNamedPipe(pipe_.native_handle());
+            listen();
+            return;
+        }
+
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            state_ = connection_state::connected;
+        }
+        server_.connected_.fetch_add(1, std::memory_order_relaxed);
+        if (listening < server_.options_.listening_instances)
+            server_.grow();
+
+        server_.handler_.on_connected(*this);
+        read_next();
+    }
+
+    void named_pipe_connection::on_read_completed(DWORD const error, DWORD const bytes_read) noexcept
+    {
+        if (error != ERROR_SUCCESS && error != ERROR_MORE_DATA) {
+            on_client_gone(error);
+            return;
+        }
+
+        // a message larger than the buffer is returned in pieces each ending with ERROR_MORE_DATA but the last
+        auto const* const data = read_buffer();
+        if (error == ERROR_MORE_DATA || !partial_message_.empty()) {
+            try {
+                partial_message_.insert(partial_message_.end(), data, data + bytes_read);
+            } catch (...) {
+                on_client_gone(ERROR_NOT_ENOUGH_MEMORY);
+                return;
+            }
+        }
+
+        if (error == ERROR_SUCCESS) {
+            if (partial_message_.empty()) {
+                server_.handler_.on_message(*this, data, bytes_read);
+            } else {
+                server_.handler_.on_message(*this, partial_message_.data(), partial_message_.size());
+                std::vector<std::byte>().swap(partial_message_);
+            }
+        }
+        read_next();
+    }
+
+    void named_pipe_connection::read_next() noexcept
+    {
+        if (server_.stopping_) {
+            on_client_gone(ERROR_OPERATION_ABORTED);
+            return;
+        }
+
+        read_overlapped_ = OVERLAPPED{};
+        server_.outstanding_.fetch_add(1, std::memory_order_relaxed);
+        // both a complete read and one ending with ERROR_MORE_DATA still queue a completion
+        if (ReadFile(pipe_.native_handle(), read_buffer(), server_.options_.buffer_size, nullptr, &read_overlapped_) != FALSE)
+            return;
+
+        auto const error = GetLastError();
+        if (error == ERROR_IO_PENDING || error == ERROR_MORE_DATA)
+            return;
+
+        server_.outstanding_.fetch_sub(1, std::memory_order_relaxed);
+        on_client_gone(error);
+    }
+
+    void named_pipe_connection::on_client_gone(DWORD const error) noexcept
+    {
+        // sends hold the lock shared so none can reach the next client once the state has changed
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            state_ = connection_state::closed;
+        }
+        std::ignore = DisconnectNamedPipe(pipe_.native_handle());
+        server_.release_block(read_block_);
+        read_block_ = nullptr;
+        std::vector<std::byte>().swap(partial_message_);
+
+        server_.connected_.fetch_sub(1, std::memory_order_relaxed);
+        server_.handler_.on_disconnected(*this, error);
+
+        if (!server_.stopping_)
+            listen();
+    }
+
+    std::byte* named_pipe_connection::read_buffer() const noexcept
+    {
+        return read_block_ + header_size;
+    }
+
+    named_pipe_server::named_pipe_server(std::wstring name, threading::io_completion_executor& executor, named_pipe_handler& handler,
+        named_pipe_server_options const& options)
+        : name_(std::move(name))
+        , executor_(executor)
+        , handler_(handler)
+        , options_(options)
+    {
+        options_.listening_instances = (std::max)(options_.listening_instances, std::size_t{ 1 });
+        if (options_.max_instances != PIPE_UNLIMITED_INSTANCES)
+            options_.listening_instances = (std::min)(options_.listening_instances, static_cast<std::size_t>(options_.max_instances));
+        block_size_ = header_size + options_.buffer_size;
+
+        try {
+            for (std::size_t index = 0; index < options_.listening_instances; ++index) {
+                add_instance(create_instance(index == 0));
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    named_pipe_server::~named_pipe_server()
+    {
+        stop();
+    }
+
+    std::wstring const& named_pipe_server::name() const noexcept
+    {
+        return name_;
+    }
+
+    std::size_t named_pipe_server::instance_count() const noexcept
+    {
+        threading::shared_slim_lock guard{ instances_lock_ };
+        return instances_.size();
+    }
+
+    std::size_t named_pipe_server::connected_count() const noexcept
+    {
+        return connected_.load(std::memory_order_relaxed);
+    }
+
+    invalid_handle named_pipe_server::create_instance(bool const first) const
+    {
+        invalid_handle pipe{ CreateNamedPipeW(name_.c_str(),
+            PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | (first ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0UL),
+            PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT | (options_.reject_remote_clients ? PIPE_REJECT_REMOTE_CLIENTS : PIPE_ACCEPT_REMOTE_CLIENTS),
+            options_.max_instances, options_.buffer_size, options_.buffer_size, 0UL, nullptr) };
+        if (!static_cast<bool>(pipe))
+            throw windows_exception();
+        return pipe;
+    }
+
+    void named_pipe_server::add_instance(invalid_handle&& pipe)
+    {
+        std::unique_ptr<named_pipe_connection> instance{ new named_pipe_connection(*this, std::move(pipe)) };
+        if (!executor_.associate(instance->native_handle(), *instance))
+            throw windows_exception();
+
+        auto& added = *instance;
+        {
+            threading::slim_lock_guard guard{ instances_lock_ };
+            if (stopping_)
+                return;
+            instances_.emplace_back(std::move(instance));
+        }
+        added.listen();
+    }
+
+    void named_pipe_server::grow() noexcept
+    {
+        {
+            threading::shared_slim_lock guard{ instances_lock_ };
+            if (stopping_ || (options_.max_instances != PIPE_UNLIMITED_INSTANCES && instances_.size() >= options_.max_instances))
+                return;
+        }
+
+        // failure leaves fewer instances listening, the next connect tries again
+        try {
+            add_instance(create_instance(false));
+        } catch (...) {
+        }
+    }
+
+    void named_pipe_server::stop() noexcept
+    {
+        stopping_ = true;
+
+        // cancelled repeatedly as an instance may be between checking stopping_ and starting its next operation
+        for (auto remaining = outstanding_.load(std::memory_order_acquire); remaining != 0; remaining = outstanding_.load(std::memory_order_acquire)) {
+            {
+                threading::shared_slim_lock guard{ instances_lock_ };
+                for (auto const& instance : instances_) {
+                    std::ignore = CancelIoEx(instance->native_handle(), nullptr);
+                }
+            }
+            std::ignore = threading::wait_on_address(outstanding_, remaining, std::chrono::milliseconds(1));
+        }
+
+        threading::slim_lock_guard guard{ pool_lock_ };
+        for (auto* const block : free_blocks_) {
+            delete[] block;
+        }
+        free_blocks_.clear();
+    }
+
+    std::byte* named_pipe_server::acquire_block() noexcept
+    {
+        {
+            threading::slim_lock_guard guard{ pool_lock_ };
+            if (!free_blocks_.empty()) {
+                auto* const block = free_blocks_.back();
+                free_blocks_.pop_back();
+                return block;
+            }
+        }
+        return new (std::nothrow) std::byte[block_size_];
+    }
+
+    void named_pipe_server::release_block(std::byte* const block) noexcept
+    {
+        if (block == nullptr)
+            return;
+
+        try {
+            threading::slim_lock_guard guard{ pool_lock_ };
+            if (!stopping_ && free_blocks_.size() < options_.max_pooled_buffers) {
+                free_blocks_.push_back(block);
+                return;
+            }
+        } catch (...) {
+        }
+        delete[] block;
+    }
+
+}
@@ -0,0 +1,87 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/numa.h>
+#include <modern_win32/threading/thread.h>
+#include <modern_win32/windows_exception.h>
+
+namespace modern_win32
+{
+    std::optional<DWORD> highest_numa_node() noexcept
+    {
+        ULONG highest{};
+        if (GetNumaHighestNodeNumber(&highest) == FALSE)
+            return std::nullopt;
+        return highest;
+    }
+
+    std::vector<DWORD> get_numa_nodes()
+    {
+        std::vector<DWORD> nodes;
+        auto const highest = highest_numa_node();
+        if (!highest.has_value())
+            return nodes;
+
+        // node numbers may be sparse, nodes without processors are skipped
+        for (DWORD node = 0; node <= highest.value(); ++node) {
+            if (auto const affinity = get_numa_node_affinity(node); affinity.has_value() && !affinity.value().empty())
+                nodes.push_back(node);
+        }
+        return nodes;
+    }
+
+    std::optional<threading::group_affinity> get_numa_node_affinity(DWORD const node) noexcept
+    {
+        GROUP_AFFINITY affinity{};
+        if (GetNumaNodeProcessorMaskEx(static_cast<USHORT>(node), &affinity) == FALSE)
+            return std::nullopt;
+        return threading::group_affinity{ affinity.Group, affinity.Mask };
+    }
+
+    std::optional<std::uint64_t> get_numa_node_available_memory(DWORD const node) noexcept
+    {
+        ULONGLONG available{};
+        if (GetNumaAvailableMemoryNodeEx(static_cast<USHORT>(node), &available) == FALSE)
+            return std::nullopt;
+        return available;
+    }
+
+    std::optional<DWORD> current_numa_node() noexcept
+    {
+        PROCESSOR_NUMBER processor{};
+        GetCurrentProcessorNumberEx(&processor);
+        USHORT node{};
+        if (GetNumaProcessorNodeEx(&processor, &node) == FALSE)
+            return std::nullopt;
+        return node;
+    }
+
+    bool bind_current_thread_to_numa_node(DWORD const node) noexcept
+    {
+        return threading::set_thread_numa_node(GetCurrentThread(), node);
+    }
+
+    virtual_memory_handle allocate_on_numa_node(std::size_t const size, DWORD const node) noexcept
+    {
+        return virtual_memory_handle(VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node));
+    }
+
+    virtual_arena make_numa_local_arena(std::size_t const reserve_size, arena_page_size const page_size, std::size_t const commit_size)
+    {
+        auto const node = current_numa_node();
+        if (!node.has_value())
+            throw windows_exception();
+        return virtual_arena(reserve_size, page_size, commit_size, node);
+    }
+
+}
@@ -0,0 +1,73 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/private_heap.h>
+#include <modern_win32/windows_exception.h>
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        bool has_option(heap_options const options, heap_options const option) noexcept
+        {
+            return (static_cast<DWORD>(options) & static_cast<DWORD>(option)) != 0U;
+        }
+    }
+
+    private_heap::private_heap(heap_options const options, std::size_t const initial_size, std::size_t const maximum_size)
+        : handle_{ HeapCreate(static_cast<DWORD>(options), initial_size, maximum_size) }
+    {
+        if (!static_cast<bool>(handle_))
+            throw windows_exception();
+
+        // fixed size heaps and those without serialization cannot use the low fragmentation heap, failing to enable it
+        // only costs fragmentation so is not treated as an error
+        if (maximum_size == 0 && !has_option(options, heap_options::no_serialize)) {
+            ULONG low_fragmentation_heap = 2;
+            static_cast<void>(HeapSetInformation(handle_.native_handle(), HeapCompatibilityInformation, &low_fragmentation_heap, sizeof(low_fragmentation_heap)));
+        }
+    }
+
+    void* private_heap::allocate(std::size_t const size) const noexcept
+    {
+        return HeapAlloc(handle_.native_handle(), 0, size);
+    }
+
+    void private_heap::free(void* const memory) const noexcept
+    {
+        if (memory != nullptr)
+            static_cast<void>(HeapFree(handle_.native_handle(), 0, memory));
+    }
+
+    heap_deleter private_heap::get_deleter() const noexcept
+    {
+        return heap_deleter(handle_.native_handle());
+    }
+
+    std::size_t private_heap::compact() const noexcept
+    {
+        return HeapCompact(handle_.native_handle(), 0);
+    }
+
+    private_heap::operator bool() const noexcept
+    {
+        return static_cast<bool>(handle_);
+    }
+
+    private_heap::native_handle_type private_heap::native_handle() const noexcept
+    {
+        return handle_.native_handle();
+    }
+
+}
@@ -11,14 +11,17 @@
 // WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 // 
 
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
+#include <utility>
 #include <vector>
 #include <modern_win32/access_denied_exception.h>
 #include <modern_win32/process.h>
 #include <modern_win32/process_enums.h>
 #include <modern_win32/process_startup_info.h>
 #include <modern_win32/shared_utilities.h>
+#include <modern_win32/tracing.h>
 #include <modern_win32/wait_for.h>
 #include <modern_win32/windows_error.h>
 #include <modern_win32/shared_utilities.h>
@@ -29,12 +32,68 @@
 namespace modern_win32
 {
 
+    class process::query_lease final
+    {
+    public:
+        explicit query_lease(process_handle const& owned) noexcept
+            : handle_{ &owned }
+        {
+        }
+        explicit query_lease(process_handle&& temporary) noexcept
+            : temporary_{ std::move(temporary) }
+        {
+        }
+        query_lease(process_handle const& cached, threading::shared_slim_lock&& lock) noexcept
+            : handle_{ &cached }
+            , lock_{ std::move(lock) }
+        {
+        }
+        query_lease(query_lease const&) = delete;
+        query_lease(query_lease&&) noexcept = delete;
+        ~query_lease() = default;
+        query_lease& operator=(query_lease const&) = delete;
+        query_lease& operator=(query_lease&&) noexcept = delete;
+
+        [[nodiscard]]
+        process_handle const& handle() const noexcept
+        {
+            return *handle_;
+        }
+
+        [[nodiscard]]
+        bool is_cached() const noexcept
+        {
+            return lock_.owns_lock();
+        }
+
+        void unlock() noexcept
+        {
+            if (lock_.owns_lock())
+                lock_.unlock();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(*handle_);
+        }
+
+    private:
+        process_handle temporary_{};
+        process_handle const* handle_{ &temporary_ };
+        threading::shared_slim_lock lock_{};
+    };
+
     process::process(process_id_type const& id)
         : id_{id}
     {
         if (id == 0UL)
             throw std::invalid_argument("id cannot be 0");
     }
+    process::process(process_id_type const& id, process_handle_policy const handle_policy)
+        : process(id)
+    {
+        handle_policy_ = handle_policy;
+    }
     process::process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles)
         : process(id)
     {
@@ -64,6 +123,9 @@ namespace modern_win32
     {
     }
     process::process(process&& other) noexcept
+        : cached_handle_{ other.cached_handle_.release() }
+        , cached_exit_code_{ std::exchange(other.cached_exit_code_, std::nullopt) }
+        , handle_policy_{ other.handle_policy_ }
     {
         auto [id, handle] = other.release();
         id_ = id;
@@ -76,6 +138,9 @@ namespace modern_win32
             return *this;
 
         static_cast<void>(handle_.reset(other.handle_.release()));
+        static_cast<void>(cached_handle_.reset(other.cached_handle_.release()));
+        cached_exit_code_ = std::exchange(other.cached_exit_code_, std::nullopt);
+        handle_policy_ = other.handle_policy_;
         id_ = other.id_;
         other.id_ = 0;
 
@@ -95,17 +160,20 @@ namespace modern_win32
     {
         if (static_cast<bool>(handle_))
             return true;
-        if (id_ != 0UL) {
-            return static_cast<bool>(impl::get_process_handle(id_, combine(process_access_rights::process_query_information, process_access_rights::synchronize)));
-        }
-        return false;
+        if (id_ == 0UL || recorded_exit_code().has_value())
+            return false;
+
+        return static_cast<bool>(query_handle());
     }
 
     void swap(process& first, process& second) noexcept
     {
         using std::swap;
         swap(first.handle_, second.handle_);
+        swap(first.cached_handle_, second.cached_handle_);
+        swap(first.cached_exit_code_, second.cached_exit_code_);
         swap(first.id_, second.id_);
+        swap(first.handle_policy_, second.handle_policy_);
     }
 
     bool process::reset(deconstruct_type const& process)
@@ -134,6 +202,8 @@ namespace modern_win32
     {
         process_id_type id{};
         std::swap(id_, id);
+        static_cast<void>(cached_handle_.reset());
+        cached_exit_code_.reset();
         return make_deconstruct_type(id, handle_.release());
     }
 
@@ -147,6 +217,11 @@ namespace modern_win32
         return handle_;
     }
 
+    process_handle_policy process::handle_policy() const noexcept
+    {
+        return handle_policy_;
+    }
+
     std::optional<process_id_type> process::get_process_id() const
     {
         return id_;
@@ -154,11 +229,16 @@ namespace modern_win32
 
     bool process::is_running() const
     {
-        if (!static_cast<bool>(*this))
+        if (recorded_exit_code().has_value())
             return false;
 
-        auto const [isRunning, exit_code] = impl::get_running_details(handle_);
-        static_cast<void>(exit_code);
+        auto lease = query_handle();
+        if (!static_cast<bool>(lease))
+            return false;
+
+        auto const [isRunning, exit_code] = impl::get_running_details(lease.handle());
+        if (!isRunning)
+            record_exit(lease, exit_code);
         return isRunning;
     }
 
@@ -170,57 +250,159 @@ namespace modern_win32
 
     std::optional<process_priority> process::get_priority() const
     {
-        if (!static_cast<bool>(*this))
+        if (recorded_exit_code().has_value())
             return std::nullopt;
 
-        if (static_cast<bool>(handle_))
-            return impl::get_process_priority(handle_);
-
-        auto const handle = impl::get_process_handle(id_, process_access_rights::process_query_information);
-        return impl::get_process_priority(handle);
+        auto const lease = query_handle();
+        return impl::get_process_priority(lease.handle());
     }
 
     std::optional<process::exit_code_type> process::get_exit_code() const
     {
-        if (!static_cast<bool>(handle_))
+        if (auto const recorded = recorded_exit_code(); recorded.has_value())
+            return recorded;
+
+        auto lease = query_handle();
+        if (!static_cast<bool>(lease))
+            // another query may have recorded the exit and closed the cached handle since the check above
+            return recorded_exit_code();
+
+        auto const [isRunning, exit_code] = impl::get_running_details(lease.handle().native_handle());
+        if (isRunning)
             return std::nullopt;
 
-        auto const [isRunning, exit_code] = impl::get_running_details(handle_.native_handle());
-        return isRunning
-            ? std::nullopt
-            : std::optional(exit_code);
+        record_exit(lease, exit_code);
+        return std::optional(exit_code);
     }
 
-    void process::wait_for_exit() const
+    std::optional<process_sample> process::sample() const noexcept
     {
-        if (!static_cast<bool>(*this))
-            return;
+        auto const lease = query_handle();
+        if (!static_cast<bool>(lease))
+            return std::nullopt;
 
-        if (static_cast<bool>(handle_)) {
-            impl::wait_for_exit(handle_);
-            return;
+        auto const native_handle = lease.handle().native_handle();
+        auto const to_duration = [](FILETIME const& time) {
+            return process_time_duration((static_cast<std::int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime);
+        };
+
+        process_sample sample{};
+        sample.sampled_at = std::chrono::steady_clock::now();
+
+        FILETIME create_time{};
+        FILETIME exit_time{};
+        FILETIME kernel_time{};
+        FILETIME user_time{};
+        if (GetProcessTimes(native_handle, &create_time, &exit_time, &kernel_time, &user_time) == FALSE)
+            return std::nullopt;
+        sample.kernel_time = to_duration(kernel_time);
+        sample.user_time = to_duration(user_time);
+
+        ULONG64 cycle_time{};
+        if (QueryProcessCycleTime(native_handle, &cycle_time) == TRUE)
+            sample.cycle_time = cycle_time;
+
+        PROCESS_MEMORY_COUNTERS_EX memory{};
+        memory.cb = sizeof(memory);
+        if (GetProcessMemoryInfo(native_handle, reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&memory), sizeof(memory)) == TRUE) {
+            sample.working_set_bytes = memory.WorkingSetSize;
+            sample.peak_working_set_bytes = memory.PeakWorkingSetSize;
+            sample.private_bytes = memory.PrivateUsage;
+            sample.pagefile_bytes = memory.PagefileUsage;
+            sample.page_fault_count = memory.PageFaultCount;
         }
 
-        static_cast<void>(wait_one(handle_));
+        IO_COUNTERS io{};
+        if (GetProcessIoCounters(native_handle, &io) == TRUE) {
+            sample.read_operation_count = io.ReadOperationCount;
+            sample.write_operation_count = io.WriteOperationCount;
+            sample.other_operation_count = io.OtherOperationCount;
+            sample.read_transfer_bytes = io.ReadTransferCount;
+            sample.write_transfer_bytes = io.WriteTransferCount;
+            sample.other_transfer_bytes = io.OtherTransferCount;
+        }
+
+        DWORD handle_count{};
+        if (GetProcessHandleCount(native_handle, &handle_count) == TRUE)
+            sample.handle_count = handle_count;
+
+        return sample;
+    }
+
+    void process::wait_for_exit() const
+    {
+        if (recorded_exit_code().has_value())
+            return;
+
+        if (auto const lease = query_handle(); static_cast<bool>(lease))
+            impl::wait_for_exit(lease.handle());
     }
 
     bool process::wait_for_exit(std::chrono::milliseconds const& timeout) const 
     {
-        if (!static_cast<bool>(*this))
+        if (recorded_exit_code().has_value())
             return true;
 
-        if (static_cast<bool>(handle_))
-            return impl::wait_for_exit(handle_, timeout);
+        auto const lease = query_handle();
+        if (!static_cast<bool>(lease))
+            return true;
 
-        auto const handle = impl::get_process_handle(id_, combine(process_access_rights::process_query_information, process_access_rights::synchronize));
-        return impl::wait_for_exit(handle, timeout);
+        return impl::wait_for_exit(lease.handle(), timeout);
     }
 
     void process::close() noexcept
     {
-        if (*this)
-            static_cast<void>(handle_.reset());
+        static_cast<void>(handle_.reset());
+        static_cast<void>(cached_handle_.reset());
+        cached_exit_code_.reset();
+    }
+
+    process::query_lease process::query_handle() const noexcept
+    {
+        if (static_cast<bool>(handle_) || id_ == 0UL)
+            return query_lease{ handle_ };
+
+        // the union of the rights required by every query, so a cached handle serves all of them
+        auto const rights = combine(process_access_rights::process_query_information, process_access_rights::synchronize);
+        if (handle_policy_ != process_handle_policy::cached)
+            return query_lease{ impl::get_process_handle(id_, rights) };
+
+        // the cached handle is only opened or closed under the exclusive lock, and every query holds the shared
+        // lock while using it so it can't be closed, and its value recycled, part way through a query
+        threading::shared_slim_lock lock{ cache_lock_ };
+        if (!static_cast<bool>(cached_handle_) && !cached_exit_code_.has_value()) {
+            lock.unlock();
+            {
+                threading::slim_lock_guard guard{ cache_lock_ };
+                if (!static_cast<bool>(cached_handle_) && !cached_exit_code_.has_value())
+                    static_cast<void>(cached_handle_.reset(impl::get_process_handle(id_, rights).release()));
+            }
+            lock.lock();
+        }
+        return query_lease{ cached_handle_, std::move(lock) };
+    }
+
+    void process::record_exit(query_lease& lease, exit_code_type const exit_code) const noexcept
+    {
+        // an owned or temporary handle makes no promise about later queries, only the cached handle is replaced
+        if (!lease.is_cached())
+            return;
 
+        lease.unlock();
+        threading::slim_lock_guard guard{ cache_lock_ };
+        if (cached_exit_code_.has_value())
+            return;
+
+        cached_exit_code_ = exit_code;
+        if (tracing::is_enabled(tracing::keyword::process))
+            tracing::process_exited(id_, exit_code, cached_handle_.native_handle());
+        static_cast<void>(cached_handle_.reset());
+    }
+
+    std::optional<process::exit_code_type> process::recorded_exit_code() const noexcept
+    {
+        threading::shared_slim_lock lock{ cache_lock_ };
+        return cached_exit_code_;
     }
 
     process_module process::get_primary_module() const
@@ -249,21 +431,74 @@ namespace modern_win32
             throw windows_exception(ERROR_PROC_NOT_FOUND); // maybe a better choice here, ideally this should never happen, 
         }
 
-        for (DWORD index = 0ULL, upper_bound = bytes_required / sizeof(HMODULE); index < upper_bound; index++) {
+        // bytes_required is the size needed for every module, which may be more than was retrieved
+        for (DWORD index = 0ULL, upper_bound = (std::min)(bytes_required / static_cast<DWORD>(sizeof(HMODULE)), max_count); index < upper_bound; index++) {
             modules.emplace_back(handle_.native_handle(), module_handles[static_cast<size_t>(index)]);
         }
 
         return modules;
     }
 
-    process open_process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles)
+    std::vector<process_module> process::enumerate_modules(bool const include_information) const
     {
-        process process{id, access_rights, inherit_handles};
+        if (!static_cast<bool>(handle_)) {
+            throw windows_exception(ERROR_PROC_NOT_FOUND);
+        }
 
-        if (static_cast<bool>(process))
-            return process;
+        std::vector<HMODULE> module_handles(256);
+        DWORD bytes_required{};
+        for (;;) {
+            auto const bytes_available = static_cast<DWORD>(module_handles.size() * sizeof(HMODULE));
+            if (EnumProcessModules(handle_.native_handle(), module_handles.data(), bytes_available, &bytes_required) == 0) {
+                throw windows_exception();
+            }
+            if (bytes_required <= bytes_available) {
+                break;
+            }
+            // modules may be loaded between calls so allow some headroom
+            module_handles.resize(bytes_required / sizeof(HMODULE) + 32);
+        }
+        module_handles.resize(bytes_required / sizeof(HMODULE));
 
-        windows_error_details const error{};
+        std::vector<process_module> modules;
+        modules.reserve(module_handles.size());
+        for (auto const module : module_handles) {
+            if (!include_information) {
+                modules.emplace_back(handle_.native_handle(), module);
+                continue;
+            }
+
+            MODULEINFO native{};
+            if (GetModuleInformation(handle_.native_handle(), module, &native, sizeof(native)) == FALSE) {
+                // unloaded since enumeration, information is retried on first use
+                modules.emplace_back(handle_.native_handle(), module);
+                continue;
+            }
+            modules.emplace_back(handle_.native_handle(), module,
+                module_information{ native.lpBaseOfDll, static_cast<std::size_t>(native.SizeOfImage), native.EntryPoint });
+        }
+
+        return modules;
+    }
+
+    windows_result<process> try_open_process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles) noexcept
+    {
+        if (id == 0UL)
+            return windows_error_details(windows_error::error_invalid_parameter);
+
+        auto handle = impl::get_process_handle(id, access_rights, inherit_handles);
+        if (!static_cast<bool>(handle))
+            return windows_error_details();
+        return process(id, handle.release());
+    }
+
+    process open_process(process_id_type const& id, process_access_rights const access_rights, bool const inherit_handles)
+    {
+        auto opened = try_open_process(id, access_rights, inherit_handles);
+        if (opened.has_value())
+            return std::move(*opened);
+
+        auto const error = opened.error();
         switch (error) {  // NOLINT(clang-diagnostic-switch-enum)
         case windows_error::error_invalid_parameter:
             throw std::invalid_argument("invalid process id");
@@ -274,6 +509,42 @@ namespace modern_win32
         }
     }
 
+    process_sample_rates sample_rates(process_sample const& earlier, process_sample const& later, std::uint32_t processor_count) noexcept
+    {
+        using seconds = std::chrono::duration<double>;
+        auto const elapsed = std::chrono::duration_cast<seconds>(later.sampled_at - earlier.sampled_at).count();
+        if (elapsed <= 0.0)
+            return process_sample_rates{};
+
+        if (processor_count == 0U)
+            processor_count = (std::max)(1UL, GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+
+        // counters only increase for a given process, a decrease means the samples are from different processes
+        auto const per_second = [elapsed](std::uint64_t const first, std::uint64_t const second) {
+            return second > first
+                ? static_cast<double>(second - first) / elapsed
+                : 0.0;
+        };
+
+        auto const cpu_time = (later.user_time + later.kernel_time) - (earlier.user_time + earlier.kernel_time);
+        auto const cpu_processors = cpu_time.count() > 0
+            ? std::chrono::duration_cast<seconds>(cpu_time).count() / elapsed
+            : 0.0;
+
+        process_sample_rates rates{};
+        rates.cpu_processors = cpu_processors;
+        rates.cpu_percent = cpu_processors * 100.0 / static_cast<double>(processor_count);
+        rates.cycles_per_second = per_second(earlier.cycle_time, later.cycle_time);
+        rates.page_faults_per_second = per_second(earlier.page_fault_count, later.page_fault_count);
+        rates.read_operations_per_second = per_second(earlier.read_operation_count, later.read_operation_count);
+        rates.write_operations_per_second = per_second(earlier.write_operation_count, later.write_operation_count);
+        rates.other_operations_per_second = per_second(earlier.other_operation_count, later.other_operation_count);
+        rates.read_bytes_per_second = per_second(earlier.read_transfer_bytes, later.read_transfer_bytes);
+        rates.write_bytes_per_second = per_second(earlier.write_transfer_bytes, later.write_transfer_bytes);
+        rates.other_bytes_per_second = per_second(earlier.other_transfer_bytes, later.other_transfer_bytes);
+        return rates;
+    }
+
 process start_process(narrow_process_startup_info const& startup_info)
 {
     return impl::start_process<char>(startup_info);
@@ -283,6 +554,15 @@ process start_process(wide_process_startup_info const& startup_info)
     return impl::start_process<wchar_t>(startup_info);
 }
 
+windows_result<process> try_start_process(narrow_process_startup_info const& startup_info)
+{
+    return impl::try_start_process<char>(startup_info);
+}
+windows_result<process> try_start_process(wide_process_startup_info const& startup_info)
+{
+    return impl::try_start_process<wchar_t>(startup_info);
+}
+
 process start_process(char const* filename, char const* arguments)
 {
     auto const startup_info = narrow_process_startup_info_builder()
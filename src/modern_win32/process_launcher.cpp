@@ -0,0 +1,103 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/metrics.h>
+#include <modern_win32/process_launcher.h>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/windows_exception.h>
+
+#include "impl/process_impl.h"
+
+namespace modern_win32
+{
+    template <typename TCHAR>
+    process_launcher<TCHAR>::process_launcher(process_startup_info<TCHAR> const& startup_info)
+        : executable_(startup_info.filename)
+        , default_arguments_(startup_info.arguments)
+        , directory_(startup_info.directory)
+        , environment_block_(impl::build_environment_block<TCHAR>(startup_info.environment))
+        , native_startup_info_(startup_info.template build_native_startup_info<native_startup_info_type>())
+        , creation_options_(startup_info.build_creation_options())
+        , inherit_handles_(startup_info.inherit_handles)
+    {
+        if (!exists(executable_))
+            throw std::filesystem::filesystem_error("filename not found", std::error_code(static_cast<int>(windows_error::error_file_not_found), std::iostream_category()));
+
+        executable_ = absolute(executable_);
+        if constexpr (std::is_same_v<TCHAR, wchar_t>)
+            application_name_ = executable_.wstring();
+        else
+            application_name_ = executable_.string();
+
+        if (auto const* const prebuilt = startup_info.get_environment_block(); prebuilt != nullptr && prebuilt->data() != nullptr)
+            environment_block_.assign(prebuilt->data(), prebuilt->data() + prebuilt->block_size());
+
+        command_prefix_ = startup_info.filename;
+        command_prefix_.push_back(TCHAR(' '));
+    }
+
+    template <typename TCHAR>
+    process process_launcher<TCHAR>::launch() const
+    {
+        return launch(default_arguments_);
+    }
+
+    template <typename TCHAR>
+    process process_launcher<TCHAR>::launch(string_view_type const arguments) const
+    {
+        // CreateProcessW may modify the command line so each thread gets its own, kept to reuse its capacity
+        thread_local std::vector<TCHAR> command_line{};
+        command_line.clear();
+        command_line.insert(command_line.end(), command_prefix_.begin(), command_prefix_.end());
+        command_line.insert(command_line.end(), arguments.begin(), arguments.end());
+        command_line.push_back(TCHAR(0));
+
+        // CreateProcess only reads the environment block, so it is shared by every launch
+        auto* const environment = environment_block_.empty()
+            ? nullptr
+            : static_cast<void*>(const_cast<TCHAR*>(environment_block_.data()));
+        auto* const directory = directory_.empty() ? nullptr : directory_.c_str();
+        auto startup_info = native_startup_info_;
+        PROCESS_INFORMATION process_information{};
+
+        auto const started = metrics::metrics_enabled ? qpc_clock::ticks() : 0LL;
+        BOOL created;
+        if constexpr (std::is_same_v<TCHAR, wchar_t>)
+            created = CreateProcessW(application_name_.c_str(), command_line.data(), nullptr, nullptr, inherit_handles_ ? TRUE : FALSE,
+                to_underlying_type(creation_options_), environment, directory, &startup_info, &process_information);
+        else
+            created = CreateProcessA(application_name_.c_str(), command_line.data(), nullptr, nullptr, inherit_handles_ ? TRUE : FALSE,
+                to_underlying_type(creation_options_), environment, directory, &startup_info, &process_information);
+        if (created == FALSE) {
+            windows_exception const error{};
+            if constexpr (metrics::metrics_enabled)
+                metrics::library().process_launch_failures.add();
+            throw error;
+        }
+        if constexpr (metrics::metrics_enabled)
+            metrics::library().process_launch.record(qpc_clock::to_duration(qpc_clock::ticks() - started));
+
+        CloseHandle(process_information.hThread);
+        return process(process_information.dwProcessId, process_information.hProcess);
+    }
+
+    template <typename TCHAR>
+    std::filesystem::path const& process_launcher<TCHAR>::executable() const noexcept
+    {
+        return executable_;
+    }
+
+    template class MODERN_WIN32_EXPORT process_launcher<char>;
+    template class MODERN_WIN32_EXPORT process_launcher<wchar_t>;
+
+}
@@ -0,0 +1,197 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/process_memory.h>
+#include <modern_win32/shared_utilities.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+namespace modern_win32
+{
+    namespace
+    {
+        constexpr auto memory_rights = combine(process_access_rights::process_vm_read, process_access_rights::process_query_information);
+
+        [[nodiscard]]
+        process_handle open_for_memory(process_id_type const id)
+        {
+            process_handle handle{ OpenProcess(to_underlying_type(memory_rights), FALSE, id) };
+            if (!static_cast<bool>(handle))
+                throw windows_exception();
+            return handle;
+        }
+
+        [[nodiscard]]
+        process_handle duplicate_for_memory(process const& target)
+        {
+            if (target.native_handle() == process_handle::invalid()) {
+                auto const id = target.get_process_id().value_or(0UL);
+                if (id == 0UL)
+                    throw std::invalid_argument("target has neither a handle nor an id");
+                return open_for_memory(id);
+            }
+
+            HANDLE duplicate{};
+            if (DuplicateHandle(GetCurrentProcess(), target.native_handle(), GetCurrentProcess(), &duplicate, 0UL, FALSE, DUPLICATE_SAME_ACCESS) == FALSE)
+                throw windows_exception();
+            return process_handle{ duplicate };
+        }
+    }
+
+    process_memory::process_memory(process const& target)
+        : handle_{ duplicate_for_memory(target) }
+    {
+    }
+
+    process_memory::process_memory(process_id_type const id)
+        : handle_{ open_for_memory(id) }
+    {
+    }
+
+    std::vector<memory_region> const& process_memory::regions() const
+    {
+        if (regions_.has_value())
+            return regions_.value();
+        return refresh_regions();
+    }
+
+    std::vector<memory_region> const& process_memory::refresh_regions() const
+    {
+        std::vector<memory_region> regions{};
+        if (regions_.has_value()) {
+            regions.reserve(regions_->size());
+        }
+
+        MEMORY_BASIC_INFORMATION information{};
+        std::uintptr_t address{};
+        while (VirtualQueryEx(handle_.native_handle(), reinterpret_cast<void const*>(address), &information, sizeof(information)) == sizeof(information)) {
+            auto const base = reinterpret_cast<std::uintptr_t>(information.BaseAddress);
+            if (information.State != MEM_FREE)
+                regions.push_back(memory_region{ base, information.RegionSize, information.State, information.Protect, information.Type });
+
+            auto const next = base + information.RegionSize;
+            if (next <= address)
+                break;
+            address = next;
+        }
+
+        regions_ = std::move(regions);
+        return regions_.value();
+    }
+
+    std::optional<memory_region> process_memory::find_region(std::uintptr_t const address) const
+    {
+        auto const& all = regions();
+        auto const after = std::upper_bound(all.begin(), all.end(), address,
+            [](std::uintptr_t const value, memory_region const& region) { return value < region.base_address; });
+        if (after == all.begin())
+            return std::nullopt;
+
+        auto const& candidate = *std::prev(after);
+        return candidate.contains(address)
+            ? std::optional(candidate)
+            : std::nullopt;
+    }
+
+    std::size_t process_memory::read(std::uintptr_t const address, void* const buffer, std::size_t const size) const noexcept
+    {
+        if (size == 0U)
+            return 0U;
+
+        // a partial copy still reports the bytes read before the inaccessible page
+        SIZE_T bytes_read{};
+        static_cast<void>(ReadProcessMemory(handle_.native_handle(), reinterpret_cast<void const*>(address), buffer, size, &bytes_read));
+        return bytes_read;
+    }
+
+    std::size_t process_memory::read_scatter(memory_read_request* const requests, std::size_t const count) const
+    {
+        if (count == 0U)
+            return 0U;
+
+        thread_local std::vector<memory_read_request*> ordered{};
+        thread_local std::vector<char> span{};
+        ordered.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            requests[i].bytes_read = 0U;
+            if (requests[i].size > 0U)
+                ordered.push_back(&requests[i]);
+        }
+        std::sort(ordered.begin(), ordered.end(),
+            [](memory_read_request const* const first, memory_read_request const* const second) { return first->address < second->address; });
+
+        std::size_t completed = count - ordered.size();
+        for (auto first = ordered.begin(); first != ordered.end();) {
+            auto const span_begin = (*first)->address;
+            auto span_end = span_begin + (*first)->size;
+
+            // extend the span while the next request starts within it, or within a page of it, and the span stays bounded
+            auto last = std::next(first);
+            for (; last != ordered.end(); ++last) {
+                auto const next_end = (*last)->address + (*last)->size;
+                if ((*last)->address > span_end + 4096U || (std::max)(span_end, next_end) - span_begin > max_coalesced_read)
+                    break;
+                span_end = (std::max)(span_end, next_end);
+            }
+
+            if (std::distance(first, last) == 1) {
+                completed += read_individually(&*first, &*first + 1);
+                first = last;
+                continue;
+            }
+
+            auto const span_size = static_cast<std::size_t>(span_end - span_begin);
+            span.resize((std::max)(span.size(), span_size));
+            if (read(span_begin, span.data(), span_size) == span_size) {
+                for (auto current = first; current != last; ++current) {
+                    auto& request = **current;
+                    std::memcpy(request.destination, span.data() + (request.address - span_begin), request.size);
+                    request.bytes_read = request.size;
+                }
+                completed += static_cast<std::size_t>(std::distance(first, last));
+            } else {
+                // part of the span is unreadable, which may be in a gap between requests
+                completed += read_individually(&*first, &*first + std::distance(first, last));
+            }
+            first = last;
+        }
+        return completed;
+    }
+
+    process_handle::native_handle_type process_memory::native_handle() const noexcept
+    {
+        return handle_.native_handle();
+    }
+
+    std::size_t process_memory::read_individually(memory_read_request* const* first, memory_read_request* const* const last) const noexcept
+    {
+        std::size_t completed{};
+        for (; first != last; ++first) {
+            auto& request = **first;
+            request.bytes_read = read(request.address, request.destination, request.size);
+            if (request.bytes_read == request.size)
+                ++completed;
+        }
+        return completed;
+    }
+
+    process_memory process::memory() const
+    {
+        return process_memory(*this);
+    }
+
+}
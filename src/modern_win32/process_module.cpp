@@ -13,42 +13,70 @@
 
 #include "modern_win32/process_module.h"
 #include <Psapi.h>
-#include <memory>
+#include <algorithm>
+#include <string>
 
 namespace modern_win32
 {
-
-    [[nodiscard]]
-    std::wstring get_module_filename(HANDLE process, HMODULE module, DWORD size) 
+    namespace
     {
+        // longest path supported by the module APIs, including the terminator
+        constexpr DWORD max_module_path = 32768UL;
 
-        auto buffer = std::make_unique<WCHAR[]>(size);
-        auto const length = GetModuleFileNameExW(process, module, buffer.get(), size - 1);
-        if (length == 0) {
-            throw windows_exception();
+        /// <summary>
+        /// calls <paramref name="query"/> with a growing buffer until the result is no longer truncated, the module
+        /// APIs truncate silently so a result filling the buffer is treated as truncated
+        /// </summary>
+        template <typename QUERY>
+        [[nodiscard]]
+        std::wstring query_module_string(QUERY query)
+        {
+            std::wstring buffer(MAX_PATH + 1, L'\0');
+            for (;;) {
+                auto const size = static_cast<DWORD>(buffer.size());
+                auto const length = query(buffer.data(), size);
+                if (length == 0) {
+                    throw windows_exception();
+                }
+                if (length < size - 1 || size >= max_module_path) {
+                    buffer.resize(length);
+                    return buffer;
+                }
+                buffer.resize((std::min)(static_cast<std::size_t>(size) * 2, static_cast<std::size_t>(max_module_path)));
+            }
         }
+    }
 
-        if (length >= size) {
-            buffer.reset();
-            return get_module_filename(process, module, length + 1);
+    std::wstring const& process_module::get_name() const
+    {
+        if (!name_.has_value()) {
+            name_ = query_module_string([this](LPWSTR const buffer, DWORD const size) {
+                return GetModuleBaseNameW(process_, module_, buffer, size);
+            });
         }
-        return std::wstring(buffer.get());
+        return name_.value();
     }
 
-    std::wstring process_module::get_name() const
+    std::wstring const& process_module::get_filename() const
     {
-        WCHAR name[MAX_PATH + 1]{};
-        if (auto const result = GetModuleBaseNameW(process_, module_, name, MAX_PATH);
-            result == 0) {
-            throw windows_exception();
+        if (!filename_.has_value()) {
+            filename_ = query_module_string([this](LPWSTR const buffer, DWORD const size) {
+                return GetModuleFileNameExW(process_, module_, buffer, size);
+            });
         }
-
-        return name;
+        return filename_.value();
     }
 
-    std::wstring process_module::get_filename() const
+    module_information const& process_module::get_information() const
     {
-        return get_module_filename(process_, module_, MAX_PATH + 1);
+        if (!information_.has_value()) {
+            MODULEINFO native{};
+            if (GetModuleInformation(process_, module_, &native, sizeof(native)) == FALSE) {
+                throw windows_exception();
+            }
+            information_ = module_information{ native.lpBaseOfDll, static_cast<std::size_t>(native.SizeOfImage), native.EntryPoint };
+        }
+        return information_.value();
     }
 
     process_module::process_module(native_process_handle_type process, native_module_handle_type module)
@@ -57,5 +85,12 @@ namespace modern_win32
     {
     }
 
+    process_module::process_module(native_process_handle_type process, native_module_handle_type module, module_information const& information)
+        : process_{ process }
+        , module_{ module }
+        , information_{ information }
+    {
+    }
+
 
 }
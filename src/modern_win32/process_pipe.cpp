@@ -0,0 +1,167 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/process_pipe.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        std::wstring make_unique_pipe_name()
+        {
+            static std::atomic<std::uint64_t> next_pipe{};
+            return LR"(\\.\pipe\modern_win32.stdio.)" + std::to_wstring(GetCurrentProcessId()) + L"." +
+                std::to_wstring(next_pipe.fetch_add(1, std::memory_order_relaxed));
+        }
+    }
+
+    process_output_pipe::process_output_pipe(threading::io_completion_executor const& executor, process_output_handler& handler, DWORD const pipe_buffer_size)
+        : handler_(handler)
+    {
+        auto const name = make_unique_pipe_name();
+
+        static_cast<void>(server_.reset(CreateNamedPipeW(name.c_str(),
+            PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE,
+            PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+            1UL, 0UL, pipe_buffer_size, 0UL, nullptr)));
+        if (!static_cast<bool>(server_))
+            throw windows_exception();
+
+        // the child writes synchronously so only this end is overlapped
+        SECURITY_ATTRIBUTES inheritable{ sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE };
+        static_cast<void>(child_.reset(CreateFileW(name.c_str(), GENERIC_WRITE, 0UL, &inheritable, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)));
+        if (!static_cast<bool>(child_))
+            throw windows_exception();
+
+        if (!executor.associate(server_.native_handle(), *this))
+            throw windows_exception();
+    }
+
+    process_output_pipe::~process_output_pipe()
+    {
+        threading::unique_slim_lock guard{ lock_ };
+        stopping_ = true;
+        if (state_ == pipe_state::reading)
+            static_cast<void>(CancelIoEx(server_.native_handle(), &overlapped_));
+        else if (state_ != pipe_state::closed)
+            state_ = pipe_state::closed;
+
+        changed_.wait(guard, [this] { return state_ == pipe_state::closed; });
+    }
+
+    HANDLE process_output_pipe::child_handle() const noexcept
+    {
+        return child_.native_handle();
+    }
+
+    void process_output_pipe::start()
+    {
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            if (state_ != pipe_state::not_started)
+                throw std::logic_error("pipe has already been started");
+            state_ = pipe_state::reading;
+        }
+        static_cast<void>(child_.reset());
+        read_next();
+    }
+
+    bool process_output_pipe::resume()
+    {
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            if (state_ != pipe_state::paused || stopping_)
+                return false;
+            state_ = pipe_state::reading;
+        }
+        read_next();
+        return true;
+    }
+
+    bool process_output_pipe::is_closed() const
+    {
+        threading::slim_lock_guard guard{ lock_ };
+        return state_ == pipe_state::closed;
+    }
+
+    bool process_output_pipe::wait_for_close(std::chrono::milliseconds const& timeout) const
+    {
+        threading::unique_slim_lock guard{ lock_ };
+        return changed_.wait_for(guard, timeout, [this] { return state_ == pipe_state::closed; });
+    }
+
+    void process_output_pipe::on_completion(threading::io_completion const& completion) noexcept
+    {
+        if (completion.overlapped != &overlapped_)
+            return;
+
+        if (!completion.succeeded()) {
+            DWORD bytes_read{};
+            auto const error = GetOverlappedResult(server_.native_handle(), &overlapped_, &bytes_read, FALSE) == FALSE
+                ? GetLastError()
+                : static_cast<DWORD>(ERROR_BROKEN_PIPE);
+            finish(error);
+            return;
+        }
+
+        if (completion.bytes_transferred > 0UL)
+            handler_.on_data(buffer_, completion.bytes_transferred);
+        read_next();
+    }
+
+    void process_output_pipe::read_next() noexcept
+    {
+        auto const buffer = handler_.next_buffer();
+
+        threading::unique_slim_lock guard{ lock_ };
+        if (stopping_) {
+            guard.unlock();
+            finish(ERROR_OPERATION_ABORTED);
+            return;
+        }
+        if (buffer.empty()) {
+            state_ = pipe_state::paused;
+            return;
+        }
+
+        buffer_ = buffer;
+        overlapped_ = OVERLAPPED{};
+        // the completion is queued to the executor even if the read completes immediately
+        if (ReadFile(server_.native_handle(), buffer.data, static_cast<DWORD>((std::min)(buffer.size, static_cast<std::size_t>(MAXDWORD))), nullptr, &overlapped_) == FALSE) {
+            auto const error = GetLastError();
+            if (error != ERROR_IO_PENDING) {
+                guard.unlock();
+                finish(error);
+            }
+        }
+    }
+
+    void process_output_pipe::finish(DWORD const error) noexcept
+    {
+        handler_.on_closed(error);
+
+        // notified under the lock as the destructor may be waiting, nothing is touched once released
+        threading::slim_lock_guard guard{ lock_ };
+        state_ = pipe_state::closed;
+        changed_.notify_all();
+    }
+
+}
@@ -0,0 +1,329 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/process_snapshot.h>
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/module_handle.h>
+#include <modern_win32/windows_exception.h>
+#include <Windows.h>
+#include <TlHelp32.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+
+namespace modern_win32
+{
+    namespace
+    {
+        using nt_status = LONG;
+        constexpr nt_status status_success = 0L;
+        constexpr nt_status status_info_length_mismatch = static_cast<nt_status>(0xC0000004L);
+        constexpr ULONG system_process_information_class = 5UL;
+
+        struct native_unicode_string final
+        {
+            USHORT Length;
+            USHORT MaximumLength;
+            PWSTR Buffer;
+        };
+
+        /// <summary>
+        /// SYSTEM_PROCESS_INFORMATION including the members winternl.h declares as reserved, the layout has been
+        /// stable since Windows XP
+        /// </summary>
+        struct native_process_information final
+        {
+            ULONG NextEntryOffset;
+            ULONG NumberOfThreads;
+            LARGE_INTEGER WorkingSetPrivateSize;
+            ULONG HardFaultCount;
+            ULONG NumberOfThreadsHighWatermark;
+            ULONGLONG CycleTime;
+            LARGE_INTEGER CreateTime;
+            LARGE_INTEGER UserTime;
+            LARGE_INTEGER KernelTime;
+            native_unicode_string ImageName;
+            LONG BasePriority;
+            HANDLE UniqueProcessId;
+            HANDLE InheritedFromUniqueProcessId;
+            ULONG HandleCount;
+            ULONG SessionId;
+            ULONG_PTR UniqueProcessKey;
+            SIZE_T PeakVirtualSize;
+            SIZE_T VirtualSize;
+            ULONG PageFaultCount;
+            SIZE_T PeakWorkingSetSize;
+            SIZE_T WorkingSetSize;
+            SIZE_T QuotaPeakPagedPoolUsage;
+            SIZE_T QuotaPagedPoolUsage;
+            SIZE_T QuotaPeakNonPagedPoolUsage;
+            SIZE_T QuotaNonPagedPoolUsage;
+            SIZE_T PagefileUsage;
+            SIZE_T PeakPagefileUsage;
+            SIZE_T PrivatePageCount;
+        };
+
+        using nt_query_system_information_delegate = nt_status (WINAPI *)(ULONG, PVOID, ULONG, PULONG);
+
+        [[nodiscard]]
+        nt_query_system_information_delegate get_nt_query_system_information() noexcept
+        {
+            static auto const delegate = []() -> nt_query_system_information_delegate {
+                auto const maybe_ntdll = get_module("ntdll.dll");
+                if (!maybe_ntdll.has_value()) {
+                    return nullptr;
+                }
+                // ntdll is never unloaded so the address remains valid once the module handle is released
+                return reinterpret_cast<nt_query_system_information_delegate>(
+                    GetProcAddress(maybe_ntdll.value().native_handle(), "NtQuerySystemInformation"));
+            }();
+            return delegate;
+        }
+
+        [[nodiscard]]
+        constexpr process_time_duration to_process_time(LARGE_INTEGER const& value) noexcept
+        {
+            return process_time_duration(value.QuadPart);
+        }
+
+        [[nodiscard]]
+        process_id_type to_process_id(HANDLE const value) noexcept
+        {
+            return static_cast<process_id_type>(reinterpret_cast<ULONG_PTR>(value));
+        }
+
+        // query buffer kept per thread so that polling doesn't reallocate on every capture
+        thread_local std::vector<std::byte> query_buffer{};
+    }
+
+    process_snapshot process_snapshot::capture()
+    {
+        process_snapshot snapshot{};
+        snapshot.refresh();
+        return snapshot;
+    }
+
+    void process_snapshot::refresh()
+    {
+        entries_.clear();
+        names_.clear();
+        if (!capture_system_information()) {
+            entries_.clear();
+            names_.clear();
+            capture_toolhelp();
+        }
+
+        std::sort(entries_.begin(), entries_.end(), [](process_snapshot_entry const& left, process_snapshot_entry const& right) {
+            return left.id < right.id;
+        });
+        captured_at_ = std::chrono::steady_clock::now();
+    }
+
+    process_snapshot::const_iterator process_snapshot::begin() const noexcept
+    {
+        return entries_.begin();
+    }
+
+    process_snapshot::const_iterator process_snapshot::end() const noexcept
+    {
+        return entries_.end();
+    }
+
+    std::size_t process_snapshot::size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    bool process_snapshot::empty() const noexcept
+    {
+        return entries_.empty();
+    }
+
+    process_snapshot_entry const& process_snapshot::operator[](std::size_t const index) const noexcept
+    {
+        return entries_[index];
+    }
+
+    std::vector<process_snapshot_entry> const& process_snapshot::entries() const noexcept
+    {
+        return entries_;
+    }
+
+    process_snapshot_entry const* process_snapshot::find(process_id_type const id) const noexcept
+    {
+        auto const found = std::lower_bound(entries_.begin(), entries_.end(), id, [](process_snapshot_entry const& entry, process_id_type const value) {
+            return entry.id < value;
+        });
+        return found != entries_.end() && found->id == id
+            ? &*found
+            : nullptr;
+    }
+
+    std::wstring_view process_snapshot::name(process_snapshot_entry const& entry) const noexcept
+    {
+        if (static_cast<std::size_t>(entry.name_offset) + entry.name_length > names_.size()) {
+            return {};
+        }
+        return std::wstring_view(names_.data() + entry.name_offset, entry.name_length);
+    }
+
+    process_snapshot_source process_snapshot::source() const noexcept
+    {
+        return source_;
+    }
+
+    std::chrono::steady_clock::time_point process_snapshot::captured_at() const noexcept
+    {
+        return captured_at_;
+    }
+
+    bool process_snapshot::capture_system_information()
+    {
+        auto const query = get_nt_query_system_information();
+        if (query == nullptr) {
+            return false;
+        }
+
+        if (query_buffer.empty()) {
+            query_buffer.resize(256 * 1024);
+        }
+
+        // processes may start between calls so the required length is padded rather than used as is
+        nt_status status;
+        for (;;) {
+            ULONG required{};
+            status = query(system_process_information_class, query_buffer.data(), static_cast<ULONG>(query_buffer.size()), &required);
+            if (status != status_info_length_mismatch) {
+                break;
+            }
+            auto const grown = (std::max)(static_cast<std::size_t>(required) + 64 * 1024, query_buffer.size() * 2);
+            if (grown > (std::numeric_limits<ULONG>::max)()) {
+                return false;
+            }
+            query_buffer.resize(grown);
+        }
+        if (status != status_success) {
+            return false;
+        }
+
+        for (std::size_t offset = 0;;) {
+            auto const& native = *reinterpret_cast<native_process_information const*>(query_buffer.data() + offset);
+
+            process_snapshot_entry entry{};
+            entry.id = to_process_id(native.UniqueProcessId);
+            entry.parent_id = to_process_id(native.InheritedFromUniqueProcessId);
+            entry.thread_count = native.NumberOfThreads;
+            entry.handle_count = native.HandleCount;
+            entry.session_id = native.SessionId;
+            entry.base_priority = native.BasePriority;
+            entry.create_time = to_process_time(native.CreateTime);
+            entry.user_time = to_process_time(native.UserTime);
+            entry.kernel_time = to_process_time(native.KernelTime);
+            entry.working_set_bytes = native.WorkingSetSize;
+            entry.peak_working_set_bytes = native.PeakWorkingSetSize;
+            entry.private_bytes = native.PrivatePageCount;
+            entry.virtual_bytes = native.VirtualSize;
+            entry.pagefile_bytes = native.PagefileUsage;
+
+            // the idle process has no image name
+            auto const name = native.ImageName.Buffer != nullptr
+                ? std::wstring_view(native.ImageName.Buffer, native.ImageName.Length / sizeof(wchar_t))
+                : std::wstring_view(entry.id == 0 ? L"System Idle Process" : L"");
+            entry.name_offset = append_name(name);
+            entry.name_length = static_cast<std::uint32_t>(name.size());
+            entries_.push_back(entry);
+
+            if (native.NextEntryOffset == 0UL) {
+                break;
+            }
+            offset += native.NextEntryOffset;
+        }
+
+        source_ = process_snapshot_source::system_information;
+        return true;
+    }
+
+    void process_snapshot::capture_toolhelp()
+    {
+        invalid_handle const snapshot{ CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0UL) };
+        if (!static_cast<bool>(snapshot)) {
+            throw windows_exception();
+        }
+
+        PROCESSENTRY32W native{};
+        native.dwSize = sizeof(native);
+        for (auto more = Process32FirstW(snapshot.native_handle(), &native) == TRUE; more; more = Process32NextW(snapshot.native_handle(), &native) == TRUE) {
+            process_snapshot_entry entry{};
+            entry.id = native.th32ProcessID;
+            entry.parent_id = native.th32ParentProcessID;
+            entry.thread_count = native.cntThreads;
+            entry.base_priority = native.pcPriClassBase;
+
+            std::wstring_view const name{ native.szExeFile };
+            entry.name_offset = append_name(name);
+            entry.name_length = static_cast<std::uint32_t>(name.size());
+            entries_.push_back(entry);
+        }
+        if (auto const error = GetLastError(); entries_.empty() && error != ERROR_NO_MORE_FILES) {
+            throw windows_exception(static_cast<native_windows_error>(error));
+        }
+
+        source_ = process_snapshot_source::toolhelp;
+    }
+
+    std::uint32_t process_snapshot::append_name(std::wstring_view const name)
+    {
+        if (names_.size() + name.size() > (std::numeric_limits<std::uint32_t>::max)()) {
+            throw std::length_error("process names exceed the capacity of the snapshot");
+        }
+        auto const offset = static_cast<std::uint32_t>(names_.size());
+        names_.append(name);
+        return offset;
+    }
+
+    process_snapshot_difference difference(process_snapshot const& previous, process_snapshot const& current)
+    {
+        process_snapshot_difference result{};
+
+        auto before = previous.begin();
+        auto after = current.begin();
+        while (before != previous.end() || after != current.end()) {
+            if (after == current.end() || (before != previous.end() && before->id < after->id)) {
+                result.exited.push_back(before->id);
+                ++before;
+            } else if (before == previous.end() || after->id < before->id) {
+                result.started.push_back(after->id);
+                ++after;
+            } else {
+                if (!before->same_process(*after)) {
+                    result.exited.push_back(before->id);
+                    result.started.push_back(after->id);
+                }
+                ++before;
+                ++after;
+            }
+        }
+        return result;
+    }
+
+    std::optional<process_time_duration> cpu_time_delta(process_snapshot_entry const& previous, process_snapshot_entry const& current) noexcept
+    {
+        if (!previous.same_process(current)) {
+            return std::nullopt;
+        }
+        return (current.user_time + current.kernel_time) - (previous.user_time + previous.kernel_time);
+    }
+
+}
@@ -0,0 +1,282 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/process_supervisor.h>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/windows_exception.h>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "impl/process_impl.h"
+
+namespace modern_win32
+{
+    namespace
+    {
+        // the least needed to wait on the process and read its exit code
+        constexpr DWORD watch_rights = SYNCHRONIZE | PROCESS_QUERY_LIMITED_INFORMATION;
+    }
+
+    struct process_supervisor::state final
+    {
+        struct watched_process final
+        {
+            watched_process(state* const owner, process_id_type const id, process_handle&& handle) noexcept
+                : owner(owner)
+                , id(id)
+                , handle(handle.release())
+            {
+            }
+            watched_process(watched_process const&) = delete;
+            watched_process(watched_process&&) noexcept = delete;
+            ~watched_process()
+            {
+                // from within the callback the wait is released once the callback returns
+                if (wait != nullptr) {
+                    CloseThreadpoolWait(wait);
+                }
+            }
+            watched_process& operator=(watched_process const&) = delete;
+            watched_process& operator=(watched_process&&) noexcept = delete;
+
+            state* const owner;
+            process_id_type const id;
+            process_handle handle;
+            PTP_WAIT wait{};
+        };
+
+        state(exit_callback callback, threading::executor* const target, threading::io_completion_port const* const port, ULONG_PTR const key)
+            : callback(std::move(callback))
+            , target(target)
+            , port(port)
+            , key(key)
+        {
+        }
+
+        exit_callback const callback;
+        threading::executor* const target;
+        threading::io_completion_port const* const port;
+        ULONG_PTR const key;
+
+        mutable threading::slim_lock lock{};
+        threading::condition_variable idle{};
+        std::unordered_map<process_id_type, std::unique_ptr<watched_process>> watched{};
+        std::vector<process_exit_event> pending{};
+        threading::executor_work delivery{ &state::deliver, this };
+        bool delivering{};
+        bool stopping{};
+        std::atomic<std::size_t> unhandled_exceptions{};
+
+        [[nodiscard]]
+        bool add(process_id_type const id, process_handle&& handle)
+        {
+            auto entry = std::make_unique<watched_process>(this, id, std::move(handle));
+            entry->wait = CreateThreadpoolWait(&state::on_exit, entry.get(), nullptr);
+            if (entry->wait == nullptr) {
+                throw windows_exception();
+            }
+
+            threading::slim_lock_guard guard{ lock };
+            if (stopping) {
+                throw std::logic_error("process_supervisor has been shut down");
+            }
+            auto const [position, inserted] = watched.try_emplace(id, std::move(entry));
+            if (inserted) {
+                SetThreadpoolWait(position->second->wait, position->second->handle.native_handle(), nullptr);
+            }
+            return inserted;
+        }
+
+        /// <summary>
+        /// cancels the wait of <paramref name="entry"/> and waits for a callback in progress, must be called without the lock
+        /// </summary>
+        static void cancel(watched_process& entry) noexcept
+        {
+            SetThreadpoolWait(entry.wait, nullptr, nullptr);
+            WaitForThreadpoolWaitCallbacks(entry.wait, TRUE);
+        }
+
+        static void CALLBACK on_exit(PTP_CALLBACK_INSTANCE, void* context, PTP_WAIT, TP_WAIT_RESULT)
+        {
+            auto* const entry = static_cast<watched_process*>(context);
+            auto* const self = entry->owner;
+
+            process_exit_event event{ entry->id, process_exit_event::exit_code_unavailable };
+            try {
+                if (auto const [is_running, exit_code] = impl::get_running_details(entry->handle.native_handle()); !is_running) {
+                    event.exit_code = exit_code;
+                }
+            } catch (windows_exception const&) {
+                // reported as unavailable
+            }
+
+            // once unlocked the supervisor may be destroyed, unless a delivery has been started which it waits for
+            std::unique_ptr<watched_process> exited{};
+            auto run_inline = false;
+            {
+                threading::slim_lock_guard guard{ self->lock };
+                auto const found = self->watched.find(entry->id);
+                if (self->stopping || found == self->watched.end() || found->second.get() != entry) {
+                    // being unwatched or shut down, the entry is owned by the thread waiting for this callback
+                    return;
+                }
+                exited = std::move(found->second);
+                self->watched.erase(found);
+
+                if (self->port != nullptr) {
+                    std::ignore = self->port->post(self->key, reinterpret_cast<OVERLAPPED*>(static_cast<ULONG_PTR>(event.id)), event.exit_code);
+                } else {
+                    self->pending.push_back(event);
+                    if (!self->delivering) {
+                        self->delivering = true;
+                        run_inline = !self->target->post(self->delivery);
+                    }
+                }
+            }
+
+            if (run_inline) {
+                deliver(self);
+            }
+        }
+
+        static void deliver(void* context)
+        {
+            auto* const self = static_cast<state*>(context);
+            for (;;) {
+                std::vector<process_exit_event> batch{};
+                {
+                    threading::slim_lock_guard guard{ self->lock };
+                    if (self->pending.empty() || self->stopping) {
+                        self->pending.clear();
+                        self->delivering = false;
+                        self->idle.notify_all();
+                        return;
+                    }
+                    batch.swap(self->pending);
+                }
+
+                try {
+                    self->callback(batch);
+                } catch (...) {
+                    self->unhandled_exceptions.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    process_supervisor::process_supervisor(exit_callback callback, threading::executor& target)
+    {
+        if (!callback) {
+            throw std::invalid_argument("callback cannot be empty");
+        }
+        state_ = std::make_unique<state>(std::move(callback), &target, nullptr, ULONG_PTR{});
+    }
+
+    process_supervisor::process_supervisor(threading::io_completion_port const& port, ULONG_PTR const key)
+        : state_{ std::make_unique<state>(exit_callback{}, nullptr, &port, key) }
+    {
+    }
+
+    process_supervisor::~process_supervisor()
+    {
+        shutdown();
+    }
+
+    bool process_supervisor::watch(process const& child)
+    {
+        if (child.native_handle() == process_handle::invalid()) {
+            auto const id = child.get_process_id().value_or(0UL);
+            if (id == 0UL) {
+                throw std::invalid_argument("child has neither a handle nor an id");
+            }
+            return watch(id);
+        }
+
+        HANDLE duplicate{};
+        if (DuplicateHandle(GetCurrentProcess(), child.native_handle(), GetCurrentProcess(), &duplicate, watch_rights, FALSE, 0UL) == FALSE) {
+            throw windows_exception();
+        }
+        process_handle handle{ duplicate };
+
+        auto id = child.get_process_id().value_or(0UL);
+        if (id == 0UL) {
+            id = impl::get_process_id(handle.native_handle());
+        }
+        return state_->add(id, std::move(handle));
+    }
+
+    bool process_supervisor::watch(process_id_type const id)
+    {
+        process_handle handle{ OpenProcess(watch_rights, FALSE, id) };
+        if (!static_cast<bool>(handle)) {
+            throw windows_exception();
+        }
+        return state_->add(id, std::move(handle));
+    }
+
+    bool process_supervisor::unwatch(process_id_type const id)
+    {
+        std::unique_ptr<state::watched_process> entry{};
+        {
+            threading::slim_lock_guard guard{ state_->lock };
+            auto const found = state_->watched.find(id);
+            if (found == state_->watched.end()) {
+                return false;
+            }
+            entry = std::move(found->second);
+            state_->watched.erase(found);
+        }
+        state::cancel(*entry);
+        return true;
+    }
+
+    std::size_t process_supervisor::size() const
+    {
+        threading::slim_lock_guard guard{ state_->lock };
+        return state_->watched.size();
+    }
+
+    std::size_t process_supervisor::unhandled_exception_count() const noexcept
+    {
+        return state_->unhandled_exceptions.load(std::memory_order_relaxed);
+    }
+
+    void process_supervisor::shutdown()
+    {
+        std::unordered_map<process_id_type, std::unique_ptr<state::watched_process>> watched{};
+        {
+            threading::slim_lock_guard guard{ state_->lock };
+            state_->stopping = true;
+            watched.swap(state_->watched);
+        }
+        for (auto& [id, entry] : watched) {
+            std::ignore = id;
+            state::cancel(*entry);
+        }
+        watched.clear();
+
+        threading::unique_slim_lock guard{ state_->lock };
+        state_->idle.wait(guard, [this] { return !state_->delivering; });
+    }
+
+    process_exit_event process_supervisor::to_exit_event(threading::io_completion const& packet) noexcept
+    {
+        return process_exit_event{ static_cast<process_id_type>(reinterpret_cast<ULONG_PTR>(packet.overlapped)), packet.bytes_transferred };
+    }
+
+}
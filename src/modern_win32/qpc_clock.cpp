@@ -0,0 +1,86 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/qpc_clock.h>
+
+#include <algorithm>
+
+#if defined(MODERN_WIN32_HAS_TSC_CLOCK) && !defined(_MSC_VER)
+#   include <cpuid.h>
+#endif
+
+namespace modern_win32
+{
+    std::int64_t qpc_clock::frequency() noexcept
+    {
+        // cannot fail on Windows XP or later
+        static std::int64_t const frequency = [] {
+            LARGE_INTEGER value{};
+            static_cast<void>(QueryPerformanceFrequency(&value));
+            return value.QuadPart;
+        }();
+        return frequency;
+    }
+
+#ifdef MODERN_WIN32_HAS_TSC_CLOCK
+
+    namespace
+    {
+        [[nodiscard]]
+        std::int64_t calibrate_tsc_frequency() noexcept
+        {
+            constexpr DWORD calibration_milliseconds = 10;
+
+            auto const qpc_start = qpc_clock::ticks();
+            auto const tsc_start = tsc_clock::ticks();
+            Sleep(calibration_milliseconds);
+            auto const tsc_end = tsc_clock::ticks();
+            auto const qpc_end = qpc_clock::ticks();
+
+            // ~10ms of either counter is far too small for this product to overflow
+            auto const qpc_elapsed = (std::max)(qpc_end - qpc_start, std::int64_t{ 1 });
+            return (std::max)((tsc_end - tsc_start) * qpc_clock::frequency() / qpc_elapsed, std::int64_t{ 1 });
+        }
+    }
+
+    std::int64_t tsc_clock::frequency() noexcept
+    {
+        static std::int64_t const frequency = calibrate_tsc_frequency();
+        return frequency;
+    }
+
+    bool tsc_clock::is_invariant() noexcept
+    {
+        constexpr unsigned int advanced_power_management_leaf = 0x80000007U;
+        constexpr unsigned int invariant_tsc_bit = 1U << 8;
+
+#   ifdef _MSC_VER
+        int registers[4]{};
+        __cpuid(registers, static_cast<int>(0x80000000U));
+        if (static_cast<unsigned int>(registers[0]) < advanced_power_management_leaf)
+            return false;
+        __cpuid(registers, static_cast<int>(advanced_power_management_leaf));
+        return (static_cast<unsigned int>(registers[3]) & invariant_tsc_bit) != 0;
+#   else
+        unsigned int eax{};
+        unsigned int ebx{};
+        unsigned int ecx{};
+        unsigned int edx{};
+        return __get_cpuid(advanced_power_management_leaf, &eax, &ebx, &ecx, &edx) != 0 &&
+            (edx & invariant_tsc_bit) != 0;
+#   endif
+    }
+
+#endif
+
+}
@@ -0,0 +1,118 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/random_pool.h>
+#include <modern_win32/bcrypt_random.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        bool generate(byte* data, std::size_t length) noexcept
+        {
+            auto const algorithm = bcrypt_rng_algorithm();
+            while (length > 0) {
+                auto const count = static_cast<unsigned long>((std::min)(length, static_cast<std::size_t>((std::numeric_limits<unsigned long>::max)())));
+                auto const generated = algorithm != nullptr
+                    ? bcrypt_get_random_bytes(algorithm, data, count)
+                    : bcrypt_get_random_bytes(data, count);
+                if (!generated)
+                    return false;
+                data += count;
+                length -= count;
+            }
+            return true;
+        }
+
+        struct random_buffer final
+        {
+            std::array<byte, random_pool::block_size> bytes{};
+            std::size_t next{random_pool::block_size};
+
+            random_buffer() noexcept = default;
+            random_buffer(random_buffer const&) = delete;
+            random_buffer(random_buffer&&) = delete;
+            ~random_buffer()
+            {
+                discard();
+            }
+
+            [[nodiscard]]
+            std::size_t available() const noexcept
+            {
+                return bytes.size() - next;
+            }
+
+            [[nodiscard]]
+            bool refill() noexcept
+            {
+                if (!generate(bytes.data(), bytes.size()))
+                    return false;
+                next = 0;
+                return true;
+            }
+
+            void discard() noexcept
+            {
+                SecureZeroMemory(bytes.data() + next, available());
+                next = bytes.size();
+            }
+
+            random_buffer& operator=(random_buffer const&) = delete;
+            random_buffer& operator=(random_buffer&&) = delete;
+        };
+
+        [[nodiscard]]
+        random_buffer& current_buffer() noexcept
+        {
+            thread_local random_buffer buffer{};
+            return buffer;
+        }
+    }
+
+    bool random_pool::get_bytes(byte* data, std::size_t length) noexcept
+    {
+        if (length == 0)
+            return true;
+        if (data == nullptr)
+            return false;
+        if (length >= block_size)
+            return generate(data, length);
+
+        auto& buffer = current_buffer();
+        while (length > 0) {
+            if (buffer.available() == 0 && !buffer.refill())
+                return false;
+
+            auto const count = (std::min)(length, buffer.available());
+            auto* const source = buffer.bytes.data() + buffer.next;
+            std::memcpy(data, source, count);
+            SecureZeroMemory(source, count);
+            buffer.next += count;
+            data += count;
+            length -= count;
+        }
+        return true;
+    }
+
+    void random_pool::discard() noexcept
+    {
+        current_buffer().discard();
+    }
+
+}
@@ -0,0 +1,440 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/shared_memory_ring.h>
+#include <modern_win32/environment.h>
+#include <modern_win32/guid.h>
+#include <modern_win32/wait_for.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace modern_win32
+{
+    namespace details
+    {
+        /// <summary>
+        /// layout at the start of the shared mapping, each position is a monotonically increasing byte count with
+        /// the offset into the data given by masking with capacity - 1
+        /// </summary>
+        /// <remarks>
+        /// positions written by different sides are kept on separate cache lines so the reader and writers only
+        /// contend on the line they hand over
+        /// </remarks>
+        struct alignas(64) ring_header final
+        {
+            std::uint32_t magic{};
+            std::uint32_t version{};
+            std::uint64_t capacity{};
+            ring_producers producers{};
+
+            alignas(64) std::atomic<std::uint64_t> claimed{};
+
+            alignas(64) std::atomic<std::uint64_t> published{};
+            std::atomic<std::uint32_t> reader_idle{};
+
+            alignas(64) std::atomic<std::uint64_t> consumed{};
+            std::atomic<std::uint32_t> writers_waiting{};
+            std::atomic<std::uint32_t> attached{};
+        };
+
+        // the header is shared between processes which may not be built alike, so nothing may rely on a lock
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+        static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+    }
+
+    namespace
+    {
+        using details::ring_header;
+        using steady_deadline = std::optional<std::chrono::steady_clock::time_point>;
+
+        constexpr std::uint32_t ring_magic = 0x474E4952U; // "RING"
+        constexpr std::uint32_t ring_version = 1U;
+        constexpr std::uint64_t minimum_capacity = 4096U;
+
+        enum class record_kind : std::uint32_t
+        {
+            message,
+            padding,
+        };
+
+        struct record_header final
+        {
+            std::uint32_t size;
+            record_kind kind;
+        };
+        static_assert(sizeof(record_header) == 8);
+
+        constexpr std::uint64_t record_alignment = sizeof(record_header);
+
+        [[nodiscard]]
+        constexpr std::uint64_t record_size(std::uint64_t const message_size) noexcept
+        {
+            return sizeof(record_header) + ((message_size + record_alignment - 1) & ~(record_alignment - 1));
+        }
+
+        /// <summary>
+        /// returns the bytes <paramref name="record"/> occupies including its header, zero if its kind is unknown
+        /// </summary>
+        [[nodiscard]]
+        constexpr std::uint64_t record_span(record_header const& record) noexcept
+        {
+            switch (record.kind) {
+            case record_kind::message:
+                return record_size(record.size);
+            case record_kind::padding:
+                return sizeof(record_header) + static_cast<std::uint64_t>(record.size);
+            default:
+                return 0U;
+            }
+        }
+
+        [[nodiscard]]
+        constexpr std::uint64_t to_capacity(std::size_t const requested) noexcept
+        {
+            std::uint64_t capacity = minimum_capacity;
+            while (capacity < requested)
+                capacity <<= 1;
+            return capacity;
+        }
+
+        [[nodiscard]]
+        steady_deadline to_deadline(std::optional<std::chrono::milliseconds> const& timeout) noexcept
+        {
+            if (!timeout.has_value())
+                return std::nullopt;
+            return std::chrono::steady_clock::now() + (std::max)(timeout.value(), std::chrono::milliseconds::zero());
+        }
+
+        /// <summary>
+        /// returns the time left until <paramref name="deadline"/>, rounded up so a wait never ends early
+        /// </summary>
+        [[nodiscard]]
+        std::optional<std::chrono::milliseconds> remaining_until(steady_deadline const& deadline) noexcept
+        {
+            if (!deadline.has_value())
+                return std::nullopt;
+            auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - std::chrono::steady_clock::now());
+            return (std::max)(remaining, std::chrono::milliseconds::zero());
+        }
+
+        [[nodiscard]]
+        std::wstring make_ring_name()
+        {
+            return L"Local\\modern_win32_ring_" + to_wstring(guid());
+        }
+    }
+
+    shared_memory_ring shared_memory_ring::create(std::size_t const capacity, ring_producers const producers)
+    {
+        return create(make_ring_name(), capacity, producers);
+    }
+
+    shared_memory_ring shared_memory_ring::create(std::wstring const& name, std::size_t const capacity, ring_producers const producers)
+    {
+        if (capacity > (std::numeric_limits<std::uint32_t>::max)())
+            throw std::invalid_argument("capacity is too large");
+
+        auto const ring_capacity = to_capacity(capacity);
+        shared_memory_ring ring(name, file_mapping::create_shared(name.c_str(), sizeof(ring_header) + ring_capacity));
+
+        // the name has not been shared yet so nothing else can see the header before it is initialized
+        ring.header_ = new (ring.view_.data()) ring_header{};
+        ring.header_->magic = ring_magic;
+        ring.header_->version = ring_version;
+        ring.header_->capacity = ring_capacity;
+        ring.header_->producers = producers;
+        ring.mask_ = ring_capacity - 1;
+        return ring;
+    }
+
+    shared_memory_ring shared_memory_ring::open(std::wstring const& name)
+    {
+        shared_memory_ring ring(name, file_mapping::open_shared(name.c_str()));
+
+        auto const* const header = ring.header_;
+        if (header->magic != ring_magic || header->version != ring_version)
+            throw std::runtime_error("mapping is not a compatible shared memory ring");
+        if (header->capacity < minimum_capacity || (header->capacity & (header->capacity - 1)) != 0 ||
+            header->capacity > ring.view_.size() - sizeof(ring_header))
+            throw std::runtime_error("shared memory ring capacity is invalid");
+
+        ring.mask_ = header->capacity - 1;
+        ring.read_position_ = header->consumed.load(std::memory_order_acquire);
+        ring.header_->attached.fetch_add(1, std::memory_order_acq_rel);
+        static_cast<void>(ring.attached_.set());
+        return ring;
+    }
+
+    shared_memory_ring shared_memory_ring::open_from_environment(wchar_t const* const variable)
+    {
+        auto const length = GetEnvironmentVariableW(variable, nullptr, 0);
+        if (length == 0)
+            throw windows_exception();
+
+        std::vector<wchar_t> buffer(length);
+        auto const written = GetEnvironmentVariableW(variable, buffer.data(), length);
+        if (written == 0 || written >= length)
+            throw windows_exception();
+
+        return open(std::wstring(buffer.data(), written));
+    }
+
+    shared_memory_ring::shared_memory_ring(std::wstring name, file_mapping&& mapping)
+        : name_{ std::move(name) }
+        , mapping_{ std::move(mapping) }
+        , view_{ mapping_.map() }
+        , readable_{ false, (name_ + L"_readable").c_str() }
+        , writable_{ false, (name_ + L"_writable").c_str() }
+        , attached_{ false, (name_ + L"_attached").c_str() }
+    {
+        if (view_.size() < sizeof(ring_header) + minimum_capacity)
+            throw std::runtime_error("mapping is too small for a shared memory ring");
+        if (!static_cast<bool>(readable_) || !static_cast<bool>(writable_) || !static_cast<bool>(attached_))
+            throw windows_exception();
+
+        header_ = reinterpret_cast<ring_header*>(view_.data());
+        data_ = view_.data() + sizeof(ring_header);
+    }
+
+    void shared_memory_ring::share_with(wide_process_startup_info& startup_info, wchar_t const* const variable) const
+    {
+        auto environment = startup_info.environment;
+        if (!environment.has_value()) {
+            environment_map<wchar_t> current;
+            if (!try_get_all_environment_variables(current))
+                throw windows_exception();
+            environment = std::move(current);
+        }
+
+        environment.value()[variable] = name_;
+        startup_info.environment = environment;
+    }
+
+    bool shared_memory_ring::wait_for_attach(std::optional<std::chrono::milliseconds> const& timeout) const
+    {
+        return header_->attached.load(std::memory_order_acquire) != 0 || attached_.wait_one(timeout);
+    }
+
+    bool shared_memory_ring::wait_for_attach(process const& child, std::optional<std::chrono::milliseconds> const& timeout) const
+    {
+        if (header_->attached.load(std::memory_order_acquire) != 0)
+            return true;
+
+        HANDLE const handles[]{ attached_.native_handle(), child.native_handle() };
+        auto const timeout_value = timeout.has_value()
+            ? to_numeric_milliseconds<DWORD>((std::max)(timeout.value(), std::chrono::milliseconds::zero()))
+            : INFINITE;
+        return WaitForMultipleObjects(2, handles, FALSE, timeout_value) == WAIT_OBJECT_0;
+    }
+
+    bool shared_memory_ring::try_write(void const* const data, std::size_t const size) noexcept
+    {
+        return claim_and_write(data, size);
+    }
+
+    bool shared_memory_ring::write(void const* const data, std::size_t const size, std::optional<std::chrono::milliseconds> const& timeout)
+    {
+        if (size > max_message_size())
+            return false;
+
+        for (std::uint32_t spin = 0; spin < default_spin_count; ++spin) {
+            if (claim_and_write(data, size))
+                return true;
+            YieldProcessor();
+        }
+
+        // registering before the final check pairs with the fence in notify_writers so a pop is never missed
+        auto const deadline = to_deadline(timeout);
+        header_->writers_waiting.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto written = false;
+        while (!(written = claim_and_write(data, size))) {
+            auto const remaining = remaining_until(deadline);
+            if (remaining.has_value() && remaining.value() == std::chrono::milliseconds::zero())
+                break;
+            static_cast<void>(writable_.wait_one(remaining));
+        }
+
+        // an auto-reset event wakes a single writer, pass the wake on so other waiting writers recheck the space
+        if (header_->writers_waiting.fetch_sub(1, std::memory_order_acq_rel) > 1)
+            static_cast<void>(writable_.set());
+        return written;
+    }
+
+    std::optional<ring_message> shared_memory_ring::try_read() noexcept
+    {
+        // published and every record header are written by other processes, anything which would reach outside
+        // the published records or the mapping is treated as no message rather than trusted
+        auto const capacity = mask_ + 1;
+        auto const published = header_->published.load(std::memory_order_acquire);
+        if (published - read_position_ > capacity)
+            return std::nullopt;
+
+        while (read_position_ != published) {
+            auto const offset = read_position_ & mask_;
+            auto const available = published - read_position_;
+            if ((offset & (record_alignment - 1)) != 0 || available < sizeof(record_header))
+                return std::nullopt;
+
+            record_header record{};
+            std::memcpy(&record, data_ + offset, sizeof(record));
+
+            auto const span = record_span(record);
+            if (span == 0 || (span & (record_alignment - 1)) != 0 || span > capacity - offset || span > available)
+                return std::nullopt;
+
+            if (record.kind == record_kind::padding) {
+                read_position_ += span;
+                header_->consumed.store(read_position_, std::memory_order_release);
+                continue;
+            }
+
+            pending_size_ = span;
+            return ring_message{ data_ + offset + sizeof(record_header), record.size };
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ring_message> shared_memory_ring::read(std::optional<std::chrono::milliseconds> const& timeout)
+    {
+        for (std::uint32_t spin = 0; spin < default_spin_count; ++spin) {
+            if (auto message = try_read(); message.has_value())
+                return message;
+            YieldProcessor();
+        }
+
+        // marking idle before the final check pairs with the fence in notify_reader so a publish is never missed
+        auto const deadline = to_deadline(timeout);
+        header_->reader_idle.store(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::optional<ring_message> message;
+        while (!(message = try_read()).has_value()) {
+            auto const remaining = remaining_until(deadline);
+            if (remaining.has_value() && remaining.value() == std::chrono::milliseconds::zero())
+                break;
+            static_cast<void>(readable_.wait_one(remaining));
+        }
+
+        header_->reader_idle.store(0, std::memory_order_relaxed);
+        return message;
+    }
+
+    void shared_memory_ring::pop() noexcept
+    {
+        if (pending_size_ == 0)
+            return;
+
+        read_position_ += std::exchange(pending_size_, 0U);
+        header_->consumed.store(read_position_, std::memory_order_release);
+        notify_writers();
+    }
+
+    std::size_t shared_memory_ring::capacity() const noexcept
+    {
+        return static_cast<std::size_t>(mask_ + 1);
+    }
+
+    std::size_t shared_memory_ring::max_message_size() const noexcept
+    {
+        // anything larger could need more than the whole ring once padding to the wrap point is included
+        return static_cast<std::size_t>((mask_ + 1) / 2 - sizeof(record_header));
+    }
+
+    std::wstring const& shared_memory_ring::name() const noexcept
+    {
+        return name_;
+    }
+
+    bool shared_memory_ring::claim_and_write(void const* const data, std::size_t const size) noexcept
+    {
+        if (size > max_message_size())
+            return false;
+
+        auto const capacity = mask_ + 1;
+        auto const record = record_size(size);
+        auto const multiple_producers = header_->producers == ring_producers::multiple;
+
+        std::uint64_t start = header_->claimed.load(std::memory_order_relaxed);
+        std::uint64_t padding{};
+        while (true) {
+            // a record never straddles the end of the data, the remainder is filled with a padding record instead;
+            // offsets are always 8 byte aligned so at least a padding header fits
+            auto const until_end = capacity - (start & mask_);
+            padding = record > until_end ? until_end : 0U;
+
+            if (start + padding + record - header_->consumed.load(std::memory_order_acquire) > capacity)
+                return false;
+
+            if (!multiple_producers) {
+                header_->claimed.store(start + padding + record, std::memory_order_relaxed);
+                break;
+            }
+            if (header_->claimed.compare_exchange_weak(start, start + padding + record, std::memory_order_relaxed, std::memory_order_relaxed))
+                break;
+        }
+
+        if (padding != 0) {
+            record_header const header{ static_cast<std::uint32_t>(padding - sizeof(record_header)), record_kind::padding };
+            std::memcpy(data_ + (start & mask_), &header, sizeof(header));
+        }
+
+        auto const offset = (start + padding) & mask_;
+        record_header const header{ static_cast<std::uint32_t>(size), record_kind::message };
+        std::memcpy(data_ + offset, &header, sizeof(header));
+        if (size != 0)
+            std::memcpy(data_ + offset + sizeof(record_header), data, size);
+
+        // records are published in claim order, a writer waits for those claimed before it to finish copying;
+        // a producer which dies between claiming and publishing leaves every later writer waiting here
+        if (multiple_producers) {
+            std::uint32_t spin = 0;
+            while (header_->published.load(std::memory_order_acquire) != start) {
+                if (++spin < default_spin_count) {
+                    YieldProcessor();
+                } else {
+                    spin = 0;
+                    static_cast<void>(SwitchToThread());
+                }
+            }
+        }
+        header_->published.store(start + padding + record, std::memory_order_release);
+
+        notify_reader();
+        return true;
+    }
+
+    void shared_memory_ring::notify_reader() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (header_->reader_idle.load(std::memory_order_relaxed) != 0)
+            static_cast<void>(readable_.set());
+    }
+
+    void shared_memory_ring::notify_writers() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (header_->writers_waiting.load(std::memory_order_relaxed) != 0)
+            static_cast<void>(writable_.set());
+    }
+
+}
@@ -0,0 +1,105 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/adaptive_mutex.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <algorithm>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        constexpr std::uint32_t unlocked = 0;
+        constexpr std::uint32_t locked = 1;
+        constexpr std::uint32_t contended = 2;
+
+        constexpr std::uint32_t minimum_spin_count = 10;
+    }
+
+    adaptive_mutex::adaptive_mutex(std::uint32_t const max_spin_count, std::uint32_t const initial_spin_budget) noexcept
+        : spin_budget_((std::min)(initial_spin_budget, max_spin_count))
+        , max_spin_count_(max_spin_count)
+    {
+    }
+
+    void adaptive_mutex::lock() noexcept
+    {
+        std::ignore = acquire(std::nullopt);
+    }
+
+    bool adaptive_mutex::try_lock() noexcept
+    {
+        auto expected = unlocked;
+        return state_.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void adaptive_mutex::unlock() noexcept
+    {
+        if (state_.exchange(unlocked, std::memory_order_release) == contended) {
+            wake_one(state_);
+        }
+    }
+
+    std::uint32_t adaptive_mutex::spin_budget() const noexcept
+    {
+        return spin_budget_.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t adaptive_mutex::max_spin_count() const noexcept
+    {
+        return max_spin_count_;
+    }
+
+    bool adaptive_mutex::acquire(std::optional<std::chrono::steady_clock::time_point> const& deadline) noexcept
+    {
+        if (try_lock()) {
+            return true;
+        }
+
+        auto const budget = spin_budget_.load(std::memory_order_relaxed);
+        auto const spin_limit = (std::min)(max_spin_count_, budget * 2 + minimum_spin_count);
+        for (std::uint32_t spins = 0; spins < spin_limit; ++spins) {
+            YieldProcessor();
+            if (state_.load(std::memory_order_relaxed) == unlocked && try_lock()) {
+                update_spin_budget(spins);
+                return true;
+            }
+        }
+        // the holder outlasted the spin, feeding the limit back in would grow the budget for the longest holds
+        spin_budget_.store(budget / 2, std::memory_order_relaxed);
+
+        // once parked the state stays contended until unlock, so no waiter is missed by a release
+        while (state_.exchange(contended, std::memory_order_acquire) != unlocked) {
+            std::optional<std::chrono::milliseconds> remaining{};
+            if (deadline.has_value()) {
+                auto const now = std::chrono::steady_clock::now();
+                if (now >= deadline.value()) {
+                    return false;
+                }
+                remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now);
+            }
+            std::ignore = wait_on_address(state_, contended, remaining);
+        }
+        return true;
+    }
+
+    void adaptive_mutex::update_spin_budget(std::uint32_t const spins) noexcept
+    {
+        // exponential moving average, racy updates only lose a sample
+        auto const budget = static_cast<std::int64_t>(spin_budget_.load(std::memory_order_relaxed));
+        auto const updated = budget + (static_cast<std::int64_t>(spins) - budget) / 8;
+        spin_budget_.store(static_cast<std::uint32_t>((std::min)(updated, static_cast<std::int64_t>(max_spin_count_))), std::memory_order_relaxed);
+    }
+
+}
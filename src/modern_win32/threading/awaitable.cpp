@@ -0,0 +1,170 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/awaitable.h>
+
+#ifdef MODERN_WIN32_HAS_COROUTINES
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        /// <summary>
+        /// relative due time for the thread pool, negative values are relative in 100 nanosecond units
+        /// </summary>
+        [[nodiscard]]
+        FILETIME to_relative_file_time(long long const ticks) noexcept
+        {
+            ULARGE_INTEGER due{};
+            due.QuadPart = static_cast<ULONGLONG>(-ticks);
+            FILETIME file_time{};
+            file_time.dwLowDateTime = due.LowPart;
+            file_time.dwHighDateTime = due.HighPart;
+            return file_time;
+        }
+    }
+
+    wait_awaitable::wait_awaitable(HANDLE const handle, std::optional<std::chrono::milliseconds> const& timeout) noexcept
+        : handle_(handle)
+        , timeout_(timeout)
+    {
+    }
+
+    wait_awaitable::~wait_awaitable()
+    {
+        // only reached with a registered wait if the suspended coroutine was destroyed
+        if (wait_ != nullptr) {
+            SetThreadpoolWait(wait_, nullptr, nullptr);
+            WaitForThreadpoolWaitCallbacks(wait_, TRUE);
+            CloseThreadpoolWait(wait_);
+        }
+    }
+
+    bool wait_awaitable::await_ready() noexcept
+    {
+        switch (WaitForSingleObject(handle_, 0)) {
+        case WAIT_OBJECT_0:
+            result_ = wait_for_result::object;
+            return true;
+        case WAIT_ABANDONED:
+            result_ = wait_for_result::abandonded;
+            return true;
+        case WAIT_TIMEOUT:
+            if (timeout_.has_value() && timeout_.value().count() <= 0) {
+                result_ = wait_for_result::timeout;
+                return true;
+            }
+            return false;
+        default:
+            result_ = wait_for_result::failed;
+            return true;
+        }
+    }
+
+    bool wait_awaitable::await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        continuation_ = continuation;
+        wait_ = CreateThreadpoolWait(on_wait, this, nullptr);
+        if (wait_ == nullptr) {
+            result_ = wait_for_result::failed;
+            return false;
+        }
+
+        if (timeout_.has_value()) {
+            auto due = to_relative_file_time(std::chrono::duration_cast<delay_awaitable::delay_duration>(timeout_.value()).count());
+            SetThreadpoolWait(wait_, handle_, &due);
+        } else {
+            SetThreadpoolWait(wait_, handle_, nullptr);
+        }
+        // the callback may already have resumed the coroutine, this must not be touched from here on
+        return true;
+    }
+
+    wait_for_result wait_awaitable::await_resume() const noexcept
+    {
+        return result_;
+    }
+
+    void CALLBACK wait_awaitable::on_wait(PTP_CALLBACK_INSTANCE, void* context, PTP_WAIT wait, TP_WAIT_RESULT const wait_result) noexcept
+    {
+        auto* const self = static_cast<wait_awaitable*>(context);
+        switch (wait_result) {
+        case WAIT_OBJECT_0:
+            self->result_ = wait_for_result::object;
+            break;
+        case WAIT_ABANDONED_0:
+            self->result_ = wait_for_result::abandonded;
+            break;
+        case WAIT_TIMEOUT:
+            self->result_ = wait_for_result::timeout;
+            break;
+        default:
+            self->result_ = wait_for_result::failed;
+            break;
+        }
+
+        // closing from within the callback is permitted, the wait is released once this callback returns
+        CloseThreadpoolWait(wait);
+        self->wait_ = nullptr;
+        self->continuation_.resume();
+    }
+
+    delay_awaitable::delay_awaitable(delay_duration const delay) noexcept
+        : delay_(delay)
+    {
+    }
+
+    delay_awaitable::~delay_awaitable()
+    {
+        if (timer_ != nullptr) {
+            SetThreadpoolTimer(timer_, nullptr, 0, 0);
+            WaitForThreadpoolTimerCallbacks(timer_, TRUE);
+            CloseThreadpoolTimer(timer_);
+        }
+    }
+
+    bool delay_awaitable::await_ready() const noexcept
+    {
+        return delay_.count() <= 0;
+    }
+
+    bool delay_awaitable::await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        continuation_ = continuation;
+        timer_ = CreateThreadpoolTimer(on_timer, this, nullptr);
+        if (timer_ == nullptr) {
+            return false;
+        }
+
+        auto due = to_relative_file_time(delay_.count());
+        SetThreadpoolTimer(timer_, &due, 0, 0);
+        return true;
+    }
+
+    bool delay_awaitable::await_resume() const noexcept
+    {
+        return elapsed_ || delay_.count() <= 0;
+    }
+
+    void CALLBACK delay_awaitable::on_timer(PTP_CALLBACK_INSTANCE, void* context, PTP_TIMER timer) noexcept
+    {
+        auto* const self = static_cast<delay_awaitable*>(context);
+        self->elapsed_ = true;
+        CloseThreadpoolTimer(timer);
+        self->timer_ = nullptr;
+        self->continuation_.resume();
+    }
+
+}
+
+#endif
@@ -0,0 +1,51 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/barrier.h>
+#include <modern_win32/windows_exception.h>
+#include <stdexcept>
+#include <string>
+
+namespace modern_win32::threading
+{
+    barrier::barrier(std::ptrdiff_t const expected, long const spin_count)
+    {
+        if (expected <= 0 || expected > (max)()) {
+            throw std::invalid_argument("invalid expected count " + std::to_string(expected));
+        }
+        if (InitializeSynchronizationBarrier(&barrier_, static_cast<LONG>(expected), spin_count) == FALSE) {
+            throw windows_exception();
+        }
+    }
+
+    barrier::~barrier()
+    {
+        DeleteSynchronizationBarrier(&barrier_);
+    }
+
+    bool barrier::arrive_and_wait() noexcept
+    {
+        return EnterSynchronizationBarrier(&barrier_, 0) == TRUE;
+    }
+
+    bool barrier::arrive_and_spin() noexcept
+    {
+        return EnterSynchronizationBarrier(&barrier_, SYNCHRONIZATION_BARRIER_FLAGS_SPIN_ONLY) == TRUE;
+    }
+
+    barrier::native_handle_type barrier::native_handle() noexcept
+    {
+        return &barrier_;
+    }
+
+}
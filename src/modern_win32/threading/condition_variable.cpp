@@ -0,0 +1,79 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/windows_exception.h>
+#include <stdexcept>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        [[nodiscard]]
+        bool sleep_condition_variable(PCONDITION_VARIABLE condition, slim_lock* lock, DWORD const timeout, ULONG const flags)
+        {
+            if (lock == nullptr) {
+                throw std::invalid_argument("lock does not reference a slim_lock");
+            }
+            if (SleepConditionVariableSRW(condition, lock->native_handle(), timeout, flags) == TRUE) {
+                return true;
+            }
+            if (GetLastError() == ERROR_TIMEOUT) {
+                return false;
+            }
+            throw windows_exception();
+        }
+    }
+
+    condition_variable::condition_variable() noexcept
+    {
+        InitializeConditionVariable(&condition_);
+    }
+
+    void condition_variable::notify_one() noexcept
+    {
+        WakeConditionVariable(&condition_);
+    }
+
+    void condition_variable::notify_all() noexcept
+    {
+        WakeAllConditionVariable(&condition_);
+    }
+
+    void condition_variable::wait(unique_slim_lock& lock)
+    {
+        std::ignore = sleep(lock, INFINITE);
+    }
+
+    void condition_variable::wait(shared_slim_lock& lock)
+    {
+        std::ignore = sleep(lock, INFINITE);
+    }
+
+    condition_variable::native_handle_type condition_variable::native_handle() noexcept
+    {
+        return &condition_;
+    }
+
+    bool condition_variable::sleep(unique_slim_lock& lock, DWORD const timeout)
+    {
+        return sleep_condition_variable(&condition_, lock.mutex(), timeout, 0UL);
+    }
+
+    bool condition_variable::sleep(shared_slim_lock& lock, DWORD const timeout)
+    {
+        return sleep_condition_variable(&condition_, lock.mutex(), timeout, CONDITION_VARIABLE_LOCKMODE_SHARED);
+    }
+
+}
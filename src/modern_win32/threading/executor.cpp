@@ -0,0 +1,37 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <Windows.h>
+#include <modern_win32/threading/executor.h>
+
+namespace modern_win32::threading
+{
+    static void CALLBACK run_executor_work(PTP_CALLBACK_INSTANCE, void* context)
+    {
+        if (auto const* work = static_cast<executor_work const*>(context);
+            work != nullptr) {
+            (*work)();
+        }
+    }
+
+    bool default_threadpool_executor::post(executor_work& work) noexcept
+    {
+        return TrySubmitThreadpoolCallback(run_executor_work, &work, nullptr) == TRUE;
+    }
+
+    default_threadpool_executor& default_threadpool_executor::instance() noexcept
+    {
+        static default_threadpool_executor executor{};
+        return executor;
+    }
+}
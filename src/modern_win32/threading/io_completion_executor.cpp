@@ -0,0 +1,134 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/io_completion_executor.h>
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        // posted work uses key 0 with the executor_work as the overlapped pointer, handlers use their address as
+        // the key so that they can never be zero; a packet with key 0 and no overlapped stops one thread
+        constexpr ULONG_PTR work_key = 0;
+        constexpr std::size_t batch_size = 64;
+    }
+
+    io_completion_executor::io_completion_executor(std::size_t thread_count, DWORD const concurrency, std::wstring const& name)
+        : port_(concurrency)
+    {
+        if (thread_count == 0) {
+            SYSTEM_INFO system_info{};
+            GetSystemInfo(&system_info);
+            thread_count = (std::max)(static_cast<std::size_t>(system_info.dwNumberOfProcessors), std::size_t{ 1 });
+        }
+
+        threads_.reserve(thread_count);
+        try {
+            for (std::size_t index = 0; index < thread_count; ++index) {
+                threads_.emplace_back(start_thread(&io_completion_executor::worker_proc, static_cast<thread::thread_parameter>(this)));
+                auto const thread_name = name + L" #" + std::to_wstring(index);
+                std::ignore = threads_.back().set_name(thread_name.c_str());
+            }
+        } catch (...) {
+            shutdown();
+            throw;
+        }
+    }
+
+    io_completion_executor::~io_completion_executor()
+    {
+        shutdown();
+    }
+
+    bool io_completion_executor::associate(HANDLE const file, io_completion_handler& handler) const noexcept
+    {
+        return port_.associate(file, reinterpret_cast<ULONG_PTR>(&handler));
+    }
+
+    bool io_completion_executor::post(executor_work& work) noexcept
+    {
+        if (stopping_) {
+            return false;
+        }
+        return port_.post(work_key, reinterpret_cast<OVERLAPPED*>(&work));
+    }
+
+    void io_completion_executor::shutdown()
+    {
+        if (stopping_.exchange(true)) {
+            return;
+        }
+        // the port is FIFO so everything queued before the stop packets is still processed
+        stop_threads(threads_.size());
+        for (auto const& worker : threads_) {
+            worker.join();
+        }
+    }
+
+    std::size_t io_completion_executor::thread_count() const noexcept
+    {
+        return threads_.size();
+    }
+
+    io_completion_port const& io_completion_executor::port() const noexcept
+    {
+        return port_;
+    }
+
+    void io_completion_executor::stop_threads(std::size_t const count) const noexcept
+    {
+        for (std::size_t index = 0; index < count; ++index) {
+            std::ignore = port_.post(work_key);
+        }
+    }
+
+    DWORD __stdcall io_completion_executor::worker_proc(thread::thread_parameter parameter)
+    {
+        auto* const owner = static_cast<io_completion_executor*>(parameter);
+        if (owner == nullptr) {
+            return 1UL;
+        }
+
+        std::array<OVERLAPPED_ENTRY, batch_size> entries{};
+        while (true) {
+            auto const removed = owner->port_.dequeue(entries.data(), entries.size());
+            if (removed == 0) {
+                // only fails if the port has been closed
+                return owner->stopping_ ? 0UL : 2UL;
+            }
+
+            // a batch may hold more than one stop packet, the rest of the batch is processed before exiting
+            // and the surplus is passed on so every thread receives one
+            std::size_t stop_count{};
+            for (std::size_t index = 0; index < removed; ++index) {
+                auto const completion = io_completion::from_entry(entries[index]);
+                if (completion.key != work_key) {
+                    reinterpret_cast<io_completion_handler*>(completion.key)->on_completion(completion);
+                } else if (completion.overlapped != nullptr) {
+                    (*reinterpret_cast<executor_work*>(completion.overlapped))();
+                } else {
+                    ++stop_count;
+                }
+            }
+
+            if (stop_count > 0) {
+                owner->stop_threads(stop_count - 1);
+                return 0UL;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,79 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/io_completion_port.h>
+#include <modern_win32/wait_for.h>
+#include <modern_win32/windows_exception.h>
+#include <algorithm>
+#include <limits>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        [[nodiscard]]
+        DWORD to_timeout(std::optional<std::chrono::milliseconds> const& timeout) noexcept
+        {
+            return timeout.has_value()
+                ? to_numeric_milliseconds<DWORD>(timeout.value())
+                : INFINITE;
+        }
+    }
+
+    io_completion_port::io_completion_port(DWORD const concurrency)
+        : handle_(CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, concurrency))
+    {
+        if (!handle_) {
+            throw windows_exception();
+        }
+    }
+
+    bool io_completion_port::associate(HANDLE const file, ULONG_PTR const key) const noexcept
+    {
+        return CreateIoCompletionPort(file, handle_.native_handle(), key, 0) == handle_.native_handle();
+    }
+
+    bool io_completion_port::post(ULONG_PTR const key, OVERLAPPED* overlapped, DWORD const bytes_transferred) const noexcept
+    {
+        return PostQueuedCompletionStatus(handle_.native_handle(), bytes_transferred, key, overlapped) == TRUE;
+    }
+
+    std::optional<io_completion> io_completion_port::dequeue(std::optional<std::chrono::milliseconds> const& timeout) const noexcept
+    {
+        OVERLAPPED_ENTRY entry{};
+        return dequeue(&entry, 1, timeout) == 1
+            ? std::optional(io_completion::from_entry(entry))
+            : std::nullopt;
+    }
+
+    std::size_t io_completion_port::dequeue(OVERLAPPED_ENTRY* entries, std::size_t const capacity,
+        std::optional<std::chrono::milliseconds> const& timeout, bool const alertable) const noexcept
+    {
+        if (entries == nullptr || capacity == 0) {
+            return 0;
+        }
+
+        ULONG removed{};
+        auto const count = static_cast<ULONG>((std::min)(capacity, static_cast<std::size_t>((std::numeric_limits<ULONG>::max)())));
+        if (GetQueuedCompletionStatusEx(handle_.native_handle(), entries, count, &removed, to_timeout(timeout), alertable ? TRUE : FALSE) != TRUE) {
+            return 0;
+        }
+        return removed;
+    }
+
+    io_completion_port::native_handle_type io_completion_port::native_handle() const noexcept
+    {
+        return handle_.native_handle();
+    }
+
+}
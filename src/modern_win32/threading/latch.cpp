@@ -0,0 +1,88 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/latch.h>
+#include <modern_win32/threading/wait_on_address.h>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    latch::latch(std::ptrdiff_t const expected)
+        : count_{ static_cast<std::uint32_t>(expected) }
+    {
+        if (expected < 0 || expected > (max)()) {
+            throw std::invalid_argument("invalid expected count " + std::to_string(expected));
+        }
+    }
+
+    void latch::count_down(std::ptrdiff_t const update)
+    {
+        if (update < 0) {
+            throw std::invalid_argument("invalid update value " + std::to_string(update));
+        }
+
+        auto current = count_.load();
+        do {
+            if (static_cast<std::uint32_t>(update) > current) {
+                throw std::invalid_argument("update " + std::to_string(update) + " exceeds count " + std::to_string(current));
+            }
+        } while (!count_.compare_exchange_weak(current, current - static_cast<std::uint32_t>(update)));
+
+        // the count reaches zero exactly once, so waiters are only ever woken once
+        if (update > 0 && current == static_cast<std::uint32_t>(update)) {
+            wake_all(count_);
+        }
+    }
+
+    bool latch::try_wait() const noexcept
+    {
+        return count_.load() == 0;
+    }
+
+    void latch::wait() const noexcept
+    {
+        std::ignore = wait_until_zero(std::nullopt);
+    }
+
+    void latch::arrive_and_wait(std::ptrdiff_t const update)
+    {
+        count_down(update);
+        wait();
+    }
+
+    bool latch::wait_until_zero(std::optional<std::chrono::milliseconds> const& timeout) const noexcept
+    {
+        auto const deadline = timeout.has_value()
+            ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+            : std::nullopt;
+
+        while (true) {
+            auto const observed = count_.load();
+            if (observed == 0) {
+                return true;
+            }
+            std::optional<std::chrono::milliseconds> remaining{};
+            if (deadline.has_value()) {
+                auto const now = std::chrono::steady_clock::now();
+                if (now >= deadline.value()) {
+                    return false;
+                }
+                remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now);
+            }
+            std::ignore = wait_on_address(count_, observed, remaining);
+        }
+    }
+
+}
@@ -0,0 +1,133 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/light_semaphore.h>
+#include <modern_win32/windows_exception.h>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    light_semaphore::light_semaphore(int const initial_count, int const maximum_count, std::uint32_t const spin_count)
+        : count_{ static_cast<std::uint32_t>(initial_count) }
+        , maximum_count_{ static_cast<std::uint32_t>(maximum_count) }
+        , spin_count_{ spin_count }
+    {
+        if (maximum_count <= 0 || initial_count < 0 || initial_count > maximum_count) {
+            throw std::invalid_argument("Invalid arguments, either initial " + std::to_string(initial_count) +
+                " or maximum " + std::to_string(maximum_count) + " count is out of range");
+        }
+    }
+
+    bool light_semaphore::try_acquire(int const count) const
+    {
+        return try_acquire_units(to_units(count));
+    }
+
+    void light_semaphore::release(int const count)
+    {
+        std::ignore = to_units(count);
+
+        auto current = count_.load();
+        do {
+            if (current + static_cast<std::uint32_t>(count) > maximum_count_) {
+                throw windows_exception(static_cast<native_windows_error>(ERROR_TOO_MANY_POSTS));
+            }
+        } while (!count_.compare_exchange_weak(current, current + static_cast<std::uint32_t>(count)));
+
+        if (waiters_ != 0) {
+            // a single wake could land on a waiter needing more units than released while one that fits sleeps on
+            if (count == 1 && multi_unit_waiters_ == 0) {
+                wake_one(count_);
+            } else {
+                wake_all(count_);
+            }
+        }
+    }
+
+    int light_semaphore::count() const noexcept
+    {
+        return static_cast<int>(count_.load());
+    }
+
+    std::uint32_t light_semaphore::to_units(int const count) const
+    {
+        if (count <= 0 || static_cast<std::uint32_t>(count) > maximum_count_) {
+            throw std::invalid_argument((std::string("invalid count value") + std::to_string(count)).c_str());
+        }
+        return static_cast<std::uint32_t>(count);
+    }
+
+    bool light_semaphore::acquire_units(std::uint32_t const units, std::optional<std::chrono::milliseconds> const& timeout) const
+    {
+        if (units == 1) {
+            return acquire_on_address(count_, waiters_, 0U, spin_count_, timeout, [this]() { return try_acquire_units(1); });
+        }
+
+        for (std::uint32_t spin = 0; spin < spin_count_; ++spin) {
+            if (try_acquire_units(units)) {
+                return true;
+            }
+            YieldProcessor();
+        }
+        if (try_acquire_units(units)) {
+            return true;
+        }
+        if (timeout.has_value() && timeout.value().count() <= 0) {
+            return false;
+        }
+
+        auto const deadline = timeout.has_value()
+            ? std::optional(std::chrono::steady_clock::now() + timeout.value())
+            : std::nullopt;
+
+        // the count may be non-zero yet too small, so wait for it to change from the value observed rather than from zero
+        ++multi_unit_waiters_;
+        ++waiters_;
+        bool acquired{};
+        while (true) {
+            auto const observed = count_.load();
+            if (observed >= units && (acquired = try_acquire_units(units))) {
+                break;
+            }
+            std::optional<std::chrono::milliseconds> remaining{};
+            if (deadline.has_value()) {
+                auto const now = std::chrono::steady_clock::now();
+                if (now >= deadline.value()) {
+                    break;
+                }
+                remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline.value() - now);
+            }
+            if (observed >= units) {
+                continue;
+            }
+            std::ignore = wait_on_address(count_, observed, remaining);
+        }
+        --waiters_;
+        --multi_unit_waiters_;
+        return acquired;
+    }
+
+    bool light_semaphore::try_acquire_units(std::uint32_t const units) const noexcept
+    {
+        auto current = count_.load();
+        while (current >= units) {
+            if (count_.compare_exchange_weak(current, current - units)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+}
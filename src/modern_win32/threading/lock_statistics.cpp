@@ -0,0 +1,97 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/lock_statistics.h>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        [[nodiscard]]
+        std::size_t bucket_for(std::chrono::nanoseconds const duration) noexcept
+        {
+            auto value = duration.count() > 0
+                ? static_cast<std::uint64_t>(duration.count())
+                : 0ULL;
+
+            std::size_t bucket = 0;
+            while (value != 0 && bucket < lock_histogram_bucket_count - 1) {
+                value >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        void record(std::array<std::atomic<std::uint64_t>, lock_histogram_bucket_count>& histogram, std::atomic<std::int64_t>& total,
+            std::chrono::nanoseconds const duration) noexcept
+        {
+            histogram[bucket_for(duration)].fetch_add(1, std::memory_order_relaxed);
+            total.fetch_add(duration.count(), std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        lock_histogram load(std::array<std::atomic<std::uint64_t>, lock_histogram_bucket_count> const& histogram) noexcept
+        {
+            lock_histogram values{};
+            for (std::size_t i = 0; i < lock_histogram_bucket_count; ++i) {
+                values[i] = histogram[i].load(std::memory_order_relaxed);
+            }
+            return values;
+        }
+    }
+
+    lock_statistics::lock_statistics(std::wstring_view const name)
+        : name_(name)
+    {
+    }
+
+    void lock_statistics::on_acquired(bool const contended, std::chrono::nanoseconds const wait) noexcept
+    {
+        acquisitions_.fetch_add(1, std::memory_order_relaxed);
+        if (contended) {
+            contended_acquisitions_.fetch_add(1, std::memory_order_relaxed);
+        }
+        record(wait_histogram_, total_wait_ns_, wait);
+    }
+
+    void lock_statistics::on_timed_out(std::chrono::nanoseconds const wait) noexcept
+    {
+        timeouts_.fetch_add(1, std::memory_order_relaxed);
+        record(wait_histogram_, total_wait_ns_, wait);
+    }
+
+    void lock_statistics::on_held(std::chrono::nanoseconds const hold) noexcept
+    {
+        record(hold_histogram_, total_hold_ns_, hold);
+    }
+
+    std::wstring const& lock_statistics::name() const noexcept
+    {
+        return name_;
+    }
+
+    lock_statistics_snapshot lock_statistics::snapshot() const
+    {
+        lock_statistics_snapshot snapshot{};
+        snapshot.name = name_;
+        snapshot.acquisitions = acquisitions_.load(std::memory_order_relaxed);
+        snapshot.contended_acquisitions = contended_acquisitions_.load(std::memory_order_relaxed);
+        snapshot.timeouts = timeouts_.load(std::memory_order_relaxed);
+        snapshot.total_wait_time = std::chrono::nanoseconds(total_wait_ns_.load(std::memory_order_relaxed));
+        snapshot.total_hold_time = std::chrono::nanoseconds(total_hold_ns_.load(std::memory_order_relaxed));
+        snapshot.wait_histogram = load(wait_histogram_);
+        snapshot.hold_histogram = load(hold_histogram_);
+        return snapshot;
+    }
+
+}
@@ -0,0 +1,123 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/parallel.h>
+#include <modern_win32/threading/latch.h>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace modern_win32::threading::details
+{
+    namespace
+    {
+        /// <summary>
+        /// state shared between the caller and any helpers it queued, helpers may outlive the call so they share
+        /// ownership but only touch the callback while a chunk remains to be claimed
+        /// </summary>
+        struct chunk_state final
+        {
+            chunk_state(std::size_t const chunk_count, chunk_callback const callback, void* context)
+                : chunk_count(chunk_count)
+                , remaining(static_cast<std::ptrdiff_t>(chunk_count))
+                , callback(callback)
+                , context(context)
+            {
+            }
+
+            std::size_t const chunk_count;
+            std::atomic<std::size_t> next_chunk{};
+            latch remaining;
+            std::atomic<bool> failed{};
+            std::exception_ptr error{};
+            chunk_callback const callback;
+            void* const context;
+
+            void drain() noexcept
+            {
+                for (;;) {
+                    auto const chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                    if (chunk >= chunk_count) {
+                        return;
+                    }
+                    if (!failed.load(std::memory_order_acquire)) {
+                        try {
+                            callback(context, chunk);
+                        } catch (...) {
+                            if (!failed.exchange(true, std::memory_order_acq_rel)) {
+                                error = std::current_exception();
+                            }
+                        }
+                    }
+                    remaining.count_down();
+                }
+            }
+        };
+
+        // chunks per participating thread when the grain is chosen automatically, enough to absorb uneven chunks
+        constexpr std::size_t chunks_per_thread = 4;
+    }
+
+    chunk_plan make_chunk_plan(thread_pool const& pool, std::size_t const item_count, std::size_t grain) noexcept
+    {
+        if (item_count == 0) {
+            return {};
+        }
+        if (grain == 0) {
+            grain = (std::max)(item_count / ((pool.worker_count() + 1) * chunks_per_thread), std::size_t{ 1 });
+        }
+
+        constexpr auto max_chunks = static_cast<std::size_t>((latch::max)());
+        if (item_count / grain >= max_chunks) {
+            grain = item_count / max_chunks + 1;
+        }
+        return chunk_plan{ item_count, grain, item_count / grain + (item_count % grain != 0 ? 1 : 0) };
+    }
+
+    void run_chunks(thread_pool& pool, std::size_t const chunk_count, chunk_callback const callback, void* context)
+    {
+        if (chunk_count == 0) {
+            return;
+        }
+        if (callback == nullptr) {
+            throw std::invalid_argument("callback cannot be null");
+        }
+        if (chunk_count > static_cast<std::size_t>((latch::max)())) {
+            throw std::invalid_argument("chunk_count exceeds the maximum supported");
+        }
+        if (chunk_count == 1 || pool.worker_count() == 0) {
+            for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+                callback(context, chunk);
+            }
+            return;
+        }
+
+        auto const state = std::make_shared<chunk_state>(chunk_count, callback, context);
+        auto helper = [state]() noexcept {
+            state->drain();
+        };
+        std::vector<decltype(helper)> helpers((std::min)(chunk_count - 1, pool.worker_count()), helper);
+        std::ignore = pool.submit_bulk(helpers.begin(), helpers.end());
+
+        state->drain();
+        state->remaining.wait();
+
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+}
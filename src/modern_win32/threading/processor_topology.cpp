@@ -0,0 +1,234 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/processor_topology.h>
+#include <modern_win32/module_handle.h>
+#include <modern_win32/windows_exception.h>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        [[nodiscard]]
+        group_affinity to_group_affinity(GROUP_AFFINITY const& affinity) noexcept
+        {
+            return group_affinity{ affinity.Group, affinity.Mask };
+        }
+
+        [[nodiscard]]
+        cache_kind to_cache_kind(PROCESSOR_CACHE_TYPE const type) noexcept
+        {
+            switch (type) {
+            case CacheInstruction:
+                return cache_kind::instruction;
+            case CacheData:
+                return cache_kind::data;
+            case CacheTrace:
+                return cache_kind::trace;
+            case CacheUnified:
+            default:
+                return cache_kind::unified;
+            }
+        }
+
+        [[nodiscard]]
+        std::unique_ptr<std::byte[]> get_logical_processor_information(DWORD& length)
+        {
+            length = 0UL;
+            if (GetLogicalProcessorInformationEx(RelationAll, nullptr, &length) == TRUE || GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+                throw windows_exception();
+            }
+
+            auto buffer = std::make_unique<std::byte[]>(length);
+            if (GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.get()), &length) != TRUE) {
+                throw windows_exception();
+            }
+            return buffer;
+        }
+
+        [[nodiscard]]
+        std::vector<cpu_set_info> get_cpu_sets()
+        {
+            // CPU sets were added in Windows 10, resolved at runtime so that earlier versions report none
+            using get_system_cpu_set_information_delegate = BOOL (WINAPI *)(PSYSTEM_CPU_SET_INFORMATION, ULONG, PULONG, HANDLE, ULONG);
+
+            auto const maybe_kernel = get_module("kernel32.dll");
+            if (!maybe_kernel.has_value()) {
+                return {};
+            }
+            auto const get_information = reinterpret_cast<get_system_cpu_set_information_delegate>(
+                GetProcAddress(maybe_kernel.value().native_handle(), "GetSystemCpuSetInformation"));
+            if (get_information == nullptr) {
+                return {};
+            }
+
+            ULONG length{};
+            std::ignore = get_information(nullptr, 0UL, &length, GetCurrentProcess(), 0UL);
+            if (length == 0UL) {
+                return {};
+            }
+
+            auto buffer = std::make_unique<std::byte[]>(length);
+            if (get_information(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.get()), length, &length, GetCurrentProcess(), 0UL) != TRUE) {
+                return {};
+            }
+
+            std::vector<cpu_set_info> cpu_sets{};
+            for (ULONG offset = 0UL; offset < length;) {
+                auto const& entry = *reinterpret_cast<SYSTEM_CPU_SET_INFORMATION const*>(buffer.get() + offset);
+                if (entry.Size == 0UL) {
+                    break;
+                }
+                if (entry.Type == CpuSetInformation) {
+                    cpu_sets.push_back(cpu_set_info{
+                        entry.CpuSet.Id,
+                        entry.CpuSet.Group,
+                        entry.CpuSet.LogicalProcessorIndex,
+                        entry.CpuSet.CoreIndex,
+                        entry.CpuSet.LastLevelCacheIndex,
+                        entry.CpuSet.NumaNodeIndex,
+                        entry.CpuSet.EfficiencyClass,
+                    });
+                }
+                offset += entry.Size;
+            }
+            return cpu_sets;
+        }
+    }
+
+    processor_topology processor_topology::query()
+    {
+        processor_topology topology{};
+
+        DWORD length{};
+        auto const buffer = get_logical_processor_information(length);
+
+        for (DWORD offset = 0UL; offset < length;) {
+            auto const& entry = *reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const*>(buffer.get() + offset);
+            if (entry.Size == 0UL) {
+                break;
+            }
+
+            switch (entry.Relationship) {  // NOLINT(clang-diagnostic-switch-enum)
+            case RelationProcessorCore:
+                for (WORD index = 0; index < entry.Processor.GroupCount; ++index) {
+                    topology.cores_.push_back(processor_core_info{
+                        (entry.Processor.Flags & LTP_PC_SMT) != 0,
+                        entry.Processor.EfficiencyClass,
+                        to_group_affinity(entry.Processor.GroupMask[index]),
+                    });
+                }
+                break;
+            case RelationNumaNode:
+                topology.numa_nodes_.push_back(numa_node_info{ entry.NumaNode.NodeNumber, to_group_affinity(entry.NumaNode.GroupMask) });
+                break;
+            case RelationCache:
+                topology.caches_.push_back(processor_cache_info{
+                    entry.Cache.Level,
+                    to_cache_kind(entry.Cache.Type),
+                    entry.Cache.LineSize,
+                    entry.Cache.CacheSize,
+                    to_group_affinity(entry.Cache.GroupMask),
+                });
+                break;
+            case RelationGroup:
+                for (WORD index = 0; index < entry.Group.ActiveGroupCount; ++index) {
+                    auto const& group = entry.Group.GroupInfo[index];
+                    topology.groups_.push_back(processor_group_info{
+                        index,
+                        group.MaximumProcessorCount,
+                        group.ActiveProcessorCount,
+                        group.ActiveProcessorMask,
+                    });
+                }
+                break;
+            default:
+                break;
+            }
+            offset += entry.Size;
+        }
+
+        topology.cpu_sets_ = get_cpu_sets();
+        return topology;
+    }
+
+    std::vector<processor_group_info> const& processor_topology::groups() const noexcept
+    {
+        return groups_;
+    }
+
+    std::vector<numa_node_info> const& processor_topology::numa_nodes() const noexcept
+    {
+        return numa_nodes_;
+    }
+
+    std::vector<processor_core_info> const& processor_topology::cores() const noexcept
+    {
+        return cores_;
+    }
+
+    std::vector<processor_cache_info> const& processor_topology::caches() const noexcept
+    {
+        return caches_;
+    }
+
+    std::vector<cpu_set_info> const& processor_topology::cpu_sets() const noexcept
+    {
+        return cpu_sets_;
+    }
+
+    std::size_t processor_topology::logical_processor_count() const noexcept
+    {
+        std::size_t count{};
+        for (auto const& group : groups_) {
+            count += group.active_processor_count;
+        }
+        return count;
+    }
+
+    std::optional<DWORD> processor_topology::numa_node_of(processor_number const& processor) const noexcept
+    {
+        if (processor.number >= sizeof(KAFFINITY) * 8) {
+            return std::nullopt;
+        }
+        auto const bit = static_cast<KAFFINITY>(1) << processor.number;
+        for (auto const& node : numa_nodes_) {
+            if (node.affinity.group == processor.group && (node.affinity.mask & bit) != 0) {
+                return node.node;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<group_affinity> processor_topology::cache_sharing_sets(BYTE const level) const
+    {
+        std::vector<group_affinity> sets{};
+        for (auto const& cache : caches_) {
+            if (cache.level != level || cache.kind == cache_kind::instruction) {
+                continue;
+            }
+            // split L1 caches report data and instruction separately, only one entry per set is wanted
+            bool duplicate{};
+            for (auto const& existing : sets) {
+                duplicate = duplicate || existing == cache.affinity;
+            }
+            if (!duplicate) {
+                sets.push_back(cache.affinity);
+            }
+        }
+        return sets;
+    }
+}
@@ -0,0 +1,317 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/scheduler.h>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/windows_exception.h>
+#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <ratio>
+#include <tuple>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    namespace details
+    {
+        struct scheduled_task final
+        {
+            scheduled_task(std::weak_ptr<scheduler_state> owner, scheduler::task_callback callback, scheduler::clock::duration const period)
+                : owner(std::move(owner))
+                , callback(std::move(callback))
+                , period(period)
+            {
+            }
+
+            std::weak_ptr<scheduler_state> const owner;
+            scheduler::task_callback callback;
+            scheduler::clock::duration const period;
+            std::atomic<bool> cancelled{};
+            std::atomic<bool> completed{};
+            scheduler::clock::time_point deadline{};
+
+            // posted to the executor, keep_alive holds the task until the callback has run
+            executor_work work{};
+            std::shared_ptr<scheduled_task> keep_alive{};
+        };
+
+        struct scheduler_state final : std::enable_shared_from_this<scheduler_state>
+        {
+            struct entry final
+            {
+                scheduler::clock::time_point deadline{};
+                std::uint64_t sequence{};
+                std::shared_ptr<scheduled_task> task{};
+            };
+
+            // orders the heap so the earliest deadline, then the earliest scheduled, is at the front
+            struct later final
+            {
+                [[nodiscard]]
+                bool operator()(entry const& left, entry const& right) const noexcept
+                {
+                    return left.deadline != right.deadline
+                        ? left.deadline > right.deadline
+                        : left.sequence > right.sequence;
+                }
+            };
+
+            scheduler_state(executor& target, std::chrono::milliseconds const tolerable_delay) noexcept
+                : target(target)
+                , tolerable_delay(tolerable_delay)
+            {
+            }
+
+            executor& target;
+            std::chrono::milliseconds const tolerable_delay;
+            PTP_TIMER timer{};
+
+            mutable slim_lock lock{};
+            condition_variable idle{};
+            std::vector<entry> heap{};
+            std::uint64_t next_sequence{};
+            std::size_t in_flight{};
+            bool stopping{};
+            std::optional<scheduler::clock::time_point> armed_for{};
+
+            std::atomic<std::size_t> unhandled_exceptions{};
+
+            static void CALLBACK on_timer(PTP_CALLBACK_INSTANCE, void* context, PTP_TIMER)
+            {
+                static_cast<scheduler_state*>(context)->dispatch_due();
+            }
+
+            static void run(void* context)
+            {
+                auto* const task = static_cast<scheduled_task*>(context);
+                auto const self = std::move(task->keep_alive);
+                if (auto const state = self->owner.lock(); state != nullptr) {
+                    state->execute(self);
+                }
+            }
+
+            void push(scheduler::clock::time_point const deadline, std::shared_ptr<scheduled_task> task)
+            {
+                task->deadline = deadline;
+                heap.push_back(entry{ deadline, next_sequence++, std::move(task) });
+                std::push_heap(heap.begin(), heap.end(), later{});
+                if (!armed_for.has_value() || deadline < *armed_for) {
+                    arm();
+                }
+            }
+
+            /// <summary>
+            /// arms the timer for the front of the heap, or disarms it if the heap is empty; called with lock held
+            /// </summary>
+            void arm() noexcept
+            {
+                if (heap.empty()) {
+                    armed_for.reset();
+                    SetThreadpoolTimer(timer, nullptr, 0UL, 0UL);
+                    return;
+                }
+
+                auto const deadline = heap.front().deadline;
+                auto const wait = std::chrono::ceil<std::chrono::duration<long long, std::ratio<1, 10'000'000>>>(deadline - scheduler::clock::now());
+
+                // negative due times are relative, using at least one interval as zero would be an absolute time
+                ULARGE_INTEGER due{};
+                due.QuadPart = static_cast<ULONGLONG>(-(std::max)(wait.count(), 1LL));
+                FILETIME due_time{};
+                due_time.dwLowDateTime = due.LowPart;
+                due_time.dwHighDateTime = due.HighPart;
+
+                armed_for = deadline;
+                SetThreadpoolTimer(timer, &due_time, 0UL, static_cast<DWORD>(tolerable_delay.count()));
+            }
+
+            void dispatch_due()
+            {
+                std::vector<std::shared_ptr<scheduled_task>> due{};
+                std::vector<std::shared_ptr<scheduled_task>> cancelled{};
+                {
+                    slim_lock_guard guard{ lock };
+                    if (stopping) {
+                        return;
+                    }
+                    auto const now = scheduler::clock::now();
+                    while (!heap.empty() && heap.front().deadline <= now) {
+                        std::pop_heap(heap.begin(), heap.end(), later{});
+                        auto task = std::move(heap.back().task);
+                        heap.pop_back();
+                        auto& destination = task->cancelled.load(std::memory_order_acquire) ? cancelled : due;
+                        destination.push_back(std::move(task));
+                    }
+                    in_flight += due.size();
+                    arm();
+                }
+
+                for (auto& task : due) {
+                    auto* const raw = task.get();
+                    raw->work = executor_work{ &scheduler_state::run, raw };
+                    raw->keep_alive = std::move(task);
+                    if (!target.post(raw->work)) {
+                        // run on the timer callback rather than lose the task
+                        run(raw);
+                    }
+                }
+            }
+
+            void execute(std::shared_ptr<scheduled_task> const& task)
+            {
+                if (!task->cancelled.load(std::memory_order_acquire)) {
+                    try {
+                        task->callback();
+                    } catch (...) {
+                        unhandled_exceptions.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                slim_lock_guard guard{ lock };
+                if (task->period > scheduler::clock::duration::zero() && !stopping && !task->cancelled.load(std::memory_order_acquire)) {
+                    // skip whole periods which elapsed while running so a slow callback doesn't run back to back
+                    auto const now = scheduler::clock::now();
+                    auto next = task->deadline + task->period;
+                    if (next <= now) {
+                        next += ((now - next) / task->period + 1) * task->period;
+                    }
+                    push(next, task);
+                } else {
+                    task->completed.store(true, std::memory_order_release);
+                }
+                if (--in_flight == 0) {
+                    idle.notify_all();
+                }
+            }
+
+            [[nodiscard]]
+            bool remove(scheduled_task const* const task)
+            {
+                // released after the lock so the callback isn't destroyed while holding it
+                std::shared_ptr<scheduled_task> removed{};
+                slim_lock_guard guard{ lock };
+                auto const found = std::find_if(heap.begin(), heap.end(), [task](entry const& item) {
+                    return item.task.get() == task;
+                });
+                if (found == heap.end()) {
+                    return false;
+                }
+                removed = std::move(found->task);
+                heap.erase(found);
+                std::make_heap(heap.begin(), heap.end(), later{});
+                if (heap.empty()) {
+                    arm();
+                }
+                return true;
+            }
+        };
+    }
+
+    scheduled_task_token::scheduled_task_token(std::weak_ptr<details::scheduled_task> task) noexcept
+        : task_{ std::move(task) }
+    {
+    }
+
+    bool scheduled_task_token::cancel() const noexcept
+    {
+        auto const task = task_.lock();
+        if (task == nullptr || task->completed.load(std::memory_order_acquire) || task->cancelled.exchange(true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        if (auto const state = task->owner.lock(); state != nullptr) {
+            std::ignore = state->remove(task.get());
+        }
+        return true;
+    }
+
+    bool scheduled_task_token::is_cancelled() const noexcept
+    {
+        auto const task = task_.lock();
+        return task != nullptr && task->cancelled.load(std::memory_order_acquire);
+    }
+
+    bool scheduled_task_token::is_active() const noexcept
+    {
+        auto const task = task_.lock();
+        return task != nullptr && !task->cancelled.load(std::memory_order_acquire) && !task->completed.load(std::memory_order_acquire);
+    }
+
+    scheduler::scheduler(executor& target, std::chrono::milliseconds const tolerable_delay)
+        : state_{ std::make_shared<details::scheduler_state>(target, tolerable_delay) }
+    {
+        if (tolerable_delay < std::chrono::milliseconds(0)) {
+            throw std::invalid_argument("tolerable_delay must be greater than or equal to zero");
+        }
+        state_->timer = CreateThreadpoolTimer(&details::scheduler_state::on_timer, state_.get(), nullptr);
+        if (state_->timer == nullptr) {
+            throw windows_exception();
+        }
+    }
+
+    scheduler::~scheduler()
+    {
+        shutdown();
+        CloseThreadpoolTimer(state_->timer);
+    }
+
+    std::size_t scheduler::size() const
+    {
+        slim_lock_guard guard{ state_->lock };
+        return state_->heap.size();
+    }
+
+    std::size_t scheduler::unhandled_exception_count() const noexcept
+    {
+        return state_->unhandled_exceptions.load(std::memory_order_relaxed);
+    }
+
+    void scheduler::shutdown()
+    {
+        std::vector<details::scheduler_state::entry> discarded{};
+        {
+            slim_lock_guard guard{ state_->lock };
+            if (state_->stopping) {
+                return;
+            }
+            state_->stopping = true;
+            discarded.swap(state_->heap);
+            state_->arm();
+        }
+        WaitForThreadpoolTimerCallbacks(state_->timer, TRUE);
+
+        unique_slim_lock guard{ state_->lock };
+        state_->idle.wait(guard, [this] { return state_->in_flight == 0; });
+    }
+
+    scheduled_task_token scheduler::schedule(clock::time_point const deadline, clock::duration const period, task_callback callback)
+    {
+        if (!callback) {
+            throw std::invalid_argument("callback cannot be empty");
+        }
+        auto task = std::make_shared<details::scheduled_task>(state_, std::move(callback), period);
+        scheduled_task_token token{ task };
+
+        slim_lock_guard guard{ state_->lock };
+        if (state_->stopping) {
+            throw std::logic_error("scheduler has been shut down");
+        }
+        state_->push(deadline, std::move(task));
+        return token;
+    }
+
+}
@@ -12,10 +12,41 @@
 // 
 
 #include <modern_win32/threading/semaphore.h>
+#include <modern_win32/module_handle.h>
 #include <modern_win32/windows_exception.h>
 
 namespace modern_win32::threading
 {
+    namespace
+    {
+        using nt_status = LONG;
+
+        constexpr int semaphore_basic_information_class = 0;
+
+        struct semaphore_basic_information final
+        {
+            LONG CurrentCount;
+            LONG MaximumCount;
+        };
+
+        using nt_query_semaphore_delegate = nt_status (WINAPI *)(HANDLE, int, PVOID, ULONG, PULONG);
+
+        [[nodiscard]]
+        nt_query_semaphore_delegate get_nt_query_semaphore() noexcept
+        {
+            static auto const delegate = []() -> nt_query_semaphore_delegate {
+                auto const maybe_ntdll = get_module("ntdll.dll");
+                if (!maybe_ntdll.has_value()) {
+                    return nullptr;
+                }
+                // ntdll is never unloaded so the address remains valid once the module handle is released
+                return reinterpret_cast<nt_query_semaphore_delegate>(
+                    GetProcAddress(maybe_ntdll.value().native_handle(), "NtQuerySemaphore"));
+            }();
+            return delegate;
+        }
+    }
+
     auto semaphore_traits::create(int const initial_count, int const maximum_count) -> native_handle_type
     {
         auto const handle = CreateSemaphoreA(nullptr, initial_count, maximum_count, nullptr);
@@ -36,8 +67,22 @@ namespace modern_win32::threading
         throw windows_exception(error.native_error_code());
     }
 
-    auto semaphore_traits::release(modern_handle_type handle, int count) -> bool
+    auto semaphore_traits::release(native_handle_type handle, int count) -> bool
+    {
+        return ReleaseSemaphore(handle, count, nullptr) == TRUE;
+    }
+
+    auto semaphore_traits::current_count(native_handle_type const handle) noexcept -> std::optional<int>
     {
-        return ReleaseSemaphore(handle.native_handle(), count, nullptr) == TRUE;
+        auto const query = get_nt_query_semaphore();
+        if (query == nullptr) {
+            return std::nullopt;
+        }
+
+        semaphore_basic_information information{};
+        if (query(handle, semaphore_basic_information_class, &information, sizeof(information), nullptr) < 0) {
+            return std::nullopt;
+        }
+        return static_cast<int>(information.CurrentCount);
     }
 }
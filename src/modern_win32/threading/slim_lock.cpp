@@ -12,6 +12,8 @@
 // 
 
 #include <modern_win32/threading/slim_lock.h>
+#include <algorithm>
+#include <tuple>
 
 namespace modern_win32::threading
 {
@@ -21,10 +23,10 @@ slim_lock::slim_lock()
     InitializeSRWLock(&lock_);
 }
 
-slim_lock::slim_lock(slim_lock&& other) noexcept 
-    : lock_(other.lock_)
+slim_lock::slim_lock(slim_lock&&) noexcept 
 {
-    InitializeSRWLock(&other.lock_);
+    // an SRWLOCK must not be copied, the new lock starts unlocked and the source is left untouched
+    InitializeSRWLock(&lock_);
 }
 
 void slim_lock::lock() noexcept
@@ -37,9 +39,64 @@ bool slim_lock::try_lock() noexcept
     return TryAcquireSRWLockExclusive(&lock_) != 0;
 }
 
+bool slim_lock::timed_lock(std::chrono::steady_clock::time_point const deadline, bool const shared) noexcept
+{
+    auto const try_acquire = [this, shared]()
+    {
+        return shared
+            ? TryAcquireSRWLockShared(&lock_) != 0
+            : TryAcquireSRWLockExclusive(&lock_) != 0;
+    };
+
+    constexpr int spin_count = 64;
+    for (int spin = 0; spin < spin_count; ++spin) {
+        if (try_acquire()) {
+            return true;
+        }
+        YieldProcessor();
+    }
+
+    ++timed_waiters_;
+    auto first_park = true;
+    bool acquired{};
+    while (true) {
+        // parked on the lock word itself, any release changes it so a release between reading it and parking
+        // returns from the wait immediately
+        void* observed = ReadPointerAcquire(&lock_.Ptr);
+        if ((acquired = try_acquire())) {
+            break;
+        }
+        auto const now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            break;
+        }
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+        if (first_park) {
+            // an unlock which read timed_waiters_ before it was incremented does not wake, every later one does
+            remaining = (std::min)(remaining, std::chrono::milliseconds(1));
+            first_park = false;
+        }
+        std::ignore = WaitOnAddress(&lock_.Ptr, &observed, sizeof(observed), static_cast<DWORD>(remaining.count()));
+    }
+    --timed_waiters_;
+    return acquired;
+}
+
+void slim_lock::wake_timed_waiters(void* const address) noexcept
+{
+    // address only, by now the next owner may have destroyed the lock
+    WakeByAddressAll(address);
+}
+
 void slim_lock::unlock() noexcept
 {
+    // read before releasing, once released this object must not be touched
+    bool const wake = timed_waiters_.load() != 0;
+    void* const address = &lock_.Ptr;
     ReleaseSRWLockExclusive(&lock_);
+    if (wake) {
+        wake_timed_waiters(address);
+    }
 }
 void slim_lock::lock_shared() noexcept
 {
@@ -51,7 +108,12 @@ bool slim_lock::try_lock_shared() noexcept
 }
 void slim_lock::unlock_shared() noexcept
 {
+    bool const wake = timed_waiters_.load() != 0;
+    void* const address = &lock_.Ptr;
     ReleaseSRWLockShared(&lock_);
+    if (wake) {
+        wake_timed_waiters(address);
+    }
 }
 
 slim_lock::native_handle_type slim_lock::native_handle() noexcept
@@ -59,19 +121,9 @@ slim_lock::native_handle_type slim_lock::native_handle() noexcept
     return &lock_;
 }
 
-slim_lock& slim_lock::operator=(slim_lock&& other) noexcept 
+slim_lock& slim_lock::operator=(slim_lock&&) noexcept 
 {
-    if (this == &other)
-        return *this;
-
-    unlock();
-    unlock_shared();
-
-    lock_ = other.lock_;
-    
-    other.lock_ = SRWLOCK{};
-    InitializeSRWLock(&other.lock_);
-
+    // neither lock may be held while moving so there is no state to transfer, both remain unlocked
     return *this;
 }
 
@@ -0,0 +1,99 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/striped_shared_lock.h>
+
+namespace modern_win32::threading
+{
+    namespace
+    {
+        [[nodiscard]]
+        std::size_t default_stripe_count() noexcept
+        {
+            auto const count = static_cast<std::size_t>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS));
+            return count == 0 ? 1 : count;
+        }
+
+        [[nodiscard]]
+        std::size_t current_processor_index() noexcept
+        {
+            PROCESSOR_NUMBER processor{};
+            GetCurrentProcessorNumberEx(&processor);
+            return static_cast<std::size_t>(processor.Group) * 64 + processor.Number;
+        }
+    }
+
+    striped_shared_lock::striped_shared_lock(std::size_t const stripe_count)
+        : stripe_count_(stripe_count == 0 ? default_stripe_count() : stripe_count)
+        , stripes_(std::make_unique<stripe[]>(stripe_count_))
+    {
+    }
+
+    void striped_shared_lock::lock() noexcept
+    {
+        for (std::size_t i = 0; i < stripe_count_; ++i) {
+            stripes_[i].lock();
+        }
+    }
+
+    bool striped_shared_lock::try_lock() noexcept
+    {
+        for (std::size_t i = 0; i < stripe_count_; ++i) {
+            if (!stripes_[i].try_lock()) {
+                release_exclusive(i);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void striped_shared_lock::unlock() noexcept
+    {
+        release_exclusive(stripe_count_);
+    }
+
+    void striped_shared_lock::lock_shared() noexcept
+    {
+        current_stripe().lock_shared();
+    }
+
+    bool striped_shared_lock::try_lock_shared() noexcept
+    {
+        return current_stripe().try_lock_shared();
+    }
+
+    void striped_shared_lock::unlock_shared() noexcept
+    {
+        current_stripe().unlock_shared();
+    }
+
+    std::size_t striped_shared_lock::stripe_count() const noexcept
+    {
+        return stripe_count_;
+    }
+
+    striped_shared_lock::stripe& striped_shared_lock::current_stripe() noexcept
+    {
+        // sampled once per thread, re-sampling on every call would let a migrated thread release a stripe it never acquired
+        thread_local std::size_t const home_processor = current_processor_index();
+        return stripes_[home_processor % stripe_count_];
+    }
+
+    void striped_shared_lock::release_exclusive(std::size_t count) noexcept
+    {
+        while (count > 0) {
+            stripes_[--count].unlock();
+        }
+    }
+
+}
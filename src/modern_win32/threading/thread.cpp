@@ -13,11 +13,71 @@
 
 #include <modern_win32/threading/thread.h>
 #include <modern_win32/module_handle.h>
+#include <modern_win32/numa.h>
+#include <modern_win32/qpc_clock.h>
 #include <modern_win32/string.h>
+#include <modern_win32/tracing.h>
 #include <modern_win32/wait_for.h>
+#include <array>
+#include <string_view>
+#include <tuple>
 
 namespace modern_win32::threading
 {
+    namespace
+    {
+        /// <summary>
+        /// CreateThread reporting each new thread and the time taken to create it when traced
+        /// </summary>
+        [[nodiscard]]
+        HANDLE create_thread(SIZE_T const stack_size, thread::thread_proc const worker, thread::thread_parameter const parameter,
+            DWORD const creation_flags, DWORD& thread_id) noexcept
+        {
+            if (!tracing::is_enabled(tracing::keyword::thread))
+                return CreateThread(nullptr, stack_size, worker, parameter, creation_flags, &thread_id);  // NOLINT(clang-diagnostic-microsoft-cast)
+
+            auto const started = qpc_clock::ticks();
+            auto const handle = CreateThread(nullptr, stack_size, worker, parameter, creation_flags, &thread_id);  // NOLINT(clang-diagnostic-microsoft-cast)
+            if (handle != nullptr)
+                tracing::thread_created(thread_id, qpc_clock::ticks() - started);
+            return handle;
+        }
+
+        struct mmcss_launch final
+        {
+            thread::thread_proc worker;
+            thread::thread_parameter parameter;
+            std::wstring task_name;
+        };
+
+        DWORD __stdcall mmcss_adapter(void* state)
+        {
+            // MMCSS registration only applies to the calling thread so it has to happen on the new thread
+            using set_characteristics_delegate = HANDLE (WINAPI *)(LPCWSTR, LPDWORD);
+            using revert_characteristics_delegate = BOOL (WINAPI *)(HANDLE);
+
+            std::unique_ptr<mmcss_launch> const launch(static_cast<mmcss_launch*>(state));
+            module_handle const avrt{ LoadLibraryExW(L"avrt.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32) };
+
+            HANDLE task{};
+            revert_characteristics_delegate revert{};
+            if (avrt) {
+                auto const set_characteristics = reinterpret_cast<set_characteristics_delegate>(GetProcAddress(avrt.native_handle(), "AvSetMmThreadCharacteristicsW"));
+                revert = reinterpret_cast<revert_characteristics_delegate>(GetProcAddress(avrt.native_handle(), "AvRevertMmThreadCharacteristics"));
+                DWORD task_index{};
+                if (set_characteristics != nullptr) {
+                    task = set_characteristics(launch->task_name.c_str(), &task_index);
+                }
+            }
+
+            auto const exit_code = launch->worker(launch->parameter);
+
+            if (task != nullptr && revert != nullptr) {
+                std::ignore = revert(task);
+            }
+            return exit_code;
+        }
+    }
 
     thread::thread(std::unique_ptr<thread_start> worker)
         : handle_(thread_handle::invalid())
@@ -63,6 +123,55 @@ namespace modern_win32::threading
         return get_thread_name(handle_.native_handle());
     }
 
+    bool thread::set_group_affinity(group_affinity const& affinity) const
+    {
+        if (!is_running())
+            return false;
+        return set_thread_group_affinity(handle_.native_handle(), affinity);
+    }
+
+    std::optional<group_affinity> thread::get_group_affinity() const
+    {
+        if (!is_running())
+            return std::nullopt;
+        return get_thread_group_affinity(handle_.native_handle());
+    }
+
+    bool thread::set_numa_node(DWORD const node) const
+    {
+        if (!is_running())
+            return false;
+        return set_thread_numa_node(handle_.native_handle(), node);
+    }
+
+    bool thread::set_ideal_processor(processor_number const& processor) const
+    {
+        if (!is_running())
+            return false;
+        return set_thread_ideal_processor(handle_.native_handle(), processor);
+    }
+
+    std::optional<processor_number> thread::get_ideal_processor() const
+    {
+        if (!is_running())
+            return std::nullopt;
+        return get_thread_ideal_processor(handle_.native_handle());
+    }
+
+    bool thread::set_selected_cpu_sets(std::vector<ULONG> const& cpu_set_ids) const
+    {
+        if (!is_running())
+            return false;
+        return set_thread_selected_cpu_sets(handle_.native_handle(), cpu_set_ids);
+    }
+
+    std::optional<std::vector<ULONG>> thread::get_selected_cpu_sets() const
+    {
+        if (!is_running())
+            return std::nullopt;
+        return get_thread_selected_cpu_sets(handle_.native_handle());
+    }
+
     auto thread::exit_code() const-> std::optional<int>
     {
         if (!static_cast<bool>(handle_))
@@ -92,28 +201,59 @@ namespace modern_win32::threading
         return GetCurrentThreadId();
     }
 
-    thread start_thread(thread::thread_proc const worker, thread::thread_parameter parameter)
+    windows_result<thread> try_start_thread(thread_options const& options, thread::thread_proc const worker, thread::thread_parameter parameter)
+    {
+        thread new_thread;
+        if (!new_thread.start(worker, parameter, options))
+            return windows_error_details();
+        return new_thread;
+    }
+
+    windows_result<thread> try_start_thread(thread::thread_proc const worker, thread::thread_parameter parameter) noexcept
     {
         thread new_thread;
         if (!new_thread.start(worker, parameter))
-            throw windows_exception();
+            return windows_error_details();
         return new_thread;
     }
 
-    thread start_thread(thread_start* const worker)
+    windows_result<thread> try_start_thread(thread_start* const worker) noexcept
     {
         thread new_thread;
         if (!new_thread.start(worker))
-            throw windows_exception();
+            return windows_error_details();
         return new_thread;
     }
 
+    thread start_thread(thread_options const& options, thread::thread_proc const worker, thread::thread_parameter parameter)
+    {
+        return try_start_thread(options, worker, parameter).value();
+    }
+
+    thread start_thread(thread::thread_proc const worker, thread::thread_parameter parameter)
+    {
+        return try_start_thread(worker, parameter).value();
+    }
+
+    thread start_thread(thread_start* const worker)
+    {
+        return try_start_thread(worker).value();
+    }
+
     bool thread::start(thread_proc worker, thread_parameter parameter) 
     {
         if (is_running() || thread_start_ != nullptr) {
             return false;
         }
-        return handle_.reset(CreateThread(nullptr, 0, worker, parameter, 0, &thread_id_));  // NOLINT(clang-diagnostic-microsoft-cast)
+        return handle_.reset(create_thread(0, worker, parameter, 0, thread_id_));
+    }
+
+    bool thread::start(thread_proc worker, thread_parameter parameter, thread_options const& options)
+    {
+        if (is_running() || thread_start_ != nullptr) {
+            return false;
+        }
+        return create(worker, parameter, options);
     }
 
     bool thread::start(thread_start* worker) 
@@ -121,7 +261,7 @@ namespace modern_win32::threading
         if (is_running() || thread_start_ != nullptr) {
             return false;
         }
-        return handle_.reset(CreateThread(nullptr, 0, thread_start::thread_proc, static_cast<thread_parameter>(worker), 0, &thread_id_));  // NOLINT(clang-diagnostic-microsoft-cast)
+        return handle_.reset(create_thread(0, thread_start::thread_proc, static_cast<thread_parameter>(worker), 0, thread_id_));
     }
 
     bool thread::start()
@@ -129,7 +269,89 @@ namespace modern_win32::threading
         if (is_running() || thread_start_ == nullptr) {
             return false;
         }
-        return handle_.reset(CreateThread(nullptr, 0, thread_start::thread_proc, thread_start_.get(), 0, &thread_id_));  // NOLINT(clang-diagnostic-microsoft-cast)
+        return handle_.reset(create_thread(0, thread_start::thread_proc, thread_start_.get(), 0, thread_id_));
+    }
+
+    bool thread::start(thread_start* worker, thread_options const& options)
+    {
+        if (is_running() || thread_start_ != nullptr) {
+            return false;
+        }
+        return create(thread_start::thread_proc, static_cast<thread_parameter>(worker), options);
+    }
+
+    bool thread::start(thread_options const& options)
+    {
+        if (is_running() || thread_start_ == nullptr) {
+            return false;
+        }
+        return create(thread_start::thread_proc, thread_start_.get(), options);
+    }
+
+    bool thread::set_priority(thread_priority const priority) const
+    {
+        if (!is_running())
+            return false;
+        return SetThreadPriority(handle_.native_handle(), static_cast<int>(priority)) == TRUE;
+    }
+
+    std::optional<thread_priority> thread::get_priority() const
+    {
+        if (!is_running())
+            return std::nullopt;
+        auto const priority = GetThreadPriority(handle_.native_handle());
+        return priority != THREAD_PRIORITY_ERROR_RETURN
+            ? std::optional(static_cast<thread_priority>(priority))
+            : std::nullopt;
+    }
+
+    bool thread::set_priority_boost(bool const enabled) const
+    {
+        if (!is_running())
+            return false;
+        // SetThreadPriorityBoost takes whether boosting is disabled
+        return SetThreadPriorityBoost(handle_.native_handle(), enabled ? FALSE : TRUE) == TRUE;
+    }
+
+    bool thread::resume() const
+    {
+        if (!static_cast<bool>(handle_))
+            return false;
+        return ResumeThread(handle_.native_handle()) != static_cast<DWORD>(-1);
+    }
+
+    bool thread::create(thread_proc worker, thread_parameter parameter, thread_options const& options)
+    {
+        std::unique_ptr<mmcss_launch> launch{};
+        if (options.mmcss_task.has_value()) {
+            launch = std::make_unique<mmcss_launch>(mmcss_launch{ worker, parameter, options.mmcss_task.value() });
+            worker = mmcss_adapter;
+            parameter = launch.get();
+        }
+
+        // priority settings must be in place before the worker runs, so the thread is held until they are applied
+        bool const configure = options.priority.has_value() || options.disable_priority_boost;
+        DWORD creation_flags = options.start_suspended || configure ? CREATE_SUSPENDED : 0UL;
+        if (options.stack_reservation != 0) {
+            creation_flags |= STACK_SIZE_PARAM_IS_A_RESERVATION;
+        }
+
+        if (!handle_.reset(create_thread(options.stack_reservation, worker, parameter, creation_flags, thread_id_))) {
+            return false;
+        }
+        // owned by mmcss_adapter once the thread exists
+        std::ignore = launch.release();
+
+        if (options.priority.has_value()) {
+            std::ignore = SetThreadPriority(handle_.native_handle(), static_cast<int>(options.priority.value()));
+        }
+        if (options.disable_priority_boost) {
+            std::ignore = SetThreadPriorityBoost(handle_.native_handle(), TRUE);
+        }
+        if (configure && !options.start_suspended) {
+            std::ignore = resume();
+        }
+        return true;
     }
 
     void thread::join() const
@@ -177,7 +399,15 @@ namespace modern_win32::threading
         auto const worker = static_cast<thread_worker>(state);  // NOLINT(clang-diagnostic-microsoft-cast)
         if (worker == nullptr)
             return 1;
+        if (!tracing::is_enabled(tracing::keyword::thread)) {
+            worker();
+            return 0;
+        }
+
+        tracing::thread_started();
+        auto const started = qpc_clock::ticks();
         worker();
+        tracing::thread_exited(0, qpc_clock::ticks() - started);
         return 0;
     }
 
@@ -203,6 +433,16 @@ namespace modern_win32::threading
 
     bool set_thread_name(thread_handle::native_handle_type const handle, char const* name) 
     {
+        if (name == nullptr)
+            return set_thread_name(handle, L"");
+
+        // thread names are short so convert on the stack, only unusually long names need an allocation
+        std::array<wchar_t, 256> buffer{};
+        if (auto const written = convert::try_to_wstring(std::string_view(name), buffer.data(), buffer.size() - 1U); written.has_value()) {
+            buffer[written.value()] = L'\0';
+            return set_thread_name(handle, buffer.data());
+        }
+
         auto const wide_name = convert::to_wstring(name);
         return set_thread_name(handle, wide_name.c_str());
     }
@@ -230,4 +470,80 @@ namespace modern_win32::threading
         return std::nullopt;
     }
 
-}
\ No newline at end of file
+    bool set_thread_group_affinity(thread_handle::native_handle_type const handle, group_affinity const& affinity)
+    {
+        GROUP_AFFINITY native_affinity{};
+        native_affinity.Group = affinity.group;
+        native_affinity.Mask = affinity.mask;
+        return SetThreadGroupAffinity(handle, &native_affinity, nullptr) == TRUE;
+    }
+
+    std::optional<group_affinity> get_thread_group_affinity(thread_handle::native_handle_type const handle)
+    {
+        GROUP_AFFINITY native_affinity{};
+        if (GetThreadGroupAffinity(handle, &native_affinity) != TRUE)
+            return std::nullopt;
+        return group_affinity{ native_affinity.Group, native_affinity.Mask };
+    }
+
+    bool set_thread_numa_node(thread_handle::native_handle_type const handle, DWORD const node)
+    {
+        auto const affinity = get_numa_node_affinity(node);
+        return affinity.has_value() && set_thread_group_affinity(handle, affinity.value());
+    }
+
+    bool set_thread_ideal_processor(thread_handle::native_handle_type const handle, processor_number const& processor)
+    {
+        PROCESSOR_NUMBER native_processor{};
+        native_processor.Group = processor.group;
+        native_processor.Number = processor.number;
+        return SetThreadIdealProcessorEx(handle, &native_processor, nullptr) == TRUE;
+    }
+
+    std::optional<processor_number> get_thread_ideal_processor(thread_handle::native_handle_type const handle)
+    {
+        PROCESSOR_NUMBER native_processor{};
+        if (GetThreadIdealProcessorEx(handle, &native_processor) != TRUE)
+            return std::nullopt;
+        return processor_number{ native_processor.Group, native_processor.Number };
+    }
+
+    bool set_thread_selected_cpu_sets(thread_handle::native_handle_type const handle, std::vector<ULONG> const& cpu_set_ids)
+    {
+        using set_thread_selected_cpu_sets_delegate = BOOL (WINAPI *)(HANDLE, ULONG const*, ULONG);
+        auto const maybe_kernel = get_module("kernel32.dll");
+        if (!maybe_kernel.has_value())
+            return false;
+
+        auto const set_delegate = reinterpret_cast<set_thread_selected_cpu_sets_delegate>(GetProcAddress(maybe_kernel.value().native_handle(), "SetThreadSelectedCpuSets"));
+        if (set_delegate == nullptr)
+            return false;
+
+        return set_delegate(handle, cpu_set_ids.empty() ? nullptr : cpu_set_ids.data(), static_cast<ULONG>(cpu_set_ids.size())) == TRUE;
+    }
+
+    std::optional<std::vector<ULONG>> get_thread_selected_cpu_sets(thread_handle::native_handle_type const handle)
+    {
+        using get_thread_selected_cpu_sets_delegate = BOOL (WINAPI *)(HANDLE, PULONG, ULONG, PULONG);
+        auto const maybe_kernel = get_module("kernel32.dll");
+        if (!maybe_kernel.has_value())
+            return std::nullopt;
+
+        auto const get_delegate = reinterpret_cast<get_thread_selected_cpu_sets_delegate>(GetProcAddress(maybe_kernel.value().native_handle(), "GetThreadSelectedCpuSets"));
+        if (get_delegate == nullptr)
+            return std::nullopt;
+
+        ULONG required_count{};
+        if (get_delegate(handle, nullptr, 0UL, &required_count) == TRUE)
+            return std::optional(std::vector<ULONG>{});
+        if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            return std::nullopt;
+
+        std::vector<ULONG> cpu_set_ids(required_count);
+        if (get_delegate(handle, cpu_set_ids.data(), static_cast<ULONG>(cpu_set_ids.size()), &required_count) != TRUE)
+            return std::nullopt;
+        cpu_set_ids.resize(required_count);
+        return std::optional(std::move(cpu_set_ids));
+    }
+
+}
@@ -0,0 +1,337 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/thread_pool.h>
+#include <modern_win32/windows_exception.h>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace modern_win32::threading
+{
+    struct thread_pool::work_item final
+    {
+        std::unique_ptr<thread_start> start{};
+        executor_work* work{};
+    };
+
+    struct thread_pool::worker_queue final
+    {
+        thread_pool* pool{};
+        std::size_t index{};
+        slim_lock lock{};
+        std::deque<work_item> items{};
+    };
+
+    namespace
+    {
+        // worker_queue of the calling thread, void as the nested type is private to thread_pool
+        thread_local void* current_worker_queue{};
+
+        [[nodiscard]]
+        std::vector<group_affinity> active_processor_groups()
+        {
+            std::vector<group_affinity> groups{};
+            auto const group_count = GetActiveProcessorGroupCount();
+            for (WORD group = 0; group < group_count; ++group) {
+                auto const processors = GetActiveProcessorCount(group);
+                if (processors == 0) {
+                    continue;
+                }
+                auto const mask = processors >= sizeof(KAFFINITY) * 8
+                    ? ~KAFFINITY{}
+                    : (KAFFINITY{ 1 } << processors) - 1;
+                groups.push_back(group_affinity{ group, mask });
+            }
+            return groups;
+        }
+
+        [[nodiscard]]
+        std::size_t processor_count(group_affinity const& affinity) noexcept
+        {
+            std::size_t count{};
+            for (auto mask = affinity.mask; mask != 0; mask &= mask - 1) {
+                ++count;
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// group for worker <paramref name="index"/> of <paramref name="worker_count"/>, workers are spread in
+        /// proportion to the number of processors in each group
+        /// </summary>
+        [[nodiscard]]
+        group_affinity const& group_for_worker(std::vector<group_affinity> const& groups, std::size_t const index, std::size_t const worker_count) noexcept
+        {
+            std::size_t total{};
+            for (auto const& group : groups) {
+                total += processor_count(group);
+            }
+            auto const position = index * total / worker_count;
+            std::size_t cumulative{};
+            for (auto const& group : groups) {
+                cumulative += processor_count(group);
+                if (position < cumulative) {
+                    return group;
+                }
+            }
+            return groups.back();
+        }
+    }
+
+    thread_pool::thread_pool(std::size_t worker_count, std::wstring const& name, thread_options const& options)
+    {
+        if (worker_count == 0) {
+            worker_count = (std::max)(static_cast<std::size_t>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS)), std::size_t{ 1 });
+        }
+
+        // threads start confined to a single group on systems before Windows 11, so they are placed explicitly
+        auto const groups = active_processor_groups();
+
+        queues_.reserve(worker_count);
+        workers_.reserve(worker_count);
+        for (std::size_t index = 0; index < worker_count; ++index) {
+            auto queue = std::make_unique<worker_queue>();
+            queue->pool = this;
+            queue->index = index;
+            queues_.emplace_back(std::move(queue));
+        }
+
+        try {
+            for (auto& queue : queues_) {
+                workers_.emplace_back(start_thread(options, &thread_pool::worker_proc, static_cast<thread::thread_parameter>(queue.get())));
+                auto const worker_name = name + L" #" + std::to_wstring(queue->index);
+                std::ignore = workers_.back().set_name(worker_name.c_str());
+                if (groups.size() > 1) {
+                    std::ignore = workers_.back().set_group_affinity(group_for_worker(groups, queue->index, worker_count));
+                }
+            }
+        } catch (...) {
+            shutdown();
+            throw;
+        }
+    }
+
+    thread_pool::~thread_pool()
+    {
+        shutdown();
+    }
+
+    bool thread_pool::submit(std::unique_ptr<thread_start> work)
+    {
+        if (work == nullptr) {
+            return false;
+        }
+        return enqueue(work_item{ std::move(work), nullptr });
+    }
+
+    std::size_t thread_pool::submit_bulk(std::vector<std::unique_ptr<thread_start>> work)
+    {
+        work.erase(std::remove(work.begin(), work.end(), nullptr), work.end());
+        if (work.empty() || stopping_) {
+            return 0;
+        }
+
+        auto const count = work.size();
+        auto const queue_count = queues_.size();
+        auto const first_queue = next_queue_.fetch_add(1) % queue_count;
+        outstanding_ += count;
+        // counted before the work is visible so that pending_ never under counts what can be taken
+        pending_ += count;
+
+        // each queue receives a contiguous share so that it is locked once
+        auto const share = (count + queue_count - 1) / queue_count;
+        auto source = work.begin();
+        for (std::size_t offset = 0; offset < queue_count && source != work.end(); ++offset) {
+            auto& queue = *queues_[(first_queue + offset) % queue_count];
+            auto const end = source + static_cast<std::ptrdiff_t>((std::min)(share, static_cast<std::size_t>(work.end() - source)));
+
+            slim_lock_guard guard{ queue.lock };
+            for (; source != end; ++source) {
+                queue.items.push_back(work_item{ std::move(*source), nullptr });
+            }
+        }
+        wake(count);
+        return count;
+    }
+
+    bool thread_pool::post(executor_work& work) noexcept
+    {
+        try {
+            return enqueue(work_item{ nullptr, &work });
+        } catch (...) {
+            return false;
+        }
+    }
+
+    void thread_pool::wait_idle() const
+    {
+        unique_slim_lock lock{ park_lock_ };
+        idle_condition_.wait(lock, [this]() { return outstanding_ == 0; });
+    }
+
+    void thread_pool::shutdown()
+    {
+        if (stopping_.exchange(true)) {
+            return;
+        }
+        {
+            slim_lock_guard guard{ park_lock_ };
+        }
+        park_condition_.notify_all();
+
+        for (auto const& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t thread_pool::worker_count() const noexcept
+    {
+        return queues_.size();
+    }
+
+    std::size_t thread_pool::unhandled_exception_count() const noexcept
+    {
+        return unhandled_exceptions_.load();
+    }
+
+    bool thread_pool::is_worker_thread() const noexcept
+    {
+        auto const* queue = static_cast<worker_queue const*>(current_worker_queue);
+        return queue != nullptr && queue->pool == this;
+    }
+
+    bool thread_pool::enqueue(work_item&& item)
+    {
+        if (stopping_) {
+            return false;
+        }
+
+        auto* queue = static_cast<worker_queue*>(current_worker_queue);
+        if (queue == nullptr || queue->pool != this) {
+            queue = queues_[next_queue_.fetch_add(1) % queues_.size()].get();
+        }
+
+        ++outstanding_;
+        ++pending_;
+        try {
+            slim_lock_guard guard{ queue->lock };
+            queue->items.push_back(std::move(item));
+        } catch (...) {
+            --pending_;
+            --outstanding_;
+            throw;
+        }
+        wake(1);
+        return true;
+    }
+
+    bool thread_pool::try_take(std::size_t const index, work_item& item)
+    {
+        auto const queue_count = queues_.size();
+        {
+            auto& own = *queues_[index];
+            slim_lock_guard guard{ own.lock };
+            if (!own.items.empty()) {
+                item = std::move(own.items.back());
+                own.items.pop_back();
+                --pending_;
+                return true;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < queue_count; ++offset) {
+            auto& victim = *queues_[(index + offset) % queue_count];
+            slim_lock_guard guard{ victim.lock };
+            if (!victim.items.empty()) {
+                item = std::move(victim.items.front());
+                victim.items.pop_front();
+                --pending_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void thread_pool::run(work_item& item) noexcept
+    {
+        try {
+            if (item.start != nullptr) {
+                (*item.start)();
+            } else if (item.work != nullptr) {
+                (*item.work)();
+            }
+        } catch (...) {
+            // exceptions must not escape a worker, they're counted so that they aren't entirely silent
+            ++unhandled_exceptions_;
+        }
+        item = work_item{};
+
+        if (--outstanding_ == 0) {
+            {
+                slim_lock_guard guard{ park_lock_ };
+            }
+            idle_condition_.notify_all();
+        }
+    }
+
+    void thread_pool::wake(std::size_t const count)
+    {
+        if (idle_workers_ == 0) {
+            return;
+        }
+        {
+            slim_lock_guard guard{ park_lock_ };
+        }
+        if (count == 1) {
+            park_condition_.notify_one();
+        } else {
+            park_condition_.notify_all();
+        }
+    }
+
+    DWORD __stdcall thread_pool::worker_proc(thread::thread_parameter parameter)
+    {
+        auto* const queue = static_cast<worker_queue*>(parameter);
+        if (queue == nullptr || queue->pool == nullptr) {
+            return 1UL;
+        }
+        auto& pool = *queue->pool;
+        current_worker_queue = queue;
+
+        work_item item{};
+        while (true) {
+            if (pool.try_take(queue->index, item)) {
+                pool.run(item);
+                continue;
+            }
+
+            unique_slim_lock lock{ pool.park_lock_ };
+            if (pool.stopping_ && pool.pending_ == 0) {
+                break;
+            }
+            ++pool.idle_workers_;
+            pool.park_condition_.wait(lock, [&pool]() { return pool.pending_ != 0 || pool.stopping_; });
+            --pool.idle_workers_;
+
+            if (pool.stopping_ && pool.pending_ == 0) {
+                break;
+            }
+        }
+
+        current_worker_queue = nullptr;
+        return 0UL;
+    }
+}
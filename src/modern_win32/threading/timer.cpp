@@ -13,6 +13,12 @@
 
 #include <modern_win32/threading/timer.h>
 #include <modern_win32/windows_exception.h>
+#include <memory>
+#include <tuple>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 namespace modern_win32::threading
 {
@@ -25,6 +31,30 @@ namespace modern_win32::threading
         return handle;
     }
 
+    auto timer_traits::create(bool manual_reset, bool high_resolution) -> native_handle_type
+    {
+        if (!high_resolution) {
+            return create(manual_reset);
+        }
+
+        DWORD const flags = (manual_reset ? CREATE_WAITABLE_TIMER_MANUAL_RESET : 0UL) | CREATE_WAITABLE_TIMER_HIGH_RESOLUTION;
+        auto const handle = CreateWaitableTimerExW(nullptr, nullptr, flags, TIMER_ALL_ACCESS);
+        if (handle != nullptr) {
+            return handle;
+        }
+
+        // high resolution timers require Windows 10 1803 or later, earlier versions reject the flag
+        if (GetLastError() == ERROR_INVALID_PARAMETER) {
+            return create(manual_reset);
+        }
+        throw windows_exception();
+    }
+
+    auto high_resolution_timer_traits::create(bool manual_reset) -> native_handle_type
+    {
+        return timer_traits::create(manual_reset, true);
+    }
+
     auto timer_traits::set_waitable_timer(
             native_handle_type handle,
             LARGE_INTEGER& due_time,
@@ -36,8 +66,115 @@ namespace modern_win32::threading
         return SetWaitableTimer(handle, &due_time, period, callback, state, restore ? TRUE : FALSE) == TRUE;
     }
 
+    auto timer_traits::set_waitable_timer_ex(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            ULONG tolerable_delay) -> bool
+    {
+        return SetWaitableTimerEx(handle, &due_time, period, callback, state, nullptr, tolerable_delay) == TRUE;
+    }
+
     bool timer_traits::cancel_waitable_timer(native_handle_type handle)
     {
         return CancelWaitableTimer(handle) == TRUE;
     }
+
+    void threadpool_timer_handle_traits::close(native_handle_type const handle) noexcept
+    {
+        if (handle == nullptr) {
+            return;
+        }
+        if (handle->timer != nullptr) {
+            SetThreadpoolTimer(handle->timer, nullptr, 0, 0);
+            WaitForThreadpoolTimerCallbacks(handle->timer, TRUE);
+            CloseThreadpoolTimer(handle->timer);
+        }
+        delete handle;
+    }
+
+    static void CALLBACK threadpool_timer_callback(PTP_CALLBACK_INSTANCE, void* context, PTP_TIMER)
+    {
+        if (auto const* timer_state = static_cast<threadpool_timer_state*>(context);
+            timer_state != nullptr && timer_state->callback != nullptr) {
+            timer_state->callback(timer_state->state, 0UL, 0UL);
+        }
+    }
+
+    auto threadpool_timer_traits::create(bool) -> native_handle_type
+    {
+        auto timer_state = std::make_unique<threadpool_timer_state>();
+        timer_state->timer = CreateThreadpoolTimer(threadpool_timer_callback, timer_state.get(), nullptr);
+        if (timer_state->timer == nullptr) {
+            throw windows_exception();
+        }
+        return timer_state.release();
+    }
+
+    auto threadpool_timer_traits::set_waitable_timer(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            bool const) -> bool
+    {
+        if (handle == nullptr || handle->timer == nullptr) {
+            SetLastError(ERROR_INVALID_HANDLE);
+            return false;
+        }
+
+        // callback and state are only replaced while the timer is disarmed so the pool callback never sees a partial update
+        handle->callback = callback;
+        handle->state = state;
+
+        FILETIME due{};
+        due.dwLowDateTime = due_time.LowPart;
+        due.dwHighDateTime = static_cast<DWORD>(due_time.HighPart);
+
+        std::ignore = SetThreadpoolTimerEx(handle->timer, &due, static_cast<DWORD>(period), 0UL);
+        return true;
+    }
+
+    auto threadpool_timer_traits::set_waitable_timer_ex(
+            native_handle_type handle,
+            LARGE_INTEGER& due_time,
+            LONG period,
+            _In_opt_ PTIMERAPCROUTINE callback,
+            void *state,
+            ULONG tolerable_delay) -> bool
+    {
+        if (handle == nullptr || handle->timer == nullptr) {
+            SetLastError(ERROR_INVALID_HANDLE);
+            return false;
+        }
+
+        handle->callback = callback;
+        handle->state = state;
+
+        FILETIME due{};
+        due.dwLowDateTime = due_time.LowPart;
+        due.dwHighDateTime = static_cast<DWORD>(due_time.HighPart);
+
+        std::ignore = SetThreadpoolTimerEx(handle->timer, &due, static_cast<DWORD>(period), tolerable_delay);
+        return true;
+    }
+
+    bool threadpool_timer_traits::cancel_waitable_timer(native_handle_type handle)
+    {
+        if (handle == nullptr || handle->timer == nullptr) {
+            return false;
+        }
+        std::ignore = SetThreadpoolTimerEx(handle->timer, nullptr, 0UL, 0UL);
+        return true;
+    }
+
+    void threadpool_timer_traits::wait_for_callbacks(native_handle_type handle) noexcept
+    {
+        if (handle != nullptr && handle->timer != nullptr) {
+            WaitForThreadpoolTimerCallbacks(handle->timer, FALSE);
+        }
+    }
 }
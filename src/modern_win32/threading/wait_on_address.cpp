@@ -0,0 +1,45 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/threading/wait_on_address.h>
+#include <modern_win32/wait_for.h>
+
+#pragma comment(lib, "Synchronization.lib")
+
+namespace modern_win32::threading
+{
+    bool wait_on_address(std::atomic<std::uint32_t> const& value, std::uint32_t undesired, std::optional<std::chrono::milliseconds> const& timeout) noexcept
+    {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) && std::atomic<std::uint32_t>::is_always_lock_free,
+            "WaitOnAddress requires the atomic to have the layout of the underlying value");
+
+        auto const timeout_value = timeout.has_value()
+            ? to_numeric_milliseconds<DWORD>(timeout.value())
+            : INFINITE;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto* const address = const_cast<std::atomic<std::uint32_t>*>(&value);
+        return WaitOnAddress(address, &undesired, sizeof(undesired), timeout_value) == TRUE;
+    }
+
+    void wake_one(std::atomic<std::uint32_t>& value) noexcept
+    {
+        WakeByAddressSingle(&value);
+    }
+
+    void wake_all(std::atomic<std::uint32_t>& value) noexcept
+    {
+        WakeByAddressAll(&value);
+    }
+
+}
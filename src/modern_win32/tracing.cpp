@@ -0,0 +1,277 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/tracing.h>
+#include <modern_win32/qpc_clock.h>
+
+#ifdef MODERN_WIN32_TRACELOGGING
+#   include <TraceLoggingProvider.h>
+#   include <winmeta.h>
+#endif
+
+namespace modern_win32::tracing
+{
+    namespace
+    {
+        constexpr std::int64_t default_long_wait_threshold_ns = 1'000'000LL;
+
+        std::atomic<std::int64_t> long_wait_threshold_ns{ default_long_wait_threshold_ns };
+    }
+
+    void set_long_wait_threshold(std::chrono::nanoseconds const threshold) noexcept
+    {
+        long_wait_threshold_ns.store(threshold.count(), std::memory_order_relaxed);
+    }
+
+    std::chrono::nanoseconds long_wait_threshold() noexcept
+    {
+        return std::chrono::nanoseconds(long_wait_threshold_ns.load(std::memory_order_relaxed));
+    }
+
+#ifdef MODERN_WIN32_TRACELOGGING
+
+    namespace details
+    {
+        std::atomic<std::uint64_t> enabled_keywords{};
+    }
+
+    // must match provider_id, which tracing_test checks against the GUID derived from provider_name
+    TRACELOGGING_DEFINE_PROVIDER(
+        modern_win32_provider,
+        "ModernWin32",
+        (0xc82012f2, 0xbc99, 0x5c66, 0x32, 0x7e, 0x74, 0x44, 0xb9, 0xdb, 0x98, 0x09));
+
+    namespace
+    {
+        constexpr std::uint64_t thread_keyword = static_cast<std::uint64_t>(keyword::thread);
+        constexpr std::uint64_t timer_keyword = static_cast<std::uint64_t>(keyword::timer);
+        constexpr std::uint64_t wait_keyword = static_cast<std::uint64_t>(keyword::wait);
+        constexpr std::uint64_t process_keyword = static_cast<std::uint64_t>(keyword::process);
+
+        [[nodiscard]]
+        std::int64_t to_nanoseconds(std::int64_t const ticks) noexcept
+        {
+            return qpc_clock::to_duration(ticks).count();
+        }
+
+        [[nodiscard]]
+        std::int64_t to_nanoseconds(FILETIME const& time) noexcept
+        {
+            return ((static_cast<std::int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 100LL;
+        }
+
+        /// <summary>
+        /// recomputes the enabled keywords from the provider state, which TraceLogging updates before calling
+        /// back so every session's level and keywords are combined
+        /// </summary>
+        void NTAPI on_enable_changed(LPCGUID, ULONG, UCHAR, ULONGLONG, ULONGLONG, PEVENT_FILTER_DESCRIPTOR, PVOID) noexcept
+        {
+            std::uint64_t enabled{};
+            for (auto const value : { thread_keyword, timer_keyword, wait_keyword, process_keyword }) {
+                if (TraceLoggingProviderEnabled(modern_win32_provider, WINEVENT_LEVEL_INFO, value))
+                    enabled |= value;
+            }
+            details::enabled_keywords.store(enabled, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// registers the provider for the lifetime of the module
+        /// </summary>
+        class provider_registration final
+        {
+        public:
+            provider_registration() noexcept
+            {
+                static_cast<void>(TraceLoggingRegisterEx(modern_win32_provider, &on_enable_changed, nullptr));
+            }
+            provider_registration(provider_registration const&) = delete;
+            provider_registration(provider_registration&&) noexcept = delete;
+            ~provider_registration()
+            {
+                details::enabled_keywords.store(0, std::memory_order_relaxed);
+                TraceLoggingUnregister(modern_win32_provider);
+            }
+            provider_registration& operator=(provider_registration const&) = delete;
+            provider_registration& operator=(provider_registration&&) noexcept = delete;
+        };
+
+        provider_registration const registration{};
+    }
+
+    void thread_created(DWORD const thread_id, std::int64_t const create_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "ThreadCreated",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(thread_keyword),
+            TraceLoggingUInt32(thread_id, "NewThreadId"),
+            TraceLoggingInt64(to_nanoseconds(create_ticks), "CreateDurationNs"));
+    }
+
+    void thread_started() noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "Thread",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(thread_keyword),
+            TraceLoggingOpcode(WINEVENT_OPCODE_START),
+            TraceLoggingUInt32(GetCurrentThreadId(), "ThreadId"));
+    }
+
+    void thread_exited(DWORD const exit_code, std::int64_t const run_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "Thread",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(thread_keyword),
+            TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+            TraceLoggingUInt32(GetCurrentThreadId(), "ThreadId"),
+            TraceLoggingUInt32(exit_code, "ExitCode"),
+            TraceLoggingInt64(to_nanoseconds(run_ticks), "RunDurationNs"));
+    }
+
+    void timer_armed(void const* const timer, std::chrono::nanoseconds const due_time, std::chrono::nanoseconds const period) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "TimerArmed",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(timer_keyword),
+            TraceLoggingPointer(timer, "Timer"),
+            TraceLoggingInt64(due_time.count(), "DueTimeNs"),
+            TraceLoggingInt64(period.count(), "PeriodNs"));
+    }
+
+    void timer_fired(void const* const timer, std::uint64_t const tick_count, std::uint64_t const missed_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "TimerFired",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(timer_keyword),
+            TraceLoggingPointer(timer, "Timer"),
+            TraceLoggingUInt64(tick_count, "TickCount"),
+            TraceLoggingUInt64(missed_ticks, "MissedTicks"));
+    }
+
+    void timer_callback_completed(void const* const timer, std::int64_t const callback_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "TimerCallback",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(timer_keyword),
+            TraceLoggingPointer(timer, "Timer"),
+            TraceLoggingInt64(to_nanoseconds(callback_ticks), "DurationNs"));
+    }
+
+    void wait_completed(std::size_t const handle_count, HANDLE const first_handle, bool const wait_all, DWORD const timeout_milliseconds,
+        DWORD const native_result, std::int64_t const wait_ticks) noexcept
+    {
+        auto const duration = to_nanoseconds(wait_ticks);
+        if (duration < long_wait_threshold_ns.load(std::memory_order_relaxed))
+            return;
+
+        TraceLoggingWrite(modern_win32_provider, "LongWait",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(wait_keyword),
+            TraceLoggingUInt64(static_cast<std::uint64_t>(handle_count), "HandleCount"),
+            TraceLoggingPointer(first_handle, "Handle"),
+            TraceLoggingBool(wait_all ? TRUE : FALSE, "WaitAll"),
+            TraceLoggingUInt32(timeout_milliseconds, "TimeoutMs"),
+            TraceLoggingHexUInt32(native_result, "Result"),
+            TraceLoggingInt64(duration, "DurationNs"));
+    }
+
+    void process_started(DWORD const process_id, DWORD const thread_id, char const* const filename, std::int64_t const create_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "Process",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(process_keyword),
+            TraceLoggingOpcode(WINEVENT_OPCODE_START),
+            TraceLoggingUInt32(process_id, "ChildProcessId"),
+            TraceLoggingUInt32(thread_id, "ChildThreadId"),
+            TraceLoggingString(filename, "Filename"),
+            TraceLoggingInt64(to_nanoseconds(create_ticks), "CreateDurationNs"));
+    }
+
+    void process_started(DWORD const process_id, DWORD const thread_id, wchar_t const* const filename, std::int64_t const create_ticks) noexcept
+    {
+        TraceLoggingWrite(modern_win32_provider, "Process",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(process_keyword),
+            TraceLoggingOpcode(WINEVENT_OPCODE_START),
+            TraceLoggingUInt32(process_id, "ChildProcessId"),
+            TraceLoggingUInt32(thread_id, "ChildThreadId"),
+            TraceLoggingWideString(filename, "Filename"),
+            TraceLoggingInt64(to_nanoseconds(create_ticks), "CreateDurationNs"));
+    }
+
+    void process_exited(DWORD const process_id, DWORD const exit_code, HANDLE const process) noexcept
+    {
+        FILETIME create_time{};
+        FILETIME exit_time{};
+        FILETIME kernel_time{};
+        FILETIME user_time{};
+        if (GetProcessTimes(process, &create_time, &exit_time, &kernel_time, &user_time) == FALSE) {
+            create_time = FILETIME{};
+            exit_time = FILETIME{};
+        }
+
+        TraceLoggingWrite(modern_win32_provider, "Process",
+            TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+            TraceLoggingKeyword(process_keyword),
+            TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+            TraceLoggingUInt32(process_id, "ChildProcessId"),
+            TraceLoggingUInt32(exit_code, "ExitCode"),
+            TraceLoggingInt64(to_nanoseconds(exit_time) - to_nanoseconds(create_time), "LifetimeNs"),
+            TraceLoggingInt64(to_nanoseconds(kernel_time), "KernelTimeNs"),
+            TraceLoggingInt64(to_nanoseconds(user_time), "UserTimeNs"));
+    }
+
+#else
+
+    void thread_created(DWORD, std::int64_t) noexcept
+    {
+    }
+
+    void thread_started() noexcept
+    {
+    }
+
+    void thread_exited(DWORD, std::int64_t) noexcept
+    {
+    }
+
+    void timer_armed(void const*, std::chrono::nanoseconds, std::chrono::nanoseconds) noexcept
+    {
+    }
+
+    void timer_fired(void const*, std::uint64_t, std::uint64_t) noexcept
+    {
+    }
+
+    void timer_callback_completed(void const*, std::int64_t) noexcept
+    {
+    }
+
+    void wait_completed(std::size_t, HANDLE, bool, DWORD, DWORD, std::int64_t) noexcept
+    {
+    }
+
+    void process_started(DWORD, DWORD, char const*, std::int64_t) noexcept
+    {
+    }
+
+    void process_started(DWORD, DWORD, wchar_t const*, std::int64_t) noexcept
+    {
+    }
+
+    void process_exited(DWORD, DWORD, HANDLE) noexcept
+    {
+    }
+
+#endif
+
+}
@@ -0,0 +1,241 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/virtual_arena.h>
+#include <modern_win32/null_handle.h>
+#include <modern_win32/windows_exception.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#pragma comment (lib, "advapi32")
+
+namespace modern_win32
+{
+    namespace
+    {
+        [[nodiscard]]
+        constexpr std::size_t round_up(std::size_t const value, std::size_t const multiple) noexcept
+        {
+            return (value + multiple - 1U) / multiple * multiple;
+        }
+
+        [[nodiscard]]
+        std::size_t get_page_size() noexcept
+        {
+            SYSTEM_INFO system_info{};
+            GetSystemInfo(&system_info);
+            return system_info.dwPageSize;
+        }
+
+        // the preferred node is recorded against the reserved range so later commits within it use the same node
+        [[nodiscard]]
+        void* reserve(std::size_t const size, DWORD const allocation_type, DWORD const protection, std::optional<DWORD> const& numa_node) noexcept
+        {
+            return numa_node.has_value()
+                ? VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, allocation_type, protection, numa_node.value())
+                : VirtualAlloc(nullptr, size, allocation_type, protection);
+        }
+
+        [[nodiscard]]
+        bool lookup_lock_memory_privilege(LUID& luid) noexcept
+        {
+            return LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &luid) != FALSE;
+        }
+
+        [[nodiscard]]
+        null_handle open_process_token(DWORD const access) noexcept
+        {
+            HANDLE token{};
+            if (OpenProcessToken(GetCurrentProcess(), access, &token) == FALSE)
+                return null_handle();
+            return null_handle(token);
+        }
+    }
+
+    std::size_t large_page_minimum() noexcept
+    {
+        return GetLargePageMinimum();
+    }
+
+    bool has_lock_memory_privilege() noexcept
+    {
+        LUID luid{};
+        if (!lookup_lock_memory_privilege(luid))
+            return false;
+        auto const token = open_process_token(TOKEN_QUERY);
+        if (!static_cast<bool>(token))
+            return false;
+
+        PRIVILEGE_SET privileges{};
+        privileges.PrivilegeCount = 1;
+        privileges.Control = PRIVILEGE_SET_ALL_NECESSARY;
+        privileges.Privilege[0].Luid = luid;
+        BOOL held{};
+        return PrivilegeCheck(token.native_handle(), &privileges, &held) != FALSE && held != FALSE;
+    }
+
+    bool enable_lock_memory_privilege() noexcept
+    {
+        LUID luid{};
+        if (!lookup_lock_memory_privilege(luid))
+            return false;
+        auto const token = open_process_token(TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY);
+        if (!static_cast<bool>(token))
+            return false;
+
+        TOKEN_PRIVILEGES privileges{};
+        privileges.PrivilegeCount = 1;
+        privileges.Privileges[0].Luid = luid;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+        // succeeds with ERROR_NOT_ALL_ASSIGNED when the account has not been granted the privilege
+        return AdjustTokenPrivileges(token.native_handle(), FALSE, &privileges, 0, nullptr, nullptr) != FALSE &&
+            GetLastError() == ERROR_SUCCESS;
+    }
+
+    virtual_arena::virtual_arena(std::size_t const reserve_size, arena_page_size const page_size, std::size_t const commit_size, std::optional<DWORD> const numa_node)
+    {
+        if (reserve_size == 0)
+            throw std::invalid_argument("reserve_size must be greater than 0");
+
+        if (page_size != arena_page_size::standard) {
+            auto const large_page = large_page_minimum();
+            if (large_page == 0 && page_size == arena_page_size::large)
+                throw windows_exception(static_cast<native_windows_error>(ERROR_NOT_SUPPORTED), "large pages are not supported");
+
+            // large pages cannot be reserved and committed separately so the whole range is committed now
+            if (large_page != 0) {
+                auto const size = round_up(reserve_size, large_page);
+                static_cast<void>(region_.reset(reserve(size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, numa_node)));
+                if (static_cast<bool>(region_)) {
+                    reserved_ = size;
+                    committed_ = size;
+                    commit_size_ = size;
+                    large_pages_ = true;
+                } else if (page_size == arena_page_size::large) {
+                    throw windows_exception("unable to allocate large pages");
+                }
+            }
+        }
+
+        if (!large_pages_) {
+            auto const system_page = get_page_size();
+            reserved_ = round_up(reserve_size, system_page);
+            commit_size_ = (std::min)(round_up((std::max)(commit_size, std::size_t{ 1 }), system_page), reserved_);
+            static_cast<void>(region_.reset(reserve(reserved_, MEM_RESERVE, PAGE_NOACCESS, numa_node)));
+            if (!static_cast<bool>(region_))
+                throw windows_exception();
+        }
+
+        base_ = static_cast<std::byte*>(region_.native_handle());
+    }
+
+    virtual_arena::virtual_arena(virtual_arena&& other) noexcept
+        : region_{ std::move(other.region_) }
+        , base_{ std::exchange(other.base_, nullptr) }
+        , offset_{ std::exchange(other.offset_, 0U) }
+        , committed_{ std::exchange(other.committed_, 0U) }
+        , reserved_{ std::exchange(other.reserved_, 0U) }
+        , commit_size_{ std::exchange(other.commit_size_, 0U) }
+        , large_pages_{ std::exchange(other.large_pages_, false) }
+    {
+    }
+
+    virtual_arena& virtual_arena::operator=(virtual_arena&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        static_cast<void>(region_.reset(other.region_.release()));
+        base_ = std::exchange(other.base_, nullptr);
+        offset_ = std::exchange(other.offset_, 0U);
+        committed_ = std::exchange(other.committed_, 0U);
+        reserved_ = std::exchange(other.reserved_, 0U);
+        commit_size_ = std::exchange(other.commit_size_, 0U);
+        large_pages_ = std::exchange(other.large_pages_, false);
+        return *this;
+    }
+
+    void* virtual_arena::allocate(std::size_t const size, std::size_t const alignment) noexcept
+    {
+        if (alignment == 0 || (alignment & (alignment - 1U)) != 0)
+            return nullptr;
+
+        // base_ is allocation granularity aligned so aligning the offset aligns the address
+        auto const start = round_up(offset_, alignment);
+        if (start > reserved_ || size > reserved_ - start)
+            return nullptr;
+
+        auto const end = start + size;
+        if (end > committed_ && !commit(end))
+            return nullptr;
+
+        offset_ = end;
+        return base_ + start;
+    }
+
+    void virtual_arena::reset() noexcept
+    {
+        offset_ = 0;
+    }
+
+    void virtual_arena::trim() noexcept
+    {
+        offset_ = 0;
+        if (large_pages_ || committed_ <= commit_size_)
+            return;
+
+        if (VirtualFree(base_ + commit_size_, committed_ - commit_size_, MEM_DECOMMIT) != FALSE)
+            committed_ = commit_size_;
+    }
+
+    std::size_t virtual_arena::used() const noexcept
+    {
+        return offset_;
+    }
+
+    std::size_t virtual_arena::committed() const noexcept
+    {
+        return committed_;
+    }
+
+    std::size_t virtual_arena::reserved() const noexcept
+    {
+        return reserved_;
+    }
+
+    bool virtual_arena::uses_large_pages() const noexcept
+    {
+        return large_pages_;
+    }
+
+    bool virtual_arena::owns(void const* const memory) const noexcept
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>(memory);
+        auto const base = reinterpret_cast<std::uintptr_t>(base_);
+        return base_ != nullptr && address >= base && address - base < reserved_;
+    }
+
+    bool virtual_arena::commit(std::size_t const required) noexcept
+    {
+        auto const target = (std::min)(round_up(required, commit_size_), reserved_);
+        if (VirtualAlloc(base_ + committed_, target - committed_, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+            return false;
+        committed_ = target;
+        return true;
+    }
+
+}
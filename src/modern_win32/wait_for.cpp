@@ -18,14 +18,25 @@ namespace modern_win32
 {
 
 bool is_complete(wait_for_result const& result)
+{
+    auto const complete = try_is_complete(result);
+    if (complete.has_value())
+        return *complete;
+
+    if (result == wait_for_result::abandonded)
+        throw std::runtime_error("unexpected handle type");
+    throw windows_exception(complete.error());
+}
+
+windows_result<bool> try_is_complete(wait_for_result const& result) noexcept
 {
     switch (result) {
     case wait_for_result::object:
         return true;
     case wait_for_result::abandonded:
-        throw std::runtime_error("unexpected handle type");
+        return windows_error_details(windows_error::error_abandoned_wait_0);
     case wait_for_result::failed:
-        throw windows_exception();
+        return windows_error_details();
     case wait_for_result::io_completion:
     case wait_for_result::timeout:
         return false;
@@ -0,0 +1,193 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/wait_set.h>
+#include <modern_win32/wait_for.h>
+#include <modern_win32/windows_exception.h>
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+
+namespace modern_win32
+{
+    struct wait_set::pool_wait final
+    {
+        wait_set* owner{};
+        index_type index{};
+        PTP_WAIT wait{};
+    };
+
+    wait_set::wait_set() = default;
+
+    wait_set::wait_set(std::vector<native_handle_type> handles)
+        : handles_(std::move(handles))
+    {
+    }
+
+    wait_set::~wait_set()
+    {
+        close_pool_waits();
+    }
+
+    wait_set::index_type wait_set::add(native_handle_type const handle)
+    {
+        handles_.push_back(handle);
+        return handles_.size() - 1;
+    }
+
+    void wait_set::clear() noexcept
+    {
+        close_pool_waits();
+        handles_.clear();
+        signaled_.clear();
+    }
+
+    std::size_t wait_set::size() const noexcept
+    {
+        return handles_.size();
+    }
+
+    bool wait_set::empty() const noexcept
+    {
+        return handles_.empty();
+    }
+
+    wait_set::native_handle_type wait_set::handle(index_type const index) const
+    {
+        if (index >= handles_.size()) {
+            throw std::out_of_range("index is out of range");
+        }
+        return handles_[index];
+    }
+
+    std::vector<wait_set::index_type> const& wait_set::signaled() const noexcept
+    {
+        return signaled_;
+    }
+
+    wait_for_result wait_set::wait(bool const all, std::optional<std::chrono::milliseconds> const& timeout, bool const alertable)
+    {
+        signaled_.clear();
+        if (handles_.empty()) {
+            return wait_for_result::failed;
+        }
+
+        auto const timeout_value = timeout.has_value()
+            ? to_numeric_milliseconds<DWORD>(timeout.value())
+            : INFINITE;
+
+        return handles_.size() <= static_cast<std::size_t>(MAXIMUM_WAIT_OBJECTS)
+            ? wait_native(all, timeout_value, alertable)
+            : wait_pooled(all, timeout_value, alertable);
+    }
+
+    wait_for_result wait_set::wait_native(bool const all, DWORD const timeout, bool const alertable)
+    {
+        auto const count = static_cast<DWORD>(handles_.size());
+        auto const native_result = WaitForMultipleObjectsEx(count, handles_.data(), all ? TRUE : FALSE, timeout, alertable ? TRUE : FALSE);
+
+        std::optional<index_type> index{};
+        if (native_result >= WAIT_OBJECT_0 && native_result < WAIT_OBJECT_0 + count) {
+            index = native_result - WAIT_OBJECT_0;
+        } else if (native_result >= WAIT_ABANDONED_0 && native_result < WAIT_ABANDONED_0 + count) {
+            index = native_result - WAIT_ABANDONED_0;
+        } else {
+            return to_wait_for_result(native_result);
+        }
+
+        if (all) {
+            signaled_.resize(handles_.size());
+            std::iota(signaled_.begin(), signaled_.end(), index_type{});
+        } else {
+            signaled_.push_back(index.value());
+        }
+        return native_result >= WAIT_ABANDONED_0
+            ? wait_for_result::abandonded
+            : wait_for_result::object;
+    }
+
+    wait_for_result wait_set::wait_pooled(bool const all, DWORD const timeout, bool const alertable)
+    {
+        for (auto index = pool_waits_.size(); index < handles_.size(); ++index) {
+            auto entry = std::make_unique<pool_wait>(pool_wait{ this, index, nullptr });
+            entry->wait = CreateThreadpoolWait(on_wait, entry.get(), nullptr);
+            if (entry->wait == nullptr) {
+                throw windows_exception();
+            }
+            pool_waits_.push_back(std::move(entry));
+        }
+
+        // reserved up front so that the callbacks never allocate
+        signaled_.reserve(handles_.size());
+        {
+            threading::slim_lock_guard guard{ lock_ };
+            target_ = all ? handles_.size() : 1;
+            abandoned_ = false;
+        }
+        std::ignore = ready_.clear();
+
+        for (auto const& entry : pool_waits_) {
+            SetThreadpoolWait(entry->wait, handles_[entry->index], nullptr);
+        }
+
+        auto const native_result = WaitForSingleObjectEx(ready_.native_handle(), timeout, alertable ? TRUE : FALSE);
+
+        // disarm everything before reading the results, callbacks already running are allowed to finish
+        for (auto const& entry : pool_waits_) {
+            SetThreadpoolWait(entry->wait, nullptr, nullptr);
+        }
+        for (auto const& entry : pool_waits_) {
+            WaitForThreadpoolWaitCallbacks(entry->wait, FALSE);
+        }
+
+        std::sort(signaled_.begin(), signaled_.end());
+        if (signaled_.size() >= target_) {
+            return abandoned_
+                ? wait_for_result::abandonded
+                : wait_for_result::object;
+        }
+        return native_result == WAIT_OBJECT_0
+            ? wait_for_result::failed
+            : to_wait_for_result(native_result);
+    }
+
+    void wait_set::close_pool_waits() noexcept
+    {
+        for (auto const& entry : pool_waits_) {
+            SetThreadpoolWait(entry->wait, nullptr, nullptr);
+            WaitForThreadpoolWaitCallbacks(entry->wait, TRUE);
+            CloseThreadpoolWait(entry->wait);
+        }
+        pool_waits_.clear();
+    }
+
+    void CALLBACK wait_set::on_wait(PTP_CALLBACK_INSTANCE, void* context, PTP_WAIT, TP_WAIT_RESULT const wait_result) noexcept
+    {
+        auto const* const entry = static_cast<pool_wait const*>(context);
+        auto& owner = *entry->owner;
+
+        bool complete{};
+        {
+            threading::slim_lock_guard guard{ owner.lock_ };
+            owner.signaled_.push_back(entry->index);
+            owner.abandoned_ = owner.abandoned_ || wait_result == WAIT_ABANDONED_0;
+            complete = owner.signaled_.size() >= owner.target_;
+        }
+        if (complete) {
+            std::ignore = owner.ready_.set();
+        }
+    }
+
+}
@@ -0,0 +1,220 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#include <modern_win32/windows_error_category.h>
+#include <modern_win32/string.h>
+#include <modern_win32/threading/slim_lock.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace modern_win32
+{
+    namespace
+    {
+        using threading::slim_lock;
+
+        /// <summary>
+        /// formatted messages keyed by language in the high 32 bits and error code in the low; entries are never
+        /// removed so references handed out stay valid
+        /// </summary>
+        struct message_cache final
+        {
+            slim_lock lock;
+            std::unordered_map<std::uint64_t, std::string> messages;
+        };
+
+        [[nodiscard]]
+        message_cache& get_message_cache()
+        {
+            static message_cache cache{};
+            return cache;
+        }
+
+        [[nodiscard]]
+        constexpr std::uint64_t to_cache_key(native_windows_error const error_code, LANGID const language) noexcept
+        {
+            return static_cast<std::uint64_t>(language) << 32 | static_cast<std::uint32_t>(error_code);
+        }
+
+        [[nodiscard]]
+        std::string format_message(native_windows_error const error_code, LANGID const language)
+        {
+            wchar_t* buffer{};
+            auto const length = FormatMessageW(
+                FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+                nullptr,
+                error_code,
+                language,
+                reinterpret_cast<wchar_t*>(&buffer),
+                0,
+                nullptr);
+            if (length == 0 || buffer == nullptr) {
+                // the requested language may not be installed, the neutral language always has a message if any does
+                return language != windows_error_category::default_language
+                    ? format_message(error_code, windows_error_category::default_language)
+                    : std::string("unknown error");
+            }
+            std::unique_ptr<wchar_t, decltype(&LocalFree)> const owner(buffer, &LocalFree);
+
+            // system messages end with a line break, and some with trailing spaces
+            std::wstring_view message(buffer, length);
+            while (!message.empty() && (message.back() == L'\r' || message.back() == L'\n' || message.back() == L' '))
+                message.remove_suffix(1);
+
+            std::string formatted;
+            convert::to_string(message, formatted);
+            return formatted;
+        }
+
+        [[nodiscard]]
+        std::optional<windows_error> to_windows_error(std::error_code const& error) noexcept
+        {
+            if (error.category() != windows_category() && error.category() != std::system_category())
+                return std::nullopt;
+            return windows_error_details(static_cast<native_windows_error>(error.value())).get();
+        }
+    }
+
+    char const* windows_error_category::name() const noexcept
+    {
+        return "windows";
+    }
+
+    std::string windows_error_category::message(int const error_code) const
+    {
+        return cached_message(static_cast<native_windows_error>(error_code));
+    }
+
+    std::error_condition windows_error_category::default_error_condition(int const error_code) const noexcept
+    {
+        return std::system_category().default_error_condition(error_code);
+    }
+
+    std::string const& windows_error_category::cached_message(native_windows_error const error_code, LANGID const language) const
+    {
+        auto& cache = get_message_cache();
+        auto const key = to_cache_key(error_code, language);
+        {
+            std::shared_lock const read_lock(cache.lock);
+            if (auto const existing = cache.messages.find(key); existing != cache.messages.end())
+                return existing->second;
+        }
+
+        // formatted outside the lock, if another thread got there first its message is kept and this one discarded
+        auto message = format_message(error_code, language);
+        std::lock_guard const write_lock(cache.lock);
+        return cache.messages.try_emplace(key, std::move(message)).first->second;
+    }
+
+    std::error_category const& windows_category() noexcept
+    {
+        static windows_error_category const category{};
+        return category;
+    }
+
+    bool is_transient_error(windows_error const error) noexcept
+    {
+        switch (error) {
+        case windows_error::error_sharing_violation:
+        case windows_error::error_lock_violation:
+        case windows_error::error_drive_locked:
+        case windows_error::error_busy:
+        case windows_error::error_busy_drive:
+        case windows_error::error_not_ready:
+        case windows_error::error_pipe_busy:
+        case windows_error::error_retry:
+        case windows_error::error_sem_timeout:
+        case windows_error::error_timeout:
+        case windows_error::error_delete_pending:
+        case windows_error::error_user_mapped_file:
+        case windows_error::error_not_enough_memory:
+        case windows_error::error_outofmemory:
+        case windows_error::error_no_system_resources:
+        case windows_error::error_nonpaged_system_resources:
+        case windows_error::error_paged_system_resources:
+        case windows_error::error_working_set_quota:
+        case windows_error::error_pagefile_quota:
+        case windows_error::error_commitment_limit:
+        case windows_error::error_too_many_open_files:
+        case windows_error::error_no_proc_slots:
+        case windows_error::error_too_many_threads:
+        case windows_error::error_network_busy:
+        case windows_error::error_unexp_net_err:
+        case windows_error::error_bad_net_resp:
+        case windows_error::error_netname_deleted:
+        case windows_error::error_req_not_accep:
+        case windows_error::error_too_many_cmds:
+        case windows_error::error_network_unreachable:
+        case windows_error::error_host_unreachable:
+        case windows_error::error_connection_refused:
+        case windows_error::error_connection_aborted:
+        case windows_error::error_service_request_timeout:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool is_access_error(windows_error const error) noexcept
+    {
+        switch (error) {
+        case windows_error::error_access_denied:
+        case windows_error::error_network_access_denied:
+        case windows_error::error_privilege_not_held:
+        case windows_error::error_elevation_required:
+        case windows_error::error_cant_access_file:
+        case windows_error::error_account_restriction:
+        case windows_error::error_cant_open_anonymous:
+        case windows_error::error_bad_impersonation_level:
+        case windows_error::error_invalid_owner:
+        case windows_error::error_logon_failure:
+        case windows_error::error_write_protect:
+        case windows_error::error_access_disabled_by_policy:
+        case windows_error::error_access_disabled_no_safer_ui_by_policy:
+        case windows_error::error_virus_infected:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool is_permanent_error(windows_error const error) noexcept
+    {
+        return error != windows_error::none && !is_transient_error(error);
+    }
+
+    bool is_transient_error(std::error_code const& error) noexcept
+    {
+        auto const value = to_windows_error(error);
+        return value.has_value() && is_transient_error(value.value());
+    }
+
+    bool is_access_error(std::error_code const& error) noexcept
+    {
+        auto const value = to_windows_error(error);
+        return value.has_value() && is_access_error(value.value());
+    }
+
+    bool is_permanent_error(std::error_code const& error) noexcept
+    {
+        auto const value = to_windows_error(error);
+        return value.has_value() && is_permanent_error(value.value());
+    }
+
+}
@@ -0,0 +1,95 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <modern_win32/guid.h>
+#include <modern_win32/string.h>
+
+using modern_win32::guid_string_length;
+using modern_win32::new_guid;
+using modern_win32::try_parse_guid;
+
+namespace
+{
+    [[nodiscard]]
+    std::string make_ascii(std::size_t const length)
+    {
+        std::string value(length, '\0');
+        for (std::size_t index = 0; index < length; ++index) {
+            value[index] = static_cast<char>('a' + index % 26);
+        }
+        return value;
+    }
+
+    void convert__to_wstring(benchmark::State& state)
+    {
+        auto const source = make_ascii(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(modern_win32::convert::to_wstring(source));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void convert__to_string(benchmark::State& state)
+    {
+        auto const source = modern_win32::convert::to_wstring(make_ascii(static_cast<std::size_t>(state.range(0))));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(modern_win32::convert::to_string(source));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(wchar_t)));
+    }
+
+    void guid__to_string(benchmark::State& state)
+    {
+        auto const value = new_guid();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(to_string(value));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void guid__format_guid(benchmark::State& state)
+    {
+        auto const value = static_cast<GUID>(new_guid());
+        char buffer[guid_string_length];
+        for (auto _ : state) {
+            modern_win32::format_guid(value, buffer);
+            benchmark::DoNotOptimize(buffer);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void guid__try_parse_guid(benchmark::State& state)
+    {
+        auto const text = to_string(new_guid());
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(try_parse_guid(std::string_view(text)));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(convert__to_wstring)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(convert__to_string)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(guid__to_string);
+BENCHMARK(guid__format_guid);
+BENCHMARK(guid__try_parse_guid);
@@ -0,0 +1,104 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <cstdint>
+#include <shared_mutex>
+#include <modern_win32/threading/slim_lock.h>
+
+using modern_win32::threading::slim_lock;
+
+namespace
+{
+    template <class MUTEX>
+    void lock_exclusive__uncontended(benchmark::State& state)
+    {
+        MUTEX mutex;
+        for (auto _ : state) {
+            mutex.lock();
+            mutex.unlock();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <class MUTEX>
+    void lock_shared__uncontended(benchmark::State& state)
+    {
+        MUTEX mutex;
+        for (auto _ : state) {
+            mutex.lock_shared();
+            mutex.unlock_shared();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// <summary>
+    /// lock and counter shared by every thread of a contended benchmark, one per MUTEX type
+    /// </summary>
+    template <class MUTEX>
+    struct contended_state final
+    {
+        static MUTEX& mutex()
+        {
+            static MUTEX instance;
+            return instance;
+        }
+
+        static std::uint64_t& counter() noexcept
+        {
+            static std::uint64_t value{};
+            return value;
+        }
+    };
+
+    template <class MUTEX>
+    void lock_exclusive__contended(benchmark::State& state)
+    {
+        auto& mutex = contended_state<MUTEX>::mutex();
+        auto& counter = contended_state<MUTEX>::counter();
+        for (auto _ : state) {
+            mutex.lock();
+            benchmark::DoNotOptimize(++counter);
+            mutex.unlock();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <class MUTEX>
+    void lock_shared__contended(benchmark::State& state)
+    {
+        auto& mutex = contended_state<MUTEX>::mutex();
+        auto const& counter = contended_state<MUTEX>::counter();
+        for (auto _ : state) {
+            mutex.lock_shared();
+            benchmark::DoNotOptimize(counter);
+            mutex.unlock_shared();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK_TEMPLATE(lock_exclusive__uncontended, slim_lock);
+BENCHMARK_TEMPLATE(lock_exclusive__uncontended, std::shared_mutex);
+BENCHMARK_TEMPLATE(lock_shared__uncontended, slim_lock);
+BENCHMARK_TEMPLATE(lock_shared__uncontended, std::shared_mutex);
+
+BENCHMARK_TEMPLATE(lock_exclusive__contended, slim_lock)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(lock_exclusive__contended, std::shared_mutex)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(lock_shared__contended, slim_lock)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(lock_shared__contended, std::shared_mutex)->ThreadRange(2, 16)->UseRealTime();
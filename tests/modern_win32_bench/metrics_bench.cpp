@@ -0,0 +1,68 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <chrono>
+#include <cstdint>
+#include <modern_win32/metrics.h>
+
+using modern_win32::metrics::counter;
+using modern_win32::metrics::latency_histogram;
+using modern_win32::metrics::registry;
+
+namespace
+{
+    void histogram_record(benchmark::State& state)
+    {
+        auto& histogram = registry::instance().get_histogram(L"bench.histogram_record");
+        std::int64_t value{ 1 };
+        for (auto _ : state) {
+            histogram.record(std::chrono::nanoseconds(value));
+            // spread values over the buckets rather than hammering one
+            value = (value * 33 + 7) & 0xFFFFFF;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void counter_add(benchmark::State& state)
+    {
+        auto& value = registry::instance().get_counter(L"bench.counter_add");
+        for (auto _ : state) {
+            value.add();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void histogram_snapshot(benchmark::State& state)
+    {
+        latency_histogram histogram{};
+        for (std::int64_t i = 0; i < 10'000; ++i) {
+            histogram.record(std::chrono::nanoseconds(i * 97));
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(histogram.snapshot());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(histogram_record);
+BENCHMARK(histogram_record)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(counter_add);
+BENCHMARK(counter_add)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(histogram_snapshot);
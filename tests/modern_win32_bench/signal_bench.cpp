@@ -0,0 +1,99 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <tuple>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/semaphore.h>
+#include <modern_win32/threading/thread.h>
+
+using modern_win32::qpc_clock;
+using modern_win32::threading::auto_reset_event;
+using modern_win32::threading::semaphore;
+using modern_win32::threading::start_thread;
+
+namespace
+{
+    /// <summary>
+    /// time from set() on this thread until the waiting thread returns from wait_one, reported as manual time
+    /// </summary>
+    void event__set_to_wake_latency(benchmark::State& state)
+    {
+        auto_reset_event request{ false };
+        auto_reset_event acknowledged{ false };
+        std::atomic<std::int64_t> woken_at{};
+        std::atomic<bool> stopping{};
+
+        auto const waiter = start_thread([&request, &acknowledged, &woken_at, &stopping] {
+            while (true) {
+                std::ignore = request.wait_one();
+                woken_at.store(qpc_clock::ticks(), std::memory_order_relaxed);
+                if (stopping.load(std::memory_order_relaxed))
+                    return;
+                std::ignore = acknowledged.set();
+            }
+        });
+
+        for (auto _ : state) {
+            auto const set_at = qpc_clock::ticks();
+            std::ignore = request.set();
+            std::ignore = acknowledged.wait_one();
+            state.SetIterationTime(std::chrono::duration<double>(qpc_clock::to_duration(woken_at.load(std::memory_order_relaxed) - set_at)).count());
+        }
+
+        stopping = true;
+        std::ignore = request.set();
+        waiter.join();
+    }
+
+    /// <summary>
+    /// one release and wait in each direction between two threads
+    /// </summary>
+    void semaphore__ping_pong(benchmark::State& state)
+    {
+        semaphore<> ping{ 0, 1 };
+        semaphore<> pong{ 0, 1 };
+        std::atomic<bool> stopping{};
+
+        auto const partner = start_thread([&ping, &pong, &stopping] {
+            while (true) {
+                std::ignore = ping.wait_one();
+                if (stopping.load(std::memory_order_relaxed))
+                    return;
+                pong.release(1);
+            }
+        });
+
+        for (auto _ : state) {
+            ping.release(1);
+            std::ignore = pong.wait_one();
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        stopping = true;
+        ping.release(1);
+        partner.join();
+    }
+}
+
+BENCHMARK(event__set_to_wake_latency)->UseManualTime();
+BENCHMARK(semaphore__ping_pong)->UseRealTime();
@@ -0,0 +1,50 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <thread>
+#include <modern_win32/threading/thread.h>
+
+using modern_win32::threading::start_thread;
+
+namespace
+{
+    /// <summary>
+    /// creating, running and joining a thread which does nothing
+    /// </summary>
+    void start_thread__launch_and_join(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            auto const worker = start_thread([] {});
+            worker.join();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void std_thread__launch_and_join(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            std::thread worker([] {});
+            worker.join();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(start_thread__launch_and_join)->UseRealTime();
+BENCHMARK(std_thread__launch_and_join)->UseRealTime();
@@ -0,0 +1,115 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <modern_win32/qpc_clock.h>
+#include <modern_win32/threading/timer.h>
+
+using modern_win32::qpc_clock;
+using modern_win32::threading::synchronization_timer;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto timer_period = milliseconds(10);
+    constexpr auto measurement_interval = milliseconds(1000);
+
+    /// <summary>
+    /// records the spacing of the ticks of one timer, only written by that timer's callback thread
+    /// </summary>
+    struct timer_probe final
+    {
+        std::int64_t last_tick{};
+        std::uint64_t ticks{};
+        std::chrono::nanoseconds total_jitter{};
+        std::chrono::nanoseconds max_jitter{};
+
+        void on_tick() noexcept
+        {
+            auto const now = qpc_clock::ticks();
+            if (ticks++ != 0) {
+                auto const interval = qpc_clock::to_duration(now - last_tick);
+                auto const jitter = interval > timer_period
+                    ? interval - timer_period
+                    : timer_period - interval;
+                total_jitter += jitter;
+                max_jitter = (std::max)(max_jitter, jitter);
+            }
+            last_tick = now;
+        }
+    };
+
+    using probe_timer = synchronization_timer<timer_probe*>;
+
+    /// <summary>
+    /// runs state.range(0) periodic timers concurrently, reporting how far each tick strays from the period and
+    /// the total tick rate
+    /// </summary>
+    void synchronization_timer__jitter_and_throughput(benchmark::State& state)
+    {
+        auto const timer_count = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state) {
+            std::vector<timer_probe> probes(timer_count);
+            std::vector<std::unique_ptr<probe_timer>> timers;
+            timers.reserve(timer_count);
+            for (auto& probe : probes) {
+                timers.emplace_back(std::make_unique<probe_timer>([](timer_probe*& target) { target->on_tick(); }, &probe));
+            }
+
+            for (auto const& timer : timers) {
+                timer->start(timer_period, timer_period);
+            }
+            std::this_thread::sleep_for(measurement_interval);
+            for (auto const& timer : timers) {
+                std::ignore = timer->stop();
+            }
+            // destroying the timers waits for callbacks in flight so the probes are no longer written
+            timers.clear();
+
+            std::uint64_t ticks{};
+            std::uint64_t intervals{};
+            std::chrono::nanoseconds total_jitter{};
+            std::chrono::nanoseconds max_jitter{};
+            for (auto const& probe : probes) {
+                ticks += probe.ticks;
+                intervals += probe.ticks > 0 ? probe.ticks - 1 : 0;
+                total_jitter += probe.total_jitter;
+                max_jitter = (std::max)(max_jitter, probe.max_jitter);
+            }
+
+            using microseconds = std::chrono::duration<double, std::micro>;
+            state.counters["mean_jitter_us"] = intervals > 0
+                ? microseconds(total_jitter).count() / static_cast<double>(intervals)
+                : 0.0;
+            state.counters["max_jitter_us"] = microseconds(max_jitter).count();
+            state.counters["ticks_per_second"] = benchmark::Counter(static_cast<double>(ticks), benchmark::Counter::kIsRate);
+        }
+    }
+}
+
+BENCHMARK(synchronization_timer__jitter_and_throughput)
+    ->Arg(1)->Arg(10)->Arg(1000)
+    ->Iterations(1)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,62 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <benchmark/benchmark.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/wait_for_result.h>
+#include <modern_win32/wait_set.h>
+
+using modern_win32::wait_for_result;
+using modern_win32::wait_set;
+using modern_win32::threading::manual_reset_event;
+
+namespace
+{
+    /// <summary>
+    /// wait_any over state.range(0) handles of which only the last is signaled, the worst case for the scan;
+    /// sets larger than MAXIMUM_WAIT_OBJECTS go through the thread pool waits
+    /// </summary>
+    void wait_set__wait_any_last_signaled(benchmark::State& state)
+    {
+        auto const count = static_cast<std::size_t>(state.range(0));
+        std::vector<manual_reset_event> events{};
+        events.reserve(count);
+        for (std::size_t index = 0; index < count; ++index) {
+            events.emplace_back(false);
+        }
+
+        wait_set set{};
+        for (auto const& event : events) {
+            std::ignore = set.add(event);
+        }
+        std::ignore = events.back().set();
+
+        for (auto _ : state) {
+            if (set.wait_any() != wait_for_result::object) {
+                state.SkipWithError("wait_any failed");
+                break;
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(wait_set__wait_any_last_signaled)->Arg(1)->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
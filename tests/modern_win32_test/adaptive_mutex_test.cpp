@@ -0,0 +1,145 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <modern_win32/shared/timed_lock_guard.h>
+#include <modern_win32/threading/adaptive_mutex.h>
+
+using modern_win32::shared::timed_lock_guard;
+using modern_win32::threading::adaptive_mutex;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(adaptive_mutex_test, try_lock__returns_false__when_already_locked)
+{
+    adaptive_mutex mutex{};
+    std::lock_guard guard(mutex);
+
+    auto other = std::async(std::launch::async, [&mutex]() {
+        bool const acquired = mutex.try_lock();
+        if (acquired) {
+            mutex.unlock();
+        }
+        return acquired;
+    });
+
+    ASSERT_FALSE(other.get());
+}
+
+TEST(adaptive_mutex_test, try_lock_for__returns_false__when_owner_does_not_release_within_timeout)
+{
+    adaptive_mutex mutex{};
+    std::lock_guard guard(mutex);
+
+    auto other = std::async(std::launch::async, [&mutex]() {
+        timed_lock_guard const timed(mutex, milliseconds(20));
+        return timed.owns_lock();
+    });
+
+    ASSERT_EQ(std::future_status::ready, other.wait_for(TEST_TIMEOUT));
+    ASSERT_FALSE(other.get());
+}
+
+TEST(adaptive_mutex_test, unlock__wakes_blocked_thread__when_thread_is_parked)
+{
+    adaptive_mutex mutex{ 0 };
+    mutex.lock();
+
+    auto other = std::async(std::launch::async, [&mutex]() {
+        std::lock_guard guard(mutex);
+        return true;
+    });
+    std::this_thread::sleep_for(milliseconds(20));
+    mutex.unlock();
+
+    ASSERT_EQ(std::future_status::ready, other.wait_for(TEST_TIMEOUT));
+    ASSERT_TRUE(other.get());
+}
+
+TEST(adaptive_mutex_test, lock__provides_mutual_exclusion__when_many_threads_contend)
+{
+    adaptive_mutex mutex{};
+    int counter{};
+    constexpr int thread_count = 4;
+    constexpr int iterations = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&mutex, &counter]() {
+            for (int j = 0; j < iterations; ++j) {
+                std::lock_guard guard(mutex);
+                ++counter;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(thread_count * iterations, counter);
+    ASSERT_LE(mutex.spin_budget(), mutex.max_spin_count());
+}
+
+TEST(adaptive_mutex_test, spin_budget__remains_zero__when_max_spin_count_is_zero)
+{
+    adaptive_mutex mutex{ 0 };
+    mutex.lock();
+
+    auto other = std::async(std::launch::async, [&mutex]() {
+        std::lock_guard guard(mutex);
+    });
+    std::this_thread::sleep_for(milliseconds(20));
+    mutex.unlock();
+    other.wait();
+
+    ASSERT_EQ(0U, mutex.spin_budget());
+}
+
+TEST(adaptive_mutex_test, spin_budget__falls__when_lock_is_held_longer_than_spin)
+{
+    adaptive_mutex mutex{ adaptive_mutex::default_max_spin_count, 1000 };
+    auto const initial = mutex.spin_budget();
+
+    for (int round = 0; round < 3; ++round) {
+        mutex.lock();
+        auto other = std::async(std::launch::async, [&mutex]() {
+            std::lock_guard guard(mutex);
+        });
+        std::this_thread::sleep_for(milliseconds(20));
+        mutex.unlock();
+        other.wait();
+    }
+
+    ASSERT_EQ(1000U, initial);
+    ASSERT_LT(mutex.spin_budget(), initial);
+}
+
+TEST(adaptive_mutex_test, constructor__limits_initial_spin_budget__when_above_max_spin_count)
+{
+    adaptive_mutex const mutex{ 100, 1000 };
+
+    ASSERT_EQ(100U, mutex.spin_budget());
+}
@@ -0,0 +1,301 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <modern_win32/async_file.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/windows_exception.h>
+
+using modern_win32::async_file;
+using modern_win32::async_file_access;
+using modern_win32::async_file_request;
+using modern_win32::io_buffer;
+using modern_win32::io_segment_list;
+using modern_win32::threading::io_completion_executor;
+using modern_win32::threading::manual_reset_event;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(5000);
+
+    class temporary_path final
+    {
+    public:
+        temporary_path()
+            : path_(std::filesystem::temp_directory_path() / ("modern_win32_async_file_" + std::to_string(GetCurrentProcessId()) + "_" + std::to_string(next_id_++) + ".tmp"))
+        {
+        }
+        temporary_path(temporary_path const&) = delete;
+        temporary_path(temporary_path&&) = delete;
+        ~temporary_path()
+        {
+            std::error_code error{};
+            std::filesystem::remove(path_, error);
+        }
+        temporary_path& operator=(temporary_path const&) = delete;
+        temporary_path& operator=(temporary_path&&) = delete;
+
+        [[nodiscard]]
+        std::filesystem::path const& path() const noexcept
+        {
+            return path_;
+        }
+
+    private:
+        static inline std::atomic<int> next_id_{};
+        std::filesystem::path path_;
+    };
+
+    /// <summary>
+    /// request which signals an event on completion so the test thread can wait for it
+    /// </summary>
+    struct waitable_request final
+    {
+        async_file_request request{};
+        manual_reset_event completed{ false };
+
+        waitable_request() noexcept
+        {
+            request.callback = &on_complete;
+            request.context = this;
+        }
+
+        [[nodiscard]]
+        bool wait() const
+        {
+            return completed.wait_one(TEST_TIMEOUT);
+        }
+
+        static void on_complete(async_file_request& request) noexcept
+        {
+            std::ignore = static_cast<waitable_request*>(request.context)->completed.set();
+        }
+    };
+
+    void fill(io_buffer const& buffer, char const seed)
+    {
+        for (std::size_t index = 0; index < buffer.size(); ++index) {
+            buffer.data()[index] = static_cast<std::byte>(seed + static_cast<char>(index % 23));
+        }
+    }
+}
+
+TEST(io_buffer_test, constructor__rounds_size_up_to_whole_pages__always)
+{
+    io_buffer const buffer{ 1 };
+
+    ASSERT_EQ(io_buffer::page_size(), buffer.size());
+    ASSERT_EQ(1U, buffer.page_count());
+    ASSERT_EQ(0U, reinterpret_cast<std::uintptr_t>(buffer.data()) % io_buffer::page_size());
+}
+
+TEST(io_segment_list_test, add_page__throws_invalid_argument__when_page_is_not_aligned)
+{
+    io_buffer const buffer{ io_buffer::page_size() };
+    io_segment_list segments;
+
+    ASSERT_THROW(segments.add_page(buffer.data() + 1), std::invalid_argument);
+    ASSERT_EQ(0U, segments.page_count());
+}
+
+TEST(async_file_test, read__returns_written_data__when_many_operations_are_in_flight)
+{
+    constexpr std::size_t operation_count = 16;
+    temporary_path const path;
+    io_completion_executor executor{ 2 };
+    async_file file{ path.path(), async_file_access::read_write, executor };
+
+    auto const block = file.sector_size();
+    io_buffer const written{ block * operation_count };
+    io_buffer const read{ block * operation_count };
+    fill(written, 'a');
+
+    std::array<waitable_request, operation_count> writes{};
+    for (std::size_t index = 0; index < operation_count; ++index) {
+        ASSERT_TRUE(file.write(index * block, written.data() + index * block, static_cast<DWORD>(block), writes[index].request));
+    }
+    for (auto const& write : writes) {
+        ASSERT_TRUE(write.wait());
+        ASSERT_TRUE(write.request.succeeded());
+    }
+
+    std::array<waitable_request, operation_count> reads{};
+    for (std::size_t index = 0; index < operation_count; ++index) {
+        ASSERT_TRUE(file.read(index * block, read.data() + index * block, static_cast<DWORD>(block), reads[index].request));
+    }
+    for (auto const& pending : reads) {
+        ASSERT_TRUE(pending.wait());
+        ASSERT_TRUE(pending.request.succeeded());
+        ASSERT_EQ(block, pending.request.bytes_transferred);
+    }
+
+    ASSERT_EQ(0, std::memcmp(written.data(), read.data(), written.size()));
+    ASSERT_EQ(0U, file.outstanding());
+}
+
+TEST(async_file_test, read_scatter__reads_pages_written_by_write_gather__when_file_is_unbuffered)
+{
+    temporary_path const path;
+    io_completion_executor executor{ 1 };
+    async_file file{ path.path(), async_file_access::read_write, executor };
+
+    io_buffer const first{ io_buffer::page_size() };
+    io_buffer const second{ io_buffer::page_size() * 2 };
+    fill(first, 'x');
+    fill(second, 'k');
+    io_segment_list gather;
+    gather.add(first);
+    gather.add(second);
+
+    waitable_request write;
+    ASSERT_TRUE(file.write_gather(0, gather, write.request));
+    ASSERT_TRUE(write.wait());
+    ASSERT_TRUE(write.request.succeeded());
+
+    io_buffer const scattered{ io_buffer::page_size() * 3 };
+    io_segment_list scatter;
+    scatter.add(scattered);
+
+    waitable_request read;
+    ASSERT_TRUE(file.read_scatter(0, scatter, read.request));
+    ASSERT_TRUE(read.wait());
+
+    ASSERT_TRUE(read.request.succeeded());
+    ASSERT_EQ(scatter.byte_count(), read.request.bytes_transferred);
+    ASSERT_EQ(0, std::memcmp(first.data(), scattered.data(), first.size()));
+    ASSERT_EQ(0, std::memcmp(second.data(), scattered.data() + first.size(), second.size()));
+}
+
+TEST(async_file_test, read__completes_with_handle_eof__when_offset_is_past_end_of_file)
+{
+    temporary_path const path;
+    io_completion_executor executor{ 1 };
+    async_file file{ path.path(), async_file_access::read_write, executor };
+    io_buffer const buffer{ file.sector_size() };
+
+    waitable_request read;
+    auto const started = file.read(buffer.size() * 4, buffer.data(), static_cast<DWORD>(buffer.size()), read.request);
+
+    // an unbuffered read past the end may also fail without starting
+    if (started) {
+        ASSERT_TRUE(read.wait());
+        ASSERT_EQ(static_cast<DWORD>(ERROR_HANDLE_EOF), read.request.error);
+    } else {
+        ASSERT_EQ(static_cast<DWORD>(ERROR_HANDLE_EOF), GetLastError());
+    }
+}
+
+TEST(async_file_test, set_size__trims_sector_padding__when_called_after_unbuffered_write)
+{
+    temporary_path const path;
+    {
+        io_completion_executor executor{ 1 };
+        async_file file{ path.path(), async_file_access::write, executor };
+        io_buffer const buffer{ file.sector_size() };
+        fill(buffer, 'q');
+
+        waitable_request write;
+        ASSERT_TRUE(file.write(0, buffer.data(), static_cast<DWORD>(buffer.size()), write.request));
+        ASSERT_TRUE(write.wait());
+        ASSERT_TRUE(file.set_size(10));
+        ASSERT_EQ(10U, file.size());
+    }
+
+    ASSERT_EQ(10U, std::filesystem::file_size(path.path()));
+}
+
+TEST(async_file_test, constructor__throws_windows_exception__when_reading_missing_file)
+{
+    temporary_path const path;
+    io_completion_executor executor{ 1 };
+
+    ASSERT_THROW({ async_file const file(path.path(), async_file_access::read, executor); }, modern_win32::windows_exception);
+}
+
+#ifdef MODERN_WIN32_HAS_COROUTINES
+
+namespace
+{
+    struct detached_task final
+    {
+        struct promise_type final
+        {
+            detached_task get_return_object() noexcept
+            {
+                return {};
+            }
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+            void return_void() noexcept
+            {
+            }
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    detached_task write_then_read(async_file& file, io_buffer const& written, io_buffer const& read, DWORD& transferred, bool& succeeded, manual_reset_event& completed)
+    {
+        auto const write = co_await modern_win32::async_write(file, 0, written.data(), static_cast<DWORD>(written.size()));
+        auto const result = co_await modern_win32::async_read(file, 0, read.data(), static_cast<DWORD>(read.size()));
+        succeeded = write.has_value() && result.has_value();
+        transferred = result.value_or(0UL);
+        std::ignore = completed.set();
+    }
+}
+
+TEST(async_file_test, async_read__resumes_with_bytes_transferred__when_awaited_after_async_write)
+{
+    temporary_path const path;
+    io_completion_executor executor{ 1 };
+    async_file file{ path.path(), async_file_access::read_write, executor };
+    io_buffer const written{ file.sector_size() };
+    io_buffer const read{ file.sector_size() };
+    fill(written, 'm');
+
+    DWORD transferred{};
+    bool succeeded{};
+    manual_reset_event completed{ false };
+    write_then_read(file, written, read, transferred, succeeded, completed);
+
+    ASSERT_TRUE(completed.wait_one(TEST_TIMEOUT));
+    ASSERT_TRUE(succeeded);
+    ASSERT_EQ(written.size(), transferred);
+    ASSERT_EQ(0, std::memcmp(written.data(), read.data(), written.size()));
+}
+
+#endif
@@ -0,0 +1,150 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <modern_win32/threading/awaitable.h>
+
+#ifdef MODERN_WIN32_HAS_COROUTINES
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/semaphore.h>
+
+using modern_win32::wait_for_result;
+using modern_win32::threading::async_delay;
+using modern_win32::threading::async_wait_one;
+using modern_win32::threading::auto_reset_event;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::semaphore;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+
+    /// <summary>
+    /// minimal eagerly started coroutine, the frame is destroyed when the body completes
+    /// </summary>
+    struct detached_task final
+    {
+        struct promise_type final
+        {
+            detached_task get_return_object() noexcept
+            {
+                return {};
+            }
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+            void return_void() noexcept
+            {
+            }
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    template <typename WAITABLE>
+    detached_task wait_and_record(WAITABLE const& waitable, std::optional<milliseconds> timeout, wait_for_result& result, manual_reset_event& completed)
+    {
+        result = co_await async_wait_one(waitable, timeout);
+        std::ignore = completed.set();
+    }
+
+    detached_task delay_and_record(milliseconds delay, bool& elapsed, manual_reset_event& completed)
+    {
+        elapsed = co_await async_delay(delay);
+        std::ignore = completed.set();
+    }
+}
+
+TEST(awaitable_test, async_wait_one__completes_with_object__when_event_is_set_after_suspending)
+{
+    manual_reset_event event{ false };
+    manual_reset_event completed{ false };
+    auto result = wait_for_result::failed;
+
+    wait_and_record(event, std::nullopt, result, completed);
+    ASSERT_FALSE(completed.wait_one(milliseconds(20)));
+    std::ignore = event.set();
+
+    ASSERT_TRUE(completed.wait_one(TEST_TIMEOUT));
+    ASSERT_EQ(wait_for_result::object, result);
+}
+
+TEST(awaitable_test, async_wait_one__completes_without_suspending__when_event_is_already_set)
+{
+    auto_reset_event event{ true };
+    manual_reset_event completed{ false };
+    auto result = wait_for_result::failed;
+
+    wait_and_record(event, std::nullopt, result, completed);
+
+    ASSERT_TRUE(completed.wait_one(milliseconds(0)));
+    ASSERT_EQ(wait_for_result::object, result);
+    ASSERT_FALSE(event.wait_one(milliseconds(0)));
+}
+
+TEST(awaitable_test, async_wait_one__completes_with_timeout__when_timeout_elapses)
+{
+    manual_reset_event event{ false };
+    manual_reset_event completed{ false };
+    auto result = wait_for_result::failed;
+
+    wait_and_record(event, milliseconds(20), result, completed);
+
+    ASSERT_TRUE(completed.wait_one(TEST_TIMEOUT));
+    ASSERT_EQ(wait_for_result::timeout, result);
+}
+
+TEST(awaitable_test, async_wait_one__acquires_semaphore__when_count_is_available)
+{
+    semaphore<> const counter{ 1, 1 };
+    manual_reset_event completed{ false };
+    auto result = wait_for_result::failed;
+
+    wait_and_record(counter, milliseconds(20), result, completed);
+
+    ASSERT_TRUE(completed.wait_one(TEST_TIMEOUT));
+    ASSERT_EQ(wait_for_result::object, result);
+    ASSERT_FALSE(counter.wait_one(std::optional(milliseconds(0))));
+}
+
+TEST(awaitable_test, async_delay__resumes_after_delay__when_delay_is_positive)
+{
+    manual_reset_event completed{ false };
+    bool elapsed{};
+    auto const start = std::chrono::steady_clock::now();
+
+    delay_and_record(milliseconds(30), elapsed, completed);
+
+    ASSERT_TRUE(completed.wait_one(TEST_TIMEOUT));
+    ASSERT_TRUE(elapsed);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, milliseconds(25));
+}
+
+#endif
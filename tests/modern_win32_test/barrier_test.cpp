@@ -0,0 +1,95 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <modern_win32/threading/barrier.h>
+
+using modern_win32::threading::barrier;
+
+TEST(barrier_test, constructor__throws_invalid_argument__when_expected_is_zero)
+{
+    ASSERT_THROW(barrier(0), std::invalid_argument);
+}
+
+TEST(barrier_test, arrive_and_wait__returns_true_for_one_thread__when_phase_completes)
+{
+    constexpr int thread_count = 4;
+    barrier sync{ thread_count };
+    std::atomic<int> serial_threads{};
+
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&sync, &serial_threads]() {
+            if (sync.arrive_and_wait()) {
+                ++serial_threads;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(1, serial_threads.load());
+}
+
+TEST(barrier_test, arrive_and_wait__orders_phases__when_barrier_is_reused)
+{
+    constexpr int thread_count = 4;
+    constexpr int phase_count = 50;
+    barrier sync{ thread_count, 100 };
+    std::atomic<int> arrivals{};
+    std::atomic<bool> out_of_phase{};
+
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&]() {
+            for (int phase = 0; phase < phase_count; ++phase) {
+                ++arrivals;
+                sync.arrive_and_wait();
+                if (arrivals.load() < (phase + 1) * thread_count) {
+                    out_of_phase = true;
+                }
+                sync.arrive_and_wait();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_FALSE(out_of_phase.load());
+    ASSERT_EQ(thread_count * phase_count, arrivals.load());
+}
+
+TEST(barrier_test, arrive_and_spin__releases_every_thread__when_all_arrive)
+{
+    barrier sync{ 2 };
+    std::atomic<int> released{};
+
+    std::thread other([&sync, &released]() {
+        sync.arrive_and_spin();
+        ++released;
+    });
+    sync.arrive_and_spin();
+    ++released;
+    other.join();
+
+    ASSERT_EQ(2, released.load());
+}
@@ -0,0 +1,139 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <string>
+#include <unordered_map>
+#include <modern_win32/shared/case_insensitive_string.h>
+
+using modern_win32::shared::case_insensitive_string;
+using modern_win32::shared::case_insensitive_string_view;
+using modern_win32::shared::case_insensitive_wstring;
+using modern_win32::shared::case_insensitive_wstring_view;
+
+namespace
+{
+    [[nodiscard]]
+    case_insensitive_string repeated(std::size_t const count, char const ch)
+    {
+        return case_insensitive_string(count, ch);
+    }
+    [[nodiscard]]
+    case_insensitive_wstring repeated(std::size_t const count, wchar_t const ch)
+    {
+        return case_insensitive_wstring(count, ch);
+    }
+}
+
+TEST(case_insensitive_string_test, compare__returns_zero__when_strings_differ_only_by_case)
+{
+    ASSERT_EQ(case_insensitive_string("Path"), case_insensitive_string("PATH"));
+    ASSERT_EQ(case_insensitive_wstring(L"Path"), case_insensitive_wstring(L"pAtH"));
+}
+
+TEST(case_insensitive_string_test, compare__returns_zero__when_long_strings_differ_only_by_case)
+{
+    for (std::size_t length : {15U, 16U, 17U, 31U, 32U, 33U, 65U}) {
+        ASSERT_EQ(repeated(length, 'a'), repeated(length, 'A'));
+        ASSERT_EQ(repeated(length, L'z'), repeated(length, L'Z'));
+    }
+}
+
+TEST(case_insensitive_string_test, compare__orders_by_first_difference__when_difference_is_inside_a_block)
+{
+    for (std::size_t position : {0U, 7U, 15U, 16U, 31U, 40U}) {
+        auto left = repeated(48, 'a');
+        auto right = repeated(48, 'A');
+        left[position] = 'b';
+        right[position] = 'C';
+
+        ASSERT_LT(left.compare(right), 0);
+        ASSERT_GT(right.compare(left), 0);
+
+        auto wide_left = repeated(48, L'a');
+        auto wide_right = repeated(48, L'A');
+        wide_left[position] = L'b';
+        wide_right[position] = L'C';
+
+        ASSERT_LT(wide_left.compare(wide_right), 0);
+        ASSERT_GT(wide_right.compare(wide_left), 0);
+    }
+}
+
+TEST(case_insensitive_string_test, compare__does_not_fold_punctuation__when_adjacent_to_letters)
+{
+    // '@' and '[' border 'A'-'Z', '`' and '{' border 'a'-'z'
+    ASSERT_NE(repeated(32, '@'), repeated(32, '`'));
+    ASSERT_NE(repeated(32, '['), repeated(32, '{'));
+    ASSERT_NE(repeated(32, L'@'), repeated(32, L'`'));
+}
+
+TEST(case_insensitive_string_test, compare__uses_locale_upper_case__when_block_contains_non_ascii)
+{
+    auto left = repeated(40, L'a');
+    auto right = repeated(40, L'A');
+    left[20] = L'\u00E9';
+    right[20] = L'\u00C9';
+    ASSERT_EQ(static_cast<int>(towupper(L'\u00E9')) == L'\u00C9', left == right);
+
+    right[39] = L'B';
+    ASSERT_NE(left, right);
+}
+
+TEST(case_insensitive_string_test, find__returns_first_match__when_character_differs_by_case)
+{
+    auto const value = repeated(40, 'x') + "Needle";
+    auto const view = case_insensitive_string_view(value);
+
+    ASSERT_EQ(40U, view.find('n'));
+    ASSERT_EQ(41U, view.find('E'));
+
+    auto const wide_value = repeated(20, L'x') + L"Needle";
+    ASSERT_EQ(20U, case_insensitive_wstring_view(wide_value).find(L'N'));
+}
+
+TEST(case_insensitive_string_test, find__returns_npos__when_character_not_present)
+{
+    ASSERT_EQ(case_insensitive_string::npos, repeated(40, 'x').find('y'));
+    ASSERT_EQ(case_insensitive_wstring::npos, repeated(40, L'x').find(L'\u00E9'));
+}
+
+TEST(case_insensitive_string_test, find__returns_position_of_substring__when_case_differs)
+{
+    auto const value = repeated(33, 'q') + "Environment";
+    ASSERT_EQ(33U, value.find("ENVIRONMENT"));
+}
+
+TEST(case_insensitive_string_test, hash__returns_same_value__when_strings_differ_only_by_case)
+{
+    std::hash<case_insensitive_string> const string_hash{};
+    std::hash<case_insensitive_wstring_view> const view_hash{};
+
+    ASSERT_EQ(string_hash("SystemRoot"), string_hash("SYSTEMROOT"));
+    ASSERT_EQ(view_hash(L"SystemRoot"), view_hash(L"systemroot"));
+}
+
+TEST(case_insensitive_string_test, unordered_map__finds_key__when_lookup_differs_by_case)
+{
+    std::unordered_map<case_insensitive_wstring, int> variables{{L"Path", 1}, {L"TEMP", 2}};
+
+    auto const match = variables.find(L"PATH");
+    ASSERT_NE(variables.end(), match);
+    ASSERT_EQ(1, match->second);
+    ASSERT_EQ(1U, variables.count(L"temp"));
+}
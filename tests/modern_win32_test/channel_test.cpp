@@ -0,0 +1,156 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <modern_win32/threading/channel.h>
+
+using modern_win32::threading::channel;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(channel_test, try_pop__returns_nullopt__when_channel_is_empty)
+{
+    channel<int, 4> queue{};
+
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(channel_test, try_pop__returns_elements_in_order__when_elements_were_pushed)
+{
+    channel<int, 4> queue{};
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+
+    ASSERT_EQ(1, queue.try_pop().value());
+    ASSERT_EQ(2, queue.try_pop().value());
+}
+
+TEST(channel_test, try_push__leaves_value_untouched__when_channel_is_full)
+{
+    channel<std::unique_ptr<int>, 2> queue{};
+    ASSERT_TRUE(queue.try_push(std::make_unique<int>(1)));
+    ASSERT_TRUE(queue.try_push(std::make_unique<int>(2)));
+
+    auto value = std::make_unique<int>(3);
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    ASSERT_NE(nullptr, value);
+    ASSERT_EQ(2U, queue.size_approx());
+}
+
+TEST(channel_test, try_emplace__constructs_element_in_place__when_space_is_available)
+{
+    channel<std::unique_ptr<int>, 2> queue{};
+
+    ASSERT_TRUE(queue.try_emplace(new int(42)));
+    ASSERT_EQ(42, *queue.try_pop().value());
+}
+
+TEST(channel_test, pop__returns_nullopt__when_timeout_elapses_while_empty)
+{
+    channel<int, 4> queue{};
+
+    ASSERT_FALSE(queue.pop(milliseconds(20)).has_value());
+}
+
+TEST(channel_test, pop__wakes_consumer__when_producer_pushes)
+{
+    channel<int, 4> queue{};
+    auto consumer = std::async(std::launch::async, [&queue]() { return queue.pop(TEST_TIMEOUT); });
+    std::this_thread::sleep_for(milliseconds(20));
+
+    ASSERT_TRUE(queue.try_push(7));
+
+    ASSERT_EQ(std::future_status::ready, consumer.wait_for(TEST_TIMEOUT));
+    ASSERT_EQ(7, consumer.get().value());
+}
+
+TEST(channel_test, push__blocks_producer__until_consumer_pops_when_full)
+{
+    channel<int, 2> queue{};
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+
+    auto producer = std::async(std::launch::async, [&queue]() { return queue.push(3, TEST_TIMEOUT); });
+    ASSERT_EQ(std::future_status::timeout, producer.wait_for(milliseconds(20)));
+    ASSERT_EQ(1, queue.try_pop().value());
+
+    ASSERT_EQ(std::future_status::ready, producer.wait_for(TEST_TIMEOUT));
+    ASSERT_TRUE(producer.get());
+}
+
+TEST(channel_test, try_push_batch__adds_until_full__when_range_exceeds_capacity)
+{
+    channel<int, 4> queue{};
+    std::vector<int> const values{ 1, 2, 3, 4, 5, 6 };
+
+    ASSERT_EQ(4U, queue.try_push_batch(values.begin(), values.end()));
+
+    std::vector<int> popped{};
+    ASSERT_EQ(4U, queue.try_pop_batch(std::back_inserter(popped), 8));
+    ASSERT_EQ((std::vector<int>{ 1, 2, 3, 4 }), popped);
+}
+
+TEST(channel_test, pop_batch__returns_zero__when_timeout_elapses_while_empty)
+{
+    channel<int, 4> queue{};
+    std::vector<int> popped{};
+
+    ASSERT_EQ(0U, queue.pop_batch(std::back_inserter(popped), 4, milliseconds(10)));
+}
+
+TEST(channel_test, push__delivers_every_element_once__when_many_producers_and_consumers)
+{
+    constexpr int per_producer = 10000;
+    constexpr int thread_count = 4;
+    channel<int, 64> queue{};
+    std::atomic<long long> sum{};
+    std::atomic<int> received{};
+
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&queue]() {
+            for (int value = 1; value <= per_producer; ++value) {
+                ASSERT_TRUE(queue.push(int{ value }, TEST_TIMEOUT));
+            }
+        });
+        threads.emplace_back([&queue, &sum, &received]() {
+            for (int count = 0; count < per_producer; ++count) {
+                auto const value = queue.pop(TEST_TIMEOUT);
+                ASSERT_TRUE(value.has_value());
+                sum += value.value();
+                ++received;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    constexpr long long expected_sum = static_cast<long long>(per_producer) * (per_producer + 1) / 2 * thread_count;
+    ASSERT_EQ(thread_count * per_producer, received.load());
+    ASSERT_EQ(expected_sum, sum.load());
+}
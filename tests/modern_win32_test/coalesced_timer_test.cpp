@@ -0,0 +1,107 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <chrono>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/timer.h>
+
+using modern_win32::threading::default_tolerable_delay;
+using modern_win32::threading::delayed_callback;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::synchronization_timer;
+using modern_win32::threading::threadpool_timer_traits;
+using modern_win32::threading::timer_precision;
+
+TEST(coalesced_timer_test, precision__returns_exact__when_not_set)
+{
+    delayed_callback<int> const timer([](int&) { /* ... */ }, 3);
+
+    ASSERT_EQ(timer_precision::exact, timer.precision());
+}
+
+TEST(coalesced_timer_test, set_precision__uses_default_tolerable_delay__when_delay_not_given)
+{
+    delayed_callback<int> timer([](int&) { /* ... */ }, 3);
+
+    timer.set_precision(timer_precision::coalesced);
+
+    ASSERT_EQ(timer_precision::coalesced, timer.precision());
+    ASSERT_EQ(default_tolerable_delay, timer.tolerable_delay());
+}
+
+TEST(coalesced_timer_test, set_precision__throws_invalid_argument__when_coalesced_with_zero_delay)
+{
+    delayed_callback<int> timer([](int&) { /* ... */ }, 3);
+
+    ASSERT_THROW(timer.set_precision(timer_precision::coalesced, 0ms), std::invalid_argument);
+}
+
+TEST(coalesced_timer_test, set_precision__clears_tolerable_delay__when_exact)
+{
+    delayed_callback<int> timer([](int&) { /* ... */ }, 3);
+    timer.set_precision(timer_precision::coalesced, 100ms);
+
+    timer.set_precision(timer_precision::exact);
+
+    ASSERT_EQ(timer_precision::exact, timer.precision());
+    ASSERT_EQ(0ms, timer.tolerable_delay());
+}
+
+TEST(coalesced_timer_test, start__invokes_callback__when_delayed_callback_is_coalesced)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const& state) {
+        if (state == 3) {
+            std::ignore = callback_event.set();
+        }
+    };
+
+    delayed_callback<int, decltype(callback)> timer(callback, 3);
+    timer.start(50ms, 100ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_EQ(timer_precision::exact, timer.precision());
+}
+
+TEST(coalesced_timer_test, start__invokes_callback__when_threadpool_timer_is_coalesced)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const&) {
+        std::ignore = callback_event.set();
+    };
+
+    synchronization_timer<int, decltype(callback), threadpool_timer_traits> timer(callback, 3);
+    timer.start(50ms, 100ms, 50ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_TRUE(timer.stop());
+}
+
+TEST(coalesced_timer_test, start__leaves_precision_unchanged__when_tolerable_delay_given)
+{
+    auto callback = [](int const&) {};
+
+    synchronization_timer<int, decltype(callback), threadpool_timer_traits> timer(callback, 3);
+    timer.set_precision(timer_precision::coalesced, 100ms);
+    timer.start(1h, 1h, 25ms);
+    ASSERT_TRUE(timer.is_running());
+    std::ignore = timer.stop();
+
+    ASSERT_EQ(timer_precision::coalesced, timer.precision());
+    ASSERT_EQ(100ms, timer.tolerable_delay());
+}
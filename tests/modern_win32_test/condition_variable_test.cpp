@@ -0,0 +1,110 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <modern_win32/threading/condition_variable.h>
+#include <modern_win32/threading/slim_lock.h>
+
+using modern_win32::threading::condition_variable;
+using modern_win32::threading::shared_slim_lock;
+using modern_win32::threading::slim_lock;
+using modern_win32::threading::slim_lock_guard;
+using modern_win32::threading::unique_slim_lock;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(condition_variable_test, wait_for__returns_timeout__when_not_notified)
+{
+    slim_lock lock{};
+    condition_variable condition{};
+    unique_slim_lock guard{ lock };
+
+    ASSERT_EQ(std::cv_status::timeout, condition.wait_for(guard, milliseconds(20)));
+    ASSERT_TRUE(guard.owns_lock());
+}
+
+TEST(condition_variable_test, wait_for__returns_false__when_predicate_is_never_satisfied)
+{
+    slim_lock lock{};
+    condition_variable condition{};
+    unique_slim_lock guard{ lock };
+
+    ASSERT_FALSE(condition.wait_for(guard, milliseconds(20), []() { return false; }));
+}
+
+TEST(condition_variable_test, wait__returns_when_predicate_satisfied__when_producer_notifies_exclusive_waiter)
+{
+    slim_lock lock{};
+    condition_variable condition{};
+    std::deque<int> queue{};
+
+    std::thread producer([&]()
+    {
+        std::this_thread::sleep_for(milliseconds(20));
+        {
+            slim_lock_guard guard{ lock };
+            queue.push_back(42);
+        }
+        condition.notify_one();
+    });
+
+    unique_slim_lock guard{ lock };
+    auto const ready = condition.wait_for(guard, TEST_TIMEOUT, [&queue]() { return !queue.empty(); });
+    auto const value = ready ? queue.front() : 0;
+    guard.unlock();
+    producer.join();
+
+    ASSERT_TRUE(ready);
+    ASSERT_EQ(42, value);
+}
+
+TEST(condition_variable_test, notify_all__wakes_every_shared_waiter__when_waiting_in_shared_mode)
+{
+    slim_lock lock{};
+    condition_variable condition{};
+    bool ready{};
+    std::atomic<int> woken{};
+
+    auto const waiter = [&]()
+    {
+        shared_slim_lock guard{ lock };
+        if (condition.wait_for(guard, TEST_TIMEOUT, [&ready]() { return ready; })) {
+            ++woken;
+        }
+    };
+    std::thread first(waiter);
+    std::thread second(waiter);
+
+    std::this_thread::sleep_for(milliseconds(20));
+    {
+        slim_lock_guard guard{ lock };
+        ready = true;
+    }
+    condition.notify_all();
+    first.join();
+    second.join();
+
+    ASSERT_EQ(2, woken.load());
+}
@@ -16,7 +16,11 @@
 #pragma warning(default : 26812 26495)
 
 #include "timer_test.h"
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
 #include <modern_win32/threading/timer.h>
 #include <modern_win32/threading/event.h>
 #include "context.h"
@@ -50,6 +54,40 @@ TEST(delayed_callback_test, constructor__does_not_throw__when_state_is_reference
     });
 }
 
+TEST(delayed_callback_test, constructor__does_not_throw__when_state_is_move_only)
+{
+    ASSERT_NO_THROW({
+        delayed_callback<std::unique_ptr<int>> delay([](std::unique_ptr<int>&) { /* ... */ }, std::make_unique<int>(3));
+    });
+}
+
+TEST(delayed_callback_test, constructor__does_not_throw__when_state_is_constructed_in_place)
+{
+    ASSERT_NO_THROW({
+        delayed_callback<std::atomic<int>> delay([](std::atomic<int>&) { /* ... */ }, std::in_place, 3);
+    });
+}
+
+TEST(delayed_callback_test, start__passes_owned_state__when_state_is_move_only)
+{
+    manual_reset_event callback_event{ false };
+    std::atomic<std::size_t> observed{};
+    auto callback = [&observed, &callback_event](std::vector<std::unique_ptr<int>>& state) {
+        observed = state.size();
+        std::ignore = callback_event.set();
+    };
+    std::vector<std::unique_ptr<int>> state{};
+    state.push_back(std::make_unique<int>(1));
+    state.push_back(std::make_unique<int>(2));
+
+    delayed_callback<std::vector<std::unique_ptr<int>>, decltype(callback)> timer(callback, std::move(state));
+    auto moved{ std::move(timer) };
+    moved.start(10ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_EQ(2U, observed.load());
+}
+
 TEST_P(delayed_callback_test, start__throws_invalid_argument__when_due_time_is_less_than_zero)
 {
     try {
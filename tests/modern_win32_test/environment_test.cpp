@@ -17,9 +17,15 @@
 #pragma warning(default : 26812)
 #pragma warning(default : 26495)
 
+#include <chrono>
+#include <string_view>
+#include <Windows.h>
 #include <modern_win32/environment.h>
+#include <modern_win32/process.h>
 
 using modern_win32::environment_map;
+using modern_win32::narrow_environment_block;
+using modern_win32::wide_environment_block;
 
 TEST(environment, get_all_environment_returns_true_on_success)
 {
@@ -30,3 +36,69 @@ TEST(environment, get_all_environment_returns_true_on_success)
     
     ASSERT_TRUE(success);
 }
+
+TEST(environment, get_all_environment_fills_wide_environment_on_success)
+{
+    using modern_win32::try_get_all_environment_variables;
+
+    environment_map<wchar_t> env;
+    bool const success = try_get_all_environment_variables(env);
+
+    ASSERT_TRUE(success);
+    ASSERT_FALSE(env.empty());
+}
+
+TEST(environment, environment_block_current_finds_variable_ignoring_case)
+{
+    ASSERT_NE(FALSE, SetEnvironmentVariableW(L"MODERN_WIN32_BLOCK_TEST", L"block value"));
+
+    auto const block = wide_environment_block::current();
+    auto const value = block.find(L"modern_win32_block_test");
+
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(std::wstring_view(L"block value"), value.value());
+    ASSERT_FALSE(block.find(L"MODERN_WIN32_BLOCK_TEST_MISSING").has_value());
+    static_cast<void>(SetEnvironmentVariableW(L"MODERN_WIN32_BLOCK_TEST", nullptr));
+}
+
+TEST(environment, environment_block_from_map_iterates_every_variable)
+{
+    environment_map<char> const source{ { "alpha", "1" }, { "Beta", "2" }, { "gamma", "" } };
+
+    narrow_environment_block const block{ source };
+
+    ASSERT_EQ(source.size(), block.size());
+    ASSERT_EQ(source, block.to_map());
+    ASSERT_EQ(std::string_view("2"), block.find("BETA").value());
+    ASSERT_EQ(std::string_view(""), block.find("Gamma").value());
+    ASSERT_EQ('\0', block.data()[block.block_size() - 1]);
+    ASSERT_EQ('\0', block.data()[block.block_size() - 2]);
+}
+
+TEST(environment, environment_block_from_empty_map_is_terminated)
+{
+    narrow_environment_block const block{ environment_map<char>{} };
+
+    ASSERT_TRUE(block.empty());
+    ASSERT_EQ(2U, block.block_size());
+    ASSERT_EQ('\0', block.data()[0]);
+}
+
+TEST(environment, environment_block_is_passed_to_start_process)
+{
+    wide_environment_block const block{ environment_map<wchar_t>{ { L"MODERN_WIN32_EXIT_CODE", L"9" } } };
+    auto const startup_info = modern_win32::wide_process_startup_info_builder()
+#ifdef _WIN64
+        .with_filename(LR"(c:\windows\system32\cmd.exe)")
+#else
+        .with_filename(LR"(c:\windows\SysWOW64\cmd.exe)")
+#endif
+        .with_arguments(L"/c exit %MODERN_WIN32_EXIT_CODE%")
+        .with_environment_block(block)
+        .build();
+
+    auto const child = modern_win32::start_process(startup_info);
+
+    ASSERT_TRUE(child.wait_for_exit(std::chrono::milliseconds(30'000)));
+    ASSERT_EQ(9U, child.get_exit_code().value());
+}
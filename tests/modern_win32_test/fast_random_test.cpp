@@ -0,0 +1,156 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <modern_win32/fast_random.h>
+
+using modern_win32::non_cryptographic::pcg32;
+using modern_win32::non_cryptographic::xoshiro256_star_star;
+
+TEST(xoshiro256_star_star_test, call_operator__returns_reference_sequence__when_state_is_known)
+{
+    xoshiro256_star_star generator({ 1U, 2U, 3U, 4U });
+
+    ASSERT_EQ(11520ULL, generator());
+    ASSERT_EQ(0ULL, generator());
+    ASSERT_EQ(1509978240ULL, generator());
+    ASSERT_EQ(1215971899390074240ULL, generator());
+}
+
+TEST(xoshiro256_star_star_test, constructor__returns_same_sequence__when_seed_is_same)
+{
+    xoshiro256_star_star first(42U);
+    xoshiro256_star_star second(42U);
+
+    for (int i = 0; i < 16; ++i)
+        ASSERT_EQ(first(), second());
+}
+
+TEST(xoshiro256_star_star_test, jump__returns_different_sequence__when_copied_from_same_generator)
+{
+    xoshiro256_star_star first(42U);
+    auto second = first;
+    second.jump();
+
+    ASSERT_NE(first, second);
+    ASSERT_NE(first(), second());
+}
+
+TEST(xoshiro256_star_star_test, fill__interleaves_long_jumped_lanes__when_count_is_large)
+{
+    constexpr std::size_t count = 1027;
+    xoshiro256_star_star generator(7U);
+    std::array<xoshiro256_star_star, 4> lanes{ generator, generator, generator, generator };
+    for (std::size_t lane = 1; lane < lanes.size(); ++lane) {
+        lanes[lane] = lanes[lane - 1];
+        lanes[lane].long_jump();
+    }
+    std::vector<std::uint64_t> expected(count);
+    for (std::size_t i = 0; i < count; ++i)
+        expected[i] = lanes[i % lanes.size()]();
+
+    std::vector<std::uint64_t> actual(count);
+    generator.fill(actual.data(), actual.size());
+
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(lanes[0], generator);
+}
+
+TEST(xoshiro256_star_star_test, fill__matches_call_operator__when_count_is_small)
+{
+    xoshiro256_star_star generator(7U);
+    auto expected_generator = generator;
+    std::array<std::uint64_t, 10> actual{};
+
+    generator.fill(actual.data(), actual.size());
+
+    for (auto const value : actual)
+        ASSERT_EQ(expected_generator(), value);
+}
+
+TEST(xoshiro256_star_star_test, fill__writes_exact_length__when_filling_bytes)
+{
+    std::vector<byte> buffer(3001, byte{0xCD});
+    xoshiro256_star_star generator(7U);
+
+    generator.fill(buffer.data(), buffer.size() - 1);
+
+    ASSERT_EQ(byte{0xCD}, buffer.back());
+}
+
+TEST(xoshiro256_star_star_test, from_random_seed__returns_generator__when_random_bytes_available)
+{
+    auto const generator = xoshiro256_star_star::from_random_seed();
+
+    ASSERT_TRUE(generator.has_value());
+}
+
+TEST(xoshiro256_star_star_test, generator__produces_values_in_range__when_used_with_distribution)
+{
+    xoshiro256_star_star generator(7U);
+    std::uniform_int_distribution<int> distribution(1, 6);
+
+    for (int i = 0; i < 1000; ++i) {
+        auto const value = distribution(generator);
+        ASSERT_TRUE(value >= 1 && value <= 6);
+    }
+}
+
+TEST(pcg32_test, call_operator__returns_reference_sequence__when_seed_and_stream_are_known)
+{
+    pcg32 generator(42U, 54U);
+
+    ASSERT_EQ(0xA15C02B7U, generator());
+    ASSERT_EQ(0x7B47F409U, generator());
+    ASSERT_EQ(0xBA1D3330U, generator());
+    ASSERT_EQ(0x83D2F293U, generator());
+    ASSERT_EQ(0xBFA4784BU, generator());
+    ASSERT_EQ(0xCBED606EU, generator());
+}
+
+TEST(pcg32_test, advance__matches_discarding_each_value__when_delta_is_positive)
+{
+    pcg32 advanced(42U, 54U);
+    pcg32 stepped(42U, 54U);
+
+    advanced.advance(1000U);
+    for (int i = 0; i < 1000; ++i)
+        static_cast<void>(stepped());
+
+    ASSERT_EQ(stepped, advanced);
+    ASSERT_EQ(stepped(), advanced());
+}
+
+TEST(pcg32_test, constructor__returns_different_sequence__when_stream_differs)
+{
+    pcg32 first(42U, 1U);
+    pcg32 second(42U, 2U);
+
+    ASSERT_NE(first(), second());
+}
+
+TEST(pcg32_test, from_random_seed__returns_generator__when_random_bytes_available)
+{
+    auto const generator = pcg32::from_random_seed();
+
+    ASSERT_TRUE(generator.has_value());
+}
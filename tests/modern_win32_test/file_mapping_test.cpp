@@ -0,0 +1,218 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <modern_win32/file_mapping.h>
+
+using modern_win32::file_mapping;
+using modern_win32::mapped_view;
+using modern_win32::mapping_access;
+
+namespace
+{
+    class temporary_file final
+    {
+    public:
+        explicit temporary_file(std::string_view const content)
+            : path_(std::filesystem::temp_directory_path() / ("modern_win32_file_mapping_" + std::to_string(GetCurrentProcessId()) + "_" + std::to_string(next_id_++) + ".tmp"))
+        {
+            std::ofstream stream(path_, std::ios::binary | std::ios::trunc);
+            stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+        temporary_file(temporary_file const&) = delete;
+        temporary_file(temporary_file&&) = delete;
+        ~temporary_file()
+        {
+            std::error_code error{};
+            std::filesystem::remove(path_, error);
+        }
+        temporary_file& operator=(temporary_file const&) = delete;
+        temporary_file& operator=(temporary_file&&) = delete;
+
+        [[nodiscard]]
+        std::filesystem::path const& path() const noexcept
+        {
+            return path_;
+        }
+
+        [[nodiscard]]
+        std::string read() const
+        {
+            std::ifstream stream(path_, std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        }
+
+    private:
+        static inline std::atomic<int> next_id_{};
+        std::filesystem::path path_;
+    };
+
+    [[nodiscard]]
+    std::string_view as_string_view(mapped_view const& view)
+    {
+        return { reinterpret_cast<char const*>(view.data()), view.size() };
+    }
+}
+
+TEST(file_mapping_test, map__returns_file_content__when_access_is_read_only)
+{
+    temporary_file const file("hello mapped world");
+    auto const mapping = file_mapping::open(file.path());
+
+    auto const view = mapping.map();
+
+    ASSERT_EQ(18U, mapping.size());
+    ASSERT_EQ("hello mapped world", as_string_view(view));
+}
+
+TEST(file_mapping_test, map__returns_requested_range__when_offset_is_not_aligned)
+{
+    std::string content(200000, 'a');
+    content.replace(70000, 5, "range");
+    temporary_file const file(content);
+    auto const mapping = file_mapping::open(file.path());
+
+    auto const view = mapping.map(70000, 5);
+
+    ASSERT_EQ("range", as_string_view(view));
+}
+
+TEST(file_mapping_test, map__throws_out_of_range__when_range_exceeds_mapping)
+{
+    temporary_file const file("short");
+    auto const mapping = file_mapping::open(file.path());
+
+    ASSERT_THROW(static_cast<void>(mapping.map(2, 10)), std::out_of_range);
+    ASSERT_THROW(static_cast<void>(mapping.map(6)), std::out_of_range);
+}
+
+TEST(file_mapping_test, map__returns_empty_view__when_file_is_empty)
+{
+    temporary_file const file("");
+    auto const mapping = file_mapping::open(file.path());
+
+    auto const view = mapping.map();
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(nullptr, mapping.native_handle());
+}
+
+TEST(file_mapping_test, map__leaves_file_unchanged__when_copy_on_write_view_is_modified)
+{
+    temporary_file const file("original");
+    auto const mapping = file_mapping::open(file.path(), mapping_access::copy_on_write);
+    auto const view = mapping.map();
+
+    std::memcpy(view.data(), "modified", 8);
+
+    ASSERT_EQ("modified", as_string_view(view));
+    ASSERT_EQ("original", file.read());
+}
+
+TEST(file_mapping_test, map__writes_through_to_file__when_access_is_read_write)
+{
+    temporary_file const file("original");
+    {
+        auto const mapping = file_mapping::open(file.path(), mapping_access::read_write);
+        auto const view = mapping.map();
+
+        std::memcpy(view.data(), "modified", 8);
+        ASSERT_TRUE(view.flush());
+        ASSERT_TRUE(mapping.flush_file());
+    }
+
+    ASSERT_EQ("modified", file.read());
+}
+
+TEST(file_mapping_test, grow__extends_file__when_access_is_read_write)
+{
+    temporary_file const file("data");
+    auto mapping = file_mapping::open(file.path(), mapping_access::read_write);
+    auto const original_view = mapping.map();
+
+    mapping.grow(8192);
+    auto const view = mapping.map(4096, 4);
+    std::memcpy(view.data(), "tail", 4);
+
+    ASSERT_EQ(8192U, mapping.size());
+    ASSERT_EQ("data", as_string_view(original_view));
+    ASSERT_EQ("tail", as_string_view(view));
+}
+
+TEST(file_mapping_test, grow__throws_logic_error__when_access_is_read_only)
+{
+    temporary_file const file("data");
+    auto mapping = file_mapping::open(file.path());
+
+    ASSERT_THROW(mapping.grow(8192), std::logic_error);
+}
+
+TEST(file_mapping_test, open__creates_file_of_minimum_size__when_read_write_file_does_not_exist)
+{
+    temporary_file const file("");
+    std::filesystem::remove(file.path());
+
+    auto const mapping = file_mapping::open(file.path(), mapping_access::read_write, 4096);
+
+    ASSERT_EQ(4096U, mapping.size());
+    ASSERT_EQ(4096U, mapping.map().size());
+}
+
+TEST(mapped_view_test, prefetch__returns_true__when_range_is_within_view)
+{
+    temporary_file const file(std::string(100000, 'p'));
+    auto const mapping = file_mapping::open(file.path());
+    auto const view = mapping.map();
+
+    ASSERT_TRUE(view.prefetch());
+    ASSERT_TRUE(view.prefetch(4096, 4096));
+    ASSERT_FALSE(view.prefetch(99999, 2));
+}
+
+TEST(mapped_view_test, move_constructor__transfers_view__when_view_is_moved)
+{
+    temporary_file const file("moved");
+    auto const mapping = file_mapping::open(file.path());
+    auto source = mapping.map();
+
+    mapped_view const destination(std::move(source));
+
+    ASSERT_EQ("moved", as_string_view(destination));
+    ASSERT_FALSE(static_cast<bool>(source)); // NOLINT(bugprone-use-after-move)
+}
+
+#if __cplusplus > 201703L || _MSVC_LANG > 201703L
+TEST(mapped_view_test, as_span__covers_whole_view__when_view_is_mapped)
+{
+    temporary_file const file("span");
+    auto const mapping = file_mapping::open(file.path());
+    auto const view = mapping.map();
+
+    auto const span = view.as_const_span();
+
+    ASSERT_EQ(view.data(), span.data());
+    ASSERT_EQ(4U, span.size());
+}
+#endif
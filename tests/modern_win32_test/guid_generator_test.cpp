@@ -0,0 +1,133 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <algorithm>
+#include <array>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <modern_win32/guid_generator.h>
+
+using modern_win32::guid;
+using modern_win32::guid_generator;
+
+namespace
+{
+    [[nodiscard]]
+    int version_of(guid const& value)
+    {
+        return value.get().Data3 >> 12;
+    }
+
+    [[nodiscard]]
+    bool has_rfc_variant(guid const& value)
+    {
+        return (value.get().Data4[0] & 0xC0) == 0x80;
+    }
+
+    [[nodiscard]]
+    std::vector<guid> make_guids(std::size_t const count)
+    {
+        return std::vector<guid>(count, guid(GUID{}));
+    }
+}
+
+TEST(guid_generator_test, generate_random__sets_version_4_and_variant__for_every_value)
+{
+    auto values = make_guids(100);
+
+    ASSERT_TRUE(guid_generator::generate_random(values.data(), values.size()));
+
+    for (auto const& value : values) {
+        ASSERT_EQ(4, version_of(value));
+        ASSERT_TRUE(has_rfc_variant(value));
+    }
+}
+
+TEST(guid_generator_test, generate_random__returns_unique_values__when_batch_is_large)
+{
+    auto values = make_guids(1000);
+    ASSERT_TRUE(guid_generator::generate_random(values.data(), values.size()));
+
+    std::set<std::string> unique{};
+    for (auto const& value : values)
+        unique.insert(modern_win32::to_string(value));
+
+    ASSERT_EQ(values.size(), unique.size());
+}
+
+TEST(guid_generator_test, next_random__returns_different_values__when_called_repeatedly)
+{
+    auto const first = guid_generator::next_random();
+    auto const second = guid_generator::next_random();
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_NE(first.value(), second.value());
+    ASSERT_EQ(4, version_of(first.value()));
+}
+
+TEST(guid_generator_test, next_time_ordered__sets_version_7_and_variant)
+{
+    guid_generator generator{};
+
+    auto const value = generator.next_time_ordered();
+
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(7, version_of(value.value()));
+    ASSERT_TRUE(has_rfc_variant(value.value()));
+}
+
+TEST(guid_generator_test, generate_time_ordered__returns_increasing_values__within_the_same_millisecond)
+{
+    guid_generator generator{};
+    auto values = make_guids(5000);
+
+    ASSERT_TRUE(generator.generate_time_ordered(values.data(), values.size()));
+    auto const next = generator.next_time_ordered();
+    ASSERT_TRUE(next.has_value());
+    values.push_back(next.value());
+
+    for (std::size_t i = 1; i < values.size(); ++i)
+        ASSERT_LT(modern_win32::to_string(values[i - 1]), modern_win32::to_string(values[i]));
+}
+
+TEST(guid_generator_test, next_time_ordered__returns_unique_values__when_called_concurrently)
+{
+    constexpr std::size_t THREAD_COUNT = 4;
+    constexpr std::size_t PER_THREAD = 2000;
+    guid_generator generator{};
+    std::array<std::vector<std::string>, THREAD_COUNT> produced{};
+
+    std::vector<std::thread> threads{};
+    for (auto& output : produced) {
+        threads.emplace_back([&generator, &output] {
+            for (std::size_t i = 0; i < PER_THREAD; ++i)
+                output.push_back(modern_win32::to_string(generator.next_time_ordered().value()));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::set<std::string> unique{};
+    for (auto const& output : produced) {
+        ASSERT_TRUE(std::is_sorted(output.begin(), output.end()));
+        unique.insert(output.begin(), output.end());
+    }
+    ASSERT_EQ(THREAD_COUNT * PER_THREAD, unique.size());
+}
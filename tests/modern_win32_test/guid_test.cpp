@@ -14,6 +14,9 @@
 #pragma warning(disable : 26812 26495)
 #include <gtest/gtest.h>
 #pragma warning(default : 26812 26495)
+#include <cstring>
+#include <unordered_set>
+#include <vector>
 #include <modern_win32/guid.h>
 #include "context.h"
 
@@ -115,3 +118,98 @@ TEST(guid, get_returns_correct_wstring)
     ASSERT_EQ(raw_value, as_string);
 }
 
+
+TEST(guid, try_parse_guid_returns_value_when_string_is_canonical)
+{
+    auto const parsed = modern_win32::try_parse_guid("83066e5e-D9FE-40d2-B68C-548B2131b65c");
+
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(guid("83066E5E-D9FE-40D2-B68C-548B2131B65C"), parsed.value());
+}
+
+TEST(guid, try_parse_guid_returns_value_when_string_is_braced)
+{
+    auto const parsed = modern_win32::try_parse_guid(L"{83066E5E-D9FE-40D2-B68C-548B2131B65C}");
+
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(guid("83066E5E-D9FE-40D2-B68C-548B2131B65C"), parsed.value());
+}
+
+TEST(guid, try_parse_guid_returns_nullopt_when_string_invalid)
+{
+    ASSERT_FALSE(modern_win32::try_parse_guid("83066E5E-D9FE-40D2-B68C-548B2131B65").has_value());
+    ASSERT_FALSE(modern_win32::try_parse_guid("83066E5E-D9FE-40D2-B68C-548B2131B65G").has_value());
+    ASSERT_FALSE(modern_win32::try_parse_guid("83066E5E+D9FE-40D2-B68C-548B2131B65C").has_value());
+    ASSERT_FALSE(modern_win32::try_parse_guid("[83066E5E-D9FE-40D2-B68C-548B2131B65C]").has_value());
+    ASSERT_FALSE(modern_win32::try_parse_guid(L"83066E5E-D9FE-40D2-B68C-548B2131B6\u0100C").has_value());
+}
+
+TEST(guid, format_guid_writes_canonical_upper_case_form)
+{
+    constexpr auto value = modern_win32::try_parse_guid("d6df7ecc-05ba-4778-a6d9-3db0ace208c6");
+    static_assert(value.has_value());
+
+    char buffer[modern_win32::guid_string_length];
+    modern_win32::format_guid(value.value(), buffer);
+    wchar_t braced[modern_win32::braced_guid_string_length];
+    modern_win32::format_braced_guid(value.value(), braced);
+
+    ASSERT_EQ(std::string_view("D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6"), std::string_view(buffer, std::size(buffer)));
+    ASSERT_EQ(std::wstring_view(L"{D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6}"), std::wstring_view(braced, std::size(braced)));
+}
+
+TEST(guid, guid_literal_is_evaluated_at_compile_time)
+{
+    using namespace modern_win32::literals;
+    constexpr auto value = "D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6"_guid;
+
+    ASSERT_EQ(guid("D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6"), value);
+}
+
+TEST(guid, empty_returns_true_only_for_all_zero_value)
+{
+    static_assert(guid(GUID{}).empty());
+    static_assert(!static_cast<bool>(guid(GUID{})));
+
+    guid const value("D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6");
+
+    ASSERT_FALSE(value.empty());
+    ASSERT_TRUE(static_cast<bool>(value));
+    ASSERT_TRUE(guid::zero().empty());
+}
+
+TEST(guid, less_than_matches_memcmp_order)
+{
+    std::vector<guid> const values{
+        guid("00000000-0000-0000-0000-000000000001"),
+        guid("01000000-0000-0000-0000-000000000000"),
+        guid("00000001-0000-0000-0000-000000000000"),
+        guid("00000000-0000-0000-FF00-000000000000"),
+        guid("D6DF7ECC-05BA-4778-A6D9-3DB0ACE208C6"),
+    };
+
+    for (auto const& left : values) {
+        for (auto const& right : values) {
+            auto const left_value = left.get();
+            auto const right_value = right.get();
+            auto const expected = std::memcmp(&left_value, &right_value, sizeof(GUID));
+
+            ASSERT_EQ(expected < 0, left < right);
+            ASSERT_EQ(expected == 0, !(left < right) && !(right < left));
+            ASSERT_EQ(expected > 0, left > right);
+        }
+    }
+}
+
+TEST(guid, hash_is_equal_for_equal_values_and_usable_as_key)
+{
+    guid const first("83066E5E-D9FE-40D2-B68C-548B2131B65C");
+    guid const second("6CCE5066-427E-4B32-AA77-DEDA5519F786");
+
+    std::unordered_set<guid> const values{ first, second, guid("83066e5e-d9fe-40d2-b68c-548b2131b65c") };
+
+    ASSERT_EQ(std::hash<guid>{}(first), std::hash<guid>{}(guid("83066E5E-D9FE-40D2-B68C-548B2131B65C")));
+    ASSERT_NE(std::hash<guid>{}(first), std::hash<guid>{}(second));
+    ASSERT_EQ(2U, values.size());
+    ASSERT_EQ(1U, values.count(second));
+}
@@ -0,0 +1,180 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <modern_win32/handle_diagnostics.h>
+#include <modern_win32/handle_reaper.h>
+#include <modern_win32/null_handle.h>
+#include <modern_win32/unique_handle.h>
+
+using modern_win32::deferred_close_traits;
+using modern_win32::get_handle_count;
+using modern_win32::get_handle_counter;
+using modern_win32::handle_counter;
+using modern_win32::handle_diagnostics_enabled;
+using modern_win32::handle_reaper;
+using modern_win32::null_handle_traits;
+using modern_win32::unique_handle;
+
+using std::chrono::milliseconds;
+
+namespace
+{
+    std::atomic<int> closed_count{};
+    std::atomic<std::thread::id> closing_thread{};
+
+    struct counting_traits
+    {
+        using native_handle_type = int*;
+
+        static constexpr native_handle_type invalid() noexcept
+        {
+            return nullptr;
+        }
+        static void close(native_handle_type const handle) noexcept
+        {
+            delete handle;
+            closing_thread = std::this_thread::get_id();
+            ++closed_count;
+        }
+    };
+
+    struct diagnostics_traits : counting_traits
+    {
+    };
+
+    [[nodiscard]]
+    bool wait_for_closed(handle_reaper const& reaper, std::uint64_t const expected)
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (reaper.closed() < expected) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST(handle_reaper_test, flush__closes_every_deferred_handle__when_called)
+{
+    closed_count = 0;
+    handle_reaper reaper{ 1024, milliseconds(10000) };
+
+    for (int i = 0; i < 100; ++i)
+        reaper.defer<counting_traits>(new int(i));
+    reaper.flush();
+
+    ASSERT_EQ(0U, reaper.pending());
+    ASSERT_EQ(100U, reaper.closed());
+    ASSERT_EQ(100, closed_count.load());
+}
+
+TEST(handle_reaper_test, defer__closes_on_background_thread__when_batch_is_full)
+{
+    closed_count = 0;
+    handle_reaper reaper{ 8, milliseconds(10000) };
+
+    for (int i = 0; i < 8; ++i)
+        reaper.defer<counting_traits>(new int(i));
+
+    ASSERT_TRUE(wait_for_closed(reaper, 8));
+    ASSERT_NE(std::this_thread::get_id(), closing_thread.load());
+}
+
+TEST(handle_reaper_test, defer__closes_partial_batch__when_flush_interval_elapses)
+{
+    closed_count = 0;
+    handle_reaper reaper{ 1024, milliseconds(10) };
+
+    reaper.defer<counting_traits>(new int(1));
+
+    ASSERT_TRUE(wait_for_closed(reaper, 1));
+    ASSERT_EQ(1, closed_count.load());
+}
+
+TEST(handle_reaper_test, destructor__closes_pending_handles__when_not_flushed)
+{
+    closed_count = 0;
+    {
+        handle_reaper reaper{ 1024, milliseconds(10000) };
+        for (int i = 0; i < 10; ++i)
+            reaper.defer<counting_traits>(new int(i));
+    }
+
+    ASSERT_EQ(10, closed_count.load());
+}
+
+TEST(handle_reaper_test, deferred_close_traits__hands_handle_to_shared_reaper__when_unique_handle_is_destroyed)
+{
+    auto const closed_before = handle_reaper::shared().closed();
+    {
+        unique_handle<deferred_close_traits<null_handle_traits>> const handle{ CreateEventW(nullptr, TRUE, FALSE, nullptr) };
+        ASSERT_TRUE(static_cast<bool>(handle));
+    }
+    handle_reaper::shared().flush();
+
+    ASSERT_EQ(closed_before + 1, handle_reaper::shared().closed());
+}
+
+TEST(handle_counter_test, snapshot__reports_open_handles__when_opened_more_than_closed)
+{
+    handle_counter counter{ "handle_counter_test" };
+    counter.on_opened();
+    counter.on_opened();
+    counter.on_closed();
+
+    auto const snapshot = counter.snapshot();
+
+    ASSERT_EQ(1, snapshot.open);
+    ASSERT_EQ(2U, snapshot.opened);
+    ASSERT_EQ(1U, snapshot.closed);
+}
+
+TEST(handle_counter_test, get_handle_counter__returns_same_counter__when_names_are_equal)
+{
+    std::string const name{ "handle_counter_test::shared" };
+
+    auto& first = get_handle_counter(name.c_str());
+    auto& second = get_handle_counter(std::string{ name }.c_str());
+
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(name, first.traits_name());
+}
+
+TEST(handle_counter_test, get_handle_count__tracks_unique_handle_lifetime__when_diagnostics_enabled)
+{
+    if constexpr (!handle_diagnostics_enabled) {
+        GTEST_SKIP() << "MODERN_WIN32_HANDLE_DIAGNOSTICS is not defined";
+    }
+
+    auto const before = get_handle_count<diagnostics_traits>();
+    {
+        unique_handle<diagnostics_traits> first{ new int(1) };
+        unique_handle<diagnostics_traits> const second{ std::move(first) };
+        ASSERT_EQ(before.open + 1, get_handle_count<diagnostics_traits>().open);
+    }
+    auto const after = get_handle_count<diagnostics_traits>();
+
+    ASSERT_EQ(before.open, after.open);
+    ASSERT_EQ(before.closed + 1, after.closed);
+}
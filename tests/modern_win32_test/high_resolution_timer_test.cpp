@@ -0,0 +1,118 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <atomic>
+#include <chrono>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/timer.h>
+
+using modern_win32::test::fake_timer_traits;
+using modern_win32::threading::high_resolution_delayed_callback;
+using modern_win32::threading::high_resolution_synchronization_timer;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::synchronization_timer;
+
+using std::literals::chrono_literals::operator ""us;
+
+namespace
+{
+    struct captured_timer_settings final
+    {
+        long long due_time{};
+        LONG period{};
+    };
+
+    auto capture_set_waitable_timer(captured_timer_settings& settings, manual_reset_event& set_event)
+    {
+        return [&settings, &set_event](int, LARGE_INTEGER& due_time, LONG period, PTIMERAPCROUTINE, void*, bool const) {
+            settings.due_time = due_time.QuadPart;
+            settings.period = period;
+            std::ignore = set_event.set();
+            return true;
+        };
+    }
+}
+
+TEST(high_resolution_timer_test, start__passes_period_in_milliseconds__when_period_is_whole_milliseconds)
+{
+    fake_timer_traits::reset();
+    captured_timer_settings settings{};
+    manual_reset_event set_event{ false };
+    fake_timer_traits::get_set_waitable_timer_result() = capture_set_waitable_timer(settings, set_event);
+
+    {
+        synchronization_timer<int, void(*)(int&), fake_timer_traits> timer([](int&) { /* ... */ }, 3);
+        timer.start(10ms, 250ms);
+        ASSERT_TRUE(set_event.wait_one(5s));
+    }
+    fake_timer_traits::reset();
+
+    ASSERT_EQ(-100'000LL, settings.due_time);
+    ASSERT_EQ(250L, settings.period);
+}
+
+TEST(high_resolution_timer_test, start__preserves_sub_millisecond_due_time__when_due_time_is_in_microseconds)
+{
+    fake_timer_traits::reset();
+    captured_timer_settings settings{};
+    manual_reset_event set_event{ false };
+    fake_timer_traits::get_set_waitable_timer_result() = capture_set_waitable_timer(settings, set_event);
+
+    {
+        synchronization_timer<int, void(*)(int&), fake_timer_traits> timer([](int&) { /* ... */ }, 3);
+        timer.start(1500us, 500us);
+        ASSERT_TRUE(set_event.wait_one(5s));
+    }
+    fake_timer_traits::reset();
+
+    ASSERT_EQ(-15'000LL, settings.due_time);
+    // sub-millisecond periods are re-armed from the callback rather than passed as the native period
+    ASSERT_EQ(0L, settings.period);
+}
+
+TEST(high_resolution_timer_test, start__invokes_callback__when_delayed_callback_due)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const& state) {
+        if (state == 3) {
+            std::ignore = callback_event.set();
+        }
+    };
+
+    high_resolution_delayed_callback<int, decltype(callback)> timer(callback, 3);
+    timer.start(500us);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+}
+
+TEST(high_resolution_timer_test, start__invokes_callback_repeatedly__when_period_is_sub_millisecond)
+{
+    manual_reset_event callback_event{ false };
+    std::atomic<int> call_count{};
+    auto callback = [&callback_event, &call_count](int const&) {
+        if (++call_count == 5) {
+            std::ignore = callback_event.set();
+        }
+    };
+
+    high_resolution_synchronization_timer<int, decltype(callback)> timer(callback, 3);
+    timer.start(500us, 500us);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_TRUE(timer.stop());
+}
@@ -0,0 +1,132 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <thread>
+#include <modern_win32/threading/instrumented_lock.h>
+
+using modern_win32::threading::instrumented_lock;
+using modern_win32::threading::instrumented_slim_lock;
+using modern_win32::threading::instrumented_timed_lock_guard;
+using modern_win32::threading::lock_statistics;
+using modern_win32::threading::no_lock_statistics;
+using modern_win32::threading::slim_lock;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+
+    [[nodiscard]]
+    std::uint64_t total(modern_win32::threading::lock_histogram const& histogram)
+    {
+        return std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{});
+    }
+}
+
+TEST(instrumented_lock_test, snapshot__returns_name__when_constructed_with_name)
+{
+    instrumented_slim_lock const lock{ L"routing table" };
+
+    ASSERT_EQ(L"routing table", lock.instrumentation().snapshot().name);
+}
+
+TEST(instrumented_lock_test, lock__records_uncontended_acquisition__when_lock_is_free)
+{
+    instrumented_slim_lock lock{ L"uncontended" };
+
+    {
+        std::lock_guard guard(lock);
+    }
+    {
+        std::shared_lock guard(lock);
+    }
+
+    auto const snapshot = lock.instrumentation().snapshot();
+    ASSERT_EQ(2U, snapshot.acquisitions);
+    ASSERT_EQ(0U, snapshot.contended_acquisitions);
+    ASSERT_EQ(2U, total(snapshot.wait_histogram));
+    ASSERT_EQ(1U, total(snapshot.hold_histogram));
+}
+
+TEST(instrumented_lock_test, lock__records_contended_acquisition__when_lock_is_held)
+{
+    instrumented_slim_lock lock{ L"contended" };
+    lock.lock();
+
+    auto other = std::async(std::launch::async, [&lock]() {
+        std::lock_guard guard(lock);
+    });
+    std::this_thread::sleep_for(milliseconds(20));
+    lock.unlock();
+    ASSERT_EQ(std::future_status::ready, other.wait_for(TEST_TIMEOUT));
+
+    auto const snapshot = lock.instrumentation().snapshot();
+    ASSERT_EQ(2U, snapshot.acquisitions);
+    ASSERT_EQ(1U, snapshot.contended_acquisitions);
+    ASSERT_GE(snapshot.total_wait_time, milliseconds(10));
+    ASSERT_GE(snapshot.total_hold_time, milliseconds(10));
+}
+
+TEST(instrumented_lock_test, try_lock_for__records_timeout__when_lock_is_not_released)
+{
+    instrumented_slim_lock lock{ L"timeout" };
+    std::lock_guard guard(lock);
+
+    auto other = std::async(std::launch::async, [&lock]() {
+        return lock.try_lock_for(milliseconds(10));
+    });
+
+    ASSERT_FALSE(other.get());
+    ASSERT_EQ(1U, lock.instrumentation().snapshot().timeouts);
+}
+
+TEST(instrumented_lock_test, instrumented_timed_lock_guard__records_hold__when_lock_is_acquired)
+{
+    slim_lock lock{};
+    lock_statistics statistics{ L"call site" };
+
+    {
+        instrumented_timed_lock_guard const guard(lock, statistics, milliseconds(10));
+        ASSERT_TRUE(guard.owns_lock());
+    }
+
+    auto const snapshot = statistics.snapshot();
+    ASSERT_EQ(1U, snapshot.acquisitions);
+    ASSERT_EQ(1U, total(snapshot.hold_histogram));
+}
+
+TEST(instrumented_lock_test, lock__provides_exclusion__when_instrumentation_is_disabled)
+{
+    instrumented_lock<slim_lock, no_lock_statistics> lock{ L"disabled" };
+    lock.lock();
+
+    auto other = std::async(std::launch::async, [&lock]() {
+        bool const acquired = lock.try_lock();
+        if (acquired) {
+            lock.unlock();
+        }
+        return acquired;
+    });
+
+    ASSERT_FALSE(other.get());
+    lock.unlock();
+}
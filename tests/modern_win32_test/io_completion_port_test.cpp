@@ -0,0 +1,151 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <tuple>
+#include <modern_win32/null_handle.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/threading/io_completion_port.h>
+
+using modern_win32::threading::auto_reset_event;
+using modern_win32::threading::executor_work;
+using modern_win32::threading::io_completion;
+using modern_win32::threading::io_completion_executor;
+using modern_win32::threading::io_completion_handler;
+using modern_win32::threading::io_completion_port;
+using modern_win32::threading::manual_reset_event;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+
+    struct recording_handler final : io_completion_handler
+    {
+        manual_reset_event completed{ false };
+        std::atomic<DWORD> bytes_transferred{};
+        std::atomic<bool> succeeded{};
+
+        void on_completion(io_completion const& completion) noexcept override
+        {
+            bytes_transferred = completion.bytes_transferred;
+            succeeded = completion.succeeded();
+            std::ignore = completed.set();
+        }
+    };
+
+    [[nodiscard]]
+    modern_win32::null_handle create_overlapped_temp_file()
+    {
+        std::array<wchar_t, MAX_PATH + 1> directory{};
+        std::array<wchar_t, MAX_PATH + 1> path{};
+        if (GetTempPathW(static_cast<DWORD>(directory.size()), directory.data()) == 0 ||
+            GetTempFileNameW(directory.data(), L"mwi", 0, path.data()) == 0) {
+            return modern_win32::null_handle{};
+        }
+
+        auto const file = CreateFileW(path.data(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+            FILE_FLAG_OVERLAPPED | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+        return modern_win32::null_handle{ file != INVALID_HANDLE_VALUE ? file : nullptr };
+    }
+}
+
+TEST(io_completion_port_test, dequeue__returns_posted_packet__when_packet_was_posted)
+{
+    io_completion_port const port{};
+    OVERLAPPED overlapped{};
+
+    ASSERT_TRUE(port.post(42, &overlapped, 7));
+    auto const completion = port.dequeue(TEST_TIMEOUT);
+
+    ASSERT_TRUE(completion.has_value());
+    ASSERT_EQ(42U, completion.value().key);
+    ASSERT_EQ(&overlapped, completion.value().overlapped);
+    ASSERT_EQ(7UL, completion.value().bytes_transferred);
+}
+
+TEST(io_completion_port_test, dequeue__returns_nullopt__when_timeout_expires)
+{
+    io_completion_port const port{};
+
+    ASSERT_FALSE(port.dequeue(milliseconds(10)).has_value());
+}
+
+TEST(io_completion_port_test, dequeue__removes_multiple_packets__when_batch_capacity_allows)
+{
+    io_completion_port const port{};
+    for (ULONG_PTR key = 1; key <= 3; ++key) {
+        ASSERT_TRUE(port.post(key));
+    }
+
+    std::array<OVERLAPPED_ENTRY, 8> entries{};
+    auto const removed = port.dequeue(entries.data(), entries.size(), TEST_TIMEOUT);
+
+    ASSERT_EQ(3U, removed);
+    ASSERT_EQ(1U, entries[0].lpCompletionKey);
+    ASSERT_EQ(3U, entries[2].lpCompletionKey);
+}
+
+TEST(io_completion_executor_test, post__runs_work__when_executor_is_running)
+{
+    io_completion_executor executor{ 2 };
+    auto_reset_event ran{ false };
+    executor_work work{ [](void* context) { std::ignore = static_cast<auto_reset_event*>(context)->set(); }, &ran };
+
+    ASSERT_TRUE(executor.post(work));
+
+    ASSERT_TRUE(ran.wait_one(TEST_TIMEOUT));
+}
+
+TEST(io_completion_executor_test, shutdown__runs_work_queued_before_shutdown__always)
+{
+    std::atomic<int> count{};
+    executor_work work{ [](void* context) { ++*static_cast<std::atomic<int>*>(context); }, &count };
+    {
+        io_completion_executor executor{ 2 };
+        for (int index = 0; index < 16; ++index) {
+            ASSERT_TRUE(executor.post(work));
+        }
+        executor.shutdown();
+        ASSERT_FALSE(executor.post(work));
+    }
+
+    ASSERT_EQ(16, count.load());
+}
+
+TEST(io_completion_executor_test, associate__dispatches_io_completion_to_handler__when_write_completes)
+{
+    auto const file = create_overlapped_temp_file();
+    ASSERT_TRUE(static_cast<bool>(file));
+
+    io_completion_executor executor{ 1 };
+    recording_handler handler{};
+    ASSERT_TRUE(executor.associate(file.native_handle(), handler));
+
+    std::string const data = "completion port";
+    OVERLAPPED overlapped{};
+    auto const written = WriteFile(file.native_handle(), data.data(), static_cast<DWORD>(data.size()), nullptr, &overlapped);
+    ASSERT_TRUE(written == TRUE || GetLastError() == ERROR_IO_PENDING);
+
+    ASSERT_TRUE(handler.completed.wait_one(TEST_TIMEOUT));
+    ASSERT_TRUE(handler.succeeded);
+    ASSERT_EQ(static_cast<DWORD>(data.size()), handler.bytes_transferred.load());
+}
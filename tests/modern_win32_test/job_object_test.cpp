@@ -0,0 +1,107 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <Windows.h>
+#include <modern_win32/job_object.h>
+
+using modern_win32::job_limits;
+using modern_win32::job_object;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = std::chrono::milliseconds(30'000);
+
+#ifdef _WIN64
+    constexpr auto JOB_COMMAND = R"(c:\windows\system32\cmd.exe)";
+#else
+    constexpr auto JOB_COMMAND = R"(c:\windows\SysWOW64\cmd.exe)";
+#endif
+}
+
+TEST(job_object_test, start_process__assigns_child_to_job__always)
+{
+    job_object const job{};
+
+    auto const child = job.start_process(JOB_COMMAND, "/c exit 0");
+
+    ASSERT_TRUE(job.contains(child));
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+}
+
+TEST(job_object_test, get_accounting__counts_every_process__after_children_exit)
+{
+    job_object const job{};
+
+    for (auto i = 0; i < 3; ++i) {
+        auto const child = job.start_process(JOB_COMMAND, "/c exit 0");
+        ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+    }
+
+    auto const accounting = job.get_accounting();
+    ASSERT_EQ(3U, accounting.total_processes);
+    ASSERT_EQ(0U, accounting.active_processes);
+}
+
+TEST(job_object_test, get_process_ids__includes_running_child__when_started_in_job)
+{
+    job_object const job{};
+    auto const child = job.start_process(JOB_COMMAND, "/c ping -n 10 127.0.0.1 > nul");
+
+    auto const ids = job.get_process_ids();
+
+    ASSERT_NE(ids.end(), std::find(ids.begin(), ids.end(), child.get_process_id().value()));
+    job.terminate(5U);
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+    ASSERT_EQ(5U, child.get_exit_code().value());
+}
+
+TEST(job_object_test, set_limits__prevents_second_process__when_active_process_limit_is_one)
+{
+    job_object job{};
+    job_limits limits{};
+    limits.active_process_limit = 1U;
+    limits.kill_on_close = true;
+    job.set_limits(limits);
+
+    auto const first = job.start_process(JOB_COMMAND, "/c ping -n 10 127.0.0.1 > nul");
+
+    ASSERT_ANY_THROW({ auto const second = job.start_process(JOB_COMMAND, "/c exit 0"); });
+    job.terminate();
+}
+
+TEST(job_object_test, set_limits__throws_invalid_argument__when_cpu_rate_out_of_range)
+{
+    job_object job{};
+    job_limits limits{};
+    limits.cpu_rate_percent = 150.0;
+
+    ASSERT_THROW(job.set_limits(limits), std::invalid_argument);
+}
+
+TEST(job_object_test, set_limits__accepts_cpu_and_memory_limits__always)
+{
+    job_object job{};
+    job_limits limits{};
+    limits.cpu_rate_percent = 50.0;
+    limits.process_memory_bytes = 256U * 1024U * 1024U;
+    limits.job_memory_bytes = 512U * 1024U * 1024U;
+
+    ASSERT_NO_THROW(job.set_limits(limits));
+}
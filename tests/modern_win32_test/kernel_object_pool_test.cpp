@@ -0,0 +1,111 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <optional>
+#include <tuple>
+#include <vector>
+#include <modern_win32/threading/kernel_object_pool.h>
+
+using modern_win32::threading::auto_reset_event_pool;
+using modern_win32::threading::manual_reset_event_pool;
+using modern_win32::threading::semaphore_pool;
+using std::chrono::milliseconds;
+
+TEST(kernel_object_pool_test, acquire__reuses_handle__when_previous_lease_was_returned)
+{
+    manual_reset_event_pool<> pool{};
+    HANDLE first{};
+    {
+        auto const event = pool.acquire();
+        first = event.native_handle();
+    }
+
+    auto const event = pool.acquire();
+
+    ASSERT_EQ(first, event.native_handle());
+    auto const statistics = pool.statistics();
+    ASSERT_EQ(1U, statistics.created);
+    ASSERT_EQ(1U, statistics.reused);
+    ASSERT_EQ(1U, statistics.outstanding);
+}
+
+TEST(kernel_object_pool_test, acquire__returns_non_signaled_event__when_event_was_returned_signaled)
+{
+    manual_reset_event_pool<> pool{};
+    {
+        auto event = pool.acquire();
+        ASSERT_TRUE(event.set());
+    }
+
+    auto const event = pool.acquire();
+
+    ASSERT_FALSE(event.wait_one(milliseconds(0)));
+}
+
+TEST(kernel_object_pool_test, wait_one__returns_true__when_auto_reset_event_is_set)
+{
+    auto_reset_event_pool<> pool{};
+    auto event = pool.acquire();
+
+    ASSERT_TRUE(event.set());
+
+    ASSERT_TRUE(event.wait_one(milliseconds(0)));
+    ASSERT_FALSE(event.wait_one(milliseconds(0)));
+}
+
+TEST(kernel_object_pool_test, acquire__returns_zero_count_semaphore__when_semaphore_was_returned_with_count)
+{
+    semaphore_pool<4> pool{};
+    {
+        auto semaphore = pool.acquire();
+        ASSERT_TRUE(semaphore.set());
+        ASSERT_TRUE(semaphore.set());
+    }
+
+    auto const semaphore = pool.acquire();
+
+    ASSERT_FALSE(semaphore.wait_one(milliseconds(0)));
+}
+
+TEST(kernel_object_pool_test, destructor__discards_object__when_free_list_is_full)
+{
+    manual_reset_event_pool<2> pool{};
+    {
+        std::vector<manual_reset_event_pool<2>::pooled_object> leases{};
+        for (int i = 0; i < 3; ++i) {
+            leases.push_back(pool.acquire());
+        }
+    }
+
+    auto const statistics = pool.statistics();
+    ASSERT_EQ(3U, statistics.created);
+    ASSERT_EQ(2U, statistics.recycled);
+    ASSERT_EQ(1U, statistics.discarded);
+    ASSERT_EQ(0U, statistics.outstanding);
+    ASSERT_EQ(2U, pool.idle_count());
+}
+
+TEST(kernel_object_pool_test, trim__closes_idle_objects__when_called)
+{
+    manual_reset_event_pool<> pool{};
+    std::ignore = pool.acquire();
+
+    pool.trim();
+
+    ASSERT_EQ(0U, pool.idle_count());
+}
@@ -0,0 +1,99 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <modern_win32/threading/latch.h>
+
+using modern_win32::threading::latch;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(latch_test, try_wait__returns_true__when_constructed_with_zero)
+{
+    latch const done{ 0 };
+
+    ASSERT_TRUE(done.try_wait());
+}
+
+TEST(latch_test, count_down__throws_invalid_argument__when_update_exceeds_count)
+{
+    latch done{ 1 };
+
+    ASSERT_THROW(done.count_down(2), std::invalid_argument);
+    ASSERT_FALSE(done.try_wait());
+}
+
+TEST(latch_test, wait_for__returns_false__when_count_does_not_reach_zero)
+{
+    latch done{ 2 };
+    done.count_down();
+
+    ASSERT_FALSE(done.wait_for(milliseconds(20)));
+}
+
+TEST(latch_test, wait__releases_every_waiter__when_count_reaches_zero)
+{
+    constexpr int waiter_count = 4;
+    latch done{ 2 };
+    std::atomic<int> released{};
+
+    std::vector<std::thread> waiters{};
+    for (int i = 0; i < waiter_count; ++i) {
+        waiters.emplace_back([&done, &released]() {
+            if (done.wait_for(TEST_TIMEOUT)) {
+                ++released;
+            }
+        });
+    }
+    std::this_thread::sleep_for(milliseconds(20));
+    done.count_down();
+    done.count_down();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+
+    ASSERT_EQ(waiter_count, released.load());
+}
+
+TEST(latch_test, arrive_and_wait__releases_workers__when_every_worker_arrives)
+{
+    constexpr int worker_count = 4;
+    latch start{ worker_count };
+    std::atomic<int> released{};
+
+    std::vector<std::thread> workers{};
+    for (int i = 0; i < worker_count; ++i) {
+        workers.emplace_back([&start, &released]() {
+            start.arrive_and_wait();
+            ++released;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(worker_count, released.load());
+    ASSERT_TRUE(start.try_wait());
+}
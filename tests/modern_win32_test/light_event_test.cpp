@@ -0,0 +1,93 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tuple>
+#include <modern_win32/threading/light_event.h>
+
+using modern_win32::threading::light_auto_reset_event;
+using modern_win32::threading::light_manual_reset_event;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(light_event_test, wait_one__returns_true_once__when_auto_reset_event_is_set)
+{
+    light_auto_reset_event event{ true };
+
+    ASSERT_TRUE(event.wait_one(milliseconds(0)));
+    ASSERT_FALSE(event.wait_one(milliseconds(0)));
+}
+
+TEST(light_event_test, wait_one__remains_signaled__when_manual_reset_event_is_set)
+{
+    light_manual_reset_event event{ true };
+
+    ASSERT_TRUE(event.wait_one(milliseconds(0)));
+    ASSERT_TRUE(event.wait_one(milliseconds(0)));
+}
+
+TEST(light_event_test, wait_one__returns_false__when_timeout_elapses)
+{
+    light_manual_reset_event const event{ false };
+    auto const start = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(event.wait_one(milliseconds(20)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, milliseconds(15));
+}
+
+TEST(light_event_test, wait_one__returns_false__after_manual_reset_event_is_cleared)
+{
+    light_manual_reset_event event{ true };
+
+    std::ignore = event.clear();
+
+    ASSERT_FALSE(event.wait_one(milliseconds(0)));
+}
+
+TEST(light_event_test, set__wakes_blocked_waiter__when_waiter_is_blocked)
+{
+    light_auto_reset_event event{ false, 100 };
+    std::atomic<bool> woken{};
+    std::thread waiter([&event, &woken]() { woken = event.wait_one(TEST_TIMEOUT); });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    std::ignore = event.set();
+    waiter.join();
+
+    ASSERT_TRUE(woken);
+}
+
+TEST(light_event_test, set__wakes_every_waiter__when_manual_reset_event_is_set)
+{
+    light_manual_reset_event event{ false };
+    std::atomic<int> woken{};
+    std::thread first([&event, &woken]() { woken += event.wait_one(TEST_TIMEOUT) ? 1 : 0; });
+    std::thread second([&event, &woken]() { woken += event.wait_one(TEST_TIMEOUT) ? 1 : 0; });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    std::ignore = event.set();
+    first.join();
+    second.join();
+
+    ASSERT_EQ(2, woken.load());
+}
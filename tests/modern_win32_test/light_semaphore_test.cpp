@@ -0,0 +1,136 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <modern_win32/threading/light_semaphore.h>
+#include <modern_win32/windows_exception.h>
+
+using modern_win32::windows_exception;
+using modern_win32::threading::light_semaphore;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(light_semaphore_test, constructor__throws_invalid_argument__when_initial_count_exceeds_maximum)
+{
+    ASSERT_THROW(light_semaphore(2, 1), std::invalid_argument);
+}
+
+TEST(light_semaphore_test, wait_one__decrements_count__when_count_is_available)
+{
+    light_semaphore const counter{ 2, 2 };
+
+    ASSERT_TRUE(counter.wait_one(milliseconds(0)));
+    ASSERT_TRUE(counter.wait_one(milliseconds(0)));
+    ASSERT_FALSE(counter.wait_one(milliseconds(0)));
+    ASSERT_EQ(0, counter.count());
+}
+
+TEST(light_semaphore_test, release__throws_windows_exception__when_maximum_would_be_exceeded)
+{
+    light_semaphore counter{ 1, 2 };
+
+    ASSERT_THROW(counter.release(2), windows_exception);
+    ASSERT_EQ(1, counter.count());
+}
+
+TEST(light_semaphore_test, release__wakes_blocked_waiter__when_waiter_is_blocked)
+{
+    light_semaphore counter{ 0, 1 };
+    std::atomic<bool> acquired{};
+    std::thread waiter([&counter, &acquired]() { acquired = counter.wait_one(TEST_TIMEOUT); });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    counter.release();
+    waiter.join();
+
+    ASSERT_TRUE(acquired);
+    ASSERT_EQ(0, counter.count());
+}
+
+TEST(light_semaphore_test, release__wakes_requested_number_of_waiters__when_count_is_greater_than_one)
+{
+    light_semaphore counter{ 0, 2 };
+    std::atomic<int> acquired{};
+    std::thread first([&counter, &acquired]() { acquired += counter.wait_one(TEST_TIMEOUT) ? 1 : 0; });
+    std::thread second([&counter, &acquired]() { acquired += counter.wait_one(TEST_TIMEOUT) ? 1 : 0; });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    counter.release(2);
+    first.join();
+    second.join();
+
+    ASSERT_EQ(2, acquired.load());
+}
+
+TEST(light_semaphore_test, try_acquire__leaves_count_unchanged__when_fewer_units_are_available)
+{
+    light_semaphore counter{ 2, 4 };
+
+    ASSERT_FALSE(counter.try_acquire(3));
+    ASSERT_EQ(2, counter.count());
+    ASSERT_TRUE(counter.try_acquire(2));
+    ASSERT_EQ(0, counter.count());
+}
+
+TEST(light_semaphore_test, acquire__takes_all_units_at_once__when_enough_are_released)
+{
+    light_semaphore counter{ 1, 4 };
+    std::atomic<bool> acquired{};
+    std::thread waiter([&counter, &acquired]() { acquired = counter.acquire(3, TEST_TIMEOUT); });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    counter.release();
+    std::this_thread::sleep_for(milliseconds(20));
+    ASSERT_FALSE(acquired);
+    counter.release();
+    waiter.join();
+
+    ASSERT_TRUE(acquired);
+    ASSERT_EQ(0, counter.count());
+}
+
+TEST(light_semaphore_test, release__wakes_single_unit_waiter__when_multi_unit_waiter_is_also_blocked)
+{
+    light_semaphore counter{ 0, 4 };
+    std::atomic<bool> large{};
+    std::atomic<bool> small{};
+    std::thread large_waiter([&counter, &large]() { large = counter.acquire(4, milliseconds(100)); });
+    std::thread small_waiter([&counter, &small]() { small = counter.wait_one(TEST_TIMEOUT); });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    counter.release();
+    small_waiter.join();
+    large_waiter.join();
+
+    ASSERT_TRUE(small);
+    ASSERT_FALSE(large);
+}
+
+TEST(light_semaphore_test, acquire__throws_invalid_argument__when_count_exceeds_maximum)
+{
+    light_semaphore const counter{ 1, 2 };
+
+    ASSERT_THROW(std::ignore = counter.acquire(3), std::invalid_argument);
+}
@@ -0,0 +1,193 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <modern_win32/metrics.h>
+#include <modern_win32/threading/lock_metrics.h>
+
+using modern_win32::metrics::bucket_lower_bound;
+using modern_win32::metrics::bucket_upper_bound;
+using modern_win32::metrics::counter;
+using modern_win32::metrics::latency_histogram;
+using modern_win32::metrics::registry;
+using modern_win32::metrics::value_at_percentile;
+using modern_win32::threading::metered_slim_lock;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+
+namespace
+{
+    [[nodiscard]]
+    bool is_within_bucket_error(nanoseconds const expected, nanoseconds const actual)
+    {
+        auto const error = expected > actual ? expected - actual : actual - expected;
+        return error.count() * 32 <= expected.count();
+    }
+}
+
+TEST(metrics_test, bucket_bounds__cover_every_value_without_gaps__when_iterating_buckets)
+{
+    static_assert(bucket_lower_bound(0) == 0);
+    static_assert(bucket_upper_bound(63) == 63);
+    static_assert(bucket_lower_bound(64) == 64);
+    static_assert(bucket_upper_bound(64) == 65);
+
+    for (std::size_t i = 1; i < modern_win32::metrics::histogram_bucket_count; ++i) {
+        ASSERT_EQ(bucket_upper_bound(i - 1) + 1, bucket_lower_bound(i));
+    }
+}
+
+TEST(metrics_test, snapshot__returns_zero_count__when_nothing_recorded)
+{
+    latency_histogram const histogram{ L"empty" };
+
+    auto const snapshot = histogram.snapshot();
+
+    ASSERT_EQ(L"empty", snapshot.name);
+    ASSERT_EQ(0U, snapshot.count);
+    ASSERT_EQ(nanoseconds(0), snapshot.p99);
+}
+
+TEST(metrics_test, snapshot__returns_count_min_max_and_total__when_values_recorded)
+{
+    latency_histogram histogram{};
+
+    histogram.record(nanoseconds(10));
+    histogram.record(nanoseconds(2'000));
+    histogram.record(nanoseconds(-5));
+
+    auto const snapshot = histogram.snapshot();
+
+    ASSERT_EQ(3U, snapshot.count);
+    ASSERT_EQ(nanoseconds(0), snapshot.min);
+    ASSERT_EQ(nanoseconds(2'000), snapshot.max);
+    ASSERT_EQ(nanoseconds(2'010), snapshot.total);
+}
+
+TEST(metrics_test, snapshot__returns_percentiles_within_bucket_error__when_values_are_uniform)
+{
+    latency_histogram histogram{};
+    for (int i = 1; i <= 10'000; ++i) {
+        histogram.record(microseconds(i));
+    }
+
+    auto const snapshot = histogram.snapshot();
+
+    ASSERT_TRUE(is_within_bucket_error(microseconds(5'000), snapshot.p50));
+    ASSERT_TRUE(is_within_bucket_error(microseconds(9'900), snapshot.p99));
+    ASSERT_TRUE(is_within_bucket_error(microseconds(9'990), snapshot.p999));
+    ASSERT_EQ(snapshot.max, value_at_percentile(snapshot, 100.0));
+}
+
+TEST(metrics_test, snapshot__merges_every_shard__when_recorded_from_several_threads)
+{
+    constexpr int thread_count = 12;
+    constexpr int values_per_thread = 1'000;
+    latency_histogram histogram{};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&histogram, i] {
+            for (int value = 0; value < values_per_thread; ++value) {
+                histogram.record(nanoseconds(i + 1));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto const snapshot = histogram.snapshot();
+
+    ASSERT_EQ(static_cast<std::uint64_t>(thread_count * values_per_thread), snapshot.count);
+    ASSERT_EQ(nanoseconds(1), snapshot.min);
+    ASSERT_EQ(nanoseconds(thread_count), snapshot.max);
+}
+
+TEST(metrics_test, reset__clears_histogram__when_values_recorded)
+{
+    latency_histogram histogram{};
+    histogram.record(microseconds(1));
+
+    histogram.reset();
+
+    ASSERT_EQ(0U, histogram.snapshot().count);
+}
+
+TEST(metrics_test, value__returns_sum_of_adds__when_added_from_several_threads)
+{
+    counter value{};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&value] {
+            for (int count = 0; count < 1'000; ++count) {
+                value.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(8'000U, value.value());
+}
+
+TEST(metrics_test, get_histogram__returns_same_histogram__when_name_is_reused)
+{
+    registry metrics{};
+
+    auto& first = metrics.get_histogram(L"requests");
+    auto& second = metrics.get_histogram(L"requests");
+
+    ASSERT_EQ(&first, &second);
+}
+
+TEST(metrics_test, snapshot__returns_metrics_ordered_by_name__when_registered_out_of_order)
+{
+    registry metrics{};
+    metrics.get_histogram(L"b").record(nanoseconds(1));
+    metrics.get_histogram(L"a").record(nanoseconds(1));
+    metrics.get_counter(L"z").add(3);
+
+    auto const snapshot = metrics.snapshot();
+
+    ASSERT_EQ(2U, snapshot.histograms.size());
+    ASSERT_EQ(L"a", snapshot.histograms[0].name);
+    ASSERT_EQ(L"b", snapshot.histograms[1].name);
+    ASSERT_EQ(1U, snapshot.counters.size());
+    ASSERT_EQ(3U, snapshot.counters[0].value);
+}
+
+TEST(metrics_test, metered_slim_lock__records_acquisition_and_hold__when_locked)
+{
+    metered_slim_lock lock{ L"metrics_test.metered" };
+
+    {
+        std::lock_guard guard(lock);
+    }
+
+    auto& metrics = registry::instance();
+    ASSERT_EQ(1U, metrics.get_counter(L"metrics_test.metered.acquisitions").value());
+    ASSERT_EQ(0U, metrics.get_counter(L"metrics_test.metered.contended").value());
+    ASSERT_EQ(1U, lock.instrumentation().wait_histogram().snapshot().count);
+    ASSERT_EQ(1U, lock.instrumentation().hold_histogram().snapshot().count);
+}
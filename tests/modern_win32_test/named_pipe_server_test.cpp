@@ -0,0 +1,253 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <modern_win32/invalid_handle.h>
+#include <modern_win32/named_pipe_server.h>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/io_completion_executor.h>
+#include <modern_win32/windows_exception.h>
+
+using modern_win32::invalid_handle;
+using modern_win32::named_pipe_connection;
+using modern_win32::named_pipe_handler;
+using modern_win32::named_pipe_server;
+using modern_win32::named_pipe_server_options;
+using modern_win32::windows_exception;
+using modern_win32::threading::io_completion_executor;
+using modern_win32::threading::manual_reset_event;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(5000);
+
+    [[nodiscard]]
+    std::wstring unique_pipe_name()
+    {
+        static std::atomic<int> next_id{};
+        return L"\\\\.\\pipe\\modern_win32_named_pipe_" + std::to_wstring(GetCurrentProcessId()) + L"_" + std::to_wstring(next_id++);
+    }
+
+    /// <summary>
+    /// writes every message back to the client and counts the calls it receives
+    /// </summary>
+    class echo_handler final : public named_pipe_handler
+    {
+    public:
+        std::atomic<int> connected{};
+        std::atomic<int> messages{};
+        std::atomic<int> disconnected{};
+        std::atomic<DWORD> last_error{};
+        manual_reset_event disconnected_event{ false };
+
+        void on_connected(named_pipe_connection&) noexcept override
+        {
+            ++connected;
+        }
+
+        void on_message(named_pipe_connection& connection, std::byte const* data, std::size_t size) noexcept override
+        {
+            ++messages;
+            std::ignore = connection.send(data, size);
+        }
+
+        void on_disconnected(named_pipe_connection&, DWORD const error) noexcept override
+        {
+            last_error = error;
+            ++disconnected;
+            std::ignore = disconnected_event.set();
+        }
+    };
+
+    /// <summary>
+    /// synchronous message mode client
+    /// </summary>
+    class pipe_client final
+    {
+    public:
+        explicit pipe_client(std::wstring const& name)
+            : pipe_(CreateFileW(name.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr))
+        {
+            if (!static_cast<bool>(pipe_))
+                throw windows_exception();
+            DWORD mode = PIPE_READMODE_MESSAGE;
+            if (SetNamedPipeHandleState(pipe_.native_handle(), &mode, nullptr, nullptr) == FALSE)
+                throw windows_exception();
+        }
+
+        [[nodiscard]]
+        bool write(std::string const& message) const noexcept
+        {
+            DWORD written{};
+            return WriteFile(pipe_.native_handle(), message.data(), static_cast<DWORD>(message.size()), &written, nullptr) != FALSE &&
+                written == message.size();
+        }
+
+        [[nodiscard]]
+        std::string read() const
+        {
+            std::string message;
+            char buffer[4096];
+            while (true) {
+                DWORD read{};
+                auto const success = ReadFile(pipe_.native_handle(), buffer, static_cast<DWORD>(sizeof(buffer)), &read, nullptr) != FALSE;
+                message.append(buffer, read);
+                if (success)
+                    return message;
+                if (GetLastError() != ERROR_MORE_DATA)
+                    throw windows_exception();
+            }
+        }
+
+        void close() noexcept
+        {
+            pipe_.reset();
+        }
+
+    private:
+        invalid_handle pipe_;
+    };
+
+    template <typename PREDICATE>
+    [[nodiscard]]
+    bool wait_until(PREDICATE predicate)
+    {
+        auto const deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() >= deadline)
+                return false;
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST(named_pipe_server_test, constructor__throws_windows_exception__when_name_is_in_use)
+{
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 1 };
+    echo_handler handler;
+    named_pipe_server const server{ name, executor, handler };
+
+    ASSERT_THROW((named_pipe_server{ name, executor, handler }), windows_exception);
+}
+
+TEST(named_pipe_server_test, send__echoes_message__when_client_writes)
+{
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 2 };
+    echo_handler handler;
+    named_pipe_server const server{ name, executor, handler };
+
+    pipe_client const client{ name };
+    ASSERT_TRUE(client.write("hello"));
+
+    ASSERT_EQ("hello", client.read());
+    ASSERT_EQ(1, handler.connected);
+    ASSERT_EQ(1U, server.connected_count());
+}
+
+TEST(named_pipe_server_test, on_message__receives_whole_message__when_message_is_larger_than_buffer)
+{
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 1 };
+    echo_handler handler;
+    named_pipe_server_options options{};
+    options.buffer_size = 512;
+    named_pipe_server const server{ name, executor, handler, options };
+
+    std::string message(5000, '\0');
+    for (std::size_t index = 0; index < message.size(); ++index) {
+        message[index] = static_cast<char>('a' + index % 26);
+    }
+    pipe_client const client{ name };
+    ASSERT_TRUE(client.write(message));
+
+    ASSERT_EQ(message, client.read());
+    ASSERT_EQ(1, handler.messages);
+}
+
+TEST(named_pipe_server_test, on_message__receives_every_message__when_many_clients_connect)
+{
+    constexpr int client_count = 16;
+    constexpr int message_count = 50;
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 4 };
+    echo_handler handler;
+    named_pipe_server_options options{};
+    options.listening_instances = 2;
+    named_pipe_server const server{ name, executor, handler, options };
+
+    std::vector<pipe_client> clients;
+    clients.reserve(client_count);
+    for (int index = 0; index < client_count; ++index) {
+        ASSERT_NE(FALSE, WaitNamedPipeW(name.c_str(), static_cast<DWORD>(TEST_TIMEOUT.count())));
+        clients.emplace_back(name);
+    }
+    for (int message = 0; message < message_count; ++message) {
+        for (auto const& client : clients) {
+            auto const text = std::to_string(message);
+            ASSERT_TRUE(client.write(text));
+            ASSERT_EQ(text, client.read());
+        }
+    }
+
+    ASSERT_EQ(client_count * message_count, handler.messages);
+    ASSERT_GE(server.instance_count(), static_cast<std::size_t>(client_count));
+}
+
+TEST(named_pipe_server_test, on_disconnected__called_with_broken_pipe__when_client_closes)
+{
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 1 };
+    echo_handler handler;
+    named_pipe_server const server{ name, executor, handler };
+
+    pipe_client client{ name };
+    ASSERT_TRUE(wait_until([&handler] { return handler.connected == 1; }));
+    client.close();
+
+    ASSERT_TRUE(handler.disconnected_event.wait_one(TEST_TIMEOUT));
+    ASSERT_EQ(static_cast<DWORD>(ERROR_BROKEN_PIPE), handler.last_error);
+    ASSERT_TRUE(wait_until([&server] { return server.connected_count() == 0; }));
+}
+
+TEST(named_pipe_server_test, destructor__disconnects_client__when_client_is_connected)
+{
+    auto const name = unique_pipe_name();
+    io_completion_executor executor{ 1 };
+    echo_handler handler;
+    std::optional<named_pipe_server> server{};
+    server.emplace(name, executor, handler);
+
+    pipe_client const client{ name };
+    ASSERT_TRUE(wait_until([&handler] { return handler.connected == 1; }));
+    server.reset();
+
+    ASSERT_EQ(1, handler.disconnected);
+    ASSERT_EQ(static_cast<DWORD>(ERROR_OPERATION_ABORTED), handler.last_error);
+    ASSERT_FALSE(client.write("late"));
+}
@@ -0,0 +1,117 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <modern_win32/numa.h>
+
+using modern_win32::allocate_on_numa_node;
+using modern_win32::arena_page_size;
+using modern_win32::bind_current_thread_to_numa_node;
+using modern_win32::current_numa_node;
+using modern_win32::get_numa_node_affinity;
+using modern_win32::get_numa_node_available_memory;
+using modern_win32::get_numa_nodes;
+using modern_win32::highest_numa_node;
+using modern_win32::make_numa_local_arena;
+using modern_win32::virtual_arena;
+
+TEST(numa_test, get_numa_nodes__returns_at_least_one_node__when_system_has_processors)
+{
+    auto const nodes = get_numa_nodes();
+
+    ASSERT_FALSE(nodes.empty());
+    ASSERT_LE(nodes.back(), highest_numa_node().value_or(0));
+}
+
+TEST(numa_test, current_numa_node__returns_known_node__when_called)
+{
+    auto const nodes = get_numa_nodes();
+
+    auto const node = current_numa_node();
+
+    ASSERT_TRUE(node.has_value());
+    ASSERT_NE(nodes.end(), std::find(nodes.begin(), nodes.end(), node.value()));
+}
+
+TEST(numa_test, get_numa_node_affinity__returns_processors__when_node_exists)
+{
+    auto const affinity = get_numa_node_affinity(get_numa_nodes().front());
+
+    ASSERT_TRUE(affinity.has_value());
+    ASSERT_FALSE(affinity.value().empty());
+}
+
+TEST(numa_test, get_numa_node_available_memory__returns_value__when_node_exists)
+{
+    ASSERT_TRUE(get_numa_node_available_memory(get_numa_nodes().front()).has_value());
+}
+
+TEST(numa_test, allocate_on_numa_node__returns_writable_memory__when_node_exists)
+{
+    constexpr std::size_t size = 64U * 1024U;
+
+    auto const memory = allocate_on_numa_node(size, get_numa_nodes().front());
+
+    ASSERT_TRUE(static_cast<bool>(memory));
+    std::memset(memory.native_handle(), 0xAB, size);
+}
+
+TEST(numa_test, bind_current_thread_to_numa_node__keeps_thread_on_node__when_node_exists)
+{
+    auto const node = get_numa_nodes().back();
+    bool bound{};
+    std::optional<DWORD> running_on{};
+
+    std::thread worker([node, &bound, &running_on]() {
+        bound = bind_current_thread_to_numa_node(node);
+        running_on = current_numa_node();
+    });
+    worker.join();
+
+    ASSERT_TRUE(bound);
+    ASSERT_EQ(node, running_on.value_or(~DWORD{}));
+}
+
+TEST(numa_test, make_numa_local_arena__returns_usable_arena__when_thread_is_bound)
+{
+    auto const node = get_numa_nodes().front();
+    bool bound{};
+    void* memory{};
+
+    // bound on a separate thread so the affinity of the test thread is left alone
+    std::thread worker([node, &bound, &memory]() {
+        bound = bind_current_thread_to_numa_node(node);
+        auto arena = make_numa_local_arena(1024U * 1024U);
+        memory = arena.allocate(4096);
+    });
+    worker.join();
+
+    ASSERT_TRUE(bound);
+    ASSERT_NE(nullptr, memory);
+}
+
+TEST(numa_test, virtual_arena__returns_usable_arena__when_numa_node_is_provided)
+{
+    virtual_arena arena(1024U * 1024U, arena_page_size::standard, virtual_arena::default_commit_size, get_numa_nodes().front());
+
+    ASSERT_NE(nullptr, arena.allocate(4096));
+}
@@ -0,0 +1,211 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <modern_win32/threading/parallel.h>
+#include <modern_win32/threading/slim_lock.h>
+
+using modern_win32::threading::parallel_for;
+using modern_win32::threading::parallel_for_chunks;
+using modern_win32::threading::parallel_invoke;
+using modern_win32::threading::parallel_reduce;
+using modern_win32::threading::slim_lock;
+using modern_win32::threading::slim_lock_guard;
+using modern_win32::threading::thread_pool;
+
+namespace
+{
+    constexpr std::size_t ITEM_COUNT = 10'000;
+}
+
+TEST(parallel_test, parallel_for__visits_each_index_once__when_range_is_not_empty)
+{
+    thread_pool pool{ 4 };
+    std::vector<std::atomic<int>> visits(ITEM_COUNT);
+
+    parallel_for(pool, std::size_t{}, ITEM_COUNT, [&visits](std::size_t const index) {
+        visits[index].fetch_add(1);
+    });
+
+    for (auto const& visit : visits) {
+        ASSERT_EQ(1, visit.load());
+    }
+}
+
+TEST(parallel_test, parallel_for__does_not_invoke_body__when_range_is_empty)
+{
+    thread_pool pool{ 2 };
+    std::atomic<int> calls{};
+
+    parallel_for(pool, 5, 5, [&calls](int) { calls.fetch_add(1); });
+    parallel_for(pool, 5, 1, [&calls](int) { calls.fetch_add(1); });
+
+    ASSERT_EQ(0, calls.load());
+}
+
+TEST(parallel_test, parallel_for__visits_each_element__when_given_iterators)
+{
+    thread_pool pool{ 4 };
+    std::vector<int> values(ITEM_COUNT, 1);
+
+    parallel_for(pool, values.begin(), values.end(), [](int& value) { value *= 3; });
+
+    for (auto const value : values) {
+        ASSERT_EQ(3, value);
+    }
+}
+
+TEST(parallel_test, parallel_for_chunks__uses_requested_grain__when_grain_is_provided)
+{
+    constexpr std::size_t grain = 64;
+    thread_pool pool{ 4 };
+    slim_lock lock{};
+    std::vector<std::size_t> sizes{};
+
+    parallel_for_chunks(pool, std::size_t{}, ITEM_COUNT, [&](std::size_t const begin, std::size_t const end) {
+        slim_lock_guard guard{ lock };
+        sizes.push_back(end - begin);
+    }, grain);
+
+    ASSERT_EQ((ITEM_COUNT + grain - 1) / grain, sizes.size());
+    ASSERT_EQ(ITEM_COUNT, std::accumulate(sizes.begin(), sizes.end(), std::size_t{}));
+    for (auto const size : sizes) {
+        ASSERT_LE(size, grain);
+    }
+}
+
+TEST(parallel_test, parallel_for__visits_negative_indices__when_index_is_signed)
+{
+    thread_pool pool{ 2 };
+    std::atomic<long long> sum{};
+
+    parallel_for(pool, -100, 100, [&sum](int const index) { sum.fetch_add(index); }, 7);
+
+    ASSERT_EQ(-100, sum.load());
+}
+
+TEST(parallel_test, parallel_for__rethrows_exception__when_body_throws)
+{
+    thread_pool pool{ 4 };
+
+    ASSERT_THROW(parallel_for(pool, 0, 1000, [](int const index) {
+        if (index == 500) {
+            throw std::runtime_error("expected");
+        }
+    }), std::runtime_error);
+}
+
+TEST(parallel_test, parallel_for__completes__when_called_from_worker)
+{
+    thread_pool pool{ 2 };
+    std::atomic<int> visits{};
+
+    parallel_for(pool, 0, 8, [&](int) {
+        parallel_for(pool, 0, 100, [&visits](int) { visits.fetch_add(1); });
+    }, 1);
+
+    ASSERT_EQ(800, visits.load());
+}
+
+TEST(parallel_test, parallel_reduce__returns_sum_of_mapped_indices__when_range_is_not_empty)
+{
+    thread_pool pool{ 4 };
+
+    auto const sum = parallel_reduce(pool, std::size_t{ 1 }, ITEM_COUNT + 1, std::size_t{},
+        [](std::size_t const index) { return index; },
+        [](std::size_t const lhs, std::size_t const rhs) { return lhs + rhs; });
+
+    ASSERT_EQ(ITEM_COUNT * (ITEM_COUNT + 1) / 2, sum);
+}
+
+TEST(parallel_test, parallel_reduce__returns_identity__when_range_is_empty)
+{
+    thread_pool pool{ 2 };
+    std::vector<int> const values{};
+
+    auto const sum = parallel_reduce(pool, values.begin(), values.end(), 42, [](int const lhs, int const rhs) { return lhs + rhs; });
+
+    ASSERT_EQ(42, sum);
+}
+
+TEST(parallel_test, parallel_reduce__preserves_order__when_combine_is_not_commutative)
+{
+    thread_pool pool{ 4 };
+    std::vector<std::string> values{};
+    std::string expected{};
+    for (int index = 0; index < 500; ++index) {
+        values.push_back(std::to_string(index % 10));
+        expected += values.back();
+    }
+
+    auto const joined = parallel_reduce(pool, values.cbegin(), values.cend(), std::string{},
+        [](std::string lhs, std::string const& rhs) { return lhs += rhs; }, 16);
+
+    ASSERT_EQ(expected, joined);
+}
+
+TEST(parallel_test, parallel_reduce__returns_all_of_result__when_result_type_is_bool)
+{
+    thread_pool pool{ 4 };
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        auto const all_below = parallel_reduce(pool, std::size_t{}, ITEM_COUNT, true,
+            [](std::size_t const index) { return index < ITEM_COUNT; }, std::logical_and<>{}, 16);
+        auto const all_even = parallel_reduce(pool, std::size_t{}, ITEM_COUNT, true,
+            [](std::size_t const index) { return index % 2 == 0; }, std::logical_and<>{}, 16);
+
+        ASSERT_TRUE(all_below);
+        ASSERT_FALSE(all_even);
+    }
+}
+
+TEST(parallel_test, parallel_reduce__returns_any_of_result__when_result_type_is_bool)
+{
+    thread_pool pool{ 4 };
+    std::vector<int> values(ITEM_COUNT, 0);
+    values[ITEM_COUNT - 1] = 1;
+
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        auto const any_set = parallel_reduce(pool, std::size_t{}, ITEM_COUNT, false,
+            [&values](std::size_t const index) { return values[index] != 0; }, std::logical_or<>{}, 16);
+
+        ASSERT_TRUE(any_set);
+    }
+}
+
+TEST(parallel_test, parallel_invoke__runs_each_function__when_given_several)
+{
+    thread_pool pool{ 2 };
+    std::atomic<int> first{};
+    std::atomic<int> second{};
+    std::atomic<int> third{};
+
+    parallel_invoke(pool,
+        [&first] { first.fetch_add(1); },
+        [&second] { second.fetch_add(1); },
+        [&third] { third.fetch_add(1); });
+
+    ASSERT_EQ(1, first.load());
+    ASSERT_EQ(1, second.load());
+    ASSERT_EQ(1, third.load());
+}
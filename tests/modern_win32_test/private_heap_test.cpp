@@ -0,0 +1,124 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <modern_win32/private_heap.h>
+#include <modern_win32/win_memory.h>
+
+using modern_win32::heap_deleter;
+using modern_win32::heap_memory_resource;
+using modern_win32::heap_options;
+using modern_win32::private_heap;
+using modern_win32::unique_heap_array;
+
+TEST(private_heap_test, constructor__creates_valid_heap__when_options_are_default)
+{
+    private_heap const heap;
+
+    ASSERT_TRUE(static_cast<bool>(heap));
+}
+
+TEST(private_heap_test, allocate__returns_memory_owned_by_heap__when_size_is_positive)
+{
+    private_heap const heap;
+
+    auto* const memory = heap.allocate(64);
+
+    ASSERT_NE(nullptr, memory);
+    ASSERT_EQ(static_cast<SIZE_T>(64), HeapSize(heap.native_handle(), 0, memory));
+    heap.free(memory);
+}
+
+TEST(private_heap_test, allocate_array__returns_array_freed_to_heap__when_count_is_positive)
+{
+    private_heap const heap(heap_options::no_serialize);
+
+    auto const array = heap.allocate_array<int>(16);
+
+    ASSERT_NE(nullptr, array.get());
+    ASSERT_EQ(heap.native_handle(), array.get_deleter().heap());
+}
+
+TEST(private_heap_test, get_deleter__returns_deleter_for_heap__when_heap_is_valid)
+{
+    private_heap const heap;
+
+    ASSERT_EQ(heap.native_handle(), heap.get_deleter().heap());
+}
+
+TEST(heap_deleter_test, heap__returns_process_heap__when_default_constructed)
+{
+    heap_deleter const deleter;
+
+    ASSERT_EQ(GetProcessHeap(), deleter.heap());
+}
+
+TEST(heap_deleter_test, heap__returns_process_heap__when_unique_heap_array_uses_default_heap)
+{
+    unique_heap_array<int> const array(4);
+
+    ASSERT_EQ(GetProcessHeap(), array.get_deleter().heap());
+}
+
+TEST(heap_memory_resource_test, allocate__supports_pmr_containers__when_using_private_heap)
+{
+    private_heap const heap;
+    heap_memory_resource resource(heap);
+
+    std::pmr::vector<std::pmr::string> values(&resource);
+    for (int i = 0; i < 100; ++i)
+        values.emplace_back(std::to_string(i) + " is a value long enough to avoid the small string buffer");
+
+    ASSERT_EQ(100U, values.size());
+    ASSERT_EQ(static_cast<std::pmr::memory_resource*>(&resource), values.get_allocator().resource());
+}
+
+TEST(heap_memory_resource_test, allocate__returns_aligned_memory__when_alignment_exceeds_heap_alignment)
+{
+    private_heap const heap;
+    heap_memory_resource resource(heap);
+    constexpr std::size_t alignment = 256;
+
+    auto* const memory = resource.allocate(100, alignment);
+
+    ASSERT_EQ(0U, reinterpret_cast<std::uintptr_t>(memory) % alignment);
+    resource.deallocate(memory, 100, alignment);
+}
+
+TEST(heap_memory_resource_test, is_equal__returns_true__when_resources_share_heap)
+{
+    private_heap const heap;
+    heap_memory_resource const first(heap);
+    heap_memory_resource const second(heap);
+
+    ASSERT_TRUE(first.is_equal(second));
+}
+
+TEST(heap_memory_resource_test, is_equal__returns_false__when_resources_use_different_heaps)
+{
+    private_heap const heap;
+    heap_memory_resource const first(heap);
+    heap_memory_resource const second;
+
+    ASSERT_FALSE(first.is_equal(second));
+    ASSERT_FALSE(first.is_equal(*std::pmr::new_delete_resource()));
+}
@@ -0,0 +1,112 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <modern_win32/process_launcher.h>
+
+using modern_win32::narrow_process_launcher;
+using modern_win32::narrow_process_startup_info_builder;
+using modern_win32::wide_process_launcher;
+using modern_win32::wide_process_startup_info_builder;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = std::chrono::milliseconds(30'000);
+
+#ifdef _WIN64
+    constexpr auto LAUNCHER_COMMAND = R"(c:\windows\system32\cmd.exe)";
+    constexpr auto WIDE_LAUNCHER_COMMAND = LR"(c:\windows\system32\cmd.exe)";
+#else
+    constexpr auto LAUNCHER_COMMAND = R"(c:\windows\SysWOW64\cmd.exe)";
+    constexpr auto WIDE_LAUNCHER_COMMAND = LR"(c:\windows\SysWOW64\cmd.exe)";
+#endif
+}
+
+TEST(process_launcher_test, constructor__throws_filesystem_error__when_file_not_found)
+{
+    auto const startup_info = narrow_process_startup_info_builder()
+        .with_filename("file_not_found")
+        .build();
+
+    ASSERT_THROW({ narrow_process_launcher const launcher{ startup_info }; }, std::filesystem::filesystem_error);
+}
+
+TEST(process_launcher_test, launch__uses_default_arguments__when_none_given)
+{
+    auto const startup_info = narrow_process_startup_info_builder()
+        .with_filename(LAUNCHER_COMMAND)
+        .with_arguments("/c exit 4")
+        .build();
+    narrow_process_launcher const launcher{ startup_info };
+
+    auto const child = launcher.launch();
+
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+    ASSERT_EQ(4U, child.get_exit_code().value());
+}
+
+TEST(process_launcher_test, launch__passes_environment__when_environment_given)
+{
+    std::map<std::wstring, std::wstring> environment{ { L"MODERN_WIN32_LAUNCHER_CODE", L"42" } };
+    auto const startup_info = wide_process_startup_info_builder()
+        .with_filename(WIDE_LAUNCHER_COMMAND)
+        .with_create_window(false)
+        .with_environment(environment)
+        .build();
+    wide_process_launcher const launcher{ startup_info };
+
+    auto const child = launcher.launch(L"/c exit %MODERN_WIN32_LAUNCHER_CODE%");
+
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+    ASSERT_EQ(42U, child.get_exit_code().value());
+}
+
+TEST(process_launcher_test, launch__starts_each_process__when_called_from_several_threads)
+{
+    auto const startup_info = narrow_process_startup_info_builder()
+        .with_filename(LAUNCHER_COMMAND)
+        .build();
+    narrow_process_launcher const launcher{ startup_info };
+
+    constexpr auto thread_count = 4;
+    constexpr auto launches_per_thread = 4;
+    std::vector<std::vector<modern_win32::process::exit_code_type>> exit_codes(thread_count);
+    std::vector<std::thread> threads{};
+    for (auto t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&launcher, &exit_codes, t] {
+            for (auto i = 0; i < launches_per_thread; ++i) {
+                auto const expected = t * launches_per_thread + i;
+                auto const child = launcher.launch("/c exit " + std::to_string(expected));
+                if (child.wait_for_exit(TEST_TIMEOUT))
+                    exit_codes[t].push_back(child.get_exit_code().value_or(0U));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto t = 0; t < thread_count; ++t) {
+        ASSERT_EQ(static_cast<std::size_t>(launches_per_thread), exit_codes[t].size());
+        for (auto i = 0; i < launches_per_thread; ++i)
+            ASSERT_EQ(static_cast<modern_win32::process::exit_code_type>(t * launches_per_thread + i), exit_codes[t][i]);
+    }
+}
@@ -0,0 +1,136 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <Windows.h>
+#include <modern_win32/process_memory.h>
+
+using modern_win32::memory_read_request;
+using modern_win32::process_memory;
+
+namespace
+{
+    [[nodiscard]]
+    std::uintptr_t address_of(void const* const value) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(value);
+    }
+}
+
+TEST(process_memory_test, read__returns_value__when_address_is_readable)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+    std::uint64_t const expected = 0x0123'4567'89AB'CDEFULL;
+
+    auto const actual = memory.read<std::uint64_t>(address_of(&expected));
+
+    ASSERT_TRUE(actual.has_value());
+    ASSERT_EQ(expected, actual.value());
+}
+
+TEST(process_memory_test, read__returns_nullopt__when_address_is_not_mapped)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+
+    ASSERT_FALSE(memory.read<int>(0U).has_value());
+}
+
+TEST(process_memory_test, find_region__returns_readable_region__when_address_is_on_stack)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+    int const value = 42;
+
+    auto const region = memory.find_region(address_of(&value));
+
+    ASSERT_TRUE(region.has_value());
+    ASSERT_TRUE(region->contains(address_of(&value)));
+    ASSERT_TRUE(region->is_readable());
+}
+
+TEST(process_memory_test, regions__are_in_address_order__always)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+
+    auto const& regions = memory.regions();
+
+    ASSERT_FALSE(regions.empty());
+    for (std::size_t i = 1; i < regions.size(); ++i)
+        ASSERT_LE(regions[i - 1].end_address(), regions[i].base_address);
+}
+
+TEST(process_memory_test, read_scatter__reads_every_request__when_addresses_are_close_together)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+    std::array<std::uint32_t, 64> source{};
+    std::iota(source.begin(), source.end(), 100U);
+    std::array<std::uint32_t, 8> destination{};
+
+    std::vector<memory_read_request> requests{};
+    for (std::size_t i = 0; i < destination.size(); ++i)
+        requests.push_back(memory_read_request{ address_of(&source[i * 7U]), &destination[i], sizeof(std::uint32_t) });
+
+    auto const completed = memory.read_scatter(requests);
+
+    ASSERT_EQ(destination.size(), completed);
+    for (std::size_t i = 0; i < destination.size(); ++i) {
+        ASSERT_EQ(source[i * 7U], destination[i]);
+        ASSERT_EQ(sizeof(std::uint32_t), requests[i].bytes_read);
+    }
+}
+
+TEST(process_memory_test, read_scatter__reports_failed_request__when_one_address_is_not_mapped)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+    std::uint32_t const source = 7U;
+    std::uint32_t destination[2]{};
+    std::vector<memory_read_request> requests{
+        memory_read_request{ address_of(&source), &destination[0], sizeof(std::uint32_t) },
+        memory_read_request{ 0U, &destination[1], sizeof(std::uint32_t) },
+    };
+
+    auto const completed = memory.read_scatter(requests);
+
+    ASSERT_EQ(1U, completed);
+    ASSERT_EQ(7U, destination[0]);
+    ASSERT_EQ(0U, requests[1].bytes_read);
+}
+
+TEST(process_memory_test, stream__passes_whole_region_in_chunks__when_buffer_is_smaller_than_region)
+{
+    process_memory const memory{ GetCurrentProcessId() };
+    std::vector<char> data(256U * 1024U, 'x');
+    auto const region = memory.find_region(address_of(data.data()));
+    ASSERT_TRUE(region.has_value());
+
+    std::array<char, 4096> buffer{};
+    std::size_t chunks{};
+    std::size_t largest_chunk{};
+    auto const total = memory.stream(region.value(), buffer.data(), buffer.size(),
+        [&chunks, &largest_chunk](std::uintptr_t, char const*, std::size_t const size) {
+            ++chunks;
+            largest_chunk = (std::max)(largest_chunk, size);
+            return true;
+        });
+
+    ASSERT_EQ(region->size, total);
+    ASSERT_LE(largest_chunk, buffer.size());
+    ASSERT_GE(chunks, region->size / buffer.size());
+}
@@ -0,0 +1,170 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <modern_win32/process.h>
+#include <modern_win32/process_pipe.h>
+#include <modern_win32/process_startup_info.h>
+
+using modern_win32::narrow_process_startup_info_builder;
+using modern_win32::process_output_buffer;
+using modern_win32::process_output_handler;
+using modern_win32::process_output_pipe;
+using modern_win32::start_process;
+using modern_win32::threading::io_completion_executor;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = std::chrono::milliseconds(30'000);
+
+#ifdef _WIN64
+    constexpr auto PIPE_COMMAND = R"(c:\windows\system32\cmd.exe)";
+#else
+    constexpr auto PIPE_COMMAND = R"(c:\windows\SysWOW64\cmd.exe)";
+#endif
+
+    class collecting_handler final : public process_output_handler
+    {
+    public:
+        explicit collecting_handler(std::size_t const buffers_before_pause = SIZE_MAX)
+            : remaining_before_pause_(buffers_before_pause)
+        {
+        }
+
+        [[nodiscard]]
+        process_output_buffer next_buffer() noexcept override
+        {
+            if (remaining_before_pause_ == 0U) {
+                paused_ = true;
+                return process_output_buffer{};
+            }
+            --remaining_before_pause_;
+            return process_output_buffer{ buffer_.data(), buffer_.size() };
+        }
+
+        void on_data(process_output_buffer const buffer, std::size_t const bytes_read) noexcept override
+        {
+            std::lock_guard guard{ lock_ };
+            output_.append(buffer.data, bytes_read);
+        }
+
+        void on_closed(DWORD const error) noexcept override
+        {
+            error_ = error;
+        }
+
+        void allow_more(std::size_t const buffers) noexcept
+        {
+            paused_ = false;
+            remaining_before_pause_ = buffers;
+        }
+
+        [[nodiscard]]
+        std::string output() const
+        {
+            std::lock_guard guard{ lock_ };
+            return output_;
+        }
+
+        [[nodiscard]]
+        bool paused() const noexcept
+        {
+            return paused_;
+        }
+
+        [[nodiscard]]
+        DWORD error() const noexcept
+        {
+            return error_;
+        }
+
+    private:
+        std::array<char, 16> buffer_{};
+        mutable std::mutex lock_{};
+        std::string output_{};
+        std::atomic<std::size_t> remaining_before_pause_;
+        std::atomic<bool> paused_{};
+        std::atomic<DWORD> error_{};
+    };
+}
+
+TEST(process_pipe_test, with_stdout_pipe__captures_output__when_child_writes)
+{
+    io_completion_executor executor{ 2U };
+    collecting_handler handler{};
+    process_output_pipe pipe{ executor, handler };
+
+    auto const startup_info = narrow_process_startup_info_builder()
+        .with_filename(PIPE_COMMAND)
+        .with_arguments("/c echo captured output from the child process")
+        .with_stdout_pipe(pipe)
+        .build();
+    auto const child = start_process(startup_info);
+
+    ASSERT_TRUE(pipe.wait_for_close(TEST_TIMEOUT));
+    ASSERT_EQ(static_cast<DWORD>(ERROR_BROKEN_PIPE), handler.error());
+    ASSERT_NE(std::string::npos, handler.output().find("captured output from the child process"));
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+}
+
+TEST(process_pipe_test, resume__continues_reading__when_handler_paused)
+{
+    io_completion_executor executor{ 1U };
+    collecting_handler handler{ 1U };
+    process_output_pipe pipe{ executor, handler };
+
+    auto const startup_info = narrow_process_startup_info_builder()
+        .with_filename(PIPE_COMMAND)
+        .with_arguments("/c echo more than one buffer of output")
+        .with_stdout_pipe(pipe)
+        .build();
+    auto const child = start_process(startup_info);
+
+    auto const deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+    while (!handler.paused() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+    ASSERT_TRUE(handler.paused());
+    ASSERT_FALSE(pipe.is_closed());
+
+    // the handler pauses before the pipe records it, so resume can briefly see the read as still in progress
+    handler.allow_more(SIZE_MAX);
+    auto resumed = pipe.resume();
+    while (!resumed && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+        resumed = pipe.resume();
+    }
+    ASSERT_TRUE(resumed);
+
+    ASSERT_TRUE(pipe.wait_for_close(TEST_TIMEOUT));
+    ASSERT_NE(std::string::npos, handler.output().find("more than one buffer of output"));
+    ASSERT_TRUE(child.wait_for_exit(TEST_TIMEOUT));
+}
+
+TEST(process_pipe_test, resume__returns_false__when_not_paused)
+{
+    io_completion_executor executor{ 1U };
+    collecting_handler handler{};
+    process_output_pipe pipe{ executor, handler };
+
+    ASSERT_FALSE(pipe.resume());
+}
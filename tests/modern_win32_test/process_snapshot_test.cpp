@@ -0,0 +1,125 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <algorithm>
+#include <Windows.h>
+#include <modern_win32/process_snapshot.h>
+
+using modern_win32::cpu_time_delta;
+using modern_win32::difference;
+using modern_win32::process_snapshot;
+using modern_win32::process_snapshot_entry;
+using modern_win32::process_time_duration;
+
+TEST(process_snapshot_test, capture__includes_current_process__always)
+{
+    auto const snapshot = process_snapshot::capture();
+
+    auto const* const current = snapshot.find(GetCurrentProcessId());
+
+    ASSERT_NE(nullptr, current);
+    ASSERT_GE(current->thread_count, 1U);
+    ASSERT_FALSE(snapshot.name(*current).empty());
+}
+
+TEST(process_snapshot_test, capture__returns_entries_sorted_by_id__always)
+{
+    auto const snapshot = process_snapshot::capture();
+
+    ASSERT_FALSE(snapshot.empty());
+    ASSERT_TRUE(std::is_sorted(snapshot.begin(), snapshot.end(), [](process_snapshot_entry const& left, process_snapshot_entry const& right) {
+        return left.id < right.id;
+    }));
+}
+
+TEST(process_snapshot_test, capture__reports_memory_figures__when_source_is_system_information)
+{
+    auto const snapshot = process_snapshot::capture();
+    if (snapshot.source() != modern_win32::process_snapshot_source::system_information) {
+        GTEST_SKIP();
+    }
+
+    auto const* const current = snapshot.find(GetCurrentProcessId());
+
+    ASSERT_NE(nullptr, current);
+    ASSERT_GT(current->working_set_bytes, 0U);
+    ASSERT_GT(current->private_bytes, 0U);
+    ASSERT_GT(current->create_time.count(), 0);
+}
+
+TEST(process_snapshot_test, find__returns_nullptr__when_snapshot_is_empty)
+{
+    process_snapshot const snapshot{};
+
+    ASSERT_EQ(nullptr, snapshot.find(GetCurrentProcessId()));
+}
+
+TEST(process_snapshot_test, refresh__advances_captured_at__always)
+{
+    auto snapshot = process_snapshot::capture();
+    auto const first = snapshot.captured_at();
+
+    snapshot.refresh();
+
+    ASSERT_GE(snapshot.captured_at(), first);
+    ASSERT_NE(nullptr, snapshot.find(GetCurrentProcessId()));
+}
+
+TEST(process_snapshot_test, difference__reports_every_process_as_started__when_previous_is_empty)
+{
+    process_snapshot const previous{};
+    auto const current = process_snapshot::capture();
+
+    auto const changes = difference(previous, current);
+
+    ASSERT_EQ(current.size(), changes.started.size());
+    ASSERT_TRUE(changes.exited.empty());
+}
+
+TEST(process_snapshot_test, difference__reports_no_changes__when_snapshots_are_the_same)
+{
+    auto const snapshot = process_snapshot::capture();
+
+    auto const changes = difference(snapshot, snapshot);
+
+    ASSERT_TRUE(changes.started.empty());
+    ASSERT_TRUE(changes.exited.empty());
+}
+
+TEST(process_snapshot_test, cpu_time_delta__returns_nullopt__when_process_id_was_reused)
+{
+    process_snapshot_entry previous{};
+    previous.id = 42UL;
+    previous.create_time = process_time_duration(100);
+    auto current = previous;
+    current.create_time = process_time_duration(200);
+
+    ASSERT_FALSE(cpu_time_delta(previous, current).has_value());
+}
+
+TEST(process_snapshot_test, cpu_time_delta__returns_user_and_kernel_time__when_same_process)
+{
+    process_snapshot_entry previous{};
+    previous.id = 42UL;
+    previous.user_time = process_time_duration(10);
+    previous.kernel_time = process_time_duration(5);
+    auto current = previous;
+    current.user_time = process_time_duration(40);
+    current.kernel_time = process_time_duration(15);
+
+    ASSERT_EQ(process_time_duration(40), cpu_time_delta(previous, current).value_or(process_time_duration::zero()));
+}
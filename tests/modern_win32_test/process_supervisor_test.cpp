@@ -0,0 +1,174 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <Windows.h>
+#include <modern_win32/process_supervisor.h>
+
+using modern_win32::process;
+using modern_win32::process_exit_event;
+using modern_win32::process_id_type;
+using modern_win32::process_supervisor;
+using modern_win32::start_process;
+using modern_win32::threading::io_completion_port;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = std::chrono::seconds(30);
+
+#ifdef _WIN64
+    constexpr auto SUPERVISED_COMMAND = R"(c:\windows\system32\cmd.exe)";
+#else
+    constexpr auto SUPERVISED_COMMAND = R"(c:\windows\SysWOW64\cmd.exe)";
+#endif
+
+    [[nodiscard]]
+    process start_exiting_with(int const exit_code)
+    {
+        return start_process(SUPERVISED_COMMAND, ("/c exit " + std::to_string(exit_code)).c_str());
+    }
+
+    [[nodiscard]]
+    process start_long_running()
+    {
+        return start_process(SUPERVISED_COMMAND, "/c ping -n 10 127.0.0.1 > nul");
+    }
+
+    class exit_recorder final
+    {
+    public:
+        void record(std::vector<process_exit_event> const& events)
+        {
+            std::lock_guard guard{ lock_ };
+            for (auto const& event : events) {
+                exits_[event.id] = event.exit_code;
+            }
+            changed_.notify_all();
+        }
+
+        [[nodiscard]]
+        bool wait_for(std::size_t const count)
+        {
+            std::unique_lock guard{ lock_ };
+            return changed_.wait_for(guard, TEST_TIMEOUT, [this, count] { return exits_.size() >= count; });
+        }
+
+        [[nodiscard]]
+        std::map<process_id_type, process::exit_code_type> exits() const
+        {
+            std::lock_guard guard{ lock_ };
+            return exits_;
+        }
+
+    private:
+        mutable std::mutex lock_{};
+        std::condition_variable changed_{};
+        std::map<process_id_type, process::exit_code_type> exits_{};
+    };
+}
+
+TEST(process_supervisor_test, constructor__throws_invalid_argument__when_callback_is_empty)
+{
+    ASSERT_THROW({ process_supervisor const supervisor{ process_supervisor::exit_callback{} }; }, std::invalid_argument);
+}
+
+TEST(process_supervisor_test, watch__reports_each_exit_code__when_children_exit)
+{
+    exit_recorder recorder{};
+    process_supervisor supervisor{ [&recorder](auto const& events) { recorder.record(events); } };
+
+    std::map<process_id_type, process::exit_code_type> expected{};
+    std::vector<process> children{};
+    for (auto exit_code = 1; exit_code <= 16; ++exit_code) {
+        auto child = start_exiting_with(exit_code);
+        auto const id = child.get_process_id();
+        ASSERT_TRUE(id.has_value());
+        ASSERT_TRUE(supervisor.watch(child));
+        expected[id.value()] = static_cast<process::exit_code_type>(exit_code);
+        children.push_back(std::move(child));
+    }
+
+    ASSERT_TRUE(recorder.wait_for(expected.size()));
+    ASSERT_EQ(expected, recorder.exits());
+    ASSERT_EQ(0U, supervisor.size());
+    ASSERT_EQ(0U, supervisor.unhandled_exception_count());
+}
+
+TEST(process_supervisor_test, watch__returns_false__when_process_already_watched)
+{
+    process_supervisor supervisor{ [](auto const&) {} };
+    auto child = start_long_running();
+
+    ASSERT_TRUE(supervisor.watch(child));
+    ASSERT_FALSE(supervisor.watch(child.get_process_id().value()));
+    ASSERT_EQ(1U, supervisor.size());
+
+    static_cast<void>(TerminateProcess(child.native_handle(), 0U));
+}
+
+TEST(process_supervisor_test, unwatch__stops_reporting__when_process_watched)
+{
+    exit_recorder recorder{};
+    process_supervisor supervisor{ [&recorder](auto const& events) { recorder.record(events); } };
+    auto unwatched = start_long_running();
+    auto watched = start_exiting_with(3);
+
+    ASSERT_TRUE(supervisor.watch(unwatched));
+    ASSERT_TRUE(supervisor.watch(watched));
+    ASSERT_TRUE(supervisor.unwatch(unwatched.get_process_id().value()));
+    ASSERT_FALSE(supervisor.unwatch(unwatched.get_process_id().value()));
+    static_cast<void>(TerminateProcess(unwatched.native_handle(), 0U));
+
+    ASSERT_TRUE(recorder.wait_for(1U));
+    auto const exits = recorder.exits();
+    ASSERT_EQ(1U, exits.size());
+    ASSERT_EQ(watched.get_process_id().value(), exits.begin()->first);
+}
+
+TEST(process_supervisor_test, watch__queues_packet_per_exit__when_constructed_with_port)
+{
+    constexpr ULONG_PTR key = 42;
+    io_completion_port const port{};
+    process_supervisor supervisor{ port, key };
+    auto child = start_exiting_with(7);
+
+    ASSERT_TRUE(supervisor.watch(child));
+
+    auto const packet = port.dequeue(std::chrono::duration_cast<std::chrono::milliseconds>(TEST_TIMEOUT));
+    ASSERT_TRUE(packet.has_value());
+    ASSERT_EQ(key, packet->key);
+    auto const event = process_supervisor::to_exit_event(packet.value());
+    ASSERT_EQ(child.get_process_id().value(), event.id);
+    ASSERT_EQ(7U, event.exit_code);
+}
+
+TEST(process_supervisor_test, watch__throws_logic_error__when_shut_down)
+{
+    process_supervisor supervisor{ [](auto const&) {} };
+    auto child = start_long_running();
+    supervisor.shutdown();
+
+    ASSERT_THROW(std::ignore = supervisor.watch(child), std::logic_error);
+
+    static_cast<void>(TerminateProcess(child.native_handle(), 0U));
+}
@@ -14,8 +14,11 @@
 #pragma warning(disable : 26812 26495)
 #include <gtest/gtest.h>
 #pragma warning(default : 26812 26495)
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <thread>
+#include <vector>
 
 #include <modern_win32/process.h>
 #include <modern_win32/shared_utilities.h>
@@ -34,6 +37,9 @@ using modern_win32::open_process;
 using modern_win32::process;
 using modern_win32::process_access_rights;
 using modern_win32::start_process;
+using modern_win32::try_open_process;
+using modern_win32::try_start_process;
+using modern_win32::windows_error;
 
 using std::chrono::milliseconds;
 
@@ -123,3 +129,225 @@ TEST(process, open_process_should_open_process_with_valid_id)
     auto opened_process = open_process(id, combine(process_access_rights::process_query_information, process_access_rights::synchronize));
 
 }
+
+TEST(process, try_open_process_should_return_invalid_parameter_when_id_is_zero)
+{
+    auto const result = try_open_process(0UL, process_access_rights::synchronize);
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(windows_error::error_invalid_parameter, result.error().get());
+}
+
+TEST(process, try_open_process_should_open_process_with_valid_id)
+{
+    auto const process = start_process(CommandExe, "/c Sleep 1");
+    auto const id = process.get_process_id().value_or(0UL);
+    EXPECT_NE(0UL, id);
+
+    auto const result = try_open_process(id, combine(process_access_rights::process_query_information, process_access_rights::synchronize));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(id, result->get_process_id().value_or(0UL));
+}
+
+TEST(process, try_start_process_should_return_file_not_found_when_file_not_found)
+{
+    auto const startup_info = modern_win32::narrow_process_startup_info_builder()
+        .with_filename("file_not_found")
+        .build();
+
+    auto const result = try_start_process(startup_info);
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(windows_error::error_file_not_found, result.error().get());
+}
+
+TEST(process, enumerate_modules_should_return_every_module_of_current_process)
+{
+    auto const current = open_process(GetCurrentProcessId(), combine(process_access_rights::process_query_information, process_access_rights::process_vm_read));
+
+    auto const modules = current.enumerate_modules();
+
+    ASSERT_GT(modules.size(), 1U);
+    ASSERT_EQ(modules[0].module_handle(), GetModuleHandleW(nullptr));
+}
+
+TEST(process, enumerate_modules_should_include_information_when_requested)
+{
+    auto const current = open_process(GetCurrentProcessId(), combine(process_access_rights::process_query_information, process_access_rights::process_vm_read));
+
+    auto const modules = current.enumerate_modules(true);
+
+    ASSERT_FALSE(modules.empty());
+    auto const& information = modules[0].get_information();
+    ASSERT_EQ(static_cast<void*>(modules[0].module_handle()), information.base_address);
+    ASSERT_GT(information.size, 0U);
+}
+
+TEST(process, get_modules_should_return_at_most_max_count_modules)
+{
+    auto const current = open_process(GetCurrentProcessId(), combine(process_access_rights::process_query_information, process_access_rights::process_vm_read));
+
+    auto const modules = current.get_modules(1);
+
+    ASSERT_EQ(1U, modules.size());
+}
+
+TEST(process, process_module_get_filename_should_return_cached_value_on_subsequent_calls)
+{
+    auto const current = open_process(GetCurrentProcessId(), combine(process_access_rights::process_query_information, process_access_rights::process_vm_read));
+    auto const primary = current.get_primary_module();
+
+    auto const& first = primary.get_filename();
+    auto const& second = primary.get_filename();
+
+    ASSERT_FALSE(first.empty());
+    ASSERT_EQ(&first, &second);
+    ASSERT_NE(std::wstring::npos, first.find(primary.get_name()));
+}
+
+TEST(process, is_running_should_return_true_when_constructed_from_id_of_active_process)
+{
+    auto const started = start_process(CommandExe, "/c Ping -n 2 127.0.0.1");
+    process const by_id{ started.get_process_id().value_or(0UL) };
+
+    ASSERT_TRUE(by_id.is_running());
+    EXPECT_TRUE(started.wait_for_exit(milliseconds(5000)));
+    ASSERT_FALSE(by_id.is_running());
+}
+
+TEST(process, get_exit_code_should_return_cached_exit_code_when_handle_policy_is_cached)
+{
+    auto const started = start_process(CommandExe, "/c Ping -n 2 127.0.0.1 & exit 3");
+    process const cached{ started.get_process_id().value_or(0UL), modern_win32::process_handle_policy::cached };
+
+    ASSERT_TRUE(cached.is_running());
+    EXPECT_TRUE(cached.wait_for_exit(milliseconds(5000)));
+
+    ASSERT_FALSE(cached.is_running());
+    ASSERT_EQ(process::exit_code_type{ 3 }, cached.get_exit_code());
+    ASSERT_FALSE(static_cast<bool>(cached));
+    ASSERT_EQ(modern_win32::process_handle_policy::cached, cached.handle_policy());
+}
+
+TEST(process, queries_should_agree_on_exit_code_when_cached_process_is_queried_from_several_threads)
+{
+    auto const started = start_process(CommandExe, "/c Ping -n 2 127.0.0.1 & exit 4");
+    process const cached{ started.get_process_id().value_or(0UL), modern_win32::process_handle_policy::cached };
+
+    std::atomic<bool> failed{};
+    std::vector<std::thread> queries;
+    for (int index = 0; index < 4; ++index) {
+        queries.emplace_back([&cached, &failed]() {
+            while (cached.is_running()) {
+                static_cast<void>(cached.get_priority());
+                static_cast<void>(cached.sample());
+            }
+            if (cached.get_exit_code() != process::exit_code_type{ 4 })
+                failed = true;
+        });
+    }
+    for (auto& query : queries)
+        query.join();
+
+    ASSERT_FALSE(failed.load());
+    ASSERT_FALSE(cached.is_running());
+}
+
+TEST(process, start_process_should_start_child_when_inherited_handle_list_given)
+{
+    SECURITY_ATTRIBUTES inheritable{ sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE };
+    modern_win32::null_handle const event{ CreateEventW(&inheritable, TRUE, FALSE, nullptr) };
+    ASSERT_TRUE(static_cast<bool>(event));
+
+    auto const startup_info = modern_win32::narrow_process_startup_info_builder()
+        .with_filename(CommandExe)
+        .with_arguments("/c exit 6")
+        .with_inherited_handle(event.native_handle())
+        .build();
+    auto const started = start_process(startup_info);
+
+    EXPECT_TRUE(started.wait_for_exit(milliseconds(5000)));
+    ASSERT_EQ(process::exit_code_type{ 6 }, started.get_exit_code());
+}
+
+TEST(process, start_process_should_start_child_when_group_affinity_and_ideal_node_given)
+{
+    GROUP_AFFINITY affinity{};
+    affinity.Group = 0;
+    affinity.Mask = 1;
+
+    auto const startup_info = modern_win32::narrow_process_startup_info_builder()
+        .with_filename(CommandExe)
+        .with_arguments("/c exit 7")
+        .with_group_affinity(affinity)
+        .with_ideal_node(0)
+        .build();
+    auto const started = start_process(startup_info);
+
+    EXPECT_TRUE(started.wait_for_exit(milliseconds(5000)));
+    ASSERT_EQ(process::exit_code_type{ 7 }, started.get_exit_code());
+}
+
+TEST(process, start_process_should_start_child_when_parent_process_given)
+{
+    modern_win32::null_handle const parent{ OpenProcess(PROCESS_CREATE_PROCESS, FALSE, GetCurrentProcessId()) };
+    ASSERT_TRUE(static_cast<bool>(parent));
+
+    auto const startup_info = modern_win32::narrow_process_startup_info_builder()
+        .with_filename(CommandExe)
+        .with_arguments("/c exit 8")
+        .with_parent_process(parent.native_handle())
+        .build();
+    auto const started = start_process(startup_info);
+
+    EXPECT_TRUE(started.wait_for_exit(milliseconds(5000)));
+    ASSERT_EQ(process::exit_code_type{ 8 }, started.get_exit_code());
+}
+
+TEST(process, sample_should_return_counters_of_current_process)
+{
+    process const current{ GetCurrentProcessId(), modern_win32::process_handle_policy::cached };
+
+    auto const sample = current.sample();
+
+    ASSERT_TRUE(sample.has_value());
+    ASSERT_GT(sample->working_set_bytes, 0U);
+    ASSERT_GT(sample->private_bytes, 0U);
+    ASSERT_GT(sample->handle_count, 0U);
+    ASSERT_GT((sample->user_time + sample->kernel_time).count(), 0);
+}
+
+TEST(process, sample_rates_should_report_cpu_use_when_process_is_busy)
+{
+    process const current{ GetCurrentProcessId(), modern_win32::process_handle_policy::cached };
+    auto const earlier = current.sample();
+    ASSERT_TRUE(earlier.has_value());
+
+    auto const busy_until = std::chrono::steady_clock::now() + milliseconds(200);
+    volatile std::uint64_t spin{};
+    while (std::chrono::steady_clock::now() < busy_until)
+        spin = spin + 1;
+
+    auto const later = current.sample();
+    ASSERT_TRUE(later.has_value());
+
+    auto const rates = modern_win32::sample_rates(earlier.value(), later.value(), 1U);
+    ASSERT_GT(rates.cpu_processors, 0.0);
+    ASSERT_GT(rates.cpu_percent, 0.0);
+    ASSERT_GT(rates.cycles_per_second, 0.0);
+}
+
+TEST(process, sample_rates_should_return_zero_when_samples_are_not_in_order)
+{
+    modern_win32::process_sample later{};
+    later.user_time = modern_win32::process_time_duration(10'000'000);
+    later.sampled_at = std::chrono::steady_clock::now();
+    auto earlier = later;
+    earlier.sampled_at = later.sampled_at + milliseconds(10);
+
+    auto const rates = modern_win32::sample_rates(earlier, later);
+
+    ASSERT_EQ(0.0, rates.cpu_percent);
+    ASSERT_EQ(0.0, rates.read_bytes_per_second);
+}
@@ -0,0 +1,92 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <tuple>
+#include <modern_win32/threading/processor_topology.h>
+#include <modern_win32/threading/thread.h>
+
+using modern_win32::threading::get_thread_group_affinity;
+using modern_win32::threading::get_thread_ideal_processor;
+using modern_win32::threading::processor_topology;
+using modern_win32::threading::set_thread_group_affinity;
+using modern_win32::threading::set_thread_ideal_processor;
+
+TEST(processor_topology_test, query__returns_at_least_one_group_core_and_numa_node__always)
+{
+    auto const topology = processor_topology::query();
+
+    ASSERT_FALSE(topology.groups().empty());
+    ASSERT_FALSE(topology.cores().empty());
+    ASSERT_FALSE(topology.numa_nodes().empty());
+}
+
+TEST(processor_topology_test, logical_processor_count__matches_sum_of_active_group_processors__always)
+{
+    auto const topology = processor_topology::query();
+
+    std::size_t expected{};
+    for (auto const& group : topology.groups())
+        expected += group.active_processor_count;
+
+    ASSERT_GE(topology.logical_processor_count(), 1U);
+    ASSERT_EQ(expected, topology.logical_processor_count());
+}
+
+TEST(processor_topology_test, numa_node_of__returns_value__when_processor_is_active)
+{
+    auto const topology = processor_topology::query();
+
+    ASSERT_TRUE(topology.numa_node_of({ 0, 0 }).has_value());
+}
+
+TEST(processor_topology_test, cache_sharing_sets__returns_non_empty_affinities__for_each_cache_of_level)
+{
+    auto const topology = processor_topology::query();
+
+    for (auto const& affinity : topology.cache_sharing_sets(1))
+        ASSERT_FALSE(affinity.empty());
+}
+
+TEST(processor_topology_test, set_thread_group_affinity__updates_affinity__when_mask_is_within_current_affinity)
+{
+    auto const current_thread = GetCurrentThread();
+    auto const original = get_thread_group_affinity(current_thread);
+    ASSERT_TRUE(original.has_value());
+
+    auto const lowest_processor = original.value().mask & (~original.value().mask + 1);
+    ASSERT_TRUE(set_thread_group_affinity(current_thread, { original.value().group, lowest_processor }));
+
+    auto const updated = get_thread_group_affinity(current_thread);
+    std::ignore = set_thread_group_affinity(current_thread, original.value());
+
+    ASSERT_TRUE(updated.has_value());
+    ASSERT_EQ(lowest_processor, updated.value().mask);
+}
+
+TEST(processor_topology_test, set_thread_ideal_processor__updates_ideal_processor__when_processor_is_active)
+{
+    auto const current_thread = GetCurrentThread();
+    auto const original = get_thread_ideal_processor(current_thread);
+    ASSERT_TRUE(original.has_value());
+
+    ASSERT_TRUE(set_thread_ideal_processor(current_thread, { original.value().group, 0 }));
+    auto const updated = get_thread_ideal_processor(current_thread);
+    std::ignore = set_thread_ideal_processor(current_thread, original.value());
+
+    ASSERT_TRUE(updated.has_value());
+    ASSERT_EQ(0, updated.value().number);
+}
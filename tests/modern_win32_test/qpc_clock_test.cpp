@@ -0,0 +1,104 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <modern_win32/qpc_clock.h>
+
+using modern_win32::qpc_clock;
+using modern_win32::scoped_timer;
+using modern_win32::stopwatch;
+using modern_win32::ticks_to_nanoseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+
+TEST(qpc_clock_test, ticks_to_nanoseconds__returns_exact_value__when_ticks_times_billion_overflows)
+{
+    constexpr std::int64_t frequency = 10'000'000;
+    constexpr std::int64_t ticks = 365LL * 24 * 60 * 60 * frequency + 1;
+
+    static_assert(ticks_to_nanoseconds(ticks, frequency) == nanoseconds(365LL * 24 * 60 * 60 * 1'000'000'000LL + 100));
+    ASSERT_EQ(nanoseconds(1'000'000'000LL), ticks_to_nanoseconds(3'000'000'000LL, 3'000'000'000LL));
+}
+
+TEST(qpc_clock_test, frequency__is_positive__always)
+{
+    ASSERT_GT(qpc_clock::frequency(), 0);
+}
+
+TEST(qpc_clock_test, now__never_decreases__when_called_repeatedly)
+{
+    auto previous = qpc_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        auto const current = qpc_clock::now();
+        ASSERT_GE(current, previous);
+        previous = current;
+    }
+}
+
+TEST(stopwatch_test, elapsed__is_at_least_sleep_duration__after_sleep)
+{
+    stopwatch const watch;
+    std::this_thread::sleep_for(milliseconds(20));
+
+    ASSERT_GE(watch.elapsed(), milliseconds(20));
+}
+
+TEST(stopwatch_test, lap__restarts_measurement__always)
+{
+    stopwatch watch;
+    std::this_thread::sleep_for(milliseconds(20));
+
+    ASSERT_GE(watch.lap(), milliseconds(20));
+    ASSERT_LT(watch.elapsed(), milliseconds(20));
+}
+
+TEST(scoped_timer_test, destructor__invokes_callback_with_elapsed_time__always)
+{
+    nanoseconds measured{ -1 };
+    {
+        scoped_timer const timer{ [&measured](nanoseconds const elapsed) noexcept { measured = elapsed; } };
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+
+    ASSERT_GE(measured, milliseconds(5));
+}
+
+#ifdef MODERN_WIN32_HAS_TSC_CLOCK
+
+using modern_win32::basic_stopwatch;
+using modern_win32::tsc_clock;
+
+TEST(tsc_clock_test, elapsed__agrees_with_qpc_clock__when_counter_is_invariant)
+{
+    if (!tsc_clock::is_invariant())
+        GTEST_SKIP() << "time stamp counter is not invariant";
+    ASSERT_GT(tsc_clock::frequency(), 0);
+
+    basic_stopwatch<tsc_clock> const tsc_watch;
+    stopwatch const qpc_watch;
+    std::this_thread::sleep_for(milliseconds(50));
+    auto const tsc_elapsed = tsc_watch.elapsed();
+    auto const qpc_elapsed = qpc_watch.elapsed();
+
+    ASSERT_NEAR(static_cast<double>(qpc_elapsed.count()), static_cast<double>(tsc_elapsed.count()), static_cast<double>(qpc_elapsed.count()) * 0.05);
+}
+
+#endif
@@ -0,0 +1,125 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+#include <modern_win32/bcrypt_random.h>
+#include <modern_win32/random_pool.h>
+
+using modern_win32::random_pool;
+using modern_win32::random_pool_bit_generator;
+
+TEST(random_pool_test, get_bytes__returns_different_values__when_called_repeatedly)
+{
+    std::uint64_t first{};
+    std::uint64_t second{};
+
+    ASSERT_TRUE(random_pool::get_bytes(reinterpret_cast<byte*>(&first), sizeof(first)));
+    ASSERT_TRUE(random_pool::get_bytes(reinterpret_cast<byte*>(&second), sizeof(second)));
+
+    ASSERT_NE(first, second);
+}
+
+TEST(random_pool_test, get_bytes__returns_true__when_request_spans_refills)
+{
+    std::vector<byte> buffer(random_pool::block_size - 3U);
+    std::array<std::uint64_t, 4> values{};
+
+    ASSERT_TRUE(random_pool::get_bytes(buffer.data(), buffer.size()));
+    ASSERT_TRUE(random_pool::get_bytes(reinterpret_cast<byte*>(values.data()), sizeof(values)));
+
+    ASSERT_EQ(values.size(), std::set<std::uint64_t>(values.begin(), values.end()).size());
+}
+
+TEST(random_pool_test, get_bytes__fills_whole_buffer__when_request_exceeds_block_size)
+{
+    std::vector<std::uint64_t> values(random_pool::block_size / sizeof(std::uint64_t) * 3U);
+
+    ASSERT_TRUE(random_pool::get_bytes(reinterpret_cast<byte*>(values.data()), values.size() * sizeof(std::uint64_t)));
+
+    ASSERT_EQ(values.size(), std::set<std::uint64_t>(values.begin(), values.end()).size());
+}
+
+TEST(random_pool_test, get_bytes__returns_false__when_data_is_null)
+{
+    ASSERT_FALSE(random_pool::get_bytes(nullptr, 16U));
+}
+
+TEST(random_pool_test, get__returns_different_values__after_discard)
+{
+    auto const first = random_pool::get<std::uint64_t>();
+    random_pool::discard();
+    auto const second = random_pool::get<std::uint64_t>();
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_NE(first.value(), second.value());
+}
+
+TEST(random_pool_test, bit_generator__produces_values_within_distribution_range)
+{
+    random_pool_bit_generator generator{};
+    std::uniform_int_distribution<int> distribution(1, 6);
+
+    std::set<int> seen{};
+    for (int i = 0; i < 1000; ++i) {
+        auto const value = distribution(generator);
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 6);
+        seen.insert(value);
+    }
+    ASSERT_EQ(6U, seen.size());
+}
+
+TEST(random_pool_test, get__returns_unique_values__when_called_from_multiple_threads)
+{
+    constexpr std::size_t THREAD_COUNT = 4;
+    constexpr std::size_t PER_THREAD = 2000;
+    std::array<std::vector<std::uint64_t>, THREAD_COUNT> produced{};
+
+    std::vector<std::thread> threads{};
+    for (auto& output : produced) {
+        threads.emplace_back([&output] {
+            for (std::size_t i = 0; i < PER_THREAD; ++i)
+                output.push_back(random_pool::get<std::uint64_t>().value());
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::set<std::uint64_t> unique{};
+    for (auto const& output : produced)
+        unique.insert(output.begin(), output.end());
+    ASSERT_EQ(THREAD_COUNT * PER_THREAD, unique.size());
+}
+
+TEST(random_pool_test, bcrypt_rng_algorithm__returns_same_provider__when_called_repeatedly)
+{
+    auto const first = modern_win32::bcrypt_rng_algorithm();
+
+    ASSERT_NE(nullptr, first);
+    ASSERT_EQ(first, modern_win32::bcrypt_rng_algorithm());
+
+    std::uint64_t value{};
+    ASSERT_TRUE(modern_win32::bcrypt_get_random_bytes(first, reinterpret_cast<byte*>(&value), sizeof(value)));
+}
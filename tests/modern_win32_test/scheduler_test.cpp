@@ -0,0 +1,185 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <modern_win32/threading/scheduler.h>
+#include <modern_win32/threading/thread_pool.h>
+
+using modern_win32::threading::scheduled_task_token;
+using modern_win32::threading::scheduler;
+using modern_win32::threading::thread_pool;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(2000);
+}
+
+TEST(scheduler_test, schedule_after__runs_callback__when_due_time_elapses)
+{
+    scheduler tasks{};
+    std::promise<void> ran{};
+    auto const started = std::chrono::steady_clock::now();
+
+    std::ignore = tasks.schedule_after(milliseconds(20), [&ran] { ran.set_value(); });
+
+    ASSERT_EQ(std::future_status::ready, ran.get_future().wait_for(TEST_TIMEOUT));
+    ASSERT_GE(std::chrono::steady_clock::now() - started, milliseconds(15));
+}
+
+TEST(scheduler_test, schedule_at__runs_tasks_in_deadline_order__when_scheduled_out_of_order)
+{
+    thread_pool pool{ 1 };
+    scheduler tasks{ pool };
+    std::mutex lock{};
+    std::vector<int> order{};
+    std::promise<void> done{};
+    auto const now = std::chrono::steady_clock::now();
+
+    std::ignore = tasks.schedule_at(now + milliseconds(60), [&] {
+        std::lock_guard guard{ lock };
+        order.push_back(3);
+        done.set_value();
+    });
+    std::ignore = tasks.schedule_at(now + milliseconds(20), [&] {
+        std::lock_guard guard{ lock };
+        order.push_back(1);
+    });
+    std::ignore = tasks.schedule_at(now + milliseconds(40), [&] {
+        std::lock_guard guard{ lock };
+        order.push_back(2);
+    });
+
+    ASSERT_EQ(std::future_status::ready, done.get_future().wait_for(TEST_TIMEOUT));
+    std::lock_guard guard{ lock };
+    ASSERT_EQ((std::vector<int>{ 1, 2, 3 }), order);
+}
+
+TEST(scheduler_test, schedule_every__runs_repeatedly__until_cancelled)
+{
+    scheduler tasks{};
+    std::atomic<int> calls{};
+
+    auto const token = tasks.schedule_every(milliseconds(10), [&calls] { calls.fetch_add(1); });
+    auto const deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+    while (calls.load() < 3 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(milliseconds(5));
+    }
+
+    ASSERT_TRUE(token.cancel());
+    std::this_thread::sleep_for(milliseconds(50));
+    auto const after_cancel = calls.load();
+    std::this_thread::sleep_for(milliseconds(50));
+
+    ASSERT_GE(after_cancel, 3);
+    ASSERT_EQ(after_cancel, calls.load());
+    ASSERT_FALSE(token.is_active());
+}
+
+TEST(scheduler_test, cancel__prevents_callback__when_task_is_pending)
+{
+    scheduler tasks{};
+    std::atomic<bool> ran{};
+
+    auto const token = tasks.schedule_after(milliseconds(30), [&ran] { ran = true; });
+    ASSERT_EQ(1U, tasks.size());
+
+    ASSERT_TRUE(token.cancel());
+    ASSERT_EQ(0U, tasks.size());
+    ASSERT_TRUE(token.is_cancelled());
+    std::this_thread::sleep_for(milliseconds(60));
+    ASSERT_FALSE(ran.load());
+}
+
+TEST(scheduler_test, cancel__returns_false__when_task_has_completed)
+{
+    scheduler tasks{};
+    std::promise<void> ran{};
+
+    auto const token = tasks.schedule_after(milliseconds(0), [&ran] { ran.set_value(); });
+    ASSERT_EQ(std::future_status::ready, ran.get_future().wait_for(TEST_TIMEOUT));
+    tasks.shutdown();
+
+    ASSERT_FALSE(token.cancel());
+    ASSERT_FALSE(token.is_active());
+}
+
+TEST(scheduler_test, cancel__returns_false__when_token_is_default_constructed)
+{
+    scheduled_task_token const token{};
+
+    ASSERT_FALSE(token.cancel());
+    ASSERT_FALSE(token.is_active());
+}
+
+TEST(scheduler_test, schedule_after__runs_on_executor__when_constructed_with_thread_pool)
+{
+    thread_pool pool{ 2 };
+    scheduler tasks{ pool };
+    std::promise<bool> on_worker{};
+
+    std::ignore = tasks.schedule_after(milliseconds(5), [&] { on_worker.set_value(pool.is_worker_thread()); });
+
+    auto result = on_worker.get_future();
+    ASSERT_EQ(std::future_status::ready, result.wait_for(TEST_TIMEOUT));
+    ASSERT_TRUE(result.get());
+}
+
+TEST(scheduler_test, unhandled_exception_count__is_incremented__when_callback_throws)
+{
+    scheduler tasks{};
+    std::promise<void> ran{};
+
+    std::ignore = tasks.schedule_after(milliseconds(0), [] { throw std::runtime_error("expected"); });
+    std::ignore = tasks.schedule_after(milliseconds(20), [&ran] { ran.set_value(); });
+    ASSERT_EQ(std::future_status::ready, ran.get_future().wait_for(TEST_TIMEOUT));
+    tasks.shutdown();
+
+    ASSERT_EQ(1U, tasks.unhandled_exception_count());
+}
+
+TEST(scheduler_test, schedule_every__throws_invalid_argument__when_period_is_zero)
+{
+    scheduler tasks{};
+
+    ASSERT_THROW(std::ignore = tasks.schedule_every(milliseconds(0), [] {}), std::invalid_argument);
+}
+
+TEST(scheduler_test, schedule_after__throws_invalid_argument__when_callback_is_empty)
+{
+    scheduler tasks{};
+
+    ASSERT_THROW(std::ignore = tasks.schedule_after(milliseconds(0), scheduler::task_callback{}), std::invalid_argument);
+}
+
+TEST(scheduler_test, schedule_after__throws_logic_error__when_shut_down)
+{
+    scheduler tasks{};
+    std::ignore = tasks.schedule_after(std::chrono::hours(1), [] {});
+
+    tasks.shutdown();
+
+    ASSERT_EQ(0U, tasks.size());
+    ASSERT_THROW(std::ignore = tasks.schedule_after(milliseconds(0), [] {}), std::logic_error);
+}
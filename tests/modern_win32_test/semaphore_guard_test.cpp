@@ -0,0 +1,73 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <modern_win32/threading/light_semaphore.h>
+#include <modern_win32/threading/semaphore.h>
+#include <modern_win32/threading/semaphore_guard.h>
+
+using modern_win32::threading::light_semaphore;
+using modern_win32::threading::semaphore;
+using modern_win32::threading::semaphore_guard;
+using std::chrono::milliseconds;
+
+TEST(semaphore_guard_test, destructor__returns_every_unit__when_guard_owns_units)
+{
+    light_semaphore permits{ 5, 5 };
+    {
+        semaphore_guard const guard(permits, 3);
+        ASSERT_TRUE(guard.owns_lock());
+        ASSERT_EQ(2, permits.count());
+    }
+
+    ASSERT_EQ(5, permits.count());
+}
+
+TEST(semaphore_guard_test, constructor__does_not_own_units__when_timeout_elapses)
+{
+    light_semaphore permits{ 2, 5 };
+
+    semaphore_guard const guard(permits, 3, milliseconds(10));
+
+    ASSERT_FALSE(guard.owns_lock());
+    ASSERT_EQ(0, guard.count());
+    ASSERT_EQ(2, permits.count());
+}
+
+TEST(semaphore_guard_test, release__returns_units_early__when_called_before_scope_exit)
+{
+    light_semaphore permits{ 4, 4 };
+    semaphore_guard guard(permits, 4);
+
+    guard.release();
+
+    ASSERT_FALSE(guard.owns_lock());
+    ASSERT_EQ(4, permits.count());
+}
+
+TEST(semaphore_guard_test, destructor__returns_every_unit__when_used_with_kernel_semaphore)
+{
+    semaphore permits{ 3, 3 };
+    {
+        semaphore_guard const guard(permits, 3, milliseconds(10));
+        ASSERT_TRUE(guard.owns_lock());
+        ASSERT_FALSE(permits.try_acquire(1));
+    }
+
+    ASSERT_TRUE(permits.try_acquire(3));
+    permits.release(3);
+}
@@ -16,8 +16,13 @@
 #pragma warning(default : 26812 26495)
 #include <modern_win32/threading/semaphore.h>
 #include "context.h"
+#include <chrono>
+#include <future>
+#include <thread>
+#include <tuple>
 
 using modern_win32::threading::semaphore;
+using modern_win32::threading::semaphore_traits;
 using modern_win32::windows_exception;
 
 TEST(sempahore_test, constructor__throws_windows_exception__when_initial_count_negative)
@@ -43,3 +48,71 @@ TEST(sempahore_test, constructor__throws_windows_exception__when_maximum_count_l
 
     }, std::invalid_argument);
 }
+
+TEST(sempahore_test, release__keeps_handle_open__when_called_repeatedly)
+{
+    semaphore s(0, 2);
+
+    s.release(1);
+    s.release(1);
+
+    ASSERT_TRUE(s.wait_one(std::optional(std::chrono::milliseconds(0))));
+    ASSERT_TRUE(s.wait_one(std::optional(std::chrono::milliseconds(0))));
+}
+
+TEST(sempahore_test, try_acquire__returns_false_and_keeps_units__when_not_enough_are_available)
+{
+    semaphore s(2, 4);
+
+    ASSERT_FALSE(s.try_acquire(3));
+    ASSERT_TRUE(s.try_acquire(2));
+}
+
+TEST(sempahore_test, acquire__takes_every_unit__when_units_are_released_before_timeout)
+{
+    semaphore s(1, 4);
+    auto acquired = std::async(std::launch::async, [&s]() { return s.acquire(3, std::chrono::milliseconds(1000)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    s.release(2);
+
+    ASSERT_TRUE(acquired.get());
+    ASSERT_FALSE(s.try_acquire(1));
+}
+
+TEST(sempahore_test, acquire__throws_invalid_argument__when_count_exceeds_maximum)
+{
+    semaphore s(1, 2);
+
+    ASSERT_THROW(std::ignore = s.acquire(3), std::invalid_argument);
+}
+
+TEST(sempahore_test, acquire__completes__when_two_callers_each_need_most_units)
+{
+    semaphore s(4, 4);
+    auto const take_and_return = [&s]() {
+        for (int i = 0; i < 200; ++i) {
+            if (!s.acquire(3)) {
+                return false;
+            }
+            s.release(3);
+        }
+        return true;
+    };
+
+    auto first = std::async(std::launch::async, take_and_return);
+    auto second = std::async(std::launch::async, take_and_return);
+
+    ASSERT_EQ(std::future_status::ready, first.wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(std::future_status::ready, second.wait_for(std::chrono::seconds(10)));
+    ASSERT_TRUE(first.get());
+    ASSERT_TRUE(second.get());
+}
+
+TEST(sempahore_test, try_acquire__leaves_count_unchanged__when_not_enough_are_available)
+{
+    semaphore s(2, 4);
+
+    ASSERT_FALSE(s.try_acquire(3));
+    ASSERT_EQ(std::optional(2), semaphore_traits::current_count(s.native_handle()));
+}
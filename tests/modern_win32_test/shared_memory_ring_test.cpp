@@ -0,0 +1,351 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <modern_win32/file_mapping.h>
+#include <modern_win32/shared_memory_ring.h>
+#include <modern_win32/windows_exception.h>
+
+using modern_win32::ring_producers;
+using modern_win32::shared_memory_ring;
+using modern_win32::wide_process_startup_info;
+
+namespace
+{
+    [[nodiscard]]
+    bool write_text(shared_memory_ring& ring, std::string_view const text)
+    {
+        return ring.try_write(text.data(), text.size());
+    }
+
+    [[nodiscard]]
+    std::string read_text(shared_memory_ring& ring)
+    {
+        auto const message = ring.try_read();
+        if (!message.has_value())
+            return {};
+        std::string text(reinterpret_cast<char const*>(message->data), message->size);
+        ring.pop();
+        return text;
+    }
+}
+
+TEST(shared_memory_ring_test, create__rounds_capacity_up_to_power_of_two__when_capacity_is_not_power_of_two)
+{
+    auto const ring = shared_memory_ring::create(5000);
+
+    ASSERT_EQ(8192U, ring.capacity());
+    ASSERT_EQ(8192U / 2 - 8, ring.max_message_size());
+}
+
+TEST(shared_memory_ring_test, create__uses_minimum_capacity__when_capacity_is_small)
+{
+    auto const ring = shared_memory_ring::create(16);
+
+    ASSERT_EQ(4096U, ring.capacity());
+}
+
+TEST(shared_memory_ring_test, create__throws_windows_exception__when_name_already_exists)
+{
+    auto const ring = shared_memory_ring::create(4096);
+
+    ASSERT_THROW(static_cast<void>(shared_memory_ring::create(ring.name(), 4096)), modern_win32::windows_exception);
+}
+
+TEST(shared_memory_ring_test, open__throws_windows_exception__when_name_does_not_exist)
+{
+    ASSERT_THROW(static_cast<void>(shared_memory_ring::open(L"Local\\modern_win32_ring_does_not_exist")), modern_win32::windows_exception);
+}
+
+TEST(shared_memory_ring_test, open__shares_capacity__when_ring_exists)
+{
+    auto const writer = shared_memory_ring::create(16384);
+    auto const reader = shared_memory_ring::open(writer.name());
+
+    ASSERT_EQ(writer.capacity(), reader.capacity());
+}
+
+TEST(shared_memory_ring_test, wait_for_attach__returns_true__when_ring_has_been_opened)
+{
+    auto const writer = shared_memory_ring::create(4096);
+    auto const reader = shared_memory_ring::open(writer.name());
+
+    ASSERT_TRUE(writer.wait_for_attach(std::chrono::milliseconds(0)));
+}
+
+TEST(shared_memory_ring_test, wait_for_attach__returns_false__when_ring_has_not_been_opened)
+{
+    auto const writer = shared_memory_ring::create(4096);
+
+    ASSERT_FALSE(writer.wait_for_attach(std::chrono::milliseconds(10)));
+}
+
+TEST(shared_memory_ring_test, try_read__returns_nullopt__when_ring_is_empty)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    ASSERT_FALSE(reader.try_read().has_value());
+}
+
+TEST(shared_memory_ring_test, try_read__returns_messages_in_write_order__when_messages_written)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    ASSERT_TRUE(write_text(writer, "first"));
+    ASSERT_TRUE(write_text(writer, "second"));
+    ASSERT_TRUE(write_text(writer, ""));
+    ASSERT_TRUE(write_text(writer, "third"));
+
+    ASSERT_EQ("first", read_text(reader));
+    ASSERT_EQ("second", read_text(reader));
+    auto const empty = reader.try_read();
+    ASSERT_TRUE(empty.has_value());
+    ASSERT_EQ(0U, empty->size);
+    reader.pop();
+    ASSERT_EQ("third", read_text(reader));
+    ASSERT_FALSE(reader.try_read().has_value());
+}
+
+TEST(shared_memory_ring_test, try_read__returns_same_message__when_not_popped)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+    ASSERT_TRUE(write_text(writer, "message"));
+
+    auto const first = reader.try_read();
+    auto const second = reader.try_read();
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_EQ(first->data, second->data);
+}
+
+TEST(shared_memory_ring_test, try_read__returns_data_in_place__when_message_written)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+    std::uint64_t const value = 0x0123456789ABCDEFULL;
+    ASSERT_TRUE(writer.try_write(&value, sizeof(value)));
+
+    auto const message = reader.try_read();
+
+    ASSERT_TRUE(message.has_value());
+    ASSERT_EQ(sizeof(value), message->size);
+    std::uint64_t actual{};
+    std::memcpy(&actual, message->data, sizeof(actual));
+    ASSERT_EQ(value, actual);
+}
+
+TEST(shared_memory_ring_test, try_write__returns_false__when_message_exceeds_max_message_size)
+{
+    auto writer = shared_memory_ring::create(4096);
+    std::vector<std::byte> const message(writer.max_message_size() + 1);
+
+    ASSERT_FALSE(writer.try_write(message.data(), message.size()));
+}
+
+TEST(shared_memory_ring_test, try_write__returns_false__when_ring_is_full)
+{
+    auto writer = shared_memory_ring::create(4096);
+    std::vector<std::byte> const message(1000);
+
+    std::size_t written = 0;
+    while (writer.try_write(message.data(), message.size()))
+        ++written;
+
+    ASSERT_EQ(4U, written);
+}
+
+TEST(shared_memory_ring_test, try_write__succeeds_again__when_reader_pops)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+    std::vector<std::byte> const message(1000);
+    while (writer.try_write(message.data(), message.size())) {
+    }
+
+    ASSERT_TRUE(reader.try_read().has_value());
+    reader.pop();
+
+    ASSERT_TRUE(writer.try_write(message.data(), message.size()));
+}
+
+TEST(shared_memory_ring_test, try_read__returns_intact_messages__when_writes_wrap_around)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    for (int i = 0; i < 1000; ++i) {
+        auto const text = std::string(static_cast<std::size_t>(i % 700), static_cast<char>('a' + i % 26)) + std::to_string(i);
+        ASSERT_TRUE(write_text(writer, text));
+        ASSERT_EQ(text, read_text(reader));
+    }
+}
+
+TEST(shared_memory_ring_test, read__returns_nullopt__when_timeout_expires)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    ASSERT_FALSE(reader.read(std::chrono::milliseconds(10)).has_value());
+}
+
+TEST(shared_memory_ring_test, read__returns_message__when_written_while_waiting)
+{
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    std::thread producer([&writer] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        static_cast<void>(write_text(writer, "late"));
+    });
+    auto const message = reader.read(std::chrono::seconds(5));
+    producer.join();
+
+    ASSERT_TRUE(message.has_value());
+    ASSERT_EQ("late", std::string(reinterpret_cast<char const*>(message->data), message->size));
+}
+
+TEST(shared_memory_ring_test, write__returns_false__when_ring_stays_full)
+{
+    auto writer = shared_memory_ring::create(4096);
+    std::vector<std::byte> const message(1000);
+    while (writer.try_write(message.data(), message.size())) {
+    }
+
+    ASSERT_FALSE(writer.write(message.data(), message.size(), std::chrono::milliseconds(10)));
+}
+
+TEST(shared_memory_ring_test, write__delivers_every_message_in_order__when_reader_is_slower)
+{
+    constexpr std::uint32_t count = 20000;
+    auto writer = shared_memory_ring::create(4096);
+    auto reader = shared_memory_ring::open(writer.name());
+
+    std::thread producer([&writer] {
+        for (std::uint32_t i = 0; i < count; ++i)
+            static_cast<void>(writer.write(&i, sizeof(i), std::chrono::seconds(5)));
+    });
+
+    std::uint32_t expected = 0;
+    while (expected < count) {
+        auto const message = reader.read(std::chrono::seconds(5));
+        if (!message.has_value())
+            break;
+        std::uint32_t value{};
+        std::memcpy(&value, message->data, sizeof(value));
+        reader.pop();
+        if (value != expected)
+            break;
+        ++expected;
+    }
+    producer.join();
+
+    ASSERT_EQ(count, expected);
+}
+
+TEST(shared_memory_ring_test, write__delivers_every_message_from_each_producer_in_order__when_producers_are_multiple)
+{
+    constexpr std::uint32_t producer_count = 4;
+    constexpr std::uint32_t count = 5000;
+    auto reader = shared_memory_ring::create(4096, ring_producers::multiple);
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t producer = 0; producer < producer_count; ++producer) {
+        producers.emplace_back([name = reader.name(), producer] {
+            auto writer = shared_memory_ring::open(name);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                std::uint32_t const value[]{ producer, i };
+                static_cast<void>(writer.write(value, sizeof(value), std::chrono::seconds(5)));
+            }
+        });
+    }
+
+    std::vector<std::uint32_t> next(producer_count);
+    std::uint32_t received = 0;
+    auto in_order = true;
+    while (received < producer_count * count) {
+        auto const message = reader.read(std::chrono::seconds(5));
+        if (!message.has_value())
+            break;
+        std::uint32_t value[2]{};
+        std::memcpy(value, message->data, sizeof(value));
+        reader.pop();
+        in_order = in_order && value[0] < producer_count && value[1] == next[value[0]]++;
+        ++received;
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    ASSERT_EQ(producer_count * count, received);
+    ASSERT_TRUE(in_order);
+}
+
+TEST(shared_memory_ring_test, share_with__adds_name_to_environment__when_environment_not_set)
+{
+    auto const ring = shared_memory_ring::create(4096);
+    wide_process_startup_info startup_info{};
+
+    ring.share_with(startup_info);
+
+    auto const& environment = startup_info.environment;
+    ASSERT_TRUE(environment.has_value());
+    ASSERT_EQ(ring.name(), environment->at(shared_memory_ring::default_environment_variable));
+    ASSERT_GT(environment->size(), 1U);
+}
+
+TEST(shared_memory_ring_test, open_from_environment__opens_ring__when_variable_set)
+{
+    auto writer = shared_memory_ring::create(4096);
+    ASSERT_NE(0, SetEnvironmentVariableW(L"MODERN_WIN32_SHARED_MEMORY_RING_TEST", writer.name().c_str()));
+
+    auto reader = shared_memory_ring::open_from_environment(L"MODERN_WIN32_SHARED_MEMORY_RING_TEST");
+    static_cast<void>(SetEnvironmentVariableW(L"MODERN_WIN32_SHARED_MEMORY_RING_TEST", nullptr));
+
+    ASSERT_TRUE(write_text(writer, "shared"));
+    ASSERT_EQ("shared", read_text(reader));
+}
+
+TEST(shared_memory_ring_test, try_read__returns_nullopt__when_record_size_reaches_past_the_mapping)
+{
+    auto ring = shared_memory_ring::create(4096);
+    constexpr std::string_view text = "corrupted by a peer";
+    ASSERT_TRUE(write_text(ring, text));
+
+    // a second view stands in for the peer, the record header is the 8 bytes in front of the message
+    auto const peer = modern_win32::file_mapping::open_shared(ring.name().c_str());
+    auto const view = peer.map();
+    auto const* const begin = reinterpret_cast<char const*>(view.data());
+    auto const* const end = begin + view.size();
+    auto const* const message = std::search(begin, end, text.begin(), text.end());
+    ASSERT_NE(end, message);
+    constexpr std::uint32_t oversized = 0xFFFFFF00U;
+    std::memcpy(view.data() + (message - begin) - 8, &oversized, sizeof(oversized));
+
+    ASSERT_FALSE(ring.try_read().has_value());
+}
@@ -0,0 +1,95 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <cstdint>
+#include <future>
+#include <set>
+#include <vector>
+#include <modern_win32/threading/slim_lock_array.h>
+
+using modern_win32::threading::cache_line_size;
+using modern_win32::threading::hash_to_stripe;
+using modern_win32::threading::padded_slim_lock;
+using modern_win32::threading::slim_lock_array;
+
+TEST(slim_lock_array_test, padded_slim_lock__occupies_whole_cache_lines__when_stored_in_array)
+{
+    static_assert(alignof(padded_slim_lock) == cache_line_size);
+
+    slim_lock_array<4> locks{};
+    auto const first = reinterpret_cast<std::uintptr_t>(&locks[0]);
+    auto const second = reinterpret_cast<std::uintptr_t>(&locks[1]);
+
+    ASSERT_EQ(0U, first % cache_line_size);
+    ASSERT_GE(second - first, cache_line_size);
+}
+
+TEST(slim_lock_array_test, hash_to_stripe__returns_index_in_range__when_stripe_count_is_not_power_of_two)
+{
+    for (std::size_t hash = 0; hash < 1000; ++hash) {
+        ASSERT_LT(hash_to_stripe(hash, 7), 7U);
+    }
+}
+
+TEST(slim_lock_array_test, index_for__uses_every_stripe__when_hashes_are_aligned_addresses)
+{
+    std::set<std::size_t> used{};
+    for (std::size_t hash = 0; hash < 16 * 256; hash += 256) {
+        used.insert(slim_lock_array<8>::index_for(hash));
+    }
+
+    ASSERT_EQ(8U, used.size());
+}
+
+TEST(slim_lock_array_test, for_hash__returns_same_lock__when_hash_is_equal)
+{
+    slim_lock_array<16> locks{};
+
+    ASSERT_EQ(&locks.for_hash(12345), &locks.for_hash(12345));
+}
+
+TEST(slim_lock_array_test, lock_all__blocks_every_stripe__until_unlock_all)
+{
+    slim_lock_array<4> locks{};
+    locks.lock_all();
+
+    auto blocked = std::async(std::launch::async, [&locks]() {
+        for (std::size_t i = 0; i < locks.size(); ++i) {
+            if (locks[i].try_lock_shared()) {
+                locks[i].unlock_shared();
+                return false;
+            }
+        }
+        return true;
+    });
+    ASSERT_TRUE(blocked.get());
+    locks.unlock_all();
+
+    ASSERT_TRUE(locks[3].try_lock());
+    locks[3].unlock();
+}
+
+TEST(slim_lock_array_test, padded_slim_lock__remains_usable__when_container_reallocates)
+{
+    std::vector<padded_slim_lock> locks(2);
+    locks.resize(64);
+
+    for (auto& lock : locks) {
+        ASSERT_TRUE(lock.try_lock());
+        lock.unlock();
+    }
+}
@@ -14,9 +14,14 @@
 #pragma warning(disable : 26812 26495)
 #include <gtest/gtest.h>
 #pragma warning(default : 26812 26495)
+#include <modern_win32/shared/timed_lock_guard.h>
 #include <modern_win32/threading/slim_lock.h>
 #include "context.h"
+#include <thread>
+#include <vector>
 
+using modern_win32::shared::timed_lock_guard;
+using modern_win32::shared::timed_shared_lock_guard;
 using modern_win32::threading::slim_lock;
 using modern_win32::test::context;
 
@@ -80,3 +85,112 @@ TEST(slim_lock, exclusive_lock_only_allows_one)
     ASSERT_TRUE(name == "thread_one" || name == "thread_two");
 }
 
+TEST(slim_lock, try_lock_for_fails_when_exclusively_held_for_longer_than_timeout)
+{
+    slim_lock lock{};
+    std::lock_guard guard(lock);
+
+    auto acquired = std::async(std::launch::async,
+        [&lock]()
+        {
+            return lock.try_lock_for(std::chrono::milliseconds(20));
+        });
+
+    ASSERT_FALSE(acquired.get());
+}
+
+TEST(slim_lock, try_lock_for_succeeds_when_released_before_timeout)
+{
+    slim_lock lock{};
+    lock.lock();
+
+    auto acquired = std::async(std::launch::async,
+        [&lock]()
+        {
+            auto const locked = lock.try_lock_for(TEST_TIMEOUT);
+            if (locked)
+                lock.unlock();
+            return locked;
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    lock.unlock();
+
+    ASSERT_TRUE(acquired.get());
+}
+
+TEST(slim_lock, try_lock_shared_for_succeeds_when_shared_lock_is_held)
+{
+    slim_lock lock{};
+    std::shared_lock guard(lock);
+
+    auto acquired = std::async(std::launch::async,
+        [&lock]()
+        {
+            auto const locked = lock.try_lock_shared_for(std::chrono::milliseconds(20));
+            if (locked)
+                lock.unlock_shared();
+            return locked;
+        });
+
+    ASSERT_TRUE(acquired.get());
+}
+
+TEST(slim_lock, timed_lock_guard_owns_lock_when_uncontended)
+{
+    slim_lock lock{};
+    {
+        timed_lock_guard const guard(lock, std::chrono::milliseconds(20));
+        ASSERT_TRUE(guard.owns_lock());
+    }
+
+    ASSERT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(slim_lock, timed_shared_lock_guard_does_not_own_lock_when_exclusively_held)
+{
+    slim_lock lock{};
+    std::lock_guard guard(lock);
+
+    auto owned = std::async(std::launch::async,
+        [&lock]()
+        {
+            timed_shared_lock_guard const shared_guard(lock, std::chrono::milliseconds(20));
+            return shared_guard.owns_lock();
+        });
+
+    ASSERT_FALSE(owned.get());
+}
+
+TEST(slim_lock, move_constructed_lock_is_unlocked)
+{
+    slim_lock source{};
+    slim_lock moved{std::move(source)};
+
+    ASSERT_TRUE(moved.try_lock());
+    moved.unlock();
+}
+
+TEST(slim_lock, move_assignment_leaves_both_locks_usable)
+{
+    slim_lock first{};
+    slim_lock second{};
+
+    first = std::move(second);
+
+    ASSERT_TRUE(first.try_lock());
+    ASSERT_TRUE(second.try_lock());
+    first.unlock();
+    second.unlock();
+}
+
+TEST(slim_lock, locks_remain_usable_after_container_reallocates)
+{
+    std::vector<slim_lock> locks(2);
+    locks.resize(64);
+
+    for (auto& lock : locks) {
+        ASSERT_TRUE(lock.try_lock());
+        lock.unlock();
+    }
+}
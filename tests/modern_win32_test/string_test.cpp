@@ -0,0 +1,193 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <modern_win32/string.h>
+
+using modern_win32::get_sub_string_view;
+using modern_win32::index_of;
+using modern_win32::length_until;
+using modern_win32::split_multi_string;
+
+TEST(string_test, index_of__returns_length__when_value_is_terminator)
+{
+    ASSERT_EQ(std::optional<std::string::size_type>(5U), index_of("hello"));
+    ASSERT_EQ(std::optional<std::wstring::size_type>(5U), index_of(L"hello"));
+    ASSERT_FALSE(index_of("").has_value());
+}
+
+TEST(string_test, index_of__returns_nullopt__when_terminator_precedes_value)
+{
+    ASSERT_FALSE(index_of("name", '=').has_value());
+    ASSERT_FALSE(index_of(L"name", L'=').has_value());
+}
+
+TEST(string_test, length_until__returns_position_of_value__for_every_alignment_and_position)
+{
+    std::string narrow(96, 'x');
+    std::wstring wide(96, L'x');
+    for (std::size_t offset = 0; offset < 17U; ++offset) {
+        for (std::size_t position = offset; position < 80U; ++position) {
+            narrow[position] = '=';
+            wide[position] = L'=';
+
+            ASSERT_EQ(position - offset, length_until(narrow.c_str() + offset, '='));
+            ASSERT_EQ(position - offset, length_until(wide.c_str() + offset, L'='));
+
+            narrow[position] = 'x';
+            wide[position] = L'x';
+        }
+    }
+}
+
+TEST(string_test, length_until__stops_at_terminator__when_value_not_present)
+{
+    std::string narrow(70, 'x');
+    std::wstring wide(70, L'x');
+    for (std::size_t offset = 0; offset < 17U; ++offset) {
+        ASSERT_EQ(70U - offset, length_until(narrow.c_str() + offset, '='));
+        ASSERT_EQ(70U - offset, length_until(wide.c_str() + offset, L'='));
+    }
+}
+
+TEST(string_test, length_until__ignores_value__when_it_precedes_source)
+{
+    auto const value = std::string("=abc=");
+    ASSERT_EQ(3U, length_until(value.c_str() + 1, '='));
+}
+
+TEST(string_test, get_sub_string_view__returns_prefix__when_end_char_present)
+{
+    ASSERT_EQ(std::optional<std::wstring_view>(L"PATH"), get_sub_string_view(L"PATH=C:\\Windows", L'='));
+}
+
+TEST(string_test, split_multi_string__returns_each_string__when_block_is_double_null_terminated)
+{
+    static constexpr wchar_t block[] = L"=C:=C:\\\0PATH=C:\\Windows\0TEMP=\0\0";
+
+    auto const strings = split_multi_string(block);
+
+    ASSERT_EQ((std::vector<std::wstring_view>{L"=C:=C:\\", L"PATH=C:\\Windows", L"TEMP="}), strings);
+}
+
+TEST(string_test, split_multi_string__returns_empty__when_block_is_empty)
+{
+    static constexpr char block[] = "\0";
+    ASSERT_TRUE(split_multi_string(block).empty());
+}
+
+TEST(string_test, for_each_multi_string__returns_block_size_including_final_terminator)
+{
+    static constexpr char block[] = "a=1\0bb=2\0";
+    std::size_t count{};
+
+    auto const size = modern_win32::for_each_multi_string(block, [&count](std::string_view) { ++count; });
+
+    ASSERT_EQ(2U, count);
+    ASSERT_EQ(sizeof(block) / sizeof(block[0]), size);
+}
+
+TEST(string_test, to_wstring__returns_converted_value__when_input_is_valid_utf8)
+{
+    ASSERT_EQ(std::wstring(L"thread-name"), modern_win32::convert::to_wstring("thread-name"));
+    ASSERT_EQ(std::wstring(L"caf\u00E9 \u20AC"), modern_win32::convert::to_wstring("caf\xC3\xA9 \xE2\x82\xAC"));
+}
+
+TEST(string_test, to_string__returns_converted_value__when_input_is_valid_utf16)
+{
+    ASSERT_EQ(std::string("thread-name"), modern_win32::convert::to_string(L"thread-name"));
+    ASSERT_EQ(std::string("caf\xC3\xA9 \xE2\x82\xAC"), modern_win32::convert::to_string(L"caf\u00E9 \u20AC"));
+}
+
+TEST(string_test, try_to_wstring__returns_written_length__when_long_ascii_input_fits)
+{
+    std::string const value = std::string(37, 'a') + "\xC3\xA9" + std::string(20, 'b');
+    std::array<wchar_t, 64> buffer{};
+
+    auto const written = modern_win32::convert::try_to_wstring(value, buffer.data(), buffer.size());
+
+    ASSERT_EQ(std::optional<std::size_t>(58U), written);
+    ASSERT_EQ(std::wstring(37, L'a') + L"\u00E9" + std::wstring(20, L'b'), std::wstring(buffer.data(), written.value()));
+}
+
+TEST(string_test, try_to_wstring__returns_nullopt__when_buffer_too_small)
+{
+    std::array<wchar_t, 8> buffer{};
+    ASSERT_FALSE(modern_win32::convert::try_to_wstring(std::string(9, 'a'), buffer.data(), buffer.size()).has_value());
+    ASSERT_FALSE(modern_win32::convert::try_to_wstring(std::string(8, 'a') + "\xC3\xA9", buffer.data(), buffer.size()).has_value());
+}
+
+TEST(string_test, try_to_string__returns_written_length__when_long_ascii_input_fits)
+{
+    std::wstring const value = std::wstring(40, L'x') + L"\u20AC";
+    std::array<char, 64> buffer{};
+
+    auto const written = modern_win32::convert::try_to_string(value, buffer.data(), buffer.size());
+
+    ASSERT_EQ(std::optional<std::size_t>(43U), written);
+    ASSERT_EQ(std::string(40, 'x') + "\xE2\x82\xAC", std::string(buffer.data(), written.value()));
+}
+
+TEST(string_test, to_wstring__reuses_output_capacity__when_output_already_large_enough)
+{
+    std::wstring output;
+    output.reserve(128);
+    auto const* const data = output.data();
+
+    modern_win32::convert::to_wstring(std::string_view("first"), output);
+    modern_win32::convert::to_wstring(std::string_view("second"), output);
+
+    ASSERT_EQ(L"second", output);
+    ASSERT_EQ(data, output.data());
+}
+
+TEST(string_test, utf8_to_wide_converter__joins_sequences__when_split_across_chunks)
+{
+    std::string const value = "a\xF0\x9F\x98\x80z\xE2\x82\xAC";
+    for (std::size_t split = 0; split <= value.size(); ++split) {
+        modern_win32::convert::utf8_to_wide_converter converter{};
+        std::wstring output;
+
+        converter.convert(std::string_view(value).substr(0U, split), output);
+        converter.convert(std::string_view(value).substr(split), output);
+        converter.finish(output);
+
+        ASSERT_EQ(modern_win32::convert::to_wstring(value), output);
+        ASSERT_FALSE(converter.has_pending());
+    }
+}
+
+TEST(string_test, wide_to_utf8_converter__joins_surrogate_pair__when_split_across_chunks)
+{
+    std::wstring const value = modern_win32::convert::to_wstring("a\xF0\x9F\x98\x80z");
+    for (std::size_t split = 0; split <= value.size(); ++split) {
+        modern_win32::convert::wide_to_utf8_converter converter{};
+        std::string output;
+
+        converter.convert(std::wstring_view(value).substr(0U, split), output);
+        converter.convert(std::wstring_view(value).substr(split), output);
+        converter.finish(output);
+
+        ASSERT_EQ("a\xF0\x9F\x98\x80z", output);
+    }
+}
@@ -0,0 +1,152 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <modern_win32/shared/timed_lock_guard.h>
+#include <modern_win32/threading/striped_shared_lock.h>
+
+using modern_win32::shared::timed_lock_guard;
+using modern_win32::shared::timed_shared_lock_guard;
+using modern_win32::threading::striped_shared_lock;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+}
+
+TEST(striped_shared_lock_test, constructor__uses_at_least_one_stripe__when_stripe_count_is_zero)
+{
+    striped_shared_lock const lock{};
+
+    ASSERT_GE(lock.stripe_count(), 1U);
+}
+
+TEST(striped_shared_lock_test, lock_shared__allows_multiple_readers__when_no_writer_holds_lock)
+{
+    striped_shared_lock lock{ 4 };
+    std::shared_lock first(lock);
+
+    auto other = std::async(std::launch::async, [&lock]() {
+        std::shared_lock second(lock, std::defer_lock);
+        return second.try_lock();
+    });
+
+    ASSERT_EQ(std::future_status::ready, other.wait_for(TEST_TIMEOUT));
+    ASSERT_TRUE(other.get());
+}
+
+TEST(striped_shared_lock_test, try_lock__returns_false__when_reader_holds_any_stripe)
+{
+    striped_shared_lock lock{ 4 };
+    std::shared_lock reader(lock);
+
+    auto writer = std::async(std::launch::async, [&lock]() {
+        bool const acquired = lock.try_lock();
+        if (acquired) {
+            lock.unlock();
+        }
+        return acquired;
+    });
+
+    ASSERT_EQ(std::future_status::ready, writer.wait_for(TEST_TIMEOUT));
+    ASSERT_FALSE(writer.get());
+}
+
+TEST(striped_shared_lock_test, try_lock__releases_acquired_stripes__when_acquisition_fails)
+{
+    striped_shared_lock lock{ 4 };
+    {
+        std::shared_lock reader(lock);
+        auto writer = std::async(std::launch::async, [&lock]() { return lock.try_lock(); });
+        ASSERT_FALSE(writer.get());
+    }
+
+    ASSERT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(striped_shared_lock_test, try_lock_shared_for__returns_false__when_writer_holds_lock)
+{
+    striped_shared_lock lock{ 4 };
+    std::lock_guard writer(lock);
+
+    auto reader = std::async(std::launch::async, [&lock]() {
+        timed_shared_lock_guard const guard(lock, milliseconds(20));
+        return guard.owns_lock();
+    });
+
+    ASSERT_EQ(std::future_status::ready, reader.wait_for(TEST_TIMEOUT));
+    ASSERT_FALSE(reader.get());
+}
+
+TEST(striped_shared_lock_test, try_lock_for__acquires_lock__when_readers_release_before_timeout)
+{
+    striped_shared_lock lock{ 4 };
+    std::shared_lock reader(lock);
+
+    auto writer = std::async(std::launch::async, [&lock]() {
+        timed_lock_guard const guard(lock, TEST_TIMEOUT);
+        return guard.owns_lock();
+    });
+    std::this_thread::sleep_for(milliseconds(20));
+    reader.unlock();
+
+    ASSERT_EQ(std::future_status::ready, writer.wait_for(TEST_TIMEOUT * 2));
+    ASSERT_TRUE(writer.get());
+}
+
+TEST(striped_shared_lock_test, lock__excludes_readers__when_many_threads_contend)
+{
+    striped_shared_lock lock{};
+    std::atomic<int> writers_inside{};
+    std::atomic<bool> overlap{};
+    int counter{};
+
+    auto worker = [&](bool const writer) {
+        for (int i = 0; i < 1000; ++i) {
+            if (writer) {
+                std::lock_guard guard(lock);
+                writers_inside.fetch_add(1);
+                ++counter;
+                writers_inside.fetch_sub(1);
+            } else {
+                std::shared_lock guard(lock);
+                if (writers_inside.load() != 0) {
+                    overlap = true;
+                }
+            }
+        }
+    };
+
+    std::thread first(worker, true);
+    std::thread second(worker, false);
+    std::thread third(worker, true);
+    std::thread fourth(worker, false);
+    first.join();
+    second.join();
+    third.join();
+    fourth.join();
+
+    ASSERT_FALSE(overlap.load());
+    ASSERT_EQ(2000, counter);
+}
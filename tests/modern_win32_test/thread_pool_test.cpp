@@ -0,0 +1,156 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <atomic>
+#include <functional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/slim_lock.h>
+#include <modern_win32/threading/thread.h>
+#include <modern_win32/threading/thread_pool.h>
+
+using modern_win32::threading::executor_work;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::slim_lock;
+using modern_win32::threading::slim_lock_guard;
+using modern_win32::threading::thread;
+using modern_win32::threading::thread_pool;
+
+TEST(thread_pool_test, constructor__creates_requested_workers__when_count_is_non_zero)
+{
+    thread_pool const pool(3);
+
+    ASSERT_EQ(3U, pool.worker_count());
+}
+
+TEST(thread_pool_test, constructor__creates_at_least_one_worker__when_count_is_zero)
+{
+    thread_pool const pool{};
+
+    ASSERT_GE(pool.worker_count(), 1U);
+}
+
+TEST(thread_pool_test, submit__runs_work_on_worker_thread__always)
+{
+    thread_pool pool(2);
+    std::atomic<thread::native_thread_id> worker_id{};
+    manual_reset_event complete{ false };
+
+    ASSERT_TRUE(pool.submit([&worker_id, &complete]() {
+        worker_id = thread::current_thread_id();
+        std::ignore = complete.set();
+    }));
+
+    ASSERT_TRUE(complete.wait_one(std::chrono::seconds(5)));
+    ASSERT_NE(thread::current_thread_id(), worker_id.load());
+}
+
+TEST(thread_pool_test, submit_bulk__runs_every_item__when_given_range)
+{
+    thread_pool pool(4);
+    std::atomic<int> count{};
+    std::vector<std::function<void()>> work(1000, [&count]() { ++count; });
+
+    ASSERT_EQ(work.size(), pool.submit_bulk(work.begin(), work.end()));
+    pool.wait_idle();
+
+    ASSERT_EQ(1000, count.load());
+}
+
+TEST(thread_pool_test, submit__uses_multiple_workers__when_work_blocks)
+{
+    thread_pool pool(4);
+    slim_lock lock{};
+    std::set<thread::native_thread_id> ids{};
+    manual_reset_event release{ false };
+
+    for (int i = 0; i < 4; ++i) {
+        std::ignore = pool.submit([&]() {
+            {
+                slim_lock_guard guard{ lock };
+                ids.insert(thread::current_thread_id());
+            }
+            std::ignore = release.wait_one(std::chrono::seconds(5));
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::ignore = release.set();
+    pool.wait_idle();
+
+    ASSERT_EQ(4U, ids.size());
+}
+
+TEST(thread_pool_test, submit__runs_nested_work__when_submitted_from_worker)
+{
+    thread_pool pool(2);
+    std::atomic<int> count{};
+
+    std::ignore = pool.submit([&pool, &count]() {
+        EXPECT_TRUE(pool.is_worker_thread());
+        for (int i = 0; i < 10; ++i) {
+            std::ignore = pool.submit([&count]() { ++count; });
+        }
+    });
+    pool.wait_idle();
+
+    ASSERT_EQ(10, count.load());
+}
+
+TEST(thread_pool_test, submit__returns_false__after_shutdown)
+{
+    thread_pool pool(1);
+    pool.shutdown();
+
+    ASSERT_FALSE(pool.submit([]() { /* ... */ }));
+}
+
+TEST(thread_pool_test, shutdown__runs_queued_work__before_returning)
+{
+    std::atomic<int> count{};
+    {
+        thread_pool pool(1);
+        for (int i = 0; i < 100; ++i) {
+            std::ignore = pool.submit([&count]() { ++count; });
+        }
+    }
+
+    ASSERT_EQ(100, count.load());
+}
+
+TEST(thread_pool_test, post__runs_executor_work__always)
+{
+    thread_pool pool(1);
+    manual_reset_event complete{ false };
+    executor_work work{ [](void* context) { std::ignore = static_cast<manual_reset_event*>(context)->set(); }, &complete };
+
+    ASSERT_TRUE(pool.post(work));
+
+    ASSERT_TRUE(complete.wait_one(std::chrono::seconds(5)));
+}
+
+TEST(thread_pool_test, unhandled_exception_count__counts_throwing_work__always)
+{
+    thread_pool pool(1);
+
+    std::ignore = pool.submit([]() { throw std::runtime_error("expected"); });
+    pool.wait_idle();
+
+    ASSERT_EQ(1U, pool.unhandled_exception_count());
+}
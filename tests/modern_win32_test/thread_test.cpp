@@ -18,6 +18,8 @@
 #include <modern_win32/threading/thread.h>
 #include <modern_win32/threading/event.h>
 #include "context.h"
+#include <functional>
+#include <memory>
 #include <vector>
 
 using std::chrono::milliseconds;
@@ -26,6 +28,19 @@ using namespace modern_win32::threading;
 using modern_win32::test::context;
 constexpr auto TEST_TIMOUT = std::chrono::milliseconds(250);
 
+namespace
+{
+    struct exit_code_state final
+    {
+        DWORD exit_code{};
+    };
+
+    DWORD __stdcall return_exit_code(thread::thread_parameter const parameter)
+    {
+        return static_cast<exit_code_state const*>(parameter)->exit_code;
+    }
+}
+
 TEST(thread, thread_throws_invalid_argument_on_null_worker)
 {
     std::unique_ptr<thread_start> worker;
@@ -181,3 +196,123 @@ TEST(thread, get_thread_name_returns_correct_value)
     ASSERT_EQ(expected_name, maybe_actual_name.value());
 }
 
+
+TEST(thread, start_thread_invokes_callable_with_arguments)
+{
+    context ctx{TEST_TIMOUT};
+    thread const task = start_thread(
+        [](context* context_ptr, std::unique_ptr<int> value)
+        {
+            EXPECT_NE(value, nullptr);
+            context_ptr->complete = value != nullptr && *value == 42;
+        }, &ctx, std::make_unique<int>(42));
+    task.join();
+
+    ASSERT_TRUE(ctx.complete && !ctx.get_timed_out());
+}
+
+TEST(thread, start_thread_runs_caller_provided_thread_start)
+{
+    context ctx{TEST_TIMOUT};
+    auto worker = make_thread_start(
+        [](context& context_ref)
+        {
+            context_ref.complete = true;
+        }, std::ref(ctx));
+
+    thread const task = start_thread(&worker);
+    task.join();
+
+    ASSERT_TRUE(ctx.complete && !ctx.get_timed_out());
+}
+
+TEST(thread, anonymous_thread_start_invokes_mutable_worker_in_place)
+{
+    int call_count{};
+    auto worker = anonymous_thread_start(
+        [&call_count, calls = 0]() mutable
+        {
+            call_count = ++calls;
+        });
+    thread_start& generic_worker = worker;
+
+    generic_worker();
+    generic_worker();
+
+    ASSERT_EQ(2, call_count);
+}
+
+TEST(thread, start_with_options_runs_worker_with_stack_reservation)
+{
+    context ctx{TEST_TIMOUT};
+    thread_options options{};
+    options.stack_reservation = 64 * 1024;
+
+    thread const task = start_thread(options,
+        [](context* context_ptr)
+        {
+            context_ptr->complete = true;
+        }, &ctx);
+    task.join();
+
+    ASSERT_TRUE(ctx.complete && !ctx.get_timed_out());
+}
+
+TEST(thread, start_with_options_does_not_run_suspended_thread_until_resumed)
+{
+    context ctx{TEST_TIMOUT};
+    thread_options options{};
+    options.start_suspended = true;
+
+    thread const task = start_thread(options,
+        [](context* context_ptr)
+        {
+            context_ptr->complete = true;
+        }, &ctx);
+
+    EXPECT_FALSE(task.join(milliseconds(50)));
+    EXPECT_FALSE(ctx.complete);
+    ASSERT_TRUE(task.resume());
+    task.join();
+
+    ASSERT_TRUE(ctx.complete && !ctx.get_timed_out());
+}
+
+TEST(thread, start_with_options_applies_priority_before_worker_runs)
+{
+    int observed_priority{ THREAD_PRIORITY_ERROR_RETURN };
+    thread_options options{};
+    options.priority = thread_priority::below_normal;
+
+    thread const task = start_thread(options,
+        [](int* priority)
+        {
+            *priority = GetThreadPriority(GetCurrentThread());
+        }, &observed_priority);
+    task.join();
+
+    ASSERT_EQ(THREAD_PRIORITY_BELOW_NORMAL, observed_priority);
+}
+
+TEST(thread, try_start_thread_returns_running_thread_when_worker_is_callable)
+{
+    int observed{};
+    auto result = try_start_thread([](int* value) { *value = 7; }, &observed);
+    ASSERT_TRUE(result.has_value());
+
+    result->join();
+
+    ASSERT_EQ(7, observed);
+}
+
+TEST(thread, start_thread_keeps_exit_code_when_thread_proc_is_given_typed_pointer)
+{
+    static_assert(!is_thread_callable_v<decltype(&return_exit_code), exit_code_state*>,
+        "thread_proc workers must not select the callable overloads");
+
+    exit_code_state state{ 42UL };
+    thread const task = start_thread(&return_exit_code, &state);
+    task.join();
+
+    ASSERT_EQ(std::optional<int>{ 42 }, task.exit_code());
+}
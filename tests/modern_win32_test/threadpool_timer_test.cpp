@@ -0,0 +1,85 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <atomic>
+#include <chrono>
+#include <modern_win32/threading/timer.h>
+#include <modern_win32/threading/event.h>
+
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::delayed_callback;
+using modern_win32::threading::synchronization_timer;
+using modern_win32::threading::threadpool_timer_traits;
+
+TEST(threadpool_timer_test, start__invokes_callback__when_delayed_callback_due)
+{
+    manual_reset_event callback_event{ false };
+    bool called{ false };
+    auto callback = [&called, &callback_event](int const& state) {
+        if (state == 3) {
+            called = true;
+            std::ignore = callback_event.set();
+        }
+    };
+
+    delayed_callback<int, decltype(callback), threadpool_timer_traits> timer(callback, 3);
+    timer.start(50ms);
+
+    std::ignore = callback_event.wait_one(5s);
+    ASSERT_TRUE(called);
+}
+
+TEST(threadpool_timer_test, start__does_not_create_timer_thread__always)
+{
+    delayed_callback<int, void(*)(int&), threadpool_timer_traits> timer([](int&) { /* ... */ }, 3);
+    timer.start(10s);
+
+    ASSERT_FALSE(timer.timer_thread_id().has_value());
+}
+
+TEST(threadpool_timer_test, is_running__returns_true__after_start_is_called_and_before_stop_is_called)
+{
+    synchronization_timer<int, void(*)(int&), threadpool_timer_traits> timer([](int&) { /* ... */ }, 3);
+    timer.start(100ms, 500ms);
+
+    ASSERT_TRUE(timer.is_running());
+}
+
+TEST(threadpool_timer_test, is_running__returns_false__after_stop_is_called)
+{
+    synchronization_timer<int, void(*)(int&), threadpool_timer_traits> timer([](int&) { /* ... */ }, 3);
+    timer.start(100ms, 500ms);
+    timer.stop();
+
+    ASSERT_FALSE(timer.is_running());
+}
+
+TEST(threadpool_timer_test, is_running__returns_false__after_delayed_callback_fires)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int&) {
+        std::ignore = callback_event.set();
+    };
+    delayed_callback<int, decltype(callback), threadpool_timer_traits> timer(callback, 3);
+    timer.start(10ms);
+
+    std::ignore = callback_event.wait_one(5s);
+    std::this_thread::sleep_for(50ms);
+
+    ASSERT_FALSE(timer.is_running());
+}
@@ -0,0 +1,111 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <atomic>
+#include <thread>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/executor.h>
+#include <modern_win32/threading/thread.h>
+#include <modern_win32/threading/timer.h>
+
+using modern_win32::threading::default_threadpool_executor;
+using modern_win32::threading::executor;
+using modern_win32::threading::executor_work;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::synchronization_timer;
+using modern_win32::threading::delayed_callback;
+using modern_win32::threading::thread;
+
+namespace
+{
+    class rejecting_executor final : public executor
+    {
+    public:
+        [[nodiscard]]
+        bool post(executor_work&) noexcept override
+        {
+            return false;
+        }
+    };
+}
+
+TEST(timer_executor_test, start__invokes_callback_on_executor__when_executor_set)
+{
+    struct callback_state final
+    {
+        manual_reset_event* callback_event;
+        std::atomic<thread::native_thread_id>* callback_thread_id;
+    };
+
+    manual_reset_event callback_event{ false };
+    std::atomic<thread::native_thread_id> callback_thread_id{};
+
+    delayed_callback<callback_state> timer([](callback_state& state) {
+        *state.callback_thread_id = thread::current_thread_id();
+        std::ignore = state.callback_event->set();
+    }, callback_state{ &callback_event, &callback_thread_id });
+    timer.set_executor(&default_threadpool_executor::instance());
+    timer.start(10ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_NE(thread::current_thread_id(), callback_thread_id.load());
+}
+
+TEST(timer_executor_test, statistics__counts_overlapped_ticks__when_callback_is_slower_than_period)
+{
+    synchronization_timer<int> timer([](int&) {
+        std::this_thread::sleep_for(100ms);
+    }, 3);
+    timer.set_executor(&default_threadpool_executor::instance());
+    timer.start(10ms, 10ms);
+
+    std::this_thread::sleep_for(500ms);
+    ASSERT_TRUE(timer.stop());
+
+    auto const statistics = timer.statistics();
+    ASSERT_GT(statistics.ticks, 0ULL);
+    ASSERT_GT(statistics.overlapped_ticks, 0ULL);
+}
+
+TEST(timer_executor_test, statistics__counts_missed_ticks__when_executor_rejects_work)
+{
+    rejecting_executor rejecting{};
+    delayed_callback<int> timer([](int&) { /* ... */ }, 3);
+    timer.set_executor(&rejecting);
+    timer.start(10ms);
+
+    std::this_thread::sleep_for(200ms);
+
+    ASSERT_EQ(1ULL, timer.statistics().ticks);
+    ASSERT_EQ(1ULL, timer.statistics().missed_ticks);
+}
+
+TEST(timer_executor_test, reset_statistics__clears_counters__always)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const&) {
+        std::ignore = callback_event.set();
+    };
+    delayed_callback<int, decltype(callback)> timer(callback, 3);
+    timer.start(10ms);
+    ASSERT_TRUE(callback_event.wait_one(5s));
+
+    timer.reset_statistics();
+
+    ASSERT_EQ(0ULL, timer.statistics().ticks);
+}
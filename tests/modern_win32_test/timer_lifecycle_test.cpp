@@ -0,0 +1,91 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <array>
+#include <atomic>
+#include <thread>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/timer.h>
+
+using modern_win32::threading::delayed_callback;
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::synchronization_timer;
+
+TEST(timer_lifecycle_test, is_running__returns_false__after_delayed_callback_has_fired)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const&) {
+        std::ignore = callback_event.set();
+    };
+
+    delayed_callback<int, decltype(callback)> timer(callback, 3);
+    timer.start(10ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    std::this_thread::sleep_for(50ms);
+    ASSERT_FALSE(timer.is_running());
+}
+
+TEST(timer_lifecycle_test, start__restarts_timer__when_called_from_delayed_callback)
+{
+    struct restart_state final
+    {
+        delayed_callback<restart_state*>* timer;
+        manual_reset_event* callback_event;
+        std::atomic<int>* call_count;
+    };
+
+    manual_reset_event callback_event{ false };
+    std::atomic<int> call_count{};
+    restart_state state{ nullptr, &callback_event, &call_count };
+
+    delayed_callback<restart_state*> timer([](restart_state*& value) {
+        if (++(*value->call_count) < 2) {
+            value->timer->start(10ms);
+        } else {
+            std::ignore = value->callback_event->set();
+        }
+    }, &state);
+    state.timer = &timer;
+    timer.start(10ms);
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+    ASSERT_EQ(2, call_count.load());
+}
+
+TEST(timer_lifecycle_test, stop__leaves_timer_stopped__when_start_and_stop_race)
+{
+    synchronization_timer<int> timer([](int&) { /* ... */ }, 3);
+
+    std::array<std::thread, 4> workers{};
+    for (auto& worker : workers) {
+        worker = std::thread([&timer]() {
+            for (int i = 0; i < 50; ++i) {
+                timer.start(1ms, 1ms);
+                std::ignore = timer.stop();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    std::ignore = timer.stop();
+
+    ASSERT_FALSE(timer.is_running());
+    ASSERT_FALSE(timer.timer_thread_id().has_value());
+}
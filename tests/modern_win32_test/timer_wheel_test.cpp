@@ -0,0 +1,189 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include "timer_test.h"
+#include <vector>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/threading/timer_wheel.h>
+
+using modern_win32::threading::manual_reset_event;
+using modern_win32::threading::timer_wheel;
+using modern_win32::threading::timer_wheel_id;
+
+namespace
+{
+    std::vector<int>* fired_states{};
+
+    void record_state(int& state)
+    {
+        if (fired_states != nullptr) {
+            fired_states->push_back(state);
+        }
+    }
+
+    struct fired_states_scope final
+    {
+        std::vector<int> states{};
+
+        fired_states_scope()
+        {
+            fired_states = &states;
+        }
+        fired_states_scope(fired_states_scope const&) = delete;
+        fired_states_scope(fired_states_scope&&) noexcept = delete;
+        ~fired_states_scope()
+        {
+            fired_states = nullptr;
+        }
+        fired_states_scope& operator=(fired_states_scope const&) = delete;
+        fired_states_scope& operator=(fired_states_scope&&) noexcept = delete;
+    };
+}
+
+TEST(timer_wheel_test, constructor__throws_invalid_argument__when_resolution_is_zero)
+{
+    ASSERT_THROW(timer_wheel<int>(record_state, 0ms), std::invalid_argument);
+}
+
+TEST(timer_wheel_test, schedule__throws_invalid_argument__when_due_time_is_negative)
+{
+    timer_wheel<int> wheel(record_state, 10ms);
+    ASSERT_THROW(std::ignore = wheel.schedule(-10ms, 1), std::invalid_argument);
+}
+
+TEST(timer_wheel_test, advance__invokes_callback__when_due_time_reached)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 10ms);
+    std::ignore = wheel.schedule(30ms, 3);
+
+    wheel.advance(3);
+    ASSERT_TRUE(scope.states.empty());
+
+    wheel.advance();
+    ASSERT_EQ(std::vector<int>{ 3 }, scope.states);
+}
+
+TEST(timer_wheel_test, advance__invokes_callback__when_due_time_beyond_root_level)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 1ms);
+    std::ignore = wheel.schedule(70'000ms, 7);
+
+    wheel.advance(70'000);
+    ASSERT_TRUE(scope.states.empty());
+
+    wheel.advance();
+    ASSERT_EQ(std::vector<int>{ 7 }, scope.states);
+}
+
+TEST(timer_wheel_test, advance__invokes_callback_on_time__when_due_time_beyond_horizon)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 1ms);
+    wheel.advance(1'000);
+    std::ignore = wheel.schedule(150'000'000ms, 9);
+
+    wheel.advance(150'000'000);
+    ASSERT_TRUE(scope.states.empty());
+
+    wheel.advance();
+    ASSERT_EQ(std::vector<int>{ 9 }, scope.states);
+}
+
+TEST(timer_wheel_test, advance__invokes_callbacks_in_batch__when_multiple_timers_share_tick)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 10ms);
+    std::ignore = wheel.schedule(20ms, 1);
+    std::ignore = wheel.schedule(15ms, 2);
+    std::ignore = wheel.schedule(100ms, 3);
+
+    wheel.advance(3);
+
+    ASSERT_EQ(2U, scope.states.size());
+    ASSERT_EQ(1U, wheel.size());
+}
+
+TEST(timer_wheel_test, cancel__prevents_callback__when_timer_pending)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 10ms);
+    auto const id = wheel.schedule(20ms, 1);
+
+    ASSERT_TRUE(wheel.cancel(id));
+    wheel.advance(5);
+
+    ASSERT_TRUE(scope.states.empty());
+    ASSERT_EQ(0U, wheel.size());
+}
+
+TEST(timer_wheel_test, cancel__returns_false__when_id_is_stale)
+{
+    timer_wheel<int> wheel(record_state, 10ms);
+    auto const id = wheel.schedule(10ms, 1);
+    wheel.advance(2);
+
+    auto const reused = wheel.schedule(10ms, 2);
+
+    ASSERT_EQ(id.index, reused.index);
+    ASSERT_FALSE(wheel.cancel(id));
+    ASSERT_TRUE(wheel.cancel(reused));
+}
+
+TEST(timer_wheel_test, reschedule__moves_expiry__when_timer_pending)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 10ms);
+    auto const id = wheel.schedule(20ms, 1);
+
+    ASSERT_TRUE(wheel.reschedule(id, 50ms));
+    wheel.advance(3);
+    ASSERT_TRUE(scope.states.empty());
+
+    wheel.advance(3);
+    ASSERT_EQ(std::vector<int>{ 1 }, scope.states);
+}
+
+TEST(timer_wheel_test, advance__invokes_callback_repeatedly__when_scheduled_with_period)
+{
+    fired_states_scope const scope{};
+    timer_wheel<int> wheel(record_state, 10ms);
+    auto const id = wheel.schedule(10ms, 20ms, 4);
+
+    wheel.advance(6);
+
+    ASSERT_EQ((std::vector<int>{ 4, 4, 4 }), scope.states);
+    ASSERT_TRUE(wheel.cancel(id));
+    ASSERT_EQ(0U, wheel.size());
+}
+
+TEST(timer_wheel_test, start__invokes_callback__when_due_time_elapses)
+{
+    manual_reset_event callback_event{ false };
+    auto callback = [&callback_event](int const& state) {
+        if (state == 5) {
+            std::ignore = callback_event.set();
+        }
+    };
+
+    timer_wheel<int, decltype(callback)> wheel(callback, 10ms);
+    std::ignore = wheel.schedule(50ms, 5);
+    wheel.start();
+
+    ASSERT_TRUE(callback_event.wait_one(5s));
+}
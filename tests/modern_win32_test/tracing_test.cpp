@@ -0,0 +1,101 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <Windows.h>
+#include <bcrypt.h>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <cwctype>
+#include <string_view>
+#include <vector>
+#include <modern_win32/tracing.h>
+
+#pragma comment(lib, "bcrypt")
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace tracing = modern_win32::tracing;
+
+namespace
+{
+    /// <summary>
+    /// derives the provider GUID from <paramref name="name"/> the way EventSource and TraceLogging do, SHA-1 of
+    /// a fixed namespace followed by the upper case name as big endian UTF-16, truncated and marked as version 5
+    /// </summary>
+    [[nodiscard]]
+    GUID name_based_provider_id(std::wstring_view const name)
+    {
+        std::vector<UCHAR> input{ 0x48, 0x2C, 0x2D, 0xB2, 0xC3, 0x90, 0x47, 0xC8, 0x87, 0xF8, 0x1A, 0x15, 0xBF, 0xC1, 0x30, 0xFB };
+        for (auto const character : name) {
+            auto const upper = static_cast<wchar_t>(std::towupper(character));
+            input.push_back(static_cast<UCHAR>(upper >> 8));
+            input.push_back(static_cast<UCHAR>(upper & 0xFF));
+        }
+
+        std::array<UCHAR, 20> hash{};
+        if (BCryptHash(BCRYPT_SHA1_ALG_HANDLE, nullptr, 0, input.data(), static_cast<ULONG>(input.size()), hash.data(), static_cast<ULONG>(hash.size())) != 0) {
+            return GUID{};
+        }
+        hash[7] = static_cast<UCHAR>((hash[7] & 0x0F) | 0x50);
+
+        GUID id{};
+        std::memcpy(&id, hash.data(), sizeof(id));
+        return id;
+    }
+}
+
+TEST(tracing_test, provider_id__matches_guid_derived_from_provider_name__always)
+{
+    ASSERT_EQ(name_based_provider_id(tracing::provider_name), tracing::provider_id);
+}
+
+TEST(tracing_test, is_enabled__returns_false__when_not_compiled_in)
+{
+    if constexpr (tracing::tracing_enabled)
+        GTEST_SKIP() << "built with MODERN_WIN32_TRACELOGGING";
+
+    ASSERT_FALSE(tracing::is_enabled(tracing::keyword::thread));
+    ASSERT_FALSE(tracing::is_enabled(tracing::keyword::timer));
+    ASSERT_FALSE(tracing::is_enabled(tracing::keyword::wait));
+    ASSERT_FALSE(tracing::is_enabled(tracing::keyword::process));
+}
+
+TEST(tracing_test, long_wait_threshold__returns_one_millisecond__by_default)
+{
+    ASSERT_EQ(milliseconds(1), tracing::long_wait_threshold());
+}
+
+TEST(tracing_test, long_wait_threshold__returns_updated_value__after_set_long_wait_threshold)
+{
+    auto const original = tracing::long_wait_threshold();
+
+    tracing::set_long_wait_threshold(microseconds(250));
+    auto const updated = tracing::long_wait_threshold();
+    tracing::set_long_wait_threshold(original);
+
+    ASSERT_EQ(microseconds(250), updated);
+}
+
+TEST(tracing_test, wait_completed__does_not_throw__when_no_session_is_listening)
+{
+    ASSERT_NO_THROW(tracing::wait_completed(1, nullptr, false, INFINITE, WAIT_OBJECT_0, 0));
+    ASSERT_NO_THROW(tracing::thread_exited(0, 0));
+}
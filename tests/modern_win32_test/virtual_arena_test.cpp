@@ -0,0 +1,162 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+#include <modern_win32/virtual_arena.h>
+
+using modern_win32::arena_memory_resource;
+using modern_win32::arena_page_size;
+using modern_win32::virtual_arena;
+
+namespace
+{
+    constexpr std::size_t reserve_size = 4U * 1024U * 1024U;
+}
+
+TEST(virtual_arena_test, constructor__throws_invalid_argument__when_reserve_size_is_zero)
+{
+    ASSERT_THROW(virtual_arena(0), std::invalid_argument);
+}
+
+TEST(virtual_arena_test, constructor__commits_nothing__when_page_size_is_standard)
+{
+    virtual_arena const arena(reserve_size);
+
+    ASSERT_EQ(reserve_size, arena.reserved());
+    ASSERT_EQ(0U, arena.committed());
+    ASSERT_EQ(0U, arena.used());
+}
+
+TEST(virtual_arena_test, allocate__returns_writable_memory__when_arena_has_space)
+{
+    virtual_arena arena(reserve_size);
+
+    auto* const memory = static_cast<unsigned char*>(arena.allocate(1000));
+
+    ASSERT_NE(nullptr, memory);
+    std::memset(memory, 0xAB, 1000);
+    ASSERT_TRUE(arena.owns(memory));
+    ASSERT_EQ(1000U, arena.used());
+}
+
+TEST(virtual_arena_test, allocate__returns_aligned_memory__when_alignment_is_provided)
+{
+    virtual_arena arena(reserve_size);
+    static_cast<void>(arena.allocate(1, 1));
+
+    auto* const memory = arena.allocate(64, 4096);
+
+    ASSERT_EQ(0U, reinterpret_cast<std::uintptr_t>(memory) % 4096U);
+}
+
+TEST(virtual_arena_test, allocate__commits_in_chunks__when_arena_grows)
+{
+    virtual_arena arena(reserve_size);
+
+    static_cast<void>(arena.allocate(1));
+    auto const first_commit = arena.committed();
+    static_cast<void>(arena.allocate(virtual_arena::default_commit_size));
+
+    ASSERT_EQ(virtual_arena::default_commit_size, first_commit);
+    ASSERT_EQ(2U * virtual_arena::default_commit_size, arena.committed());
+}
+
+TEST(virtual_arena_test, allocate__returns_nullptr__when_arena_is_exhausted)
+{
+    virtual_arena arena(reserve_size);
+
+    ASSERT_NE(nullptr, arena.allocate(reserve_size));
+    ASSERT_EQ(nullptr, arena.allocate(1));
+}
+
+TEST(virtual_arena_test, allocate__returns_nullptr__when_alignment_is_not_power_of_two)
+{
+    virtual_arena arena(reserve_size);
+
+    ASSERT_EQ(nullptr, arena.allocate(8, 3));
+}
+
+TEST(virtual_arena_test, reset__reuses_memory__when_called_after_allocations)
+{
+    virtual_arena arena(reserve_size);
+    auto* const first = arena.allocate(128);
+    auto const committed = arena.committed();
+
+    arena.reset();
+    auto* const second = arena.allocate(128);
+
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(committed, arena.committed());
+}
+
+TEST(virtual_arena_test, trim__decommits_memory__when_more_than_one_chunk_is_committed)
+{
+    virtual_arena arena(reserve_size);
+    static_cast<void>(arena.allocate(reserve_size / 2));
+
+    arena.trim();
+
+    ASSERT_EQ(0U, arena.used());
+    ASSERT_EQ(virtual_arena::default_commit_size, arena.committed());
+}
+
+TEST(virtual_arena_test, move_constructor__transfers_region__when_arena_is_moved)
+{
+    virtual_arena source(reserve_size);
+    auto* const memory = source.allocate(16);
+
+    virtual_arena const destination(std::move(source));
+
+    ASSERT_TRUE(destination.owns(memory));
+    ASSERT_EQ(16U, destination.used());
+    ASSERT_EQ(0U, source.reserved()); // NOLINT(bugprone-use-after-move)
+}
+
+TEST(virtual_arena_test, constructor__returns_usable_arena__when_large_pages_are_preferred)
+{
+    virtual_arena arena(reserve_size, arena_page_size::prefer_large);
+
+    ASSERT_NE(nullptr, arena.allocate(1024));
+    ASSERT_GE(arena.reserved(), reserve_size);
+}
+
+TEST(arena_memory_resource_test, allocate__supports_pmr_containers__when_using_arena)
+{
+    virtual_arena arena(reserve_size);
+    arena_memory_resource resource(arena);
+
+    std::pmr::vector<int> values(&resource);
+    for (int i = 0; i < 10000; ++i)
+        values.push_back(i);
+
+    ASSERT_TRUE(arena.owns(values.data()));
+    ASSERT_EQ(9999, values.back());
+}
+
+TEST(arena_memory_resource_test, allocate__throws_bad_alloc__when_arena_is_exhausted)
+{
+    virtual_arena arena(reserve_size);
+    arena_memory_resource resource(arena);
+
+    ASSERT_THROW(static_cast<void>(resource.allocate(reserve_size + 1)), std::bad_alloc);
+}
@@ -0,0 +1,134 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812 26495)
+
+#include <chrono>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/wait_set.h>
+
+using modern_win32::wait_for_result;
+using modern_win32::wait_set;
+using modern_win32::threading::manual_reset_event;
+using std::chrono::milliseconds;
+
+namespace
+{
+    constexpr auto TEST_TIMEOUT = milliseconds(1000);
+    constexpr std::size_t LARGE_SET_SIZE = 100;
+
+    [[nodiscard]]
+    std::vector<manual_reset_event> make_events(std::size_t const count)
+    {
+        std::vector<manual_reset_event> events{};
+        events.reserve(count);
+        for (std::size_t index = 0; index < count; ++index) {
+            events.emplace_back(false);
+        }
+        return events;
+    }
+
+    void add_all(wait_set& set, std::vector<manual_reset_event> const& events)
+    {
+        for (auto const& event : events) {
+            std::ignore = set.add(event);
+        }
+    }
+}
+
+TEST(wait_set_test, wait_any__returns_failed__when_set_is_empty)
+{
+    wait_set set{};
+
+    ASSERT_EQ(wait_for_result::failed, set.wait_any(milliseconds(0)));
+    ASSERT_TRUE(set.signaled().empty());
+}
+
+TEST(wait_set_test, wait_any__reports_signaled_index__when_set_is_small)
+{
+    auto events = make_events(3);
+    wait_set set{};
+    add_all(set, events);
+    std::ignore = events[2].set();
+
+    ASSERT_EQ(wait_for_result::object, set.wait_any(TEST_TIMEOUT));
+    ASSERT_EQ(std::vector<wait_set::index_type>{ 2 }, set.signaled());
+}
+
+TEST(wait_set_test, wait_all__reports_every_index__when_all_small_set_handles_are_signaled)
+{
+    auto events = make_events(3);
+    wait_set set{};
+    add_all(set, events);
+    for (auto& event : events) {
+        std::ignore = event.set();
+    }
+
+    ASSERT_EQ(wait_for_result::object, set.wait_all(TEST_TIMEOUT));
+    ASSERT_EQ((std::vector<wait_set::index_type>{ 0, 1, 2 }), set.signaled());
+}
+
+TEST(wait_set_test, wait_any__reports_signaled_index__when_set_exceeds_maximum_wait_objects)
+{
+    auto events = make_events(LARGE_SET_SIZE);
+    wait_set set{};
+    add_all(set, events);
+    std::ignore = events[77].set();
+
+    ASSERT_EQ(wait_for_result::object, set.wait_any(TEST_TIMEOUT));
+    ASSERT_EQ(std::vector<wait_set::index_type>{ 77 }, set.signaled());
+}
+
+TEST(wait_set_test, wait_all__reports_every_index__when_all_handles_of_large_set_are_signaled)
+{
+    auto events = make_events(LARGE_SET_SIZE);
+    wait_set set{};
+    add_all(set, events);
+    for (auto& event : events) {
+        std::ignore = event.set();
+    }
+
+    ASSERT_EQ(wait_for_result::object, set.wait_all(TEST_TIMEOUT));
+    ASSERT_EQ(LARGE_SET_SIZE, set.signaled().size());
+    ASSERT_EQ(LARGE_SET_SIZE - 1, set.signaled().back());
+}
+
+TEST(wait_set_test, wait_any__returns_timeout__when_no_handle_of_large_set_is_signaled)
+{
+    auto events = make_events(LARGE_SET_SIZE);
+    wait_set set{};
+    add_all(set, events);
+
+    ASSERT_EQ(wait_for_result::timeout, set.wait_any(milliseconds(20)));
+    ASSERT_TRUE(set.signaled().empty());
+}
+
+TEST(wait_set_test, wait_any__reports_new_index__when_reused_after_previous_wait)
+{
+    auto events = make_events(LARGE_SET_SIZE);
+    wait_set set{};
+    add_all(set, events);
+
+    std::ignore = events[5].set();
+    ASSERT_EQ(wait_for_result::object, set.wait_any(TEST_TIMEOUT));
+    std::ignore = events[5].clear();
+    std::ignore = events[90].set();
+
+    ASSERT_EQ(wait_for_result::object, set.wait_any(TEST_TIMEOUT));
+    ASSERT_EQ(std::vector<wait_set::index_type>{ 90 }, set.signaled());
+}
@@ -0,0 +1,154 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <atomic>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <modern_win32/windows_error_category.h>
+#include <modern_win32/windows_exception.h>
+
+using modern_win32::is_access_error;
+using modern_win32::is_permanent_error;
+using modern_win32::is_transient_error;
+using modern_win32::native_windows_error;
+using modern_win32::windows_category;
+using modern_win32::windows_error;
+using modern_win32::windows_error_category;
+using modern_win32::windows_exception;
+
+namespace
+{
+    [[nodiscard]]
+    windows_error_category const& get_category()
+    {
+        return dynamic_cast<windows_error_category const&>(windows_category());
+    }
+}
+
+TEST(windows_error_category_test, windows_category__returns_same_instance__when_called_repeatedly)
+{
+    ASSERT_EQ(&windows_category(), &windows_category());
+}
+
+TEST(windows_error_category_test, message__returns_message_without_line_break__when_error_is_known)
+{
+    auto const message = windows_category().message(ERROR_ACCESS_DENIED);
+
+    ASSERT_FALSE(message.empty());
+    ASSERT_NE('\n', message.back());
+    ASSERT_NE('\r', message.back());
+}
+
+TEST(windows_error_category_test, cached_message__returns_same_string__when_called_repeatedly)
+{
+    auto const& category = get_category();
+
+    auto const& first = category.cached_message(ERROR_FILE_NOT_FOUND);
+    auto const& second = category.cached_message(ERROR_FILE_NOT_FOUND);
+
+    ASSERT_EQ(&first, &second);
+    ASSERT_EQ(first, category.message(ERROR_FILE_NOT_FOUND));
+}
+
+TEST(windows_error_category_test, cached_message__returns_same_string_on_every_thread__when_called_concurrently)
+{
+    auto const& category = get_category();
+    std::atomic<std::string const*> expected{ &category.cached_message(ERROR_PATH_NOT_FOUND) };
+    std::atomic<int> mismatches{};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 1000; ++j) {
+                if (&category.cached_message(ERROR_PATH_NOT_FOUND) != expected.load())
+                    ++mismatches;
+                static_cast<void>(category.cached_message(static_cast<native_windows_error>(ERROR_INVALID_HANDLE)));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(0, mismatches.load());
+}
+
+TEST(windows_error_category_test, default_error_condition__matches_system_category__when_error_is_access_denied)
+{
+    std::error_code const code(ERROR_ACCESS_DENIED, windows_category());
+
+    ASSERT_EQ(std::system_category().default_error_condition(ERROR_ACCESS_DENIED), code.default_error_condition());
+    ASSERT_TRUE(code == std::errc::permission_denied);
+}
+
+TEST(windows_error_category_test, windows_exception__uses_windows_category__when_constructed)
+{
+    windows_exception const exception(static_cast<native_windows_error>(ERROR_ACCESS_DENIED), "open_process");
+
+    ASSERT_EQ(&windows_category(), &exception.code().category());
+    ASSERT_EQ(ERROR_ACCESS_DENIED, exception.code().value());
+    ASSERT_NE(std::string::npos, std::string(exception.what()).find(get_category().cached_message(ERROR_ACCESS_DENIED)));
+}
+
+TEST(windows_error_category_test, is_transient_error__returns_true__when_error_may_clear)
+{
+    ASSERT_TRUE(is_transient_error(windows_error::error_sharing_violation));
+    ASSERT_TRUE(is_transient_error(windows_error::error_pipe_busy));
+    ASSERT_TRUE(is_transient_error(windows_error::error_not_enough_memory));
+}
+
+TEST(windows_error_category_test, is_transient_error__returns_false__when_error_is_permanent)
+{
+    ASSERT_FALSE(is_transient_error(windows_error::none));
+    ASSERT_FALSE(is_transient_error(windows_error::error_file_not_found));
+    ASSERT_FALSE(is_transient_error(windows_error::error_access_denied));
+}
+
+TEST(windows_error_category_test, is_access_error__returns_true__when_error_is_access_denied)
+{
+    ASSERT_TRUE(is_access_error(windows_error::error_access_denied));
+    ASSERT_TRUE(is_access_error(windows_error::error_privilege_not_held));
+    ASSERT_FALSE(is_access_error(windows_error::error_file_not_found));
+}
+
+TEST(windows_error_category_test, is_permanent_error__returns_expected__for_each_kind_of_error)
+{
+    ASSERT_TRUE(is_permanent_error(windows_error::error_file_not_found));
+    ASSERT_TRUE(is_permanent_error(windows_error::error_access_denied));
+    ASSERT_TRUE(is_permanent_error(windows_error::unknown));
+    ASSERT_FALSE(is_permanent_error(windows_error::error_sharing_violation));
+    ASSERT_FALSE(is_permanent_error(windows_error::none));
+}
+
+TEST(windows_error_category_test, classification__uses_error_value__when_error_code_is_from_windows_or_system_category)
+{
+    ASSERT_TRUE(is_transient_error(std::error_code(ERROR_SHARING_VIOLATION, windows_category())));
+    ASSERT_TRUE(is_access_error(std::error_code(ERROR_ACCESS_DENIED, std::system_category())));
+    ASSERT_TRUE(is_permanent_error(windows_exception(static_cast<native_windows_error>(ERROR_FILE_NOT_FOUND)).code()));
+}
+
+TEST(windows_error_category_test, classification__returns_false__when_error_code_is_from_another_category)
+{
+    std::error_code const code(ERROR_SHARING_VIOLATION, std::generic_category());
+
+    ASSERT_FALSE(is_transient_error(code));
+    ASSERT_FALSE(is_access_error(code));
+    ASSERT_FALSE(is_permanent_error(code));
+}
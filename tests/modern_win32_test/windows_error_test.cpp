@@ -0,0 +1,67 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <modern_win32/windows_error.h>
+
+using modern_win32::native_windows_error;
+using modern_win32::windows_error;
+using modern_win32::windows_error_details;
+
+TEST(windows_error_test, get__returns_none__when_error_code_is_no_error)
+{
+    windows_error_details const details(static_cast<native_windows_error>(NO_ERROR));
+
+    ASSERT_EQ(windows_error::none, details.get());
+}
+
+TEST(windows_error_test, get__returns_matching_error__when_error_code_is_named)
+{
+    ASSERT_EQ(windows_error::error_file_not_found, windows_error_details(static_cast<native_windows_error>(ERROR_FILE_NOT_FOUND)).get());
+    ASSERT_EQ(windows_error::error_access_denied, windows_error_details(static_cast<native_windows_error>(ERROR_ACCESS_DENIED)).get());
+    ASSERT_EQ(windows_error::error_io_pending, windows_error_details(static_cast<native_windows_error>(ERROR_IO_PENDING)).get());
+}
+
+TEST(windows_error_test, get__returns_matching_error__when_error_code_is_highest_named)
+{
+    windows_error_details const details(windows_error::error_ts_video_subsystem_error);
+
+    ASSERT_EQ(windows_error::error_ts_video_subsystem_error, details.get());
+}
+
+TEST(windows_error_test, get__returns_unknown__when_error_code_is_beyond_named_range)
+{
+    // bit 29 marks application defined error codes, which are never named
+    windows_error_details const details(static_cast<native_windows_error>(0x20000001UL));
+
+    ASSERT_EQ(windows_error::unknown, details.get());
+}
+
+TEST(windows_error_test, get__returns_unknown__when_error_code_is_unknown)
+{
+    windows_error_details const details(windows_error::unknown);
+
+    ASSERT_EQ(windows_error::unknown, details.get());
+}
+
+TEST(windows_error_test, conversion__returns_get__when_converted_to_windows_error)
+{
+    windows_error const error = windows_error_details(static_cast<native_windows_error>(ERROR_INVALID_HANDLE));
+
+    ASSERT_EQ(windows_error::error_invalid_handle, error);
+}
@@ -0,0 +1,102 @@
+//
+// Copyright © 2021 Terry Moreland
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// 
+
+#pragma warning(disable : 26812)
+#pragma warning(disable : 26495)
+#include <gtest/gtest.h>
+#pragma warning(default : 26812)
+#pragma warning(default : 26495)
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <modern_win32/threading/event.h>
+#include <modern_win32/wait_for.h>
+#include <modern_win32/windows_result.h>
+
+using modern_win32::threading::manual_reset_event;
+using modern_win32::try_wait_one;
+using modern_win32::windows_error;
+using modern_win32::windows_error_details;
+using modern_win32::windows_exception;
+using modern_win32::windows_result;
+
+TEST(windows_result_test, has_value__returns_true__when_constructed_from_value)
+{
+    windows_result<int> const result{ 3 };
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(static_cast<bool>(result));
+    ASSERT_EQ(3, result.value());
+    ASSERT_EQ(3, *result);
+}
+
+TEST(windows_result_test, error__returns_none__when_result_holds_value)
+{
+    windows_result<int> const result{ 3 };
+
+    ASSERT_EQ(windows_error::none, result.error().get());
+}
+
+TEST(windows_result_test, has_value__returns_false__when_constructed_from_error)
+{
+    windows_result<int> const result{ windows_error_details(windows_error::error_access_denied) };
+
+    ASSERT_FALSE(result.has_value());
+    ASSERT_EQ(windows_error::error_access_denied, result.error().get());
+}
+
+TEST(windows_result_test, value__throws_windows_exception__when_result_holds_error)
+{
+    windows_result<int> const result{ windows_error_details(windows_error::error_access_denied) };
+
+    ASSERT_THROW(static_cast<void>(result.value()), windows_exception);
+}
+
+TEST(windows_result_test, value_or__returns_fallback__when_result_holds_error)
+{
+    windows_result<std::string> const result{ windows_error_details(windows_error::error_file_not_found) };
+
+    ASSERT_EQ(std::string("fallback"), result.value_or("fallback"));
+}
+
+TEST(windows_result_test, value__moves_value_out__when_result_is_rvalue)
+{
+    windows_result<std::unique_ptr<int>> result{ std::make_unique<int>(5) };
+
+    auto const value = std::move(result).value();
+
+    ASSERT_NE(nullptr, value);
+    ASSERT_EQ(5, *value);
+}
+
+TEST(windows_result_test, try_wait_one__returns_false__when_wait_times_out)
+{
+    manual_reset_event const event{ false };
+
+    auto const result = try_wait_one(event, std::chrono::milliseconds(10));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_FALSE(*result);
+}
+
+TEST(windows_result_test, try_wait_one__returns_true__when_handle_is_signaled)
+{
+    manual_reset_event event{ false };
+    static_cast<void>(event.set());
+
+    auto const result = try_wait_one(event, std::chrono::milliseconds(10));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(*result);
+}